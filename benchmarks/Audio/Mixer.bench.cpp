@@ -0,0 +1,69 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Audio/Mixer.hpp>
+#include <BLIB/Audio/NullOutput.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+namespace bench
+{
+namespace
+{
+constexpr unsigned int VoiceCount = 128;
+constexpr std::size_t FrameCount  = Mixer::DefaultSampleRate;
+constexpr unsigned int Iterations = 20;
+
+std::vector<std::int16_t> makeTone(unsigned int channels) {
+    std::vector<std::int16_t> samples(Mixer::DefaultSampleRate * channels);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<std::int16_t>(std::sin(static_cast<float>(i) * 0.05f) * 3000.f);
+    }
+    return samples;
+}
+
+// one second of output with every voice looping, half of them positional around the listener
+double mixSecond(bl::bench::Runner& runner, const std::string& label, const SoundData& sound,
+                 unsigned int polyphony) {
+    Mixer mixer(Mixer::DefaultSampleRate, VoiceCount, polyphony);
+    NullOutput output;
+    output.start(mixer);
+    {
+        auto voices = mixer.voices();
+        voices->setDefaultVoiceLimit(0);
+        for (unsigned int i = 0; i < VoiceCount; ++i) {
+            VoiceSettings settings;
+            settings.loop     = true;
+            settings.priority = static_cast<int>(i % 4);
+            if (i % 2 == 0) {
+                settings.position = glm::vec3(static_cast<float>(i % 16) - 8.f, 0.f, 0.f);
+            }
+            voices->play(sound, i, settings);
+        }
+    }
+
+    return runner.measure(label, Iterations, [&output]() { output.render(FrameCount); });
+}
+} // namespace
+
+BL_BENCHMARK(Audio, MixOneSecond) {
+    const std::vector<std::int16_t> mono   = makeTone(1);
+    const std::vector<std::int16_t> stereo = makeTone(2);
+    const SoundData monoSound{mono.data(), mono.size(), 1, Mixer::DefaultSampleRate};
+    const SoundData stereoSound{stereo.data(), stereo.size() / 2, 2, Mixer::DefaultSampleRate};
+    const SoundData resampled{mono.data(), mono.size(), 1, Mixer::DefaultSampleRate / 2};
+    const std::string voices = std::to_string(VoiceCount) + " voices";
+
+    mixSecond(runner, voices + " mono, all audible", monoSound, VoiceCount);
+    mixSecond(runner, voices + " mono, polyphony 32", monoSound, 32);
+    mixSecond(runner, voices + " stereo, polyphony 32", stereoSound, 32);
+    mixSecond(runner, voices + " resampled, polyphony 32", resampled, 32);
+}
+
+} // namespace bench
+} // namespace audio
+} // namespace bl
@@ -0,0 +1,88 @@
+#ifndef BLIB_BENCHMARKS_BENCHMARK_HPP
+#define BLIB_BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bl
+{
+namespace bench
+{
+/**
+ * @brief Passed to each benchmark to time sections of code and report results
+ */
+class Runner {
+public:
+    /**
+     * @brief Runs the given callback once to warm up, then times the given number of iterations
+     *        and reports the average time per iteration
+     *
+     * @param label The name of the measurement
+     * @param iterations The number of iterations to time
+     * @param cb The code to time
+     * @return The average time per iteration in milliseconds
+     */
+    template<typename TCallback>
+    double measure(std::string_view label, unsigned int iterations, TCallback&& cb) {
+        cb();
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i) { cb(); }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ms = std::chrono::duration<double, std::milli>(end - start).count() /
+                          static_cast<double>(iterations);
+        report(label, ms, "ms");
+        return ms;
+    }
+
+    /**
+     * @brief Reports an arbitrary value for the current benchmark
+     *
+     * @param label The name of the value
+     * @param value The value to report
+     * @param unit The unit of the value
+     */
+    void report(std::string_view label, double value, std::string_view unit) {
+        std::cout << "    " << label << ": " << value << " " << unit << std::endl;
+    }
+};
+
+/**
+ * @brief Global registry of benchmarks. Populated by BL_BENCHMARK
+ */
+struct Registry {
+    using Benchmark = std::function<void(Runner&)>;
+
+    struct Entry {
+        std::string name;
+        Benchmark benchmark;
+    };
+
+    static std::vector<Entry>& get() {
+        static std::vector<Entry> benchmarks;
+        return benchmarks;
+    }
+
+    static bool add(std::string name, Benchmark&& benchmark) {
+        get().emplace_back(Entry{std::move(name), std::move(benchmark)});
+        return true;
+    }
+};
+
+} // namespace bench
+} // namespace bl
+
+/**
+ * @brief Defines and registers a benchmark. The body has access to a Runner named runner
+ */
+#define BL_BENCHMARK(Suite, Name)                                                        \
+    void Suite##_##Name##_Benchmark(::bl::bench::Runner& runner);                        \
+    static const bool Suite##_##Name##_Registered =                                      \
+        ::bl::bench::Registry::add(#Suite "." #Name, &Suite##_##Name##_Benchmark);       \
+    void Suite##_##Name##_Benchmark(::bl::bench::Runner& runner)
+
+#endif
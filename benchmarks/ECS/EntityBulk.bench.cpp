@@ -0,0 +1,55 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/ECS.hpp>
+
+namespace bl
+{
+namespace ecs
+{
+namespace bench
+{
+namespace
+{
+constexpr std::size_t EntityCount = 50000;
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Velocity {
+    float x;
+    float y;
+};
+} // namespace
+
+BL_BENCHMARK(ECS, EntityBulk50K) {
+    Registry registry;
+    registry.getOrCreateView<Require<Position, Velocity>>();
+    std::vector<Entity> entities;
+    entities.reserve(EntityCount);
+
+    runner.measure("per entity create + destroy", 10, [&registry, &entities]() {
+        for (std::size_t i = 0; i < EntityCount; ++i) {
+            const Entity ent = registry.createEntity(0);
+            registry.addComponent<Position>(ent, {0.f, 0.f});
+            registry.addComponent<Velocity>(ent, {1.f, 1.f});
+            entities.emplace_back(ent);
+        }
+        for (const Entity ent : entities) { registry.destroyEntity(ent); }
+        registry.flushDeletions();
+        entities.clear();
+    });
+
+    runner.measure("bulk create + destroy", 10, [&registry, &entities]() {
+        registry.createEntities(
+            0, Flags::None, EntityCount, entities, Position{0.f, 0.f}, Velocity{1.f, 1.f});
+        registry.destroyEntities(entities);
+        registry.flushDeletions();
+        entities.clear();
+    });
+}
+
+} // namespace bench
+} // namespace ecs
+} // namespace bl
@@ -0,0 +1,224 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace bl
+{
+namespace gfx
+{
+namespace bench
+{
+namespace
+{
+constexpr unsigned int TextCount     = 200;
+constexpr unsigned int FrameCount    = 100;
+constexpr unsigned int FontSize      = 18;
+constexpr std::uint32_t AsciiFirst   = 32;
+constexpr std::uint32_t AsciiCount   = 95;
+constexpr std::uint32_t QuadVertices = 6;
+
+struct Vertex {
+    float data[9];
+};
+
+struct Glyph {
+    float advance;
+    float left;
+    float top;
+    float width;
+    float height;
+    int lsbDelta;
+    int rsbDelta;
+};
+
+Glyph makeGlyph(std::uint32_t code, unsigned int size) {
+    const float s = static_cast<float>(size);
+    return Glyph{s * 0.5f + static_cast<float>(code % 7),
+                 1.f,
+                 -s * 0.7f,
+                 s * 0.4f,
+                 s * 0.7f,
+                 static_cast<int>(code % 5) * 8,
+                 static_cast<int>(code % 3) * 8};
+}
+
+// mirrors FontPayload::getGlyph: every lookup goes through the ordered glyph table
+struct GlyphTable {
+    std::map<std::uint64_t, Glyph> glyphs;
+
+    const Glyph& getGlyph(std::uint32_t code, unsigned int size) {
+        const std::uint64_t key = (static_cast<std::uint64_t>(size) << 32) | code;
+        auto it                 = glyphs.find(key);
+        if (it == glyphs.end()) { it = glyphs.emplace(key, makeGlyph(code, size)).first; }
+        return it->second;
+    }
+
+    float getKerning(std::uint32_t first, std::uint32_t second, unsigned int size) {
+        if (first == 0 || second == 0) { return 0.f; }
+        const float lsb = static_cast<float>(getGlyph(second, size).lsbDelta);
+        const float rsb = static_cast<float>(getGlyph(first, size).rsbDelta);
+        return std::floor((lsb - rsb + 32.f) / 64.f);
+    }
+};
+
+// mirrors FontPayload::AsciiTable: preloaded glyph pointers and lazily cached kerning
+struct AsciiTable {
+    GlyphTable& font;
+    std::array<const Glyph*, AsciiCount> glyphs;
+    std::vector<float> kerning;
+
+    AsciiTable(GlyphTable& font)
+    : font(font)
+    , kerning(AsciiCount * AsciiCount, std::numeric_limits<float>::quiet_NaN()) {
+        for (std::uint32_t i = 0; i < AsciiCount; ++i) {
+            glyphs[i] = &font.getGlyph(AsciiFirst + i, FontSize);
+        }
+    }
+
+    const Glyph& getGlyph(std::uint32_t code, unsigned int size) {
+        if (code >= AsciiFirst && code < AsciiFirst + AsciiCount) {
+            return *glyphs[code - AsciiFirst];
+        }
+        return font.getGlyph(code, size);
+    }
+
+    float getKerning(std::uint32_t first, std::uint32_t second, unsigned int size) {
+        if (first < AsciiFirst || second < AsciiFirst || first >= AsciiFirst + AsciiCount ||
+            second >= AsciiFirst + AsciiCount) {
+            return font.getKerning(first, second, size);
+        }
+        float& k = kerning[(first - AsciiFirst) * AsciiCount + (second - AsciiFirst)];
+        if (std::isnan(k)) { k = font.getKerning(first, second, size); }
+        return k;
+    }
+};
+
+// lays out a section starting at x and returns the number of vertices. Writes if vertices is set
+template<typename TGlyphs>
+std::uint32_t layout(TGlyphs& glyphs, const std::string& content, float& x, Vertex* vertices) {
+    std::uint32_t vi       = 0;
+    std::uint32_t prevChar = 0;
+    for (const char c : content) {
+        const std::uint32_t code = static_cast<std::uint8_t>(c);
+        x += glyphs.getKerning(prevChar, code, FontSize);
+        prevChar = code;
+
+        const Glyph& glyph = glyphs.getGlyph(code, FontSize);
+        if (code != ' ') {
+            if (vertices) {
+                for (std::uint32_t i = 0; i < QuadVertices; ++i) {
+                    Vertex& v = vertices[vi + i];
+                    v.data[0] = x + glyph.left + (i % 2) * glyph.width;
+                    v.data[1] = glyph.top + (i / 3) * glyph.height;
+                }
+            }
+            vi += QuadVertices;
+        }
+        x += glyph.advance;
+    }
+    return vi;
+}
+
+struct Section {
+    std::string content;
+    std::vector<Vertex> cached;
+    float cachedX = -1.f;
+    float endX    = 0.f;
+    bool dirty    = true;
+};
+
+struct HudText {
+    std::vector<Section> sections;
+    std::vector<Vertex> vertices;
+
+    HudText() {
+        sections.resize(3);
+        sections[0].content = "Time remaining: ";
+        sections[2].content = " (bonus round active)";
+    }
+
+    void setTime(unsigned int frame, unsigned int i) {
+        const unsigned int ms  = (frame * 16 + i * 7) % 100000;
+        const std::string time = std::to_string(ms / 60000) + ":" +
+                                 std::to_string(ms / 1000 % 60) + "." + std::to_string(ms % 1000);
+        if (time != sections[1].content) {
+            sections[1].content = time;
+            sections[1].dirty   = true;
+        }
+    }
+};
+
+// previous behavior: every commit counts and then writes every section through the glyph table
+void commitFull(GlyphTable& font, HudText& text) {
+    std::uint32_t count = 0;
+    float x             = 0.f;
+    for (Section& s : text.sections) { count += layout(font, s.content, x, nullptr); }
+    if (text.vertices.size() < count) { text.vertices.resize(count * 2); }
+
+    std::uint32_t vi = 0;
+    x                = 0.f;
+    for (Section& s : text.sections) { vi += layout(font, s.content, x, &text.vertices[vi]); }
+}
+
+// cached behavior: only changed or moved sections are laid out, using the ascii table
+void commitCached(AsciiTable& font, HudText& text) {
+    std::size_t count = 0;
+    float x           = 0.f;
+    for (Section& s : text.sections) {
+        if (s.dirty || s.cachedX != x) {
+            s.cachedX = x;
+            s.cached.resize(s.content.size() * QuadVertices);
+            s.cached.resize(layout(font, s.content, x, s.cached.data()));
+            s.endX  = x;
+            s.dirty = false;
+        }
+        x = s.endX;
+        count += s.cached.size();
+    }
+    if (text.vertices.size() < count) { text.vertices.resize(count * 2); }
+
+    Vertex* dst = text.vertices.data();
+    for (const Section& s : text.sections) {
+        dst = std::copy(s.cached.begin(), s.cached.end(), dst);
+    }
+}
+
+} // namespace
+
+BL_BENCHMARK(Graphics, TextUpdatesPerFrame) {
+    const std::string label = std::to_string(TextCount) + " timer texts updated per frame";
+
+    GlyphTable fullFont;
+    std::vector<HudText> fullTexts(TextCount);
+    unsigned int frame = 0;
+    runner.measure(label + " full relayout", FrameCount, [&]() {
+        ++frame;
+        for (unsigned int i = 0; i < TextCount; ++i) {
+            fullTexts[i].setTime(frame, i);
+            commitFull(fullFont, fullTexts[i]);
+        }
+    });
+
+    GlyphTable cachedFont;
+    AsciiTable asciiTable(cachedFont);
+    std::vector<HudText> cachedTexts(TextCount);
+    frame = 0;
+    runner.measure(label + " cached layout", FrameCount, [&]() {
+        ++frame;
+        for (unsigned int i = 0; i < TextCount; ++i) {
+            cachedTexts[i].setTime(frame, i);
+            commitCached(asciiTable, cachedTexts[i]);
+        }
+    });
+}
+
+} // namespace bench
+} // namespace gfx
+} // namespace bl
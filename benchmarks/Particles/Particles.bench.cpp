@@ -0,0 +1,95 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Particles/Compaction.hpp>
+#include <BLIB/Particles/Kernels.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <BLIB/Util/ThreadPool.hpp>
+#include <future>
+
+namespace bl
+{
+namespace pcl
+{
+namespace bench
+{
+namespace
+{
+constexpr std::size_t ParticleCount = 1000000;
+
+struct Particle {
+    glm::vec2 pos;
+    glm::vec2 vel;
+    glm::vec4 color;
+    float age;
+    float lifetime;
+};
+
+std::vector<Particle> makeParticles() {
+    std::vector<Particle> particles(ParticleCount);
+    for (Particle& p : particles) {
+        p.pos      = {util::Random::get<float>(0.f, 1000.f), util::Random::get<float>(0.f, 1000.f)};
+        p.vel      = {util::Random::get<float>(-10.f, 10.f), util::Random::get<float>(-10.f, 10.f)};
+        p.color    = glm::vec4(1.f);
+        p.age      = 0.f;
+        p.lifetime = util::Random::get<float>(1.f, 5.f);
+    }
+    return particles;
+}
+
+void runAffectors(std::span<Particle> particles) {
+    kernel::accelerate<&Particle::vel>(particles, glm::vec2(0.f, 9.8f), 0.016f);
+    kernel::integrateVelocity<&Particle::pos, &Particle::vel>(particles, 0.016f);
+    kernel::colorOverLifetime<&Particle::color, &Particle::age, &Particle::lifetime>(
+        particles, glm::vec4(1.f), glm::vec4(0.f), 0.016f);
+}
+} // namespace
+
+BL_BENCHMARK(Particles, AffectorKernels1M) {
+    std::vector<Particle> particles = makeParticles();
+
+    runner.measure("single thread", 20, [&particles]() { runAffectors(particles); });
+
+    util::ThreadPool pool;
+    pool.start();
+    std::vector<std::future<void>> futures;
+    runner.measure("thread pool", 20, [&particles, &pool, &futures]() {
+        const std::size_t chunkSize = priv::computeChunkSize(particles.size(), pool.workerCount());
+        for (std::size_t i = 0; i < particles.size(); i += chunkSize) {
+            const std::size_t len = std::min(particles.size() - i, chunkSize);
+            futures.emplace_back(pool.queueTask(
+                [&particles, i, len]() { runAffectors(std::span(&particles[i], len)); }));
+        }
+        for (auto& f : futures) { f.wait(); }
+        futures.clear();
+    });
+    pool.shutdown();
+}
+
+BL_BENCHMARK(Particles, BoundsKill1M) {
+    std::vector<Particle> particles = makeParticles();
+    std::vector<const Particle*> dead(particles.size());
+    std::size_t count = 0;
+
+    runner.measure("find out of bounds", 20, [&particles, &dead, &count]() {
+        count = kernel::findOutOfBounds<&Particle::pos>(
+            std::span(particles), glm::vec2(100.f), glm::vec2(900.f), dead.data());
+    });
+    runner.report("killed", static_cast<double>(count), "particles");
+}
+
+BL_BENCHMARK(Particles, Compaction1M) {
+    const std::vector<Particle> source = makeParticles();
+    std::vector<std::size_t> freeList;
+    for (std::size_t i = 0; i < source.size(); i += 10) { freeList.emplace_back(i); }
+
+    std::vector<Particle> particles;
+    runner.measure("stable compaction (10% dead)", 10, [&particles, &source, &freeList]() {
+        particles = source;
+        priv::eraseSortedIndices<Particle>(particles, freeList);
+    });
+    runner.measure("copy only baseline", 10, [&particles, &source]() { particles = source; });
+}
+
+} // namespace bench
+} // namespace pcl
+} // namespace bl
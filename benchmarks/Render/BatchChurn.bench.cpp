@@ -0,0 +1,163 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Util/OffsetAllocator.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <algorithm>
+#include <list>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+struct Vertex {
+    float data[9];
+};
+
+constexpr std::uint32_t QuadVertices = 4;
+constexpr std::uint32_t QuadIndices  = 6;
+
+struct Quad {
+    std::uint32_t vertexStart;
+    std::uint32_t indexStart;
+    util::OffsetAllocator::Allocation vertexAlloc;
+    util::OffsetAllocator::Allocation indexAlloc;
+};
+
+void writeQuad(std::vector<std::uint32_t>& indices, const Quad& q) {
+    const std::uint32_t pattern[] = {0, 1, 2, 0, 2, 3};
+    for (std::uint32_t i = 0; i < QuadIndices; ++i) {
+        indices[q.indexStart + i] = q.vertexStart + pattern[i];
+    }
+}
+
+// mirrors the previous BatchIndexBuffer behavior: shift everything left and rebase
+struct ShiftBatch {
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    std::list<Quad> quads;
+    std::uint32_t usedVertices = 0;
+    std::uint32_t usedIndices  = 0;
+    std::size_t uploaded       = 0;
+
+    std::list<Quad>::iterator add() {
+        if (usedVertices + QuadVertices > vertices.size()) {
+            vertices.resize(std::max<std::size_t>(vertices.size() * 2, 64));
+        }
+        if (usedIndices + QuadIndices > indices.size()) {
+            indices.resize(std::max<std::size_t>(indices.size() * 2, 96));
+        }
+        Quad q{usedVertices, usedIndices, {}, {}};
+        usedVertices += QuadVertices;
+        usedIndices += QuadIndices;
+        writeQuad(indices, q);
+        return quads.emplace(quads.end(), q);
+    }
+
+    void remove(std::list<Quad>::iterator it) {
+        const Quad q = *it;
+        quads.erase(it);
+        std::copy(vertices.begin() + q.vertexStart + QuadVertices,
+                  vertices.end(),
+                  vertices.begin() + q.vertexStart);
+        std::copy(indices.begin() + q.indexStart + QuadIndices,
+                  indices.end(),
+                  indices.begin() + q.indexStart);
+        for (Quad& o : quads) {
+            if (o.vertexStart > q.vertexStart) { o.vertexStart -= QuadVertices; }
+            if (o.indexStart > q.indexStart) { o.indexStart -= QuadIndices; }
+        }
+        for (auto& i : indices) {
+            if (i >= q.vertexStart) { i -= QuadVertices; }
+        }
+        usedVertices -= QuadVertices;
+        usedIndices -= QuadIndices;
+    }
+
+    // any change uploads the whole used range once per frame
+    void endFrame() {
+        uploaded += usedVertices * sizeof(Vertex) + usedIndices * sizeof(std::uint32_t);
+    }
+};
+
+// current behavior: constant time suballocation with degenerate holes
+struct FreeListBatch {
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    util::OffsetAllocator vertexAllocator;
+    util::OffsetAllocator indexAllocator;
+    std::list<Quad> quads;
+    std::size_t uploaded = 0;
+
+    std::list<Quad>::iterator add() {
+        Quad q{0, 0, vertexAllocator.allocate(QuadVertices), indexAllocator.allocate(QuadIndices)};
+        if (!q.vertexAlloc.isValid() || !q.indexAlloc.isValid()) {
+            const std::uint32_t vc = std::max<std::uint32_t>(vertices.size() * 2, 64);
+            const std::uint32_t ic = std::max<std::uint32_t>(indices.size() * 2, 96);
+            vertices.resize(vc);
+            indices.resize(ic, 0);
+            vertexAllocator.grow(vc);
+            indexAllocator.grow(ic);
+            if (!q.vertexAlloc.isValid()) { q.vertexAlloc = vertexAllocator.allocate(QuadVertices); }
+            if (!q.indexAlloc.isValid()) { q.indexAlloc = indexAllocator.allocate(QuadIndices); }
+            uploaded += vc * sizeof(Vertex) + ic * sizeof(std::uint32_t);
+        }
+        q.vertexStart = q.vertexAlloc.offset;
+        q.indexStart  = q.indexAlloc.offset;
+        writeQuad(indices, q);
+        uploaded += QuadVertices * sizeof(Vertex) + QuadIndices * sizeof(std::uint32_t);
+        return quads.emplace(quads.end(), q);
+    }
+
+    void remove(std::list<Quad>::iterator it) {
+        const Quad q = *it;
+        quads.erase(it);
+        vertexAllocator.release(q.vertexAlloc);
+        indexAllocator.release(q.indexAlloc);
+        std::fill(indices.begin() + q.indexStart, indices.begin() + q.indexStart + QuadIndices, 0);
+        uploaded += QuadIndices * sizeof(std::uint32_t);
+    }
+
+    void endFrame() {}
+};
+
+template<typename TBatch>
+void churn(::bl::bench::Runner& runner, const std::string& label, std::uint32_t count,
+           std::uint32_t perFrame) {
+    TBatch batch;
+    std::vector<std::list<Quad>::iterator> live;
+    live.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) { live.emplace_back(batch.add()); }
+    batch.uploaded = 0;
+
+    // measure() runs one extra warmup frame
+    constexpr unsigned int Frames = 10;
+    runner.measure(label, Frames, [&]() {
+        for (std::uint32_t i = 0; i < perFrame; ++i) {
+            const std::size_t k = util::Random::get<std::size_t>(0, live.size() - 1);
+            batch.remove(live[k]);
+            live[k] = batch.add();
+        }
+        batch.endFrame();
+    });
+    runner.report("  uploaded per frame",
+                  static_cast<double>(batch.uploaded) / (Frames + 1) / (1024.0 * 1024.0),
+                  "MiB");
+}
+} // namespace
+
+BL_BENCHMARK(Render, BatchSpawnDespawnChurn) {
+    for (const std::uint32_t count : {1000, 25000}) {
+        const std::string label = std::to_string(count) + " quads, 100 respawns/frame";
+        churn<ShiftBatch>(runner, label + " shift", count, 100);
+        churn<FreeListBatch>(runner, label + " free list", count, 100);
+    }
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,55 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Render/Buffers/DirtySet.hpp>
+#include <BLIB/Util/Random.hpp>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+constexpr std::uint32_t ElementCount = 100000;
+constexpr std::uint32_t ElementSize  = 64;
+
+std::vector<std::uint32_t> makeUpdates(std::uint32_t count) {
+    std::vector<std::uint32_t> updates(count);
+    for (std::uint32_t& i : updates) { i = util::Random::get<std::uint32_t>(0, ElementCount - 1); }
+    return updates;
+}
+} // namespace
+
+BL_BENCHMARK(Render, DirtySetSparseUpload) {
+    for (const std::uint32_t count : {10, 100, 1000, 10000}) {
+        const std::vector<std::uint32_t> updates = makeUpdates(count);
+        const std::string label = std::to_string(count) + " of " + std::to_string(ElementCount);
+
+        buf::DirtyRange range;
+        for (const std::uint32_t i : updates) { range.markDirty(i); }
+        runner.report(label + " single range", range.size * ElementSize / 1024.0, "KiB");
+
+        for (const std::uint32_t gap : {0, 4, 32}) {
+            buf::DirtySet set(gap);
+            std::uint32_t regions = 0;
+            std::uint32_t bytes   = 0;
+            runner.measure(label + " gap " + std::to_string(gap), 100, [&]() {
+                set.reset();
+                for (const std::uint32_t i : updates) { set.markDirty(i); }
+                regions = 0;
+                bytes   = 0;
+                set.forEachRange([&regions, &bytes](const buf::DirtyRange& r) {
+                    ++regions;
+                    bytes += r.size * ElementSize;
+                });
+            });
+            runner.report("  uploaded", bytes / 1024.0, "KiB");
+            runner.report("  copy regions", regions, "regions");
+        }
+    }
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,81 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Render/Scenes/DrawSorter.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+constexpr std::uint32_t ObjectCount = 100000;
+constexpr std::uint32_t MovedCount  = 500;
+
+using scene::DrawSorter;
+using scene::DrawSortKey;
+
+std::uint64_t makeKey(std::uint32_t i, float depth) {
+    const DrawSortKey::Fields fields{i % 24, i % 3, i % 5 == 0 ? UpdateSpeed::Dynamic :
+                                                                 UpdateSpeed::Static};
+    return DrawSortKey::opaque(fields, depth, i % 300);
+}
+} // namespace
+
+BL_BENCHMARK(Render, DrawSort) {
+    std::vector<float> depths(ObjectCount);
+    std::vector<DrawSorter::Entry> source(ObjectCount);
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) {
+        depths[i] = util::Random::get<float>(1.f, 500.f);
+        source[i] = {makeKey(i, depths[i]), i};
+    }
+
+    std::vector<DrawSorter::Entry> entries;
+    std::vector<DrawSorter::Entry> scratch;
+    runner.measure("100k std::sort", 10, [&]() {
+        entries = source;
+        std::sort(entries.begin(),
+                  entries.end(),
+                  [](const DrawSorter::Entry& l, const DrawSorter::Entry& r) {
+                      return l.key < r.key;
+                  });
+    });
+    runner.measure("100k radix, serial", 10, [&]() {
+        entries = source;
+        DrawSorter::radixSort(entries, scratch);
+    });
+
+    util::ThreadPool pool;
+    pool.start();
+    runner.measure("100k radix, parallel", 10, [&]() {
+        entries = source;
+        DrawSorter::radixSort(entries, scratch, &pool);
+    });
+
+    // a camera that barely moves: most keys are unchanged and a few objects move
+    DrawSorter sorter;
+    sorter.beginFrame([](std::uint32_t, std::uint64_t&) { return true; });
+    for (const auto& e : source) { sorter.add(e.value, e.key); }
+    sorter.sort(&pool);
+    runner.measure("100k coherent frame, 500 moved", 10, [&]() {
+        for (std::uint32_t i = 0; i < MovedCount; ++i) {
+            const std::uint32_t j = util::Random::get<std::uint32_t>(0, ObjectCount - 1);
+            depths[j]             = util::Random::get<float>(1.f, 500.f);
+        }
+        sorter.beginFrame([&depths](std::uint32_t value, std::uint64_t& key) {
+            key = makeKey(value, depths[value]);
+            return true;
+        });
+        sorter.sort(&pool);
+    });
+
+    pool.shutdown();
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
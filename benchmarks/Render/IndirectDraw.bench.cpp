@@ -0,0 +1,102 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Render/Scenes/IndirectDrawBuilder.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <BLIB/Util/ThreadPool.hpp>
+#include <algorithm>
+#include <future>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+constexpr std::uint32_t ObjectCount = 100000;
+constexpr std::uint32_t ChunkCount  = 8;
+
+struct FakeObject {
+    prim::DrawParameters params;
+    std::uint32_t sceneId;
+    bool visible;
+};
+
+std::vector<FakeObject> makeObjects(float visibleChance) {
+    // a handful of shared batch buffers, as produced by BatchIndexBuffer users
+    std::vector<FakeObject> objects(ObjectCount);
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) {
+        FakeObject& obj         = objects[i];
+        obj.params.type         = prim::DrawParameters::DrawType::IndexBuffer;
+        obj.params.vertexBuffer = reinterpret_cast<VkBuffer>(std::uintptr_t(1 + i / 20000));
+        obj.params.indexBuffer  = reinterpret_cast<VkBuffer>(std::uintptr_t(100 + i / 20000));
+        obj.params.indexOffset  = i * 6;
+        obj.params.vertexOffset = i * 4;
+        obj.params.indexCount   = 6;
+        obj.sceneId             = i;
+        obj.visible             = util::Random::get<float>(0.f, 1.f) < visibleChance;
+    }
+    return objects;
+}
+
+void buildRange(const std::vector<FakeObject>& objects, scene::IndirectDrawBuilder& draws,
+                std::size_t begin, std::size_t end) {
+    draws.clear();
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!objects[i].visible) { continue; }
+        draws.addDraw(objects[i].params, objects[i].sceneId);
+    }
+}
+} // namespace
+
+BL_BENCHMARK(Render, IndirectDrawBuild) {
+    util::ThreadPool pool;
+    pool.start(ChunkCount);
+
+    for (const float visible : {1.f, 0.5f}) {
+        const std::vector<FakeObject> objects = makeObjects(visible);
+        const std::string label = "100k objects, " +
+                                  std::to_string(static_cast<int>(visible * 100.f)) + "% visible";
+
+        scene::IndirectDrawBuilder draws;
+        std::vector<char> mapped;
+        runner.measure(label + " serial", 20, [&]() {
+            buildRange(objects, draws, 0, objects.size());
+            mapped.resize(draws.byteSize());
+            draws.writeCommands(mapped.data());
+        });
+
+        std::vector<scene::IndirectDrawBuilder> chunks(ChunkCount);
+        std::vector<std::future<void>> futures;
+        runner.measure(label + " parallel", 20, [&]() {
+            const std::size_t chunkSize = (objects.size() + ChunkCount - 1) / ChunkCount;
+            futures.clear();
+            for (std::size_t c = 0; c < ChunkCount; ++c) {
+                const std::size_t begin = c * chunkSize;
+                const std::size_t end   = std::min(begin + chunkSize, objects.size());
+                futures.emplace_back(pool.queueTask([&objects, &chunks, c, begin, end]() {
+                    buildRange(objects, chunks[c], begin, end);
+                }));
+            }
+            draws.clear();
+            for (std::size_t c = 0; c < ChunkCount; ++c) {
+                futures[c].get();
+                draws.append(chunks[c]);
+            }
+            mapped.resize(draws.byteSize());
+            draws.writeCommands(mapped.data());
+        });
+
+        runner.report("  draw calls per object", static_cast<double>(draws.commandCount()), "");
+        runner.report("  draw calls indirect", static_cast<double>(draws.getGroups().size()), "");
+        runner.report("  indirect bytes", static_cast<double>(draws.byteSize()) / 1024.0, "KiB");
+    }
+
+    pool.shutdown();
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,53 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Render/Lighting/LightClusters.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+std::vector<glm::vec4> makeLights(std::size_t count) {
+    std::vector<glm::vec4> lights(count);
+    for (glm::vec4& light : lights) {
+        light = {util::Random::get<float>(-100.f, 100.f),
+                 util::Random::get<float>(-5.f, 20.f),
+                 util::Random::get<float>(-200.f, 0.f),
+                 util::Random::get<float>(1.f, 8.f)};
+    }
+    return lights;
+}
+} // namespace
+
+BL_BENCHMARK(Render, LightClusterBuild) {
+    glm::mat4 proj = glm::perspective(glm::radians(75.f), 16.f / 9.f, 0.1f, 200.f);
+    proj[1][1] *= -1.f;
+    const glm::mat4 view =
+        glm::lookAt(glm::vec3(0.f, 5.f, 10.f), glm::vec3(0.f, 0.f, -50.f), {0.f, 1.f, 0.f});
+
+    for (const std::size_t count : {128, 1024, 4096, 16384}) {
+        const std::vector<glm::vec4> points = makeLights(count);
+        const std::vector<glm::vec4> spots  = makeLights(count / 4);
+
+        lgt::LightClusters clusters;
+        clusters.setProjection(proj, 0.1f, 200.f);
+        const std::string label = std::to_string(count) + " point lights";
+        runner.measure(label, 20, [&]() { clusters.build(view, points, spots); });
+
+        std::uint32_t maxPerCluster = 0;
+        for (const auto& cluster : clusters.getClusters()) {
+            maxPerCluster = std::max(maxPerCluster, cluster.pointCount + cluster.spotCount);
+        }
+        runner.report("  index list size", clusters.getLightIndices().size(), "indices");
+        runner.report("  max lights per cluster", maxPerCluster, "lights");
+    }
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,125 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Render/Scenes/SceneObjectStorage.hpp>
+#include <BLIB/Util/IdAllocatorUnbounded.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace bench
+{
+namespace
+{
+constexpr std::uint32_t ObjectCount = 50000;
+constexpr std::uint32_t ChurnCount  = 2000;
+
+// mirrors the previous storage: contiguous objects, rebase on growth, linear batch removal
+struct ContiguousScene {
+    std::vector<scene::SceneObject> objects;
+    util::IdAllocatorUnbounded<std::uint32_t> ids;
+    std::vector<scene::SceneObject*> batch;
+
+    ContiguousScene() { objects.reserve(cfg::Constants::DefaultSceneObjectCapacity); }
+
+    scene::SceneObject* add(ecs::Entity entity) {
+        scene::SceneObject* base = objects.data();
+        const std::uint32_t id   = ids.allocate();
+        if (id >= objects.size()) { objects.resize(id + 1); }
+        if (objects.data() != base) {
+            for (scene::SceneObject*& so : batch) { so = objects.data() + (so - base); }
+        }
+
+        scene::SceneObject* obj = &objects[id];
+        obj->sceneKey           = {UpdateSpeed::Dynamic, id};
+        obj->entity             = entity;
+        batch.emplace_back(obj);
+        return obj;
+    }
+
+    void remove(scene::SceneObject* obj) {
+        batch.erase(std::find(batch.begin(), batch.end(), obj));
+        ids.release(obj->sceneKey.sceneId);
+    }
+
+    scene::SceneObject* get(std::uint32_t id) { return &objects[id]; }
+};
+
+struct PagedScene {
+    scene::SceneObjectStorage<scene::SceneObject> objects;
+    std::vector<scene::SceneObject*> batch;
+
+    scene::SceneObject* add(ecs::Entity entity) {
+        scene::SceneObject* obj = objects.allocate(UpdateSpeed::Dynamic, entity).newObject;
+        obj->batchIndex         = batch.size();
+        batch.emplace_back(obj);
+        return obj;
+    }
+
+    void remove(scene::SceneObject* obj) {
+        batch[obj->batchIndex]             = batch.back();
+        batch[obj->batchIndex]->batchIndex = obj->batchIndex;
+        batch.pop_back();
+        objects.release(obj->sceneKey);
+    }
+
+    scene::SceneObject* get(std::uint32_t id) {
+        return &objects.getObject({UpdateSpeed::Dynamic, id});
+    }
+};
+
+template<typename TScene>
+void spawnDespawn(const std::vector<std::uint32_t>& order) {
+    TScene scene;
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) { scene.add(i); }
+    for (const std::uint32_t id : order) { scene.remove(scene.get(id)); }
+}
+
+template<typename TScene>
+void churn(TScene& scene, std::vector<scene::SceneObject*>& live) {
+    for (std::uint32_t i = 0; i < ChurnCount; ++i) {
+        const std::size_t j = util::Random::get<std::size_t>(0, live.size() - 1);
+        scene.remove(live[j]);
+        live[j] = live.back();
+        live.pop_back();
+    }
+    for (std::uint32_t i = 0; i < ChurnCount; ++i) { live.emplace_back(scene.add(i)); }
+}
+} // namespace
+
+BL_BENCHMARK(Render, SceneChurn) {
+    std::vector<std::uint32_t> order(ObjectCount);
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) { order[i] = i; }
+    util::Random::shuffle(order.begin(), order.end());
+
+    runner.measure("50k spawn + random despawn, contiguous", 3, [&order]() {
+        spawnDespawn<ContiguousScene>(order);
+    });
+    runner.measure("50k spawn + random despawn, paged", 3, [&order]() {
+        spawnDespawn<PagedScene>(order);
+    });
+
+    // collect pointers after filling, contiguous storage moves objects as it grows
+    ContiguousScene contiguous;
+    std::vector<scene::SceneObject*> contiguousLive;
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) { contiguous.add(i); }
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) {
+        contiguousLive.emplace_back(contiguous.get(i));
+    }
+    runner.measure("2k despawn + 2k spawn of 50k, contiguous", 10, [&]() {
+        churn(contiguous, contiguousLive);
+    });
+
+    PagedScene paged;
+    std::vector<scene::SceneObject*> pagedLive;
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) { paged.add(i); }
+    for (std::uint32_t i = 0; i < ObjectCount; ++i) { pagedLive.emplace_back(paged.get(i)); }
+    runner.measure("2k despawn + 2k spawn of 50k, paged", 10, [&]() { churn(paged, pagedLive); });
+}
+
+} // namespace bench
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,121 @@
+#include "Benchmark.hpp"
+
+#include <BLIB/Serialization/Binary.hpp>
+#include <sstream>
+
+namespace bl
+{
+namespace serial
+{
+namespace bench
+{
+struct Leaf {
+    std::uint32_t id;
+    float weight;
+    std::string name;
+    std::vector<std::uint16_t> indices;
+};
+
+struct Branch {
+    std::uint32_t id;
+    std::vector<Leaf> leaves;
+};
+
+struct Limb {
+    std::string name;
+    std::vector<Branch> branches;
+};
+
+struct Tree {
+    std::uint32_t version;
+    std::vector<Limb> limbs;
+};
+} // namespace bench
+} // namespace serial
+
+namespace refl
+{
+template<>
+struct ReflectedObject<serial::bench::Leaf> {
+    using T                       = serial::bench::Leaf;
+    inline static const auto spec = makeSpec<T>(
+        "Leaf",
+        memberList(defineMember(0, "id", &T::id),
+                   defineMember(1, "weight", &T::weight),
+                   defineMember(2, "name", &T::name),
+                   defineMember(3, "indices", &T::indices)));
+};
+
+template<>
+struct ReflectedObject<serial::bench::Branch> {
+    using T                       = serial::bench::Branch;
+    inline static const auto spec = makeSpec<T>(
+        "Branch", memberList(defineMember(0, "id", &T::id), defineMember(1, "leaves", &T::leaves)));
+};
+
+template<>
+struct ReflectedObject<serial::bench::Limb> {
+    using T                       = serial::bench::Limb;
+    inline static const auto spec = makeSpec<T>(
+        "Limb",
+        memberList(defineMember(0, "name", &T::name), defineMember(1, "branches", &T::branches)));
+};
+
+template<>
+struct ReflectedObject<serial::bench::Tree> {
+    using T                       = serial::bench::Tree;
+    inline static const auto spec = makeSpec<T>(
+        "Tree",
+        memberList(defineMember(0, "version", &T::version), defineMember(1, "limbs", &T::limbs)));
+};
+} // namespace refl
+
+namespace serial
+{
+namespace bench
+{
+namespace
+{
+Tree makeTree() {
+    Tree tree{1, {}};
+    for (unsigned int l = 0; l < 16; ++l) {
+        Limb& limb = tree.limbs.emplace_back(Limb{"limb" + std::to_string(l), {}});
+        for (unsigned int b = 0; b < 16; ++b) {
+            Branch& branch = limb.branches.emplace_back(Branch{b, {}});
+            for (unsigned int f = 0; f < 16; ++f) {
+                branch.leaves.emplace_back(
+                    Leaf{f, static_cast<float>(f) * 0.5f, "leaf", {1, 2, 3, 4, 5, 6}});
+            }
+        }
+    }
+    return tree;
+}
+} // namespace
+
+BL_BENCHMARK(Serialization, ReflectedNesting) {
+    const Tree tree = makeTree();
+    std::vector<char> bytes;
+
+    runner.measure("serialize to memory (backpatched sizes)", 20, [&tree, &bytes]() {
+        bytes.clear();
+        stream::OutputStream output(bytes);
+        binary::Serializer<Tree>::serialize(output, tree);
+    });
+
+    runner.measure("serialize to wrapped stream (size pass per level)", 20, [&tree]() {
+        std::stringstream ss;
+        stream::OutputStream output(ss);
+        binary::Serializer<Tree>::serialize(output, tree);
+    });
+
+    runner.measure("deserialize", 20, [&bytes]() {
+        Tree read;
+        stream::InputStream input(std::span<const char>(bytes.data(), bytes.size()));
+        binary::Serializer<Tree>::deserialize(input, read);
+    });
+    runner.report("serialized size", static_cast<double>(bytes.size()) / 1024.0, "KiB");
+}
+
+} // namespace bench
+} // namespace serial
+} // namespace bl
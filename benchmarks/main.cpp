@@ -0,0 +1,16 @@
+#include "Benchmark.hpp"
+
+#include <string>
+
+int main(int argc, char** argv) {
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    bl::bench::Runner runner;
+    for (const auto& entry : bl::bench::Registry::get()) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos) { continue; }
+        std::cout << entry.name << std::endl;
+        entry.benchmark(runner);
+    }
+
+    return 0;
+}
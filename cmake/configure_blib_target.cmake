@@ -130,4 +130,9 @@ function(configure_blib_target target_name)
     else()
         target_compile_definitions(${target_name} PUBLIC BLIB_ECS_MASK_TYPE=std::uint64_t)
     endif()
+
+    # Profiling instrumentation
+    if(${BLIB_PROFILING})
+        target_compile_definitions(${target_name} PUBLIC BLIB_PROFILING_ENABLED)
+    endif()
 endfunction()
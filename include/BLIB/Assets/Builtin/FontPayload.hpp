@@ -4,13 +4,16 @@
 #include <BLIB/Assets/Payload.hpp>
 
 #include <BLIB/Render/Resources/TextureRef.hpp>
+#include <BLIB/Util/SkylinePacker.hpp>
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <array>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace bl
@@ -38,6 +41,73 @@ public:
         std::string family;
     };
 
+    /**
+     * @brief How glyphs are rendered into the glyph atlas
+     */
+    enum struct RenderMode {
+        /// Glyphs are rasterized separately for each size, style, and outline thickness
+        Bitmap,
+
+        /// Glyphs are rasterized once as signed distance fields and scaled to any size. Outlines
+        /// are rendered from the same distance field
+        DistanceField
+    };
+
+    /// The character size that distance field glyphs are generated at
+    static constexpr unsigned int DistanceFieldSize = 48;
+
+    /// The distance in texels around glyph edges that is encoded in the distance field
+    static constexpr unsigned int DistanceFieldSpread = 6;
+
+    /**
+     * @brief Fast lookup table for the printable ASCII range at a single size and style. Glyphs are
+     *        loaded up front and kerning pairs are cached as they are queried, so that laying out
+     *        ASCII text does not touch the glyph table or FreeType. Other characters fall back to
+     *        the font. Tables are owned by the font and stay valid until the font is reloaded
+     */
+    class AsciiTable {
+    public:
+        static constexpr std::uint32_t First = 32;
+        static constexpr std::uint32_t Last  = 126;
+        static constexpr std::uint32_t Count = Last - First + 1;
+
+        /**
+         * @brief Loads the glyphs of the printable ASCII range. Use FontPayload::getAsciiTable()
+         *
+         * @param font The font to load from
+         * @param characterSize The font size of the glyphs
+         * @param bold True for bold glyphs, false for regular glyphs
+         * @param outlineThickness Thickness of the outline, in pixels
+         */
+        AsciiTable(const FontPayload& font, unsigned int characterSize, bool bold,
+                   float outlineThickness);
+
+        /**
+         * @brief Returns the glyph for the given character
+         *
+         * @param codePoint The character to get the glyph for
+         * @return The glyph for the character at the size and style of this table
+         */
+        const sf::Glyph& getGlyph(std::uint32_t codePoint) const;
+
+        /**
+         * @brief Returns the kerning between the given characters
+         *
+         * @param first The left character
+         * @param second The right character
+         * @return The distance between the characters
+         */
+        float getKerning(std::uint32_t first, std::uint32_t second) const;
+
+    private:
+        const FontPayload& font;
+        const unsigned int characterSize;
+        const bool bold;
+        const float outlineThickness;
+        std::array<const sf::Glyph*, Count> glyphs;
+        mutable std::vector<float> kerning;
+    };
+
     /**
      * @brief Creates the font payload
      *
@@ -55,6 +125,36 @@ public:
      */
     const Info& getInfo() const;
 
+    /**
+     * @brief Sets how glyphs are rendered. Clears the glyph atlas, so this should be set before any
+     *        text is created with the font
+     *
+     * @param mode The render mode to use
+     */
+    void setRenderMode(RenderMode mode);
+
+    /**
+     * @brief Returns how glyphs are rendered
+     */
+    RenderMode getRenderMode() const;
+
+    /**
+     * @brief Returns the space around each distance field glyph that is covered by the field
+     *
+     * @param characterSize The font size being rendered
+     * @return The padding around glyph bounds in local units
+     */
+    float getDistanceFieldPadding(unsigned int characterSize) const;
+
+    /**
+     * @brief Returns the distance field value where the glyph edge is for the given outline
+     *
+     * @param characterSize The font size being rendered
+     * @param outlineThickness The thickness of the outline. 0 for the glyph fill
+     * @return The distance field value in the range [0, 1] to render the edge at
+     */
+    float getDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const;
+
     /**
      * @brief Returns the glyph information for the requested character and settings
      *
@@ -67,6 +167,17 @@ public:
     const sf::Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold,
                               float outlineThickness = 0.f) const;
 
+    /**
+     * @brief Returns the ASCII fast table for the given size and style, creating it if required
+     *
+     * @param characterSize The font size to get the table for
+     * @param bold True for bold glyphs, false for regular glyphs
+     * @param outlineThickness Thickness of the outline, in pixels
+     * @return The lookup table for the given settings
+     */
+    const AsciiTable& getAsciiTable(unsigned int characterSize, bool bold,
+                                    float outlineThickness = 0.f) const;
+
     /**
      * @brief Returns whether or not the font contains the requested character
      *
@@ -126,18 +237,8 @@ public:
     bl::rc::res::TextureRef syncTexture(bl::rc::Renderer& renderer) const;
 
 private:
-    struct Row {
-        Row(unsigned int rowTop, unsigned int rowHeight)
-        : width(0)
-        , top(rowTop)
-        , height(rowHeight) {}
-
-        unsigned int width;  //!< Current width of the row
-        unsigned int top;    //!< Y position of the row into the texture
-        unsigned int height; //!< Height of the row
-    };
-
     typedef std::map<std::uint64_t, sf::Glyph> GlyphTable;
+    typedef std::map<std::tuple<unsigned int, bool, float>, AsciiTable> AsciiTables;
 
     bool loadFromMemory();
     void cleanup(bool freeBuffer = true);
@@ -145,11 +246,13 @@ private:
     sf::Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold,
                         float outlineThickness) const;
     sf::IntRect findGlyphRect(unsigned int width, unsigned int height) const;
+    void resetAtlas() const;
     bool setCurrentSize(unsigned int characterSize) const;
 
     ////////////////////////////////////////////////////////////
     // Runtime data
     ////////////////////////////////////////////////////////////
+    RenderMode renderMode;
     mutable bool needsUpload;
     mutable bl::rc::res::TextureRef vulkanTexture;
 
@@ -160,9 +263,9 @@ private:
     bool m_isSmooth;
     Info m_info;
     mutable GlyphTable glyphs;
+    mutable AsciiTables asciiTables;
     mutable sf::Image texture;
-    mutable unsigned int nextRow;
-    mutable std::vector<Row> rows;
+    mutable util::SkylinePacker packer;
     mutable std::vector<std::uint8_t> m_pixelBuffer;
 
     ////////////////////////////////////////////////////////////
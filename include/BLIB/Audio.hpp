@@ -9,6 +9,11 @@
  */
 
 #include <BLIB/Audio/AudioSystem.hpp>
+#include <BLIB/Audio/Mixer.hpp>
+#include <BLIB/Audio/NullOutput.hpp>
+#include <BLIB/Audio/OutputDevice.hpp>
 #include <BLIB/Audio/Playlist.hpp>
+#include <BLIB/Audio/StreamOutput.hpp>
+#include <BLIB/Audio/VoicePool.hpp>
 
 #endif
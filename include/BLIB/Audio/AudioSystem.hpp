@@ -4,10 +4,13 @@
 #include <BLIB/Assets/Builtin/PlaylistPayload.hpp>
 #include <BLIB/Assets/Builtin/SoundPayload.hpp>
 #include <BLIB/Assets/TypedRef.hpp>
+#include <BLIB/Audio/Mixer.hpp>
+#include <BLIB/Audio/OutputDevice.hpp>
 #include <BLIB/Audio/Playlist.hpp>
 #include <BLIB/Containers/ObjectPool.hpp>
 #include <SFML/Audio.hpp>
 #include <cstdint>
+#include <memory>
 
 namespace bl
 {
@@ -20,7 +23,9 @@ class Engine;
 namespace audio
 {
 /**
- * @brief Centralized audio system for playing sounds and music
+ * @brief Centralized audio system for playing sounds and music. Sounds are played by voices in a
+ *        software mixer, so the same sound may overlap itself up to its voice limit. Music is
+ *        streamed separately
  *
  * @ingroup Audio
  *
@@ -33,6 +38,9 @@ public:
     /// Special value to indicate an error loading a sound or playlist
     static constexpr Handle InvalidHandle = 0;
 
+    /// Identifier of a single playing instance of a sound
+    using VoiceId = VoicePool::VoiceId;
+
     /**
      * @brief Sets the amount of time sounds should be in memory before being cleared
      *
@@ -49,9 +57,11 @@ public:
     static Handle getOrLoadSound(as::TypedRef<asi::SoundPayload> sound);
 
     /**
-     * @brief Plays the sound with the given handle
+     * @brief Plays a new voice of the sound with the given handle. Looping sounds that are already
+     *        playing are not layered
      *
      * @param sound The sound to play
+     * @param fadeIn Optional fade in time in seconds
      * @param loop True to loop, false to play once
      * @return True if the sound was able to be played, false if not
      */
@@ -65,6 +75,31 @@ public:
      */
     static bool playOrRestartSound(Handle sound);
 
+    /**
+     * @brief Plays a new voice of the given sound with full control over its parameters
+     *
+     * @param sound The sound to play
+     * @param settings The volume, priority, position, and other parameters of the voice
+     * @return The id of the new voice. InvalidVoice if it could not be played
+     */
+    static VoiceId startVoice(Handle sound, const VoiceSettings& settings);
+
+    /**
+     * @brief Moves a positional voice
+     *
+     * @param voice The voice to move
+     * @param position The new world position of the voice
+     */
+    static void moveVoice(VoiceId voice, const glm::vec3& position);
+
+    /**
+     * @brief Stops a single voice
+     *
+     * @param voice The voice to stop
+     * @param fadeOut Optional fade out time in seconds
+     */
+    static void stopVoice(VoiceId voice, float fadeOut = -1.f);
+
     /**
      * @brief Stops the given sound if it is playing
      *
@@ -78,6 +113,38 @@ public:
      */
     static void stopAllSounds();
 
+    /**
+     * @brief Sets the listener that positional voices are attenuated and panned relative to
+     *
+     * @param listener The position and orientation to hear from
+     */
+    static void setListener(const Listener& listener);
+
+    /**
+     * @brief Sets the maximum number of voices that are mixed. Lower priority and quieter voices
+     *        past the limit are virtualized until they become audible again
+     *
+     * @param voices The maximum number of audible voices. Default is 32
+     */
+    static void setPolyphony(unsigned int voices);
+
+    /**
+     * @brief Sets the maximum number of voices that may play the given sound at once. The oldest
+     *        voice is stopped when the limit is exceeded
+     *
+     * @param sound The sound to limit
+     * @param limit The maximum number of voices. 0 for no limit. Default is 4
+     */
+    static void setSoundVoiceLimit(Handle sound, unsigned int limit);
+
+    /**
+     * @brief Replaces the device that mixed sounds are output to. The default device plays on the
+     *        system sound device. Use NullOutput to run without a sound device
+     *
+     * @param device The new output device. May be nullptr to stop output
+     */
+    static void setOutputDevice(std::unique_ptr<OutputDevice>&& device);
+
     /**
      * @brief Loads a playlist and returns a handle for it. Playlists are loaded at most once
      *
@@ -0,0 +1,119 @@
+#ifndef BLIB_AUDIO_MIXER_HPP
+#define BLIB_AUDIO_MIXER_HPP
+
+#include <BLIB/Audio/VoicePool.hpp>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+/**
+ * @brief Software mixer that renders the audible voices of a VoicePool into interleaved 16 bit
+ *        stereo samples. Mixing is done in fixed size blocks into planar float buffers with
+ *        branch-free per-voice kernels so that the compiler can vectorize them. Gains ramp across
+ *        each block to avoid clicks when volume, fades, or positions change. Output devices pull
+ *        mixed samples from the mixer, possibly from their own thread
+ *
+ * @ingroup Audio
+ */
+class Mixer {
+public:
+    /// The number of channels in mixed output
+    static constexpr unsigned int ChannelCount = 2;
+
+    /// The default output sample rate
+    static constexpr unsigned int DefaultSampleRate = 44100;
+
+    /// The maximum number of frames mixed between voice updates
+    static constexpr std::size_t BlockFrames = 512;
+
+    /**
+     * @brief Scoped exclusive access to the voices of the mixer. Mixing is blocked while held
+     */
+    class VoiceAccess {
+    public:
+        VoicePool* operator->();
+        VoicePool& operator*();
+
+    private:
+        std::unique_lock<std::mutex> lock;
+        VoicePool& pool;
+
+        VoiceAccess(std::mutex& mutex, VoicePool& pool);
+
+        friend class Mixer;
+    };
+
+    /**
+     * @brief Creates the mixer
+     *
+     * @param sampleRate The output sample rate
+     * @param capacity The maximum number of voices, audible or virtual
+     * @param polyphony The maximum number of voices to mix
+     */
+    Mixer(unsigned int sampleRate = DefaultSampleRate,
+          unsigned int capacity   = VoicePool::DefaultCapacity,
+          unsigned int polyphony  = VoicePool::DefaultPolyphony);
+
+    /**
+     * @brief Locks the voices for modification. Hold the result for as short as possible
+     */
+    VoiceAccess voices();
+
+    /**
+     * @brief Pauses or resumes mixing. Paused mixers output silence and do not advance voices
+     *
+     * @param paused True to pause, false to resume
+     */
+    void setPaused(bool paused);
+
+    /**
+     * @brief Returns whether the mixer is paused
+     */
+    bool isPaused() const;
+
+    /**
+     * @brief Returns the output sample rate
+     */
+    unsigned int getSampleRate() const;
+
+    /**
+     * @brief Mixes the next frames of all audible voices
+     *
+     * @param samples Output for interleaved stereo samples. Must hold frameCount * 2 samples
+     * @param frameCount The number of frames to mix
+     */
+    void mix(std::int16_t* samples, std::size_t frameCount);
+
+private:
+    const unsigned int sampleRate;
+    std::mutex mutex;
+    VoicePool pool;
+    std::atomic<bool> paused;
+    std::vector<float> mixLeft;
+    std::vector<float> mixRight;
+    std::vector<float> voiceLeft;
+    std::vector<float> voiceRight;
+
+    void mixVoice(VoicePool::Voice& voice, std::size_t frameCount);
+    std::size_t readVoice(VoicePool::Voice& voice, std::size_t frameCount);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline VoicePool* Mixer::VoiceAccess::operator->() { return &pool; }
+
+inline VoicePool& Mixer::VoiceAccess::operator*() { return pool; }
+
+inline bool Mixer::isPaused() const { return paused; }
+
+inline unsigned int Mixer::getSampleRate() const { return sampleRate; }
+
+} // namespace audio
+} // namespace bl
+
+#endif
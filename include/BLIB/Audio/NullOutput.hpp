@@ -0,0 +1,68 @@
+#ifndef BLIB_AUDIO_NULLOUTPUT_HPP
+#define BLIB_AUDIO_NULLOUTPUT_HPP
+
+#include <BLIB/Audio/OutputDevice.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+/**
+ * @brief Output device that does not play anything. Audio is only mixed when render() is called,
+ *        into a buffer that can be inspected. Useful for tests, benchmarks, and headless servers
+ *
+ * @ingroup Audio
+ */
+class NullOutput : public OutputDevice {
+public:
+    /**
+     * @brief Creates the device
+     */
+    NullOutput();
+
+    /**
+     * @brief Destroys the device
+     */
+    virtual ~NullOutput() = default;
+
+    /**
+     * @brief Sets the mixer to render from
+     *
+     * @param mixer The mixer to render
+     * @return Always returns true
+     */
+    virtual bool start(Mixer& mixer) override;
+
+    /**
+     * @brief Clears the mixer. Subsequent renders output silence
+     */
+    virtual void stop() override;
+
+    /**
+     * @brief Mixes the next frames from the mixer into the sample buffer
+     *
+     * @param frameCount The number of frames to mix
+     * @return The interleaved stereo samples that were mixed
+     */
+    const std::vector<std::int16_t>& render(std::size_t frameCount);
+
+    /**
+     * @brief Returns the interleaved stereo samples from the last render
+     */
+    const std::vector<std::int16_t>& getSamples() const;
+
+private:
+    Mixer* mixer;
+    std::vector<std::int16_t> samples;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const std::vector<std::int16_t>& NullOutput::getSamples() const { return samples; }
+
+} // namespace audio
+} // namespace bl
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef BLIB_AUDIO_OUTPUTDEVICE_HPP
+#define BLIB_AUDIO_OUTPUTDEVICE_HPP
+
+namespace bl
+{
+namespace audio
+{
+class Mixer;
+
+/**
+ * @brief Base class for destinations of mixed audio. Devices pull samples from the mixer at their
+ *        own pace once started
+ *
+ * @ingroup Audio
+ */
+class OutputDevice {
+public:
+    /**
+     * @brief Destroys the device
+     */
+    virtual ~OutputDevice() = default;
+
+    /**
+     * @brief Begins pulling mixed audio from the given mixer
+     *
+     * @param mixer The mixer to output. Must remain valid until stop() is called
+     * @return True if the device started, false on error
+     */
+    virtual bool start(Mixer& mixer) = 0;
+
+    /**
+     * @brief Stops pulling audio from the mixer
+     */
+    virtual void stop() = 0;
+};
+
+} // namespace audio
+} // namespace bl
+
+#endif
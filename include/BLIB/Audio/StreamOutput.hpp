@@ -0,0 +1,65 @@
+#ifndef BLIB_AUDIO_STREAMOUTPUT_HPP
+#define BLIB_AUDIO_STREAMOUTPUT_HPP
+
+#include <BLIB/Audio/OutputDevice.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+/**
+ * @brief Output device that plays mixed audio on the default sound device through an
+ *        sf::SoundStream. Mixing happens on the audio thread of the stream
+ *
+ * @ingroup Audio
+ */
+class StreamOutput : public OutputDevice {
+public:
+    /**
+     * @brief Creates the device
+     */
+    StreamOutput() = default;
+
+    /**
+     * @brief Stops the stream
+     */
+    virtual ~StreamOutput();
+
+    /**
+     * @brief Begins streaming audio from the given mixer
+     *
+     * @param mixer The mixer to play
+     * @return True if the stream was started, false on error
+     */
+    virtual bool start(Mixer& mixer) override;
+
+    /**
+     * @brief Stops the stream
+     */
+    virtual void stop() override;
+
+private:
+    class Stream : public sf::SoundStream {
+    public:
+        Stream();
+        void open(Mixer& mixer);
+
+    protected:
+        virtual bool onGetData(Chunk& data) override;
+        virtual void onSeek(sf::Time timeOffset) override;
+
+    private:
+        Mixer* mixer;
+        std::vector<std::int16_t> buffer;
+    };
+
+    Stream stream;
+};
+
+} // namespace audio
+} // namespace bl
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef BLIB_AUDIO_VOICEPOOL_HPP
+#define BLIB_AUDIO_VOICEPOOL_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+class Mixer;
+
+/**
+ * @brief Interleaved 16 bit sample data of a loaded sound. The samples are not owned and must
+ *        outlive every voice playing them
+ *
+ * @ingroup Audio
+ */
+struct SoundData {
+    const std::int16_t* samples;
+    std::uint64_t frameCount;
+    unsigned int channelCount;
+    unsigned int sampleRate;
+};
+
+/**
+ * @brief Parameters of a single voice when it is started
+ *
+ * @ingroup Audio
+ */
+struct VoiceSettings {
+    /// Volume of the voice in the range [0, 1]
+    float volume = 1.f;
+
+    /// Playback speed multiplier. Also shifts the pitch
+    float pitch = 1.f;
+
+    /// Higher priority voices are kept audible when there are more voices than the polyphony
+    int priority = 0;
+
+    /// True to loop until stopped, false to play once
+    bool loop = false;
+
+    /// Fade in time in seconds. 0 or less to start at full volume
+    float fadeIn = 0.f;
+
+    /// World position of the voice. Voices without a position are not attenuated or panned
+    std::optional<glm::vec3> position;
+
+    /// Distance under which the voice is at full volume
+    float minDistance = 1.f;
+
+    /// How quickly the voice attenuates past the min distance. 0 to not attenuate
+    float attenuation = 1.f;
+};
+
+/**
+ * @brief The point that positional voices are heard from
+ *
+ * @ingroup Audio
+ */
+struct Listener {
+    /// World position of the listener
+    glm::vec3 position = glm::vec3(0.f);
+
+    /// Unit direction to the right of the listener, used for panning
+    glm::vec3 right = glm::vec3(1.f, 0.f, 0.f);
+};
+
+/**
+ * @brief Fixed capacity set of voices that play sounds. Any number of voices may play the same
+ *        sound, up to a configurable limit per sound, with the oldest voice of a sound being
+ *        stolen when the limit is reached. At most the polyphony count of voices are mixed. The
+ *        rest, and any voice too quiet to hear, are virtual: their playback position and fades
+ *        still advance so they resume in sync when they become audible again. Not thread safe,
+ *        access through Mixer::voices()
+ *
+ * @ingroup Audio
+ */
+class VoicePool {
+public:
+    /// Identifier of a playing voice
+    using VoiceId = std::uint32_t;
+
+    /// Returned when a voice could not be started
+    static constexpr VoiceId InvalidVoice = 0;
+
+    /// Default number of voices that may exist at once, audible or virtual
+    static constexpr unsigned int DefaultCapacity = 128;
+
+    /// Default number of voices that are mixed
+    static constexpr unsigned int DefaultPolyphony = 32;
+
+    /// Default number of voices that may play the same sound at once
+    static constexpr unsigned int DefaultVoiceLimit = 4;
+
+    /**
+     * @brief Creates the voice pool
+     *
+     * @param capacity The maximum number of voices, audible or virtual
+     * @param polyphony The maximum number of voices to mix
+     */
+    VoicePool(unsigned int capacity = DefaultCapacity, unsigned int polyphony = DefaultPolyphony);
+
+    /**
+     * @brief Starts a new voice playing the given sound. Steals the oldest voice of the sound if
+     *        it is at its voice limit, or the lowest priority voice if the pool is full
+     *
+     * @param sound The sample data to play
+     * @param soundId Identifier of the sound, used for voice limits and stopSound()
+     * @param settings The parameters of the new voice
+     * @return The id of the new voice, or InvalidVoice if no voice was available
+     */
+    VoiceId play(const SoundData& sound, std::uint32_t soundId, const VoiceSettings& settings);
+
+    /**
+     * @brief Stops the given voice. Does nothing if the voice already finished
+     *
+     * @param voice The voice to stop
+     * @param fadeOut Fade out time in seconds. 0 or less to stop immediately
+     */
+    void stop(VoiceId voice, float fadeOut = -1.f);
+
+    /**
+     * @brief Stops all voices playing the given sound
+     *
+     * @param soundId The sound to stop
+     * @param fadeOut Fade out time in seconds. 0 or less to stop immediately
+     */
+    void stopSound(std::uint32_t soundId, float fadeOut = -1.f);
+
+    /**
+     * @brief Stops all voices immediately
+     */
+    void stopAll();
+
+    /**
+     * @brief Returns whether the given voice is still playing, audible or not
+     */
+    bool isPlaying(VoiceId voice) const;
+
+    /**
+     * @brief Returns whether any voice is playing the given sound
+     */
+    bool isSoundPlaying(std::uint32_t soundId) const;
+
+    /**
+     * @brief Returns whether the given voice is currently being mixed
+     */
+    bool isAudible(VoiceId voice) const;
+
+    /**
+     * @brief Moves a positional voice. Voices started without a position become positional
+     *
+     * @param voice The voice to move
+     * @param position The new world position of the voice
+     */
+    void setPosition(VoiceId voice, const glm::vec3& position);
+
+    /**
+     * @brief Sets the listener that positional voices are attenuated and panned relative to
+     *
+     * @param listener The new listener
+     */
+    void setListener(const Listener& listener);
+
+    /**
+     * @brief Returns the listener that positional voices are heard from
+     */
+    const Listener& getListener() const;
+
+    /**
+     * @brief Sets the maximum number of voices to mix. Clamped to the capacity
+     *
+     * @param polyphony The maximum number of audible voices
+     */
+    void setPolyphony(unsigned int polyphony);
+
+    /**
+     * @brief Returns the maximum number of voices that are mixed
+     */
+    unsigned int getPolyphony() const;
+
+    /**
+     * @brief Sets the voice limit for sounds that do not have their own limit
+     *
+     * @param limit The maximum number of voices per sound. 0 for no limit
+     */
+    void setDefaultVoiceLimit(unsigned int limit);
+
+    /**
+     * @brief Sets the maximum number of voices that may play the given sound at once
+     *
+     * @param soundId The sound to limit
+     * @param limit The maximum number of voices of the sound. 0 for no limit
+     */
+    void setVoiceLimit(std::uint32_t soundId, unsigned int limit);
+
+    /**
+     * @brief Sets the gain under which voices are virtualized even if within the polyphony
+     *
+     * @param threshold The minimum gain to mix a voice at. Default is 0.001
+     */
+    void setAudibilityThreshold(float threshold);
+
+    /**
+     * @brief Returns the number of playing voices, audible or virtual
+     */
+    std::size_t getActiveCount() const;
+
+    /**
+     * @brief Returns the number of voices that were mixed in the last block
+     */
+    std::size_t getAudibleCount() const;
+
+    /**
+     * @brief Prepares the next block to be mixed. Releases finished voices, advances fades,
+     *        computes channel gains, picks the audible voices, and advances virtual voices. Called
+     *        by the mixer
+     *
+     * @param frameCount The number of frames in the block
+     * @param sampleRate The output sample rate
+     */
+    void prepare(std::size_t frameCount, unsigned int sampleRate);
+
+private:
+    struct Voice {
+        SoundData sound;
+        std::uint32_t soundId;
+        VoiceSettings settings;
+        double cursor;
+        double step;
+        float fadeGain;
+        float fadeRate;
+        float gain[2];
+        float prevGain[2];
+        float audibility;
+        std::uint64_t startOrder;
+        std::uint16_t generation;
+        bool active;
+        bool audible;
+        bool finished;
+        bool fresh;
+    };
+
+    std::vector<Voice> voices;
+    std::vector<std::uint32_t> freeSlots;
+    std::vector<std::uint32_t> activeSlots;
+    std::vector<std::uint32_t> audibleSlots;
+    std::unordered_map<std::uint32_t, unsigned int> voiceLimits;
+    Listener listener;
+    unsigned int polyphony;
+    unsigned int defaultVoiceLimit;
+    float audibilityThreshold;
+    std::uint64_t nextStartOrder;
+
+    Voice* find(VoiceId id);
+    const Voice* find(VoiceId id) const;
+    void release(std::uint32_t slot);
+    void stopVoice(Voice& voice, float fadeOut);
+    std::uint32_t steal(int priority);
+    void computeGains(Voice& voice) const;
+    static bool advance(Voice& voice, std::size_t frameCount);
+
+    friend class Mixer;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const Listener& VoicePool::getListener() const { return listener; }
+
+inline unsigned int VoicePool::getPolyphony() const { return polyphony; }
+
+inline std::size_t VoicePool::getActiveCount() const { return activeSlots.size(); }
+
+inline std::size_t VoicePool::getAudibleCount() const { return audibleSlots.size(); }
+
+} // namespace audio
+} // namespace bl
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <BLIB/Assets/Builtin/Animation2DSetPayload.hpp>
 #include <BLIB/Assets/TypedRef.hpp>
+#include <BLIB/Components/AnimationLodState.hpp>
 #include <BLIB/Render/Buffers/AlignedBuffer.hpp>
 #include <BLIB/Render/Resources/TextureRef.hpp>
 #include <BLIB/Util/VectorRef.hpp>
@@ -107,6 +108,14 @@ struct Animation2DPlayer {
      */
     void update(float dt);
 
+    /**
+     * @brief Sets whether this player may be throttled by the animation level of detail policy.
+     *        Enabled by default
+     *
+     * @param enabled True to allow reduced update rates when far from observers
+     */
+    void setLodEnabled(bool enabled) { lod.enabled = enabled; }
+
 private:
     const bool forSlideshow;
     as::TypedRef<asi::Animation2DSetPayload> animation;
@@ -116,6 +125,7 @@ private:
     std::size_t currentState;
     std::size_t currentFrame;
     float frameTime;
+    AnimationLodState lod;
 
     // assigned by Animation2DSystem
     std::uint32_t playerIndex;
@@ -0,0 +1,35 @@
+#ifndef BLIB_COMPONENTS_ANIMATIONLODSTATE_HPP
+#define BLIB_COMPONENTS_ANIMATIONLODSTATE_HPP
+
+#include <cstdint>
+
+namespace bl
+{
+namespace com
+{
+/**
+ * @brief Per-animation level of detail state. Owned by the animated components and advanced by
+ *        sys::AnimationLod
+ *
+ * @ingroup Components
+ */
+struct AnimationLodState {
+    float accumulatedTime;
+    std::uint32_t ticksSinceUpdate;
+    std::uint32_t level;
+    bool enabled;
+
+    /**
+     * @brief Initializes to full detail with no accumulated time
+     */
+    AnimationLodState()
+    : accumulatedTime(0.f)
+    , ticksSinceUpdate(0)
+    , level(0)
+    , enabled(true) {}
+};
+
+} // namespace com
+} // namespace bl
+
+#endif
@@ -7,6 +7,7 @@
 #include <BLIB/Render/Config/MaterialPipelineIds.hpp>
 #include <BLIB/Render/Primitives/Vertex3D.hpp>
 #include <BLIB/Render/Primitives/Vertex3DSkinned.hpp>
+#include <memory>
 
 namespace bl
 {
@@ -34,6 +35,7 @@ struct Mesh : public rc::rcom::DrawableBase {
     void create(rc::Renderer& renderer, std::uint32_t vertexCount, std::uint32_t indexCount) {
         gpuBuffer.create(renderer, vertexCount, indexCount);
         drawParams = gpuBuffer.getDrawParameters();
+        notifyDrawParametersChanged();
         gpuBuffer.queueTransfer();
     }
 
@@ -48,6 +50,7 @@ struct Mesh : public rc::rcom::DrawableBase {
                 std::vector<std::uint32_t>&& indices) {
         gpuBuffer.create(renderer, std::move(vertices), std::move(indices));
         drawParams = gpuBuffer.getDrawParameters();
+        notifyDrawParametersChanged();
         gpuBuffer.queueTransfer();
     }
 
@@ -67,12 +70,47 @@ struct Mesh : public rc::rcom::DrawableBase {
         }
     }
 
+    /**
+     * @brief Draws the geometry of another mesh instead of owning a copy. Meshes that share their
+     *        geometry are drawn instanced by scenes that support it. The shared geometry is kept
+     *        alive until every mesh drawing it is destroyed or made unique
+     *
+     * @param source The mesh to share geometry with
+     */
+    void createShared(std::shared_ptr<const Mesh> source) {
+        drawParams     = source->getDrawParameters();
+        sharedGeometry = std::move(source);
+        notifyDrawParametersChanged();
+    }
+
+    /**
+     * @brief Copies shared geometry into this mesh so that gpuBuffer may be edited without
+     *        affecting the other meshes. Does nothing if the geometry is not shared
+     *
+     * @param renderer The renderer instance
+     */
+    void makeUnique(rc::Renderer& renderer) {
+        if (!sharedGeometry) { return; }
+        std::vector<TVertex> vertices      = sharedGeometry->gpuBuffer.vertices();
+        std::vector<std::uint32_t> indices = sharedGeometry->gpuBuffer.indices();
+        sharedGeometry.reset();
+        create(renderer, std::move(vertices), std::move(indices));
+    }
+
+    /**
+     * @brief Returns whether this mesh draws geometry shared with other meshes
+     */
+    bool isShared() const { return sharedGeometry != nullptr; }
+
     /**
      * @brief Returns the default material pipeline for rendering
      */
     virtual std::uint32_t getDefaultMaterialPipelineId() const override {
         return MaterialPipelineId;
     }
+
+private:
+    std::shared_ptr<const Mesh> sharedGeometry;
 };
 
 /**
@@ -3,6 +3,7 @@
 
 #include <BLIB/Assets/Builtin/Animation3DPayload.hpp>
 #include <BLIB/Assets/TypedRef.hpp>
+#include <BLIB/Components/AnimationLodState.hpp>
 #include <BLIB/Containers/StaticVector.hpp>
 #include <BLIB/Models/Model.hpp>
 #include <BLIB/Render/Components/DescriptorComponentBase.hpp>
@@ -25,10 +26,12 @@ public:
     struct BoneLink {
         Transform3D* transform;
         Bone* bone;
+        std::uint32_t depth;
 
         BoneLink()
         : transform(nullptr)
-        , bone(nullptr) {}
+        , bone(nullptr)
+        , depth(0) {}
     };
 
     struct AnimationState {
@@ -47,6 +50,7 @@ public:
     rc::sri::SkeletalBonesResource::ComponentLink resourceLink;
     std::vector<as::TypedRef<asi::Animation3DPayload>> animations;
     ctr::StaticVector<AnimationState, 4> activeAnimations;
+    AnimationLodState lod;
     bool needsRefresh;
 
     /**
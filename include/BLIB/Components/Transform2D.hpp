@@ -199,10 +199,20 @@ public:
     const glm::mat4& getGlobalTransform();
 
     /**
-     * @brief Returns the global transform matrix for this transform
+     * @brief Returns the global transform matrix. Uses the cached matrix if it is up to date,
+     *        otherwise computes it without modifying the cache
      */
     glm::mat4 computeGlobalTransform() const;
 
+    /**
+     * @brief Refreshes the cached global transform if this transform or its direct parent changed.
+     *        The parent must already be up to date. Used to resolve hierarchies breadth-first
+     *        without walking the parent chain
+     *
+     * @return True if the global transform was recomputed, false if it was already up to date
+     */
+    bool propagateGlobalTransform();
+
     /**
      * @brief Transforms the given point by this transform
      *
@@ -217,10 +227,13 @@ private:
     glm::vec2 scaleFactors;
     float rotation;
     float depth;
+    glm::vec3 cachedGlobalPosition;
     glm::mat4 cachedGlobalTransform;
 
     void makeDirty();
     void ensureUpdated();
+    glm::vec3 computeGlobalPosition() const;
+    void refreshGlobalTransform();
     void clampAngle();
 };
 
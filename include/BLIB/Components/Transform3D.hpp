@@ -138,6 +138,15 @@ public:
      */
     glm::mat4 getGlobalTransform() const;
 
+    /**
+     * @brief Refreshes the cached global transform if this transform or its direct parent changed.
+     *        The parent must already be up to date. Used to resolve hierarchies breadth-first
+     *        without walking the parent chain
+     *
+     * @return True if the global transform was recomputed, false if it was already up to date
+     */
+    bool propagateGlobalTransform();
+
     /**
      * @brief Transforms the given point by this transform
      *
@@ -155,8 +164,11 @@ private:
     glm::vec3 position;
     glm::quat rotation;
     glm::vec3 scaleFactors;
+    glm::mat4 cachedGlobalTransform;
 
     void makeDirty();
+    void ensureUpdated();
+    void refreshGlobalTransform();
 };
 
 //////////////////////////// INLINE FUNCTIONS /////////////////////////////////
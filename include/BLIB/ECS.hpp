@@ -14,6 +14,7 @@
 #include <BLIB/ECS/Entity.hpp>
 #include <BLIB/ECS/EntityBacked.hpp>
 #include <BLIB/ECS/Events.hpp>
+#include <BLIB/ECS/HierarchyLevels.hpp>
 #include <BLIB/ECS/Registry.hpp>
 #include <BLIB/ECS/Transaction.hpp>
 #include <BLIB/ECS/View.hpp>
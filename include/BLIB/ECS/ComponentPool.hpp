@@ -10,9 +10,11 @@
 #include <BLIB/Signals/Emitter.hpp>
 #include <BLIB/Util/NonCopyable.hpp>
 #include <BLIB/Util/ReadWriteLock.hpp>
+#include <algorithm>
 #include <cstdlib>
 #include <functional>
 #include <limits>
+#include <span>
 #include <plf_colony.h>
 #include <type_traits>
 #include <utility>
@@ -50,6 +52,7 @@ protected:
 
     virtual void fireRemoveEventOnly(Entity entity)            = 0;
     virtual void* remove(Entity entity, bool fireEvent = true) = 0;
+    virtual void removeMany(std::span<const Entity> entities)  = 0;
     virtual void* queueRemove(Entity entity)                   = 0;
     virtual void flushRemovals()                               = 0;
     virtual void clear()                                       = 0;
@@ -154,10 +157,13 @@ private:
     T* emplace(Entity ent,
                const Transaction<tx::EntityUnlocked, tx::ComponentRead<>, tx::ComponentWrite<T>>&,
                TArgs&&... args);
+    void addMany(std::span<const Entity> entities, const T& component,
+                 const Transaction<tx::EntityUnlocked, tx::ComponentRead<>, tx::ComponentWrite<T>>&);
 
     virtual void fireRemoveEventOnly(Entity entity) override;
     virtual void* remove(Entity entity, bool fireEvent = true) override;
     void* doRemoveLocked(Entity entity, bool fireEvent = true);
+    virtual void removeMany(std::span<const Entity> entities) override;
     virtual void* queueRemove(Entity entity) override;
     virtual void flushRemovals() override;
     virtual void clear() override;
@@ -300,6 +306,24 @@ T* ComponentPool<T>::emplace(
     return &it->component;
 }
 
+template<typename T>
+void ComponentPool<T>::addMany(
+    std::span<const Entity> entities, const T& component,
+    const Transaction<tx::EntityUnlocked, tx::ComponentRead<>, tx::ComponentWrite<T>>&) {
+    std::uint64_t maxIndex = 0;
+    for (const Entity ent : entities) { maxIndex = std::max(maxIndex, ent.getIndex()); }
+    if (maxIndex + 1 > entityToComponent.size()) {
+        entityToComponent.resize(maxIndex + 1, nullptr);
+        entityToIter.resize(maxIndex + 1, storage.end());
+    }
+    storage.reserve(storage.size() + entities.size());
+
+    for (const Entity ent : entities) {
+        preAdd(ent);
+        postAdd(ent, storage.emplace(ent, component));
+    }
+}
+
 template<typename T>
 void ComponentPool<T>::fireRemoveEventOnly(Entity ent) {
     util::ReadWriteLock::ReadScopeGuard lock(poolLock);
@@ -338,6 +362,12 @@ void* ComponentPool<T>::doRemoveLocked(Entity ent, bool fireEvent) {
     return com;
 }
 
+template<typename T>
+void ComponentPool<T>::removeMany(std::span<const Entity> entities) {
+    util::ReadWriteLock::WriteScopeGuard lock(poolLock);
+    for (const Entity ent : entities) { doRemoveLocked(ent, false); }
+}
+
 template<typename T>
 void* ComponentPool<T>::queueRemove(Entity entity) {
     util::ReadWriteLock::ReadScopeGuard readLock(poolLock);
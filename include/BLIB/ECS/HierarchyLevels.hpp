@@ -0,0 +1,155 @@
+#ifndef BLIB_ECS_HIERARCHYLEVELS_HPP
+#define BLIB_ECS_HIERARCHYLEVELS_HPP
+
+#include <BLIB/ECS/ComponentPool.hpp>
+#include <BLIB/Util/ThreadPool.hpp>
+#include <algorithm>
+#include <future>
+#include <span>
+#include <vector>
+
+namespace bl
+{
+namespace ecs
+{
+/**
+ * @brief Flat, breadth-first ordering of parent aware components. Components are bucketed by their
+ *        depth in the parent tree so that a level can be processed once all of the levels above it
+ *        are done. Components within a level are independent and may be processed in parallel
+ *
+ * @tparam T The component type. Must inherit trait::ParentAware<T>
+ * @ingroup ECS
+ */
+template<typename T>
+class HierarchyLevels {
+public:
+    /// Levels with fewer components than this are processed on the calling thread
+    static constexpr std::size_t MinParallelLevelSize = 1024;
+
+    /**
+     * @brief Creates an empty hierarchy
+     */
+    HierarchyLevels() = default;
+
+    /**
+     * @brief Removes all components from the hierarchy
+     */
+    void clear();
+
+    /**
+     * @brief Adds the given component to the level matching its depth in the parent tree
+     *
+     * @param component The component to add. Must have a stable address
+     */
+    void add(T& component);
+
+    /**
+     * @brief Clears the hierarchy and adds every component in the given pool
+     *
+     * @param pool The pool of components to order
+     */
+    void rebuild(ComponentPool<T>& pool);
+
+    /**
+     * @brief Returns the number of levels in the hierarchy
+     */
+    std::size_t levelCount() const;
+
+    /**
+     * @brief Returns the components at the given depth
+     *
+     * @param depth The depth of the level to get. Roots have a depth of 0
+     */
+    std::span<T* const> getLevel(std::size_t depth) const;
+
+    /**
+     * @brief Returns the total number of components in the hierarchy
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Calls the given callback on every component. Parents are always visited before their
+     *        children. Large levels are split across the given thread pool
+     *
+     * @tparam TCallback Callback type with signature void(T&)
+     * @param threadPool Thread pool to parallelize large levels with. May be nullptr
+     * @param cb The callback to invoke for each component
+     */
+    template<typename TCallback>
+    void forEachBreadthFirst(util::ThreadPool* threadPool, const TCallback& cb);
+
+private:
+    std::vector<std::vector<T*>> levels;
+    std::vector<std::future<void>> futures;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+template<typename T>
+void HierarchyLevels<T>::clear() {
+    // keep level allocations around for the next rebuild
+    for (auto& level : levels) { level.clear(); }
+}
+
+template<typename T>
+void HierarchyLevels<T>::add(T& component) {
+    std::size_t depth = 0;
+    for (const T* c = &component; c->hasParent(); c = &c->getParent()) { ++depth; }
+    if (depth >= levels.size()) { levels.resize(depth + 1); }
+    levels[depth].emplace_back(&component);
+}
+
+template<typename T>
+void HierarchyLevels<T>::rebuild(ComponentPool<T>& pool) {
+    clear();
+    pool.forEach([this](Entity, T& component) { add(component); });
+    while (!levels.empty() && levels.back().empty()) { levels.pop_back(); }
+}
+
+template<typename T>
+std::size_t HierarchyLevels<T>::levelCount() const {
+    return levels.size();
+}
+
+template<typename T>
+std::span<T* const> HierarchyLevels<T>::getLevel(std::size_t depth) const {
+    return levels[depth];
+}
+
+template<typename T>
+std::size_t HierarchyLevels<T>::size() const {
+    std::size_t total = 0;
+    for (const auto& level : levels) { total += level.size(); }
+    return total;
+}
+
+template<typename T>
+template<typename TCallback>
+void HierarchyLevels<T>::forEachBreadthFirst(util::ThreadPool* threadPool, const TCallback& cb) {
+    for (auto& level : levels) {
+        if (!threadPool || !threadPool->running() || level.size() < MinParallelLevelSize) {
+            for (T* component : level) { cb(*component); }
+            continue;
+        }
+
+        const std::size_t taskCount = std::max<std::size_t>(threadPool->workerCount(), 1) * 2;
+        const std::size_t chunkSize =
+            std::max((level.size() + taskCount - 1) / taskCount, MinParallelLevelSize / 4);
+        for (std::size_t i = 0; i < level.size(); i += chunkSize) {
+            T* const* begin = level.data() + i;
+            T* const* end   = level.data() + std::min(i + chunkSize, level.size());
+            futures.emplace_back(threadPool->queueTask([begin, end, &cb]() {
+                for (T* const* it = begin; it != end; ++it) { cb(**it); }
+            }));
+        }
+
+        // children may only be processed once every parent is done
+        for (auto& future : futures) { future.wait(); }
+        futures.clear();
+    }
+}
+
+} // namespace ecs
+} // namespace bl
+
+#endif
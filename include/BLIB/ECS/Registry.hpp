@@ -15,6 +15,7 @@
 #include <BLIB/Util/NonCopyable.hpp>
 #include <cstdlib>
 #include <memory>
+#include <span>
 #include <utility>
 
 namespace bl
@@ -61,6 +62,21 @@ public:
     Entity createEntity(unsigned int worldIndex, Flags flags,
                         const Transaction<tx::EntityWrite>& transaction);
 
+    /**
+     * @brief Creates many entities at once, each with a copy of the given components. Entity ids
+     *        are allocated in a block and each component pool and view is only locked once
+     *
+     * @tparam TComponents The types of components to add to each entity
+     * @param worldIndex The index of the world that the entities belong to
+     * @param flags The flags to create the entities with
+     * @param count The number of entities to create
+     * @param entities Vector to append the new entities to
+     * @param components The component values to copy onto each entity
+     */
+    template<typename... TComponents>
+    void createEntities(unsigned int worldIndex, Flags flags, std::size_t count,
+                        std::vector<Entity>& entities, const TComponents&... components);
+
     /**
      * @brief Returns whether or not the given entity exists
      *
@@ -99,6 +115,26 @@ public:
      */
     bool destroyEntity(Entity entity, const Transaction<tx::EntityRead>& transaction);
 
+    /**
+     * @brief Queues many entities to be destroyed at once. Queued entities are destroyed together
+     *        in flushDeletions()
+     *
+     * @param entities The entities to destroy
+     * @return The number of entities that were destroyed. Entities still depended on are not
+     */
+    unsigned int destroyEntities(std::span<const Entity> entities);
+
+    /**
+     * @brief Queues many entities to be destroyed at once. Queued entities are destroyed together
+     *        in flushDeletions()
+     *
+     * @param entities The entities to destroy
+     * @param transaction The transaction to use to synchronize access
+     * @return The number of entities that were destroyed. Entities still depended on are not
+     */
+    unsigned int destroyEntities(std::span<const Entity> entities,
+                                 const Transaction<tx::EntityRead>& transaction);
+
     /**
      * @brief Destroys all entities that have the given flags
      *
@@ -530,6 +566,7 @@ private:
     std::vector<std::uint16_t> entityVersions;
     std::vector<Flags> entityFlags;
     std::vector<std::uint8_t> entityWorlds;
+    std::vector<std::uint32_t> allocatedIds;
 
     // entity relationships
     ParentGraph parentGraph;
@@ -557,6 +594,8 @@ private:
         std::vector<Entity> toVisit;
         std::vector<Entity> toUnparent;
         std::vector<Entity> toRemove;
+        std::vector<Entity> batch;
+        std::vector<std::uint32_t> ids;
     } deletionState;
 
     template<typename T>
@@ -564,8 +603,10 @@ private:
 
     bool entityExistsLocked(Entity ent) const;
     void markEntityForRemoval(Entity ent);
-    void doEntityDestroyLocked(Entity ent);
     bool queueEntityDestroy(Entity ent);
+    void allocateEntitiesLocked(unsigned int worldIndex, Flags flags, std::size_t count,
+                                std::vector<Entity>& entities);
+    void finishBulkAdd(std::span<const Entity> entities, ComponentMask::SimpleMask mask);
 
     template<typename TRequire, typename TOptional, typename TExclude>
     void populateView(View<TRequire, TOptional, TExclude>& view);
@@ -603,6 +644,27 @@ namespace bl
 {
 namespace ecs
 {
+template<typename... TComponents>
+void Registry::createEntities(unsigned int worldIndex, Flags flags, std::size_t count,
+                              std::vector<Entity>& entities, const TComponents&... components) {
+    Transaction<tx::EntityWrite, tx::ComponentRead<>, tx::ComponentWrite<TComponents...>> tx(
+        *this);
+
+    const std::size_t first = entities.size();
+    allocateEntitiesLocked(worldIndex, flags, count, entities);
+    const std::span<const Entity> created(entities.data() + first, count);
+
+    ComponentMask::SimpleMask mask = ComponentMask::EmptyMask;
+    const auto addComponent        = [this, &created, &mask, &tx](const auto& component) {
+        using T    = std::decay_t<decltype(component)>;
+        auto& pool = getPool<T>();
+        pool.addMany(created, component, tx);
+        ComponentMask::add(mask, pool.ComponentIndex);
+    };
+    (addComponent(components), ...);
+    finishBulkAdd(created, mask);
+}
+
 template<typename T>
 T* Registry::addComponent(Entity ent, const T& val) {
     return addComponent<T>(
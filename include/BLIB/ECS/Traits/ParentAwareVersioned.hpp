@@ -57,12 +57,21 @@ public:
      *        state as well, including parent changes
      */
     bool refreshRequired() const {
+        if (localRefreshRequired()) { return true; }
+        return this->hasParent() && this->getParent().refreshRequired();
+    }
+
+    /**
+     * @brief Returns whether or not this component needs to be refreshed based only on its own
+     *        version and its direct parent. Does not recurse up the parent tree, so parents must be
+     *        refreshed before their children for the result to be accurate
+     */
+    bool localRefreshRequired() const {
         if (lastRefreshVersion != getVersion()) { return true; }
         if (this->hasParent()) {
             auto& parent = this->getParent();
             if (lastParent != &parent) { return true; }
-            if (parent.getVersion() != lastParentVersion) { return true; }
-            return parent.refreshRequired();
+            return parent.getVersion() != lastParentVersion;
         }
         return lastParent != nullptr;
     }
@@ -10,6 +10,7 @@
 #include <array>
 #include <limits>
 #include <queue>
+#include <span>
 #include <typeindex>
 #include <vector>
 
@@ -39,10 +40,12 @@ protected:
     : id(id)
     , mask(mask) {}
 
-    virtual void removeEntity(Entity entity)                   = 0;
-    virtual void nullEntityComponent(Entity entity, void* com) = 0;
-    virtual void tryAddEntity(Entity entity)                   = 0;
-    virtual void clearAndRefresh()                             = 0;
+    virtual void removeEntity(Entity entity)                      = 0;
+    virtual void removeEntities(std::span<const Entity> entities) = 0;
+    virtual void nullEntityComponent(Entity entity, void* com)    = 0;
+    virtual void tryAddEntity(Entity entity)                      = 0;
+    virtual void tryAddEntities(std::span<const Entity> entities) = 0;
+    virtual void clearAndRefresh()                                = 0;
 
     friend class bl::ecs::Registry;
 };
@@ -97,6 +97,11 @@ private:
         toRemove.emplace_back(entity);
     }
 
+    virtual void removeEntities(std::span<const Entity> entities) override {
+        std::unique_lock lock(queueLock);
+        toRemove.insert(toRemove.end(), entities.begin(), entities.end());
+    }
+
     virtual void nullEntityComponent(Entity entity, void* com) override {
         const std::uint64_t entIndex = entity.getIndex();
         if (entIndex < entityToIndex.size()) {
@@ -109,6 +114,11 @@ private:
         toAdd.emplace_back(entity);
     }
 
+    virtual void tryAddEntities(std::span<const Entity> entities) override {
+        std::unique_lock lock(queueLock);
+        toAdd.insert(toAdd.end(), entities.begin(), entities.end());
+    }
+
     virtual void clearAndRefresh() override {
         lockWrite();
         results.clear();
@@ -49,8 +49,12 @@ struct FrameStage {
         /// Synced stage for systems to copy data from engine systems to renderer buffers
         RendererDataSync = 6,
 
+        /// Transform hierarchies are resolved here, after all other systems have moved things and
+        /// before descriptor data is copied to the renderer
+        TransformPropagation = 7,
+
         /// The number of engine stages
-        COUNT = 7
+        COUNT = 8
     };
 };
 
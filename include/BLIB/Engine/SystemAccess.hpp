@@ -0,0 +1,104 @@
+#ifndef BLIB_ENGINE_SYSTEMACCESS_HPP
+#define BLIB_ENGINE_SYSTEMACCESS_HPP
+
+#include <BLIB/ECS/Transaction.hpp>
+#include <typeindex>
+#include <vector>
+
+namespace bl
+{
+namespace engine
+{
+/**
+ * @brief Declares the components that a system reads and writes. Systems with declared access are
+ *        scheduled by Systems as soon as every earlier system with conflicting access has finished,
+ *        regardless of frame stage. Systems without declared access keep the stage barrier
+ *
+ * @ingroup Engine
+ */
+class SystemAccess {
+public:
+    /**
+     * @brief Creates an undeclared access set
+     */
+    SystemAccess();
+
+    /**
+     * @brief Creates a declared access set from the transaction tags used by ecs::Transaction
+     *
+     * @tparam TAccess ecs::tx::ComponentRead and ecs::tx::ComponentWrite tags
+     * @return The declared access set
+     */
+    template<typename... TAccess>
+    static SystemAccess make();
+
+    /**
+     * @brief Returns whether the access set was declared
+     */
+    bool isDeclared() const;
+
+    /**
+     * @brief Returns whether the two access sets may not run at the same time. Undeclared access
+     *        sets conflict with everything. Reads only conflict with writes
+     *
+     * @param other The access set to check against
+     * @return True if the systems must be ordered, false if they may run in parallel
+     */
+    bool conflictsWith(const SystemAccess& other) const;
+
+    /**
+     * @brief Returns the components that are read, sorted
+     */
+    const std::vector<std::type_index>& getReads() const;
+
+    /**
+     * @brief Returns the components that are written, sorted
+     */
+    const std::vector<std::type_index>& getWrites() const;
+
+private:
+    bool declared;
+    std::vector<std::type_index> reads;
+    std::vector<std::type_index> writes;
+
+    template<typename T>
+    struct Adder;
+
+    template<typename... TComponents>
+    struct Adder<ecs::tx::ComponentRead<TComponents...>> {
+        static void add(SystemAccess& access) {
+            (access.reads.emplace_back(typeid(TComponents)), ...);
+        }
+    };
+
+    template<typename... TComponents>
+    struct Adder<ecs::tx::ComponentWrite<TComponents...>> {
+        static void add(SystemAccess& access) {
+            (access.writes.emplace_back(typeid(TComponents)), ...);
+        }
+    };
+
+    void finalize();
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+template<typename... TAccess>
+SystemAccess SystemAccess::make() {
+    SystemAccess access;
+    access.declared = true;
+    (Adder<TAccess>::add(access), ...);
+    access.finalize();
+    return access;
+}
+
+inline bool SystemAccess::isDeclared() const { return declared; }
+
+inline const std::vector<std::type_index>& SystemAccess::getReads() const { return reads; }
+
+inline const std::vector<std::type_index>& SystemAccess::getWrites() const { return writes; }
+
+} // namespace engine
+} // namespace bl
+
+#endif
@@ -4,8 +4,12 @@
 #include <BLIB/Engine/FrameStage.hpp>
 #include <BLIB/Engine/StateMask.hpp>
 #include <BLIB/Engine/System.hpp>
+#include <BLIB/Engine/SystemAccess.hpp>
 #include <BLIB/Logging.hpp>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
@@ -19,6 +23,10 @@ namespace bl
 {
 namespace engine
 {
+namespace unittest
+{
+struct SystemsTestAccess;
+}
 class Engine;
 
 /**
@@ -34,6 +42,19 @@ public:
     /// Signature of one-off tasks that can be registered to run
     using Task = std::function<void()>;
 
+    /**
+     * @brief Timing information for a single system
+     *
+     * @ingroup Engine
+     */
+    struct SystemTiming {
+        const char* name;
+        FrameStage::V stage;
+        std::chrono::nanoseconds lastUpdate;
+        std::chrono::nanoseconds totalUpdate;
+        std::uint64_t updateCount;
+    };
+
     /**
      * @brief Handle to a task submitted to Systems
      *
@@ -153,6 +174,37 @@ public:
     template<typename T>
     T* getSystemMaybe();
 
+    /**
+     * @brief Declares the components that a system reads and writes. Declared systems run as soon
+     *        as the earlier systems with conflicting access have finished, possibly overlapping
+     *        systems in other stages. Undeclared systems still wait for all earlier stages.
+     *        Declared systems run on the engine thread pool and must not block on work queued to
+     *        it. Undeclared systems that are alone in their stage run on the calling thread
+     *
+     * @tparam TSystem The type of system to declare access for. Must already be registered
+     * @tparam TAccess ecs::tx::ComponentRead and ecs::tx::ComponentWrite tags
+     */
+    template<typename TSystem, typename... TAccess>
+    void declareAccess();
+
+    /**
+     * @brief Populates the given vector with the timing of every system, ordered by stage. Call
+     *        from the main thread between frames
+     *
+     * @param report The vector to populate
+     */
+    void getTimingReport(std::vector<SystemTiming>& report) const;
+
+    /**
+     * @brief Logs the timing of every system, slowest first
+     */
+    void logTimingReport() const;
+
+    /**
+     * @brief Resets the accumulated system timings
+     */
+    void resetTimings();
+
     /**
      * @brief Adds a one-off task to be executed in the given frame stage along with the systems in
      *        that stage. Tasks should be thread safe. The task queue is drained once processed
@@ -165,11 +217,20 @@ public:
 private:
     struct SystemInstance {
         StateMask::V mask;
+        const char* name;
         std::unique_ptr<System> system;
+        SystemAccess access;
+        std::chrono::nanoseconds lastUpdate;
+        std::chrono::nanoseconds totalUpdate;
+        std::uint64_t updateCount;
 
-        SystemInstance(StateMask::V mask, std::unique_ptr<System>&& sys)
+        SystemInstance(StateMask::V mask, const char* name, std::unique_ptr<System>&& sys)
         : mask(mask)
-        , system(std::forward<std::unique_ptr<System>>(sys)) {}
+        , name(name)
+        , system(std::forward<std::unique_ptr<System>>(sys))
+        , lastUpdate(0)
+        , totalUpdate(0)
+        , updateCount(0) {}
     };
 
     struct TaskEntry {
@@ -199,14 +260,53 @@ private:
         void drainTasks();
     };
 
+    struct ScheduleNode {
+        std::uint32_t stage;
+        StageSet* set;
+        SystemInstance* system; // null for the frame tasks of the stage
+        std::uint32_t dependencyCount;
+        std::vector<std::uint32_t> dependents;
+        bool onCaller;
+    };
+
+    struct Schedule {
+        FrameStage::V startStage;
+        FrameStage::V endStage;
+        StateMask::V stateMask;
+        std::uint32_t taskStages; // bit per stage that had frame tasks queued
+        std::vector<ScheduleNode> nodes;
+    };
+
+    struct UpdateTimes {
+        float dt;
+        float realDt;
+        float lag;
+        float realLag;
+    };
+
     Engine& engine;
     std::array<StageSet, FrameStage::COUNT> systems;
     std::unordered_map<std::type_index, System*> typeMap;
     std::vector<System*> backgroundSystems;
     bool inited;
+    std::vector<Schedule> schedules;
+    Schedule* schedule;
+    std::unique_ptr<std::atomic_uint32_t[]> remaining;
+    std::uint32_t remainingCapacity;
+    std::mutex callerMutex;
+    std::condition_variable callerCv;
+    UpdateTimes times;
 
     Systems(Engine& engine);
     void init();
+    void setAccess(System* system, SystemAccess&& access);
+    void invalidateSchedules();
+    Schedule& getSchedule(FrameStage::V startStage, FrameStage::V endStage,
+                          StateMask::V stateMask);
+    void buildSchedule(Schedule& schedule);
+    void dispatch(std::uint32_t node);
+    std::uint32_t releaseDependents(std::uint32_t node, bool continueOnThread);
+    void runNode(std::uint32_t node);
     void notifyFrameStart();
     void update(FrameStage::V startStage, FrameStage::V endStage, StateMask::V stateMask, float dt,
                 float realDt, float lag, float realLag);
@@ -215,6 +315,7 @@ private:
     void cleanup();
 
     friend class Engine;
+    friend struct ::bl::engine::unittest::SystemsTestAccess;
 };
 
 //////////////////////////// INLINE FUNCTIONS /////////////////////////////////
@@ -235,9 +336,10 @@ T& Systems::registerSystem(FrameStage::V stage, StateMask::V stateMask, TArgs&&.
 #endif
 
     systems[stage].systems.emplace_back(
-        stateMask, std::move(std::make_unique<T>(std::forward<TArgs>(args)...)));
+        stateMask, typeid(T).name(), std::make_unique<T>(std::forward<TArgs>(args)...));
     System* s          = systems[stage].systems.back().system.get();
     typeMap[typeid(T)] = s;
+    invalidateSchedules();
     if (inited) { s->init(engine); }
     return static_cast<T&>(*s);
 }
@@ -270,6 +372,11 @@ T* Systems::getSystemMaybe() {
     return static_cast<T*>(it->second);
 }
 
+template<typename TSystem, typename... TAccess>
+void Systems::declareAccess() {
+    setAccess(&getSystem<TSystem>(), SystemAccess::make<TAccess...>());
+}
+
 } // namespace engine
 } // namespace bl
 
@@ -94,7 +94,7 @@ private:
     void processNode(engine::World& world, Tx& tx, std::uint32_t skinnedMaterialPipelineId,
                      std::uint32_t nonSkinnedMaterialPipelineId, com::Skeleton& skeleton,
                      const as::TypedRef<asi::ModelPayload>& model, const mdl::Node& node,
-                     ecs::Entity parentEntity);
+                     ecs::Entity parentEntity, std::uint32_t depth);
 
     virtual void onAdd(rc::Scene* scene, rc::UpdateSpeed updateFreq) override;
     virtual void onRemove() override;
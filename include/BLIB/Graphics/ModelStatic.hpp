@@ -9,13 +9,17 @@
 #include <BLIB/Graphics/Drawable.hpp>
 #include <BLIB/Models.hpp>
 #include <BLIB/Render/Config/MaterialPipelineIds.hpp>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace bl
 {
 namespace gfx
 {
 /**
- * @brief Drawable for static models with no skinning or animation
+ * @brief Drawable for static models with no skinning or animation. All models created from the
+ *        same asset share their mesh geometry on the GPU so that scenes may draw them instanced
  *
  * @ingroup Graphics
  */
@@ -61,8 +65,20 @@ private:
         com::BasicMesh* mesh;
     };
 
+    struct SharedMeshes {
+        as::TypedRef<asi::ModelPayload> model;
+        std::mutex mutex;
+        std::unordered_map<const mdl::Mesh*, std::shared_ptr<const com::BasicMesh>> meshes;
+    };
+
     ecs::Registry* ecs;
     std::vector<EntityNode> drawableEntities;
+    std::shared_ptr<SharedMeshes> sharedMeshes;
+
+    static std::shared_ptr<SharedMeshes> getSharedMeshes(
+        const as::TypedRef<asi::ModelPayload>& model);
+    std::shared_ptr<const com::BasicMesh> getSharedMesh(rc::Renderer& renderer,
+                                                        const mdl::Mesh& src);
 
     com::BasicMesh* createComponents(engine::World& world, Tx& tx, ecs::Entity entity,
                                      std::uint32_t materialPipelineId,
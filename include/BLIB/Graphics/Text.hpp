@@ -13,6 +13,7 @@
 #include <BLIB/Render/Color.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <initializer_list>
+#include <utility>
 #include <vector>
 
 namespace bl
@@ -254,10 +255,16 @@ private:
     std::vector<txt::BasicText> sections;
     WrapType wrapType;
     float wordWrapWidth;
+    float wrappedWidth;
+    std::vector<std::pair<sf::String, float>> prevWrap;
     engine::Systems::TaskHandle commitTask;
     mutable bool boundsComputedWhileDirty;
+    mutable glm::mat4 cachedGlobalTransform;
+    mutable glm::mat4 cachedInverseTransform;
 
     void queueCommit();
+    void syncPipeline();
+    float computeWrapWidth();
     void computeWordWrap();
     virtual void ensureLocalSizeUpdated() override;
     void computeBoundsIfNeeded() const;
@@ -11,6 +11,7 @@
 #include <SFML/System/String.hpp>
 #include <glm/glm.hpp>
 #include <string>
+#include <vector>
 
 namespace bl
 {
@@ -154,6 +155,14 @@ public:
     const sf::Glyph& getGlyph(as::TypedRef<asi::FontPayload> font, std::uint32_t code) const;
 
 private:
+    static constexpr std::uint32_t NotFound = static_cast<std::uint32_t>(-1);
+
+    struct Metrics {
+        const asi::FontPayload::AsciiTable* glyphs;
+        float letterSpacing;
+        float whitespaceWidth;
+    };
+
     bl::gfx::Text& owner;
     sf::String content;
     sf::String wordWrappedContent;
@@ -166,15 +175,27 @@ private:
     float lineSpacingFactor;
     float cachedLineHeight;
 
+    // cached layout. Rebuilt only when the content, style, or starting position changes
+    bool layoutDirty;
+    bool colorDirty;
     glm::vec2 cachedPos;
+    glm::vec2 cachedEndPos;
     sf::FloatRect cachedBounds;
-
-    std::uint32_t refreshVertices(as::TypedRef<asi::FontPayload> font, rc::prim::Vertex* vertices,
-                                  glm::vec2& cornerPos);
-    glm::vec2 advanceCharacterPos(as::TypedRef<asi::FontPayload> font, glm::vec2 pos,
-                                  std::uint32_t curChar, std::uint32_t prevChar) const;
+    std::vector<rc::prim::Vertex> outlineVertices;
+    std::vector<rc::prim::Vertex> fillVertices;
+    std::vector<glm::vec2> charPositions;
+
+    void markLayoutDirty();
+    Metrics computeMetrics(as::TypedRef<asi::FontPayload> font) const;
+    std::uint32_t refreshVertices(as::TypedRef<asi::FontPayload> font, glm::vec2& cornerPos);
+    std::uint32_t writeVertices(rc::prim::Vertex* vertices) const;
+    void layout(as::TypedRef<asi::FontPayload> font);
+    void recolor();
+    glm::vec2 advanceCharacterPos(const Metrics& metrics, glm::vec2 pos, std::uint32_t curChar,
+                                  std::uint32_t prevChar) const;
     const sf::FloatRect& getBounds() const;
-    glm::vec2 findCharacterPos(as::TypedRef<asi::FontPayload> font, unsigned int index) const;
+    glm::vec2 findCharacterPos(unsigned int index) const;
+    std::uint32_t findCharacterAt(const glm::vec2& position, float lineHeight) const;
 
     friend class bl::gfx::Text;
 };
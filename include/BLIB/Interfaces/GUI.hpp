@@ -37,6 +37,7 @@
 #include <BLIB/Interfaces/GUI/Elements/Slider.hpp>
 #include <BLIB/Interfaces/GUI/Elements/TextEntry.hpp>
 #include <BLIB/Interfaces/GUI/Elements/ToggleButton.hpp>
+#include <BLIB/Interfaces/GUI/Elements/VirtualList.hpp>
 #include <BLIB/Interfaces/GUI/Elements/Window.hpp>
 
 #include <BLIB/Interfaces/GUI/Dialogs/FilePicker.hpp>
@@ -4,8 +4,9 @@
 #include <BLIB/Interfaces/GUI/Elements/CompositeElement.hpp>
 #include <BLIB/Interfaces/GUI/Elements/Element.hpp>
 #include <BLIB/Interfaces/GUI/Elements/Label.hpp>
-#include <BLIB/Interfaces/GUI/Elements/ScrollArea.hpp>
+#include <BLIB/Interfaces/GUI/Elements/VirtualList.hpp>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace bl
@@ -13,7 +14,8 @@ namespace bl
 namespace gui
 {
 /**
- * @brief A scrollable element that packs labels and allows the selection of one
+ * @brief A scrollable element that lists text options and allows the selection of one. Labels are
+ *        only created for the options in view so very long option lists are cheap
  *
  * @ingroup GUI
  *
@@ -121,11 +123,14 @@ public:
     void setMaxSize(const sf::Vector2f& size);
 
 private:
-    ScrollArea::Ptr content;
-    std::vector<std::pair<Box::Ptr, Label::Ptr>> values;
+    VirtualList::Ptr content;
+    std::vector<std::string> values;
+    std::unordered_map<const Element*, Label::Ptr> rowLabels;
     unsigned int selected;
 
     SelectBox();
+    Element::Ptr createRow();
+    void bindRow(Element& row, std::size_t index);
 
     virtual bool propagateEvent(const Event& e) override;
     virtual void onAcquisition() override;
@@ -0,0 +1,191 @@
+#ifndef BLIB_GUI_ELEMENTS_VIRTUALLIST_HPP
+#define BLIB_GUI_ELEMENTS_VIRTUALLIST_HPP
+
+#include <BLIB/Interfaces/GUI/Elements/Box.hpp>
+#include <BLIB/Interfaces/GUI/Elements/Slider.hpp>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace bl
+{
+namespace gui
+{
+/**
+ * @brief Vertically scrolling list that only instantiates elements for the items that are in view.
+ *        Rows are created by a factory, bound to item indices by a callback, and recycled as the
+ *        list scrolls. The scroll extent is computed from the row height so that lists with many
+ *        thousands of items stay cheap to create, pack, and render. Do not pack elements into the
+ *        list directly
+ *
+ * @ingroup GUI
+ * @see SelectBox
+ */
+class VirtualList : public Box {
+public:
+    typedef std::shared_ptr<VirtualList> Ptr;
+
+    /// Creates a new row element. Called only when no recycled row is available
+    using RowFactory = std::function<Element::Ptr()>;
+
+    /// Populates the given row with the data of the item at the given index
+    using RowBinder = std::function<void(Element& row, std::size_t index)>;
+
+    /// Returned from getRowIndex() for elements that are not bound rows
+    static constexpr std::size_t NoIndex = static_cast<std::size_t>(-1);
+
+    virtual ~VirtualList() = default;
+
+    /**
+     * @brief Creates a new VirtualList
+     *
+     * @param factory Callback to create new rows
+     * @param binder Callback to bind rows to items
+     * @return The newly created list
+     */
+    static Ptr create(RowFactory&& factory, RowBinder&& binder);
+
+    /**
+     * @brief Sets the number of items in the list. Rebinds the visible rows
+     *
+     * @param count The number of items
+     */
+    void setItemCount(std::size_t count);
+
+    /**
+     * @brief Returns the number of items in the list
+     */
+    std::size_t getItemCount() const;
+
+    /**
+     * @brief Sets the height of each row. If not set the height is estimated from the requisitions
+     *        of the bound rows and re-measured when they change
+     *
+     * @param height The height of each row. 0 to estimate
+     */
+    void setItemHeight(float height);
+
+    /**
+     * @brief Sets the number of rows to keep bound above and below the visible region
+     *
+     * @param rows The number of extra rows on each side. Default is 2
+     */
+    void setOverscan(unsigned int rows);
+
+    /**
+     * @brief Set the maximum size the list can fill before scrolling is enabled
+     *
+     * @param size The maximum size. (0,0) to reset
+     */
+    void setMaxSize(const sf::Vector2f& size);
+
+    /**
+     * @brief Scrolls the list so that the given item is visible
+     *
+     * @param index The index of the item to show
+     */
+    void scrollToItem(std::size_t index);
+
+    /**
+     * @brief Rebinds every bound row. Call when item data changes
+     */
+    void refreshItems();
+
+    /**
+     * @brief Rebinds the row for the given item if it is bound
+     *
+     * @param index The index of the item that changed
+     */
+    void refreshItem(std::size_t index);
+
+    /**
+     * @brief Returns the item index bound to the given row or any of its descendants
+     *
+     * @param element The row or element within a row
+     * @return The index of the item, or NoIndex if the element is not in a bound row
+     */
+    std::size_t getRowIndex(const Element* element) const;
+
+    /**
+     * @brief Returns the number of row elements that have been created, bound or recycled
+     */
+    std::size_t getCreatedRowCount() const;
+
+protected:
+    /**
+     * @brief Creates the list
+     *
+     * @param factory Callback to create new rows
+     * @param binder Callback to bind rows to items
+     */
+    VirtualList(RowFactory&& factory, RowBinder&& binder);
+
+    /**
+     * @brief Returns the space required for the estimated height of all items, up to the max size
+     */
+    virtual sf::Vector2f minimumRequisition() const override;
+
+    /**
+     * @brief Binds and positions the rows in view
+     */
+    virtual void onAcquisition() override;
+
+    /**
+     * @brief Scrolls the list
+     *
+     * @param scroll The scroll event
+     * @return True if the scroll was consumed, false otherwise
+     */
+    virtual bool handleScroll(const Event& scroll) override;
+
+    /**
+     * @brief Creates the visual components of the rows and re-measures them
+     *
+     * @param renderer The renderer instance
+     */
+    virtual void prepareChildrenRender(rdr::Renderer& renderer) override;
+
+    /**
+     * @brief Re-measures the rows when one of them changes
+     *
+     * @param childRequester The child requesting to dirty this list
+     */
+    virtual void requestMakeDirty(const Element* childRequester) override;
+
+private:
+    struct Row {
+        Element::Ptr element;
+        std::size_t index;
+    };
+
+    const RowFactory factory;
+    const RowBinder binder;
+    Slider::Ptr scrollbar;
+    std::vector<Row> rows;
+    std::vector<Element::Ptr> freeRows;
+    std::size_t itemCount;
+    float itemHeight;
+    float estimatedHeight;
+    float rowWidth;
+    unsigned int overscan;
+    std::optional<sf::Vector2f> maxSize;
+    float offset;
+    bool binding;
+
+    float rowHeight() const;
+    float totalHeight() const;
+    float viewHeight() const;
+    void estimateHeight();
+    bool measureRows();
+    void remeasure();
+    Element::Ptr takeRow();
+    void bindRow(Element& row, std::size_t index);
+    void scrolled();
+    void updateScrollbar();
+    void layoutRows();
+};
+
+} // namespace gui
+} // namespace bl
+
+#endif
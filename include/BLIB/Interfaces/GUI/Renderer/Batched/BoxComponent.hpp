@@ -0,0 +1,53 @@
+#ifndef BLIB_GUI_RENDERER_BATCHED_BOXCOMPONENT_HPP
+#define BLIB_GUI_RENDERER_BATCHED_BOXCOMPONENT_HPP
+
+#include <BLIB/Interfaces/GUI/Renderer/BatchedComponent.hpp>
+
+namespace bl
+{
+namespace gui
+{
+/// Components that render into a shared QuadBatch
+namespace batcoms
+{
+/**
+ * @brief Batched component type for Box and GUI elements
+ *
+ * @ingroup GUI
+ */
+class BoxComponent : public rdr::BatchedComponent {
+public:
+    /**
+     * @brief Creates the component
+     */
+    BoxComponent();
+
+    /**
+     * @brief Destroys the component
+     */
+    virtual ~BoxComponent() = default;
+
+    /**
+     * @brief Updates the scissor of the anchor to match the view constraint of the Box
+     */
+    virtual void onElementUpdated() override;
+
+    /**
+     * @brief Rebuilds the quads with the new colors
+     */
+    virtual void onRenderSettingChange() override;
+
+protected:
+    /**
+     * @brief Adds the fill and outline quads of the box
+     *
+     * @param quads Vector to add quads to
+     */
+    virtual void buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) override;
+};
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
+
+#endif
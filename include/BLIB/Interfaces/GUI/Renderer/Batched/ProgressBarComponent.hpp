@@ -0,0 +1,52 @@
+#ifndef BLIB_GUI_RENDERER_BATCHED_PROGRESSBARCOMPONENT_HPP
+#define BLIB_GUI_RENDERER_BATCHED_PROGRESSBARCOMPONENT_HPP
+
+#include <BLIB/Interfaces/GUI/Renderer/BatchedComponent.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+/**
+ * @brief Batched component type for ProgressBar elements
+ *
+ * @ingroup GUI
+ */
+class ProgressBarComponent : public rdr::BatchedComponent {
+public:
+    /**
+     * @brief Creates the component
+     */
+    ProgressBarComponent();
+
+    /**
+     * @brief Destroys the component
+     */
+    virtual ~ProgressBarComponent() = default;
+
+    /**
+     * @brief Rebuilds the quads for the new progress
+     */
+    virtual void onElementUpdated() override;
+
+    /**
+     * @brief Rebuilds the quads with the new colors
+     */
+    virtual void onRenderSettingChange() override;
+
+protected:
+    /**
+     * @brief Adds the background and bar quads
+     *
+     * @param quads Vector to add quads to
+     */
+    virtual void buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) override;
+};
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
+
+#endif
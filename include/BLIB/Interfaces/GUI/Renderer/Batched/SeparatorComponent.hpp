@@ -0,0 +1,52 @@
+#ifndef BLIB_GUI_RENDERER_BATCHED_SEPARATORCOMPONENT_HPP
+#define BLIB_GUI_RENDERER_BATCHED_SEPARATORCOMPONENT_HPP
+
+#include <BLIB/Interfaces/GUI/Renderer/BatchedComponent.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+/**
+ * @brief Batched component type for Separator elements
+ *
+ * @ingroup GUI
+ */
+class SeparatorComponent : public rdr::BatchedComponent {
+public:
+    /**
+     * @brief Creates the component
+     */
+    SeparatorComponent();
+
+    /**
+     * @brief Destroys the component
+     */
+    virtual ~SeparatorComponent() = default;
+
+    /**
+     * @brief Rebuilds the separator quad
+     */
+    virtual void onElementUpdated() override;
+
+    /**
+     * @brief Rebuilds the quad with the new color
+     */
+    virtual void onRenderSettingChange() override;
+
+protected:
+    /**
+     * @brief Adds the separator quad
+     *
+     * @param quads Vector to add quads to
+     */
+    virtual void buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) override;
+};
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef BLIB_GUI_RENDERER_BATCHED_WINDOWCOMPONENT_HPP
+#define BLIB_GUI_RENDERER_BATCHED_WINDOWCOMPONENT_HPP
+
+#include <BLIB/Interfaces/GUI/Renderer/BatchedComponent.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+/**
+ * @brief Batched component type for Window elements. Each window owns the batch for its contents
+ *        so that overlapping windows keep their relative order
+ *
+ * @ingroup GUI
+ */
+class WindowComponent : public rdr::BatchedComponent {
+public:
+    /**
+     * @brief Creates the component
+     */
+    WindowComponent();
+
+    /**
+     * @brief Destroys the component
+     */
+    virtual ~WindowComponent() = default;
+
+    /**
+     * @brief Does nothing
+     */
+    virtual void onElementUpdated() override;
+
+    /**
+     * @brief Rebuilds the quads with the new colors
+     */
+    virtual void onRenderSettingChange() override;
+
+protected:
+    /**
+     * @brief Adds the background quads of the window
+     *
+     * @param quads Vector to add quads to
+     */
+    virtual void buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) override;
+
+    /**
+     * @brief Returns true. Windows always own a batch
+     */
+    virtual bool isBatchScope() const override;
+};
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
+
+#endif
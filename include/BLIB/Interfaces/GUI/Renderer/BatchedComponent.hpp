@@ -0,0 +1,138 @@
+#ifndef BLIB_GUI_RENDERER_BATCHEDCOMPONENT_HPP
+#define BLIB_GUI_RENDERER_BATCHEDCOMPONENT_HPP
+
+#include <BLIB/Graphics/Dummy2D.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/Component.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/QuadBatch.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace rdr
+{
+/**
+ * @brief Intermediate base class for components that render their geometry into a shared
+ *        QuadBatch instead of owning drawables. Each component only owns an undrawn anchor entity
+ *        for children to parent to. Quads are batched up to the nearest Window, the GUI, or the
+ *        nearest ancestor that is not batched, so each of those costs a single draw call
+ *
+ * @ingroup GUI
+ */
+class BatchedComponent : public Component {
+public:
+    /**
+     * @brief Destroys the component
+     */
+    virtual ~BatchedComponent() = default;
+
+    /**
+     * @brief Toggle the visibility of the UI component
+     *
+     * @param visible True to be rendered, false to hide
+     */
+    virtual void setVisible(bool visible) override;
+
+    /**
+     * @brief Returns the anchor entity that children parent themselves to
+     */
+    virtual ecs::Entity getEntity() const override;
+
+    /**
+     * @brief Sets the depth of the anchor and of the quads within the batch
+     *
+     * @param depth The depth to set to
+     */
+    virtual void assignDepth(float depth) override;
+
+protected:
+    /**
+     * @brief Calls the base Component constructor
+     *
+     * @param highlightState The highlight state to pass to Component()
+     */
+    BatchedComponent(Component::HighlightState highlightState);
+
+    /**
+     * @brief Derived classes should populate the quads to render, relative to the element position
+     *
+     * @param quads Vector to add quads to. Is empty when called
+     */
+    virtual void buildQuads(std::vector<QuadBatch::Quad>& quads) = 0;
+
+    /**
+     * @brief Returns whether this component owns a batch for itself and its descendants. Default
+     *        is true only for the root element of the GUI
+     */
+    virtual bool isBatchScope() const;
+
+    /**
+     * @brief Rebuilds and commits the quads. Call when anything used by buildQuads() changes
+     */
+    void rebuild();
+
+    /**
+     * @brief Helper to add a filled rectangle with an outline drawn inside its bounds
+     *
+     * @param quads The vector to add quads to
+     * @param rect The bounds of the rectangle
+     * @param fill The fill color
+     * @param outline The outline color
+     * @param thickness The thickness of the outline
+     */
+    static void addBox(std::vector<QuadBatch::Quad>& quads, const sf::FloatRect& rect,
+                       const sf::Color& fill, const sf::Color& outline, float thickness);
+
+    /**
+     * @brief Returns the anchor entity of this component
+     */
+    gfx::Dummy2D& getAnchor();
+
+    /**
+     * @brief Creates the anchor and joins the batch of this component
+     *
+     * @param world The world to create entities in
+     * @param renderer The GUI renderer instance
+     */
+    virtual void doCreate(engine::World& world, Renderer& renderer) override;
+
+    /**
+     * @brief Writes the quads into the batch
+     *
+     * @param overlay The scene to add to
+     */
+    virtual void doSceneAdd(rc::Overlay* overlay) override;
+
+    /**
+     * @brief Releases the quads from the batch
+     */
+    virtual void doSceneRemove() override;
+
+    /**
+     * @brief Resizes the anchor and rebuilds the quads
+     */
+    virtual void handleAcquisition() override;
+
+    /**
+     * @brief Moves the anchor and offsets the quads
+     */
+    virtual void handleMove() override;
+
+private:
+    engine::Engine* engine;
+    Renderer* renderer;
+    gfx::Dummy2D anchor;
+    QuadBatch::Handle handle;
+    std::vector<QuadBatch::Quad> quads;
+    const Element* scope;
+    bool visible;
+
+    void joinBatch();
+    void updatePlacement();
+};
+
+} // namespace rdr
+} // namespace gui
+} // namespace bl
+
+#endif
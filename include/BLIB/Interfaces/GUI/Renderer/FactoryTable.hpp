@@ -35,6 +35,19 @@ public:
      */
     static FactoryTable& getDefaultTable();
 
+    /**
+     * @brief Returns a global table that uses the batched components where available. GUIs created
+     *        with this table render boxes, windows, separators, and progress bars with one draw call
+     *        per window instead of one per element
+     */
+    static FactoryTable& getBatchedTable();
+
+    /**
+     * @brief Replaces the factories for Box, GUI, ProgressBar, Separator, and Window with the
+     *        batched components. Other element types are unaffected
+     */
+    void useBatchedComponents();
+
     /**
      * @brief Sets the callback to use to create flash providers
      *
@@ -0,0 +1,182 @@
+#ifndef BLIB_GUI_RENDERER_QUADBATCH_HPP
+#define BLIB_GUI_RENDERER_QUADBATCH_HPP
+
+#include <BLIB/ECS/Entity.hpp>
+#include <BLIB/Engine/Systems.hpp>
+#include <BLIB/Graphics/BatchedShapes2D.hpp>
+#include <BLIB/Render/Overlays/Overlay.hpp>
+#include <BLIB/Util/NonCopyable.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace bl
+{
+namespace engine
+{
+class Engine;
+class World;
+} // namespace engine
+
+namespace gui
+{
+namespace rdr
+{
+/**
+ * @brief Retained batch of axis aligned colored quads that is drawn with a single draw call. Used
+ *        by batched components to flatten the plain geometry of a Window or GUI into one scene
+ *        object. Each Handle owns a sub-range of the batch and rewrites only that range when it
+ *        changes
+ *
+ * @ingroup GUI
+ */
+class QuadBatch : private util::NonCopyable {
+public:
+    /**
+     * @brief A single solid colored rectangle
+     */
+    struct Quad {
+        sf::FloatRect rect;
+        sf::Color color;
+    };
+
+    /**
+     * @brief Handle to a set of quads within a batch. Quads are positioned relative to the owning
+     *        element and offset, clipped, and depth sorted into the space of the batch
+     */
+    class Handle : private util::NonCopyable {
+    public:
+        /**
+         * @brief Creates an unassigned handle
+         */
+        Handle();
+
+        /**
+         * @brief Releases the quads from the batch
+         */
+        ~Handle();
+
+        /**
+         * @brief Assigns this handle to the given batch. Releases any prior allocation
+         *
+         * @param batch The batch to write quads into
+         */
+        void assign(QuadBatch& batch);
+
+        /**
+         * @brief Returns whether the handle is assigned to a batch that is still alive
+         */
+        bool isAssigned() const;
+
+        /**
+         * @brief Sets the quads to render. Rects are relative to the offset
+         *
+         * @param quads The quads to render
+         */
+        void setQuads(const std::vector<Quad>& quads);
+
+        /**
+         * @brief Sets the offset of the quads within the batch
+         *
+         * @param offset The position of the owning element relative to the batch
+         */
+        void setOffset(const glm::vec2& offset);
+
+        /**
+         * @brief Sets the region in batch space that quads are clipped to
+         *
+         * @param clip The clipping rectangle
+         */
+        void setClip(const sf::FloatRect& clip);
+
+        /**
+         * @brief Removes the clipping rectangle
+         */
+        void clearClip();
+
+        /**
+         * @brief Sets the depth of the quads relative to the batch
+         *
+         * @param depth The depth of the quads
+         */
+        void setDepth(float depth);
+
+        /**
+         * @brief Hides or shows the quads without releasing them
+         *
+         * @param hidden True to hide, false to show
+         */
+        void setHidden(bool hidden);
+
+        /**
+         * @brief Writes the quads into the batch if anything changed since the last commit
+         */
+        void commit();
+
+        /**
+         * @brief Frees the quads from the batch and unassigns the handle
+         */
+        void release();
+
+    private:
+        QuadBatch* owner;
+        std::shared_ptr<bool> ownerAlive;
+        rc::buf::BatchIndexBuffer::AllocHandle alloc;
+        std::vector<Quad> quads;
+        glm::vec2 offset;
+        sf::FloatRect clip;
+        bool clipped;
+        float depth;
+        bool hidden;
+        bool dirty;
+
+        void write();
+    };
+
+    /**
+     * @brief Creates the batch entity and parents it to the given anchor
+     *
+     * @param world The world to create the batch in
+     * @param anchor The entity the batch is positioned relative to
+     */
+    QuadBatch(engine::World& world, ecs::Entity anchor);
+
+    /**
+     * @brief Destroys the batch
+     */
+    ~QuadBatch();
+
+    /**
+     * @brief Adds the batch to the given overlay
+     *
+     * @param overlay The overlay to render in
+     */
+    void addToScene(rc::Overlay* overlay);
+
+    /**
+     * @brief Removes the batch from its overlay
+     */
+    void removeFromScene();
+
+    /**
+     * @brief Returns the number of vertices in use by the batch
+     */
+    std::uint32_t vertexCount() const;
+
+private:
+    engine::Engine& engine;
+    gfx::BatchedShapes2D batch;
+    std::shared_ptr<bool> alive;
+    engine::Systems::TaskHandle commitHandle;
+
+    void queueCommit();
+    void commit();
+};
+
+} // namespace rdr
+} // namespace gui
+} // namespace bl
+
+#endif
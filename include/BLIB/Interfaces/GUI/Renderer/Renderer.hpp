@@ -2,6 +2,7 @@
 #define BLIB_GUI_RENDERER_RENDERER_HPP
 
 #include <BLIB/Interfaces/GUI/Renderer/FactoryTable.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/QuadBatch.hpp>
 #include <BLIB/Render/Overlays/Overlay.hpp>
 #include <unordered_map>
 
@@ -64,6 +65,16 @@ public:
      */
     void destroyComponent(const Element& owner);
 
+    /**
+     * @brief Returns the quad batch owned by the given scope element, creating it if required.
+     *        Batches are destroyed along with the component of their scope
+     *
+     * @param scope The element that owns the batch
+     * @param anchor The entity to parent the batch to if it is created
+     * @return The batch for the given scope
+     */
+    QuadBatch& getQuadBatch(const Element& scope, ecs::Entity anchor);
+
     /**
      * @brief Adds all current and future components to the given overlay
      *
@@ -136,6 +147,7 @@ private:
     GUI& gui;
     FactoryTable& factory;
     rc::Overlay* overlay;
+    std::unordered_map<const Element*, std::unique_ptr<QuadBatch>> batches;
     std::unordered_map<const Element*, Component::Ptr> components;
     std::shared_ptr<bool> alive;
 
@@ -11,9 +11,14 @@
 #include <BLIB/Particles/System.hpp>
 
 #include <BLIB/Particles/Affector.hpp>
+#include <BLIB/Particles/Affectors/ColorOverLifetimeAffector.hpp>
+#include <BLIB/Particles/Affectors/GravityAffector.hpp>
+#include <BLIB/Particles/Affectors/VelocityAffector.hpp>
+#include <BLIB/Particles/Compaction.hpp>
 #include <BLIB/Particles/DescriptorSetFactory.hpp>
 #include <BLIB/Particles/DescriptorSetInstance.hpp>
 #include <BLIB/Particles/Emitter.hpp>
+#include <BLIB/Particles/Kernels.hpp>
 #include <BLIB/Particles/Link.hpp>
 #include <BLIB/Particles/MetaUpdater.hpp>
 #include <BLIB/Particles/ParticleManager.hpp>
@@ -21,6 +26,7 @@
 #include <BLIB/Particles/ParticleSystem.hpp>
 #include <BLIB/Particles/Renderer.hpp>
 #include <BLIB/Particles/Sink.hpp>
+#include <BLIB/Particles/Sinks/BoundsSink.hpp>
 
 // Keep separate
 #include <BLIB/Particles/DescriptorSetFactory.inl>
@@ -0,0 +1,59 @@
+#ifndef BLIB_PARTICLES_AFFECTORS_COLOROVERLIFETIMEAFFECTOR_HPP
+#define BLIB_PARTICLES_AFFECTORS_COLOROVERLIFETIMEAFFECTOR_HPP
+
+#include <BLIB/Particles/Affector.hpp>
+#include <BLIB/Particles/Kernels.hpp>
+
+namespace bl
+{
+namespace pcl
+{
+/**
+ * @brief Built-in affector that ages particles and blends their color (including alpha) from a
+ *        start color to an end color over their lifetime
+ *
+ * @tparam T The particle type
+ * @tparam Color Pointer to the color member of the particle
+ * @tparam Age Pointer to the float member containing the elapsed lifetime in seconds
+ * @tparam Lifetime Pointer to the float member containing the total lifetime in seconds
+ * @ingroup Particles
+ */
+template<typename T, auto Color, auto Age, auto Lifetime>
+class ColorOverLifetimeAffector : public Affector<T> {
+public:
+    using TColor = kernel::MemberType<T, Color>;
+
+    /**
+     * @brief Creates the affector
+     *
+     * @param start The color of particles when they are created
+     * @param end The color of particles when their lifetime expires
+     */
+    ColorOverLifetimeAffector(const TColor& start, const TColor& end)
+    : start(start)
+    , end(end) {}
+
+    /**
+     * @brief Destroys the affector
+     */
+    virtual ~ColorOverLifetimeAffector() = default;
+
+    /**
+     * @brief Ages the particles and updates their colors
+     *
+     * @param proxy The proxy containing the particles to update
+     * @param dt Elapsed simulation time in seconds
+     */
+    virtual void update(typename Affector<T>::Proxy& proxy, float dt, float) override {
+        kernel::colorOverLifetime<Color, Age, Lifetime>(proxy.particles(), start, end, dt);
+    }
+
+private:
+    const TColor start;
+    const TColor end;
+};
+
+} // namespace pcl
+} // namespace bl
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef BLIB_PARTICLES_AFFECTORS_GRAVITYAFFECTOR_HPP
+#define BLIB_PARTICLES_AFFECTORS_GRAVITYAFFECTOR_HPP
+
+#include <BLIB/Particles/Affector.hpp>
+#include <BLIB/Particles/Kernels.hpp>
+
+namespace bl
+{
+namespace pcl
+{
+/**
+ * @brief Built-in affector that applies a constant acceleration to all particles
+ *
+ * @tparam T The particle type
+ * @tparam Velocity Pointer to the velocity member of the particle
+ * @ingroup Particles
+ */
+template<typename T, auto Velocity>
+class GravityAffector : public Affector<T> {
+public:
+    using TVec = kernel::MemberType<T, Velocity>;
+
+    /**
+     * @brief Creates the affector
+     *
+     * @param acceleration The acceleration to apply to all particles
+     */
+    GravityAffector(const TVec& acceleration)
+    : acceleration(acceleration) {}
+
+    /**
+     * @brief Destroys the affector
+     */
+    virtual ~GravityAffector() = default;
+
+    /**
+     * @brief Sets the acceleration to apply
+     *
+     * @param a The acceleration to apply to all particles
+     */
+    void setAcceleration(const TVec& a) { acceleration = a; }
+
+    /**
+     * @brief Applies the acceleration to the particles
+     *
+     * @param proxy The proxy containing the particles to update
+     * @param dt Elapsed simulation time in seconds
+     */
+    virtual void update(typename Affector<T>::Proxy& proxy, float dt, float) override {
+        kernel::accelerate<Velocity>(proxy.particles(), acceleration, dt);
+    }
+
+private:
+    TVec acceleration;
+};
+
+} // namespace pcl
+} // namespace bl
+
+#endif
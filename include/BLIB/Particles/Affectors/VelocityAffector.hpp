@@ -0,0 +1,41 @@
+#ifndef BLIB_PARTICLES_AFFECTORS_VELOCITYAFFECTOR_HPP
+#define BLIB_PARTICLES_AFFECTORS_VELOCITYAFFECTOR_HPP
+
+#include <BLIB/Particles/Affector.hpp>
+#include <BLIB/Particles/Kernels.hpp>
+
+namespace bl
+{
+namespace pcl
+{
+/**
+ * @brief Built-in affector that moves particles by their velocity
+ *
+ * @tparam T The particle type
+ * @tparam Position Pointer to the position member of the particle
+ * @tparam Velocity Pointer to the velocity member of the particle
+ * @ingroup Particles
+ */
+template<typename T, auto Position, auto Velocity>
+class VelocityAffector : public Affector<T> {
+public:
+    /**
+     * @brief Destroys the affector
+     */
+    virtual ~VelocityAffector() = default;
+
+    /**
+     * @brief Integrates particle velocities into their positions
+     *
+     * @param proxy The proxy containing the particles to update
+     * @param dt Elapsed simulation time in seconds
+     */
+    virtual void update(typename Affector<T>::Proxy& proxy, float dt, float) override {
+        kernel::integrateVelocity<Position, Velocity>(proxy.particles(), dt);
+    }
+};
+
+} // namespace pcl
+} // namespace bl
+
+#endif
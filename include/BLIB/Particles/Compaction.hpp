@@ -0,0 +1,60 @@
+#ifndef BLIB_PARTICLES_COMPACTION_HPP
+#define BLIB_PARTICLES_COMPACTION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bl
+{
+namespace pcl
+{
+namespace priv
+{
+/**
+ * @brief Removes the elements at the given indices while preserving the order of the remaining
+ *        elements. Runs in a single pass that only touches elements after the first removed index
+ *
+ * @tparam T The type of element to remove
+ * @param storage The vector to remove elements from
+ * @param sortedIndices Unique indices to remove, sorted in ascending order
+ */
+template<typename T>
+void eraseSortedIndices(std::vector<T>& storage, std::span<const std::size_t> sortedIndices) {
+    if (sortedIndices.empty()) { return; }
+
+    std::size_t write = sortedIndices.front();
+    std::size_t next  = 0;
+    for (std::size_t read = write; read < storage.size(); ++read) {
+        if (next < sortedIndices.size() && sortedIndices[next] == read) {
+            ++next;
+            continue;
+        }
+        storage[write++] = std::move(storage[read]);
+    }
+    storage.erase(storage.begin() + write, storage.end());
+}
+
+/**
+ * @brief Computes how many particles each task should process. Chunks are sized so that each
+ *        worker gets a few tasks for load balancing without making tiny tasks for small pools
+ *
+ * @param particleCount The number of particles to split up
+ * @param workerCount The number of workers in the thread pool
+ * @return The number of particles to process per task
+ */
+inline std::size_t computeChunkSize(std::size_t particleCount, std::size_t workerCount) {
+    constexpr std::size_t MinParticlesPerTask = 1024;
+    constexpr std::size_t TasksPerWorker      = 4;
+
+    const std::size_t taskCount = std::max<std::size_t>(workerCount, 1) * TasksPerWorker;
+    const std::size_t chunkSize = (particleCount + taskCount - 1) / taskCount;
+    return std::max(chunkSize, MinParticlesPerTask);
+}
+
+} // namespace priv
+} // namespace pcl
+} // namespace bl
+
+#endif
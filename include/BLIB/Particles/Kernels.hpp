@@ -0,0 +1,114 @@
+#ifndef BLIB_PARTICLES_KERNELS_HPP
+#define BLIB_PARTICLES_KERNELS_HPP
+
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace bl
+{
+namespace pcl
+{
+/// Tight, branch-free particle update loops used by the built-in affectors and sinks
+namespace kernel
+{
+/**
+ * @brief Helper to resolve the type of a particle member from a member pointer
+ *
+ * @tparam T The particle type
+ * @tparam Member Pointer to the member of T
+ */
+template<typename T, auto Member>
+using MemberType = std::remove_cvref_t<decltype(std::declval<T&>().*Member)>;
+
+/**
+ * @brief Adds a constant acceleration to the velocity of each particle
+ *
+ * @tparam Velocity Pointer to the velocity member of the particle
+ * @tparam T The particle type
+ * @param particles The particles to update
+ * @param acceleration The acceleration to apply
+ * @param dt Elapsed time in seconds
+ */
+template<auto Velocity, typename T>
+void accelerate(std::span<T> particles, const MemberType<T, Velocity>& acceleration, float dt) {
+    const MemberType<T, Velocity> delta = acceleration * dt;
+    T* p                                = particles.data();
+    const std::size_t n                 = particles.size();
+    for (std::size_t i = 0; i < n; ++i) { p[i].*Velocity += delta; }
+}
+
+/**
+ * @brief Integrates the velocity of each particle into its position
+ *
+ * @tparam Position Pointer to the position member of the particle
+ * @tparam Velocity Pointer to the velocity member of the particle
+ * @tparam T The particle type
+ * @param particles The particles to update
+ * @param dt Elapsed time in seconds
+ */
+template<auto Position, auto Velocity, typename T>
+void integrateVelocity(std::span<T> particles, float dt) {
+    T* p                = particles.data();
+    const std::size_t n = particles.size();
+    for (std::size_t i = 0; i < n; ++i) { p[i].*Position += p[i].*Velocity * dt; }
+}
+
+/**
+ * @brief Advances the age of each particle and interpolates its color between the start and end
+ *        colors based on how much of its lifetime has elapsed
+ *
+ * @tparam Color Pointer to the color member of the particle
+ * @tparam Age Pointer to the float member containing the elapsed lifetime in seconds
+ * @tparam Lifetime Pointer to the float member containing the total lifetime in seconds
+ * @tparam T The particle type
+ * @param particles The particles to update
+ * @param start The color at the start of the lifetime
+ * @param end The color at the end of the lifetime
+ * @param dt Elapsed time in seconds
+ */
+template<auto Color, auto Age, auto Lifetime, typename T>
+void colorOverLifetime(std::span<T> particles, const MemberType<T, Color>& start,
+                       const MemberType<T, Color>& end, float dt) {
+    const MemberType<T, Color> range = end - start;
+    T* p                             = particles.data();
+    const std::size_t n              = particles.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        p[i].*Age += dt;
+        const float t = std::clamp(p[i].*Age / std::max(p[i].*Lifetime, 0.0001f), 0.f, 1.f);
+        p[i].*Color   = start + range * t;
+    }
+}
+
+/**
+ * @brief Collects the particles whose position lies outside of the given bounds
+ *
+ * @tparam Position Pointer to the position member of the particle
+ * @tparam T The particle type
+ * @param particles The particles to test
+ * @param min The minimum corner of the bounds
+ * @param max The maximum corner of the bounds
+ * @param out Output buffer of at least particles.size() elements to write pointers to
+ * @return The number of particles written to the output buffer
+ */
+template<auto Position, typename T>
+std::size_t findOutOfBounds(std::span<T> particles, const MemberType<T, Position>& min,
+                            const MemberType<T, Position>& max, const T** out) {
+    T* p                = particles.data();
+    const std::size_t n = particles.size();
+    std::size_t count   = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& pos = p[i].*Position;
+        out[count]      = &p[i];
+        count += glm::any(glm::lessThan(pos, min)) || glm::any(glm::greaterThan(pos, max)) ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace kernel
+} // namespace pcl
+} // namespace bl
+
+#endif
@@ -2,6 +2,7 @@
 #define BLIB_PARTICLES_PARTICLEMANAGER_HPP
 
 #include <BLIB/Particles/Affector.hpp>
+#include <BLIB/Particles/Compaction.hpp>
 #include <BLIB/Particles/Emitter.hpp>
 #include <BLIB/Particles/GlobalParticleSystemInfo.hpp>
 #include <BLIB/Particles/MetaUpdater.hpp>
@@ -10,6 +11,7 @@
 #include <BLIB/Particles/Sink.hpp>
 #include <BLIB/Render/Scenes/CodeScene.hpp>
 #include <cmath>
+#include <functional>
 #include <iterator>
 #include <memory>
 
@@ -19,7 +21,10 @@ namespace pcl
 {
 /**
  * @brief Particle manager for a specific type of particle. Instances are owned by the
- *        ParticleSystem and should be obtained from there
+ *        ParticleSystem and should be obtained from there. Particles are stored as a contiguous
+ *        array of T that is compacted every frame and handed to the renderer as-is. A
+ *        structure-of-arrays storage mode is not provided; it would need a storage policy with
+ *        its own renderer upload path and is left as a follow-up
  *
  * @tparam T The type of particle to manage
  * @tparam TRenderer The type of renderer plugin to use
@@ -268,8 +273,6 @@ public:
     void draw(rc::scene::CodeScene::RenderContext& ctx);
 
 private:
-    static constexpr std::size_t ParticlesPerThread = 800;
-
     mutable std::mutex mutex;
     engine::World* world;
     TRenderer renderer;
@@ -289,6 +292,8 @@ private:
     std::vector<std::unique_ptr<TEmitter>> emitters;
     std::vector<std::unique_ptr<TSink>> sinks;
 
+    template<typename TTask>
+    void queueChunkedTasks(util::ThreadPool& pool, const TTask& task);
     void updateSink(std::size_t i, util::ThreadPool& pool, float dt, float realDt);
     void awaitSinkAndContinue(std::size_t i, util::ThreadPool& pool, float dt, float realDt);
     void updateEmittersAndAffectors(util::ThreadPool& pool, float dt, float realDt);
@@ -53,21 +53,26 @@ void ParticleManager<T>::update(util::ThreadPool& threadPool, float dt, float re
     else { updateEmittersAndAffectors(threadPool, dt, realDt); }
 }
 
+template<typename T>
+template<typename TTask>
+void ParticleManager<T>::queueChunkedTasks(util::ThreadPool& pool, const TTask& task) {
+    const std::size_t chunkSize = priv::computeChunkSize(particles.size(), pool.workerCount());
+    futures.reserve(particles.size() / chunkSize + 1);
+    for (std::size_t i = 0; i < particles.size(); i += chunkSize) {
+        const std::size_t len = std::min(particles.size() - i, chunkSize);
+        futures.emplace_back(
+            pool.queueTask([this, task, i, len]() { task(std::span<T>(&particles[i], len)); }));
+    }
+}
+
 template<typename T>
 void ParticleManager<T>::updateSink(std::size_t i, util::ThreadPool& pool, float dt, float realDt) {
     auto* sink = sinks[i].get();
-    auto it    = particles.begin();
 
     sinkProxy.reset(&particles.front());
-    futures.reserve(particles.size() / ParticlesPerThread + 1);
-    while (it != particles.end()) {
-        const std::size_t len =
-            std::min<std::size_t>(std::distance(it, particles.end()), ParticlesPerThread);
-        futures.emplace_back(pool.queueTask([this, it, len, sink, dt, realDt]() {
-            sink->update(sinkProxy, std::span<T>(&*it, len), dt, realDt);
-        }));
-        it += len;
-    }
+    queueChunkedTasks(pool, [this, sink, dt, realDt](std::span<T> chunk) {
+        sink->update(sinkProxy, chunk, dt, realDt);
+    });
 
     pool.queueTask([this, &pool, i, dt, realDt]() { awaitSinkAndContinue(i, pool, dt, realDt); });
 }
@@ -90,7 +95,8 @@ void ParticleManager<T>::awaitSinkAndContinue(std::size_t i, util::ThreadPool& p
 template<typename T>
 void ParticleManager<T>::updateEmittersAndAffectors(util::ThreadPool& threadPool, float dt,
                                                     float realDt) {
-    // run emitters to fill holes
+    // run emitters to fill holes. Lowest holes are filled first to minimize compaction
+    std::sort(freeList.begin(), freeList.end(), std::greater<std::size_t>());
     if (!emitters.empty()) {
         std::unique_lock lock(mutex);
         typename TEmitter::Proxy proxy(*this, particles, freeList);
@@ -105,34 +111,25 @@ void ParticleManager<T>::updateEmittersAndAffectors(util::ThreadPool& threadPool
         }
     }
 
-    // remove particles that did not get re-emitted
-    for (std::size_t i : freeList) {
-        if (particles.size() > 1 && i < particles.size() - 1) { particles[i] = particles.back(); }
-        particles.pop_back();
-    }
+    // remove particles that did not get re-emitted, keeping live particles contiguous and ordered
+    std::reverse(freeList.begin(), freeList.end());
+    priv::eraseSortedIndices<T>(particles, freeList);
     freeList.clear();
 
     // run affectors over all particles
     if (!affectors.empty()) {
         erasedAffectors.resize(affectors.size(), 0);
 
-        futures.reserve(particles.size() / ParticlesPerThread + 1);
-        auto it = particles.begin();
-        while (it != particles.end()) {
-            const std::size_t len =
-                std::min<std::size_t>(std::distance(it, particles.end()), ParticlesPerThread);
-            futures.emplace_back(threadPool.queueTask([this, it, len, dt, realDt]() {
-                typename TAffector::Proxy proxy(*this, std::span<T>(&*it, len));
-                unsigned int i = 0;
-                for (auto& affector : affectors) {
-                    affector->update(proxy, dt, realDt);
-                    erasedAffectors[i] = proxy.erased ? 1 : 0;
-                    proxy.reset();
-                    ++i;
-                }
-            }));
-            it += len;
-        }
+        queueChunkedTasks(threadPool, [this, dt, realDt](std::span<T> chunk) {
+            typename TAffector::Proxy proxy(*this, chunk);
+            unsigned int i = 0;
+            for (auto& affector : affectors) {
+                affector->update(proxy, dt, realDt);
+                erasedAffectors[i] = proxy.erased ? 1 : 0;
+                proxy.reset();
+                ++i;
+            }
+        });
 
         threadPool.queueTask([this]() { awaitEmittersAndAffectorsAndFinish(); });
     }
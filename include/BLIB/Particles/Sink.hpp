@@ -40,6 +40,23 @@ public:
             }
         }
 
+        /**
+         * @brief Destroys all of the given particles. Prefer this over destroying particles one at
+         *        a time as synchronization is only performed once
+         *
+         * @param particles The particles to destroy
+         */
+        void destroy(std::span<const T* const> particles) const {
+            std::unique_lock lock(mutex);
+            for (const T* particle : particles) {
+                const std::size_t i = particle - base;
+                if (!freed[i]) {
+                    freed[i] = true;
+                    freeList.emplace_back(i);
+                }
+            }
+        }
+
         /**
          * @brief Call to erase this sink
          */
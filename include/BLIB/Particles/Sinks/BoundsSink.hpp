@@ -0,0 +1,62 @@
+#ifndef BLIB_PARTICLES_SINKS_BOUNDSSINK_HPP
+#define BLIB_PARTICLES_SINKS_BOUNDSSINK_HPP
+
+#include <BLIB/Particles/Kernels.hpp>
+#include <BLIB/Particles/Sink.hpp>
+#include <vector>
+
+namespace bl
+{
+namespace pcl
+{
+/**
+ * @brief Built-in sink that destroys particles that leave an axis aligned bounding region
+ *
+ * @tparam T The particle type
+ * @tparam Position Pointer to the position member of the particle
+ * @ingroup Particles
+ */
+template<typename T, auto Position>
+class BoundsSink : public Sink<T> {
+public:
+    using TVec = kernel::MemberType<T, Position>;
+
+    /**
+     * @brief Creates the sink
+     *
+     * @param min The minimum corner of the region particles may exist in
+     * @param max The maximum corner of the region particles may exist in
+     */
+    BoundsSink(const TVec& min, const TVec& max)
+    : min(min)
+    , max(max) {}
+
+    /**
+     * @brief Destroys the sink
+     */
+    virtual ~BoundsSink() = default;
+
+    /**
+     * @brief Destroys all particles outside of the bounds
+     *
+     * @param proxy The proxy to destroy particles with
+     * @param particles The particles to test
+     */
+    virtual void update(typename Sink<T>::Proxy& proxy, std::span<T> particles, float,
+                        float) override {
+        thread_local std::vector<const T*> dead;
+        dead.resize(particles.size());
+        const std::size_t count =
+            kernel::findOutOfBounds<Position>(particles, min, max, dead.data());
+        if (count > 0) { proxy.destroy(std::span<const T* const>(dead.data(), count)); }
+    }
+
+private:
+    const TVec min;
+    const TVec max;
+};
+
+} // namespace pcl
+} // namespace bl
+
+#endif
@@ -1,7 +1,10 @@
 #ifndef BLIB_RENDER_BUFFERS_BATCHINDEXBUFFER_HPP
 #define BLIB_RENDER_BUFFERS_BATCHINDEXBUFFER_HPP
 
+#include <BLIB/Render/Buffers/DirtyRange.hpp>
 #include <BLIB/Render/Buffers/IndexBuffer.hpp>
+#include <BLIB/Util/OffsetAllocator.hpp>
+#include <algorithm>
 #include <list>
 #include <memory>
 
@@ -13,7 +16,9 @@ namespace buf
 {
 /**
  * @brief Wrapper around IndexBufferT that allows allocations to be made out of it. Intended use is
- *        for batching multiple simple renderables into a single draw call
+ *        for batching multiple simple renderables into a single draw call. Vertex and index ranges
+ *        are suballocated in constant time and never move. Released index ranges are filled with
+ *        degenerate triangles until reused
  *
  * @tparam T The vertex type to use
  * @ingroup Renderer
@@ -32,6 +37,8 @@ public:
         std::uint32_t vertexSize;
         std::uint32_t indexStart;
         std::uint32_t indexSize;
+        util::OffsetAllocator::Allocation vertexAlloc;
+        util::OffsetAllocator::Allocation indexAlloc;
     };
 
     /**
@@ -80,7 +87,8 @@ public:
         AllocHandle& operator=(AllocHandle&& move);
 
         /**
-         * @brief Triggers the underlying index buffer to transfer. Call when contents are modified
+         * @brief Triggers the underlying index buffer to transfer the vertices and indices of this
+         *        allocation. Call when contents are modified
          */
         void commit();
 
@@ -150,8 +158,8 @@ public:
                 std::uint32_t initialIndexCount);
 
     /**
-     * @brief Allocates the requested number of vertices and indices from the buffer. Invalidates
-     *        the draw parameters
+     * @brief Allocates the requested number of vertices and indices from the buffer. Existing
+     *        allocations do not move. Invalidates the draw parameters
      *
      * @param vertexCount The number of vertices to allocate
      * @param indexCount The number of indices to allocate
@@ -210,18 +218,22 @@ public:
     const IndexBufferT<T>& getIndexBuffer() const;
 
     /**
-     * @brief Manually commit the vertices to the GPU
+     * @brief Manually commit all of the vertices to the GPU
      */
     void commit();
 
 private:
     IndexBufferT<T> storage;
+    util::OffsetAllocator vertexAllocator;
+    util::OffsetAllocator indexAllocator;
     std::uint32_t usedVertices;
     std::uint32_t usedIndices;
     std::list<AllocInfo> allocations;
     std::shared_ptr<bool> alive;
 
     void release(typename std::list<AllocInfo>::iterator alloc);
+    void commitRange(const DirtyRange& vertices, const DirtyRange& indices);
+    void updateUsedRange();
 };
 
 /**
@@ -250,31 +262,44 @@ void BatchIndexBufferT<T>::create(Renderer& renderer, std::uint32_t initialVerte
                                   std::uint32_t initialIndexCount) {
     deferDestruction();
     storage.create(renderer, initialVertexCount, initialIndexCount);
+    vertexAllocator.reset(initialVertexCount);
+    indexAllocator.reset(initialIndexCount);
 }
 
 template<typename T>
 typename BatchIndexBufferT<T>::AllocHandle BatchIndexBufferT<T>::allocate(std::uint32_t reqv,
                                                                           std::uint32_t reqi) {
-    const bool needVertices = usedVertices + reqv > vertexCapacity();
-    const bool needIndices  = usedIndices + reqi > indexCapacity();
-    if (needVertices || needIndices) {
-        const std::uint32_t vc =
-            needVertices ? std::max(vertexCapacity() * 2, usedVertices + reqv) : vertexCapacity();
-        const std::uint32_t ic =
-            needIndices ? std::max(indexCapacity() * 2, usedIndices + reqi) : indexCapacity();
+    util::OffsetAllocator::Allocation va = vertexAllocator.allocate(reqv);
+    util::OffsetAllocator::Allocation ia = indexAllocator.allocate(reqi);
+    if (!va.isValid() || !ia.isValid()) {
+        const std::uint32_t vc = !va.isValid() ?
+                                     std::max(vertexCapacity() * 2, vertexCapacity() + reqv) :
+                                     vertexCapacity();
+        const std::uint32_t ic = !ia.isValid() ?
+                                     std::max(indexCapacity() * 2, indexCapacity() + reqi) :
+                                     indexCapacity();
         storage.ensureSize(vc, ic);
+        vertexAllocator.grow(vc);
+        indexAllocator.grow(ic);
+        if (!va.isValid()) { va = vertexAllocator.allocate(reqv); }
+        if (!ia.isValid()) { ia = indexAllocator.allocate(reqi); }
+
+        // resizing resets the write range to the full buffer
+        commitRange({0, vertexCapacity()}, {0, indexCapacity()});
     }
 
     auto it           = allocations.emplace(allocations.end(), AllocInfo{});
     AllocInfo& alloc  = *it;
-    alloc.indexStart  = usedIndices;
-    alloc.vertexStart = usedVertices;
+    alloc.indexStart  = ia.offset;
+    alloc.vertexStart = va.offset;
     alloc.vertexSize  = reqv;
     alloc.indexSize   = reqi;
+    alloc.vertexAlloc = va;
+    alloc.indexAlloc  = ia;
+    updateUsedRange();
 
-    usedVertices += reqv;
-    usedIndices += reqi;
-    storage.configureWriteRange(0, usedVertices, 0, usedIndices);
+    // contents are expected to be written this frame
+    commitRange({va.offset, reqv}, {ia.offset, reqi});
 
     return {*this, alive, it};
 }
@@ -286,6 +311,8 @@ void BatchIndexBufferT<T>::destroy() {
     usedIndices  = 0;
     usedVertices = 0;
     allocations.clear();
+    vertexAllocator.reset(0);
+    indexAllocator.reset(0);
     storage.destroy();
 }
 
@@ -296,6 +323,8 @@ void BatchIndexBufferT<T>::deferDestruction() {
     usedIndices  = 0;
     usedVertices = 0;
     allocations.clear();
+    vertexAllocator.reset(0);
+    indexAllocator.reset(0);
     storage.deferDestruction();
 }
 
@@ -345,40 +374,37 @@ template<typename T>
 void BatchIndexBufferT<T>::release(typename std::list<AllocInfo>::iterator it) {
     const AllocInfo alloc = *it;
     allocations.erase(it);
+    vertexAllocator.release(alloc.vertexAlloc);
+    indexAllocator.release(alloc.indexAlloc);
 
-    // copy vertices to the left
-    const auto vertexStartIt = storage.vertices().begin() + alloc.vertexStart;
-    const auto nextVertexIt  = vertexStartIt + alloc.vertexSize;
-    std::copy(nextVertexIt, storage.vertices().end(), vertexStartIt);
-
-    // copy indices to the left
+    // degenerate triangles draw nothing until the range is reused
     const auto indexStartIt = storage.indices().begin() + alloc.indexStart;
-    const auto nextIndexIt  = indexStartIt + alloc.indexSize;
-    std::copy(nextIndexIt, storage.indices().end(), indexStartIt);
-
-    // update indices of affected allocations
-    for (AllocInfo& a : allocations) {
-        if (a.vertexStart > alloc.vertexStart) { a.vertexStart -= alloc.vertexSize; }
-        if (a.indexStart > alloc.indexStart) { a.indexStart -= alloc.indexSize; }
-    }
+    std::fill(indexStartIt, indexStartIt + alloc.indexSize, 0);
 
-    // update values of affected indices
-    for (auto& i : storage.indices()) {
-        if (i >= alloc.vertexStart) { i -= alloc.vertexSize; }
-    }
-
-    // update metadata and commit
-    usedVertices -= alloc.vertexSize;
-    usedIndices -= alloc.indexSize;
-    storage.configureWriteRange(0, usedVertices, 0, usedIndices);
-    commit();
+    // ranges past the new draw range do not need to be uploaded
+    updateUsedRange();
+    if (alloc.indexStart < usedIndices) { commitRange({}, {alloc.indexStart, alloc.indexSize}); }
 }
 
 template<typename T>
 void BatchIndexBufferT<T>::commit() {
+    commitRange({0, usedVertices}, {0, usedIndices});
+}
+
+template<typename T>
+void BatchIndexBufferT<T>::commitRange(const DirtyRange& vertices, const DirtyRange& indices) {
+    // ranges accumulate until the queued transfer executes
     if (storage.queueTransfer(tfr::Transferable::SyncRequirement::Immediate)) {
         storage.insertBarrierBeforeWrite();
+        storage.configureWriteRange(vertices.start, vertices.size, indices.start, indices.size);
     }
+    else { storage.addWriteRange(vertices.start, vertices.size, indices.start, indices.size); }
+}
+
+template<typename T>
+void BatchIndexBufferT<T>::updateUsedRange() {
+    usedVertices = vertexAllocator.usedEnd();
+    usedIndices  = indexAllocator.usedEnd();
 }
 
 template<typename T>
@@ -447,7 +473,10 @@ typename BatchIndexBufferT<T>::AllocHandle& BatchIndexBufferT<T>::AllocHandle::o
 
 template<typename T>
 void BatchIndexBufferT<T>::AllocHandle::commit() {
-    if (isValid()) { owner->commit(); }
+    if (isValid()) {
+        owner->commitRange({alloc->vertexStart, alloc->vertexSize},
+                           {alloc->indexStart, alloc->indexSize});
+    }
 }
 
 template<typename T>
@@ -0,0 +1,162 @@
+#ifndef BLIB_RENDER_BUFFERS_DIRTYSET_HPP
+#define BLIB_RENDER_BUFFERS_DIRTYSET_HPP
+
+#include <BLIB/Render/Buffers/DirtyRange.hpp>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace buf
+{
+/**
+ * @brief Tracks individual dirty elements of a buffer. Unlike DirtyRange, sparse updates do not
+ *        widen into a single span covering every element in between. Dirty elements are emitted
+ *        as coalesced ranges where gaps of up to a configurable number of clean elements are
+ *        merged in order to trade a few redundant bytes for fewer copy regions
+ *
+ * @ingroup Renderer
+ */
+class DirtySet {
+public:
+    /// The default number of clean elements allowed between merged ranges
+    static constexpr std::uint32_t DefaultGapThreshold = 4;
+
+    /**
+     * @brief Creates an empty dirty set
+     *
+     * @param gapThreshold The maximum number of clean elements between merged ranges
+     */
+    DirtySet(std::uint32_t gapThreshold = DefaultGapThreshold);
+
+    /**
+     * @brief Marks the given elements as dirty
+     *
+     * @param i The first index of the dirty elements
+     * @param n The number of dirty elements
+     */
+    void markDirty(std::uint32_t i, std::uint32_t n = 1);
+
+    /**
+     * @brief Marks every element dirty in the given set as dirty in this set
+     *
+     * @param other The set to combine with
+     */
+    void markDirty(const DirtySet& other);
+
+    /**
+     * @brief Clears all dirty elements. Cost is proportional to the span of the dirty elements
+     */
+    void reset();
+
+    /**
+     * @brief Returns whether or not no elements are dirty
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns whether or not the given element is dirty
+     *
+     * @param i The index of the element to check
+     */
+    bool isDirty(std::uint32_t i) const;
+
+    /**
+     * @brief Returns the smallest single range containing every dirty element
+     */
+    DirtyRange getBounds() const;
+
+    /**
+     * @brief Returns the number of dirty elements
+     */
+    std::uint32_t dirtyCount() const;
+
+    /**
+     * @brief Sets the maximum number of clean elements between dirty ranges that get merged
+     *
+     * @param threshold The number of clean elements to allow. 0 only merges adjacent ranges
+     */
+    void setGapThreshold(std::uint32_t threshold);
+
+    /**
+     * @brief Returns the maximum number of clean elements between merged ranges
+     */
+    std::uint32_t getGapThreshold() const;
+
+    /**
+     * @brief Calls the given callback with each coalesced dirty range in ascending order
+     *
+     * @tparam TCallback Callback type with signature void(const DirtyRange&)
+     * @param callback The callback to invoke with each range
+     */
+    template<typename TCallback>
+    void forEachRange(TCallback&& callback) const;
+
+    /**
+     * @brief Returns the coalesced dirty ranges in ascending order
+     *
+     * @param result Vector to populate. Cleared first
+     */
+    void getRanges(std::vector<DirtyRange>& result) const;
+
+private:
+    static constexpr std::uint32_t WordBits = 64;
+
+    std::vector<std::uint64_t> words;
+    std::uint32_t first;
+    std::uint32_t last; // one past the final dirty element
+    std::uint32_t gapThreshold;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline bool DirtySet::empty() const { return first >= last; }
+
+inline bool DirtySet::isDirty(std::uint32_t i) const {
+    if (i < first || i >= last) { return false; }
+    return (words[i / WordBits] >> (i % WordBits)) & 0x1;
+}
+
+inline DirtyRange DirtySet::getBounds() const {
+    return empty() ? DirtyRange() : DirtyRange(first, last - first);
+}
+
+inline void DirtySet::setGapThreshold(std::uint32_t t) { gapThreshold = t; }
+
+inline std::uint32_t DirtySet::getGapThreshold() const { return gapThreshold; }
+
+template<typename TCallback>
+void DirtySet::forEachRange(TCallback&& callback) const {
+    if (empty()) { return; }
+
+    DirtyRange current;
+    const std::uint32_t wordEnd = (last + WordBits - 1) / WordBits;
+    for (std::uint32_t w = first / WordBits; w < wordEnd; ++w) {
+        std::uint64_t word = words[w];
+        while (word != 0) {
+            // extract the lowest run of set bits then clear it
+            const std::uint32_t offset = std::countr_zero(word);
+            const std::uint32_t length = std::countr_one(word >> offset);
+            const std::uint32_t start  = w * WordBits + offset;
+            word &= word + (word & (~word + 1));
+
+            if (current.size > 0 && start <= current.start + current.size + gapThreshold) {
+                current.size = start + length - current.start;
+            }
+            else {
+                if (current.size > 0) { callback(current); }
+                current = DirtyRange(start, length);
+            }
+        }
+    }
+    if (current.size > 0) { callback(current); }
+}
+
+} // namespace buf
+} // namespace rc
+} // namespace bl
+
+#endif
@@ -2,6 +2,7 @@
 #define BLIB_RENDER_BUFFERS_INDEXBUFFER_HPP
 
 #include <BLIB/Logging.hpp>
+#include <BLIB/Render/Buffers/DirtySet.hpp>
 #include <BLIB/Render/HeaderHelpers.hpp>
 #include <BLIB/Render/Primitives/DrawParameters.hpp>
 #include <BLIB/Render/Primitives/Vertex.hpp>
@@ -136,6 +137,18 @@ public:
     void configureWriteRange(std::uint32_t vertexWriteStart, std::uint32_t vertexWriteCount,
                              std::uint32_t indexWriteStart, std::uint32_t indexWriteCount);
 
+    /**
+     * @brief Adds vertices and indices to write on next transfer without replacing the configured
+     *        ranges. Disjoint ranges are copied with separate regions
+     *
+     * @param vertexWriteStart The first vertex to write
+     * @param vertexWriteCount The number of vertices to write
+     * @param indexWriteStart The first index to write
+     * @param indexWriteCount The number of indices to write
+     */
+    void addWriteRange(std::uint32_t vertexWriteStart, std::uint32_t vertexWriteCount,
+                       std::uint32_t indexWriteStart, std::uint32_t indexWriteCount);
+
     /**
      * @brief Issues the commands to bind the index and vertex buffers
      *
@@ -162,12 +175,14 @@ private:
     std::vector<std::uint32_t> cpuIndexBuffer;
     vk::Buffer gpuVertexBuffer;
     vk::Buffer gpuIndexBuffer;
-    std::uint32_t vertexWriteStart;
-    std::uint32_t vertexWriteCount;
-    std::uint32_t indexWriteStart;
-    std::uint32_t indexWriteCount;
+    DirtySet vertexWrites;
+    DirtySet indexWrites;
+    std::vector<VkBufferCopy> copyRegions;
 
     void createCommon(Renderer& renderer, std::uint32_t vc, std::uint32_t ic);
+    void stageWrites(VkCommandBuffer commandBuffer, tfr::TransferContext& context,
+                     const DirtySet& writes, const void* src, std::uint32_t elementSize,
+                     VkBuffer dst, VkAccessFlags dstAccess);
     virtual void executeTransfer(VkCommandBuffer commandBuffer,
                                  tfr::TransferContext& context) override;
 };
@@ -270,16 +285,16 @@ bool IndexBufferT<T>::ensureSize(std::uint32_t vertexCount, std::uint32_t indexC
     if (vertexCount > cpuVertexBuffer.size()) {
         cpuVertexBuffer.resize(vertexCount);
         gpuVertexBuffer.ensureSize(vertexCount * sizeof(T));
-        vertexWriteStart = 0;
-        vertexWriteCount = vertexCount;
-        r                = true;
+        vertexWrites.reset();
+        vertexWrites.markDirty(0, vertexCount);
+        r = true;
     }
     if (indexCount > cpuIndexBuffer.size()) {
         cpuIndexBuffer.resize(indexCount);
         gpuIndexBuffer.ensureSize(indexCount * sizeof(IndexType));
-        indexWriteStart = 0;
-        indexWriteCount = indexCount;
-        r               = true;
+        indexWrites.reset();
+        indexWrites.markDirty(0, indexCount);
+        r = true;
     }
     return r;
 }
@@ -287,10 +302,17 @@ bool IndexBufferT<T>::ensureSize(std::uint32_t vertexCount, std::uint32_t indexC
 template<typename T>
 void IndexBufferT<T>::configureWriteRange(std::uint32_t vs, std::uint32_t vc, std::uint32_t is,
                                           std::uint32_t ic) {
-    vertexWriteStart = vs;
-    vertexWriteCount = vc;
-    indexWriteStart  = is;
-    indexWriteCount  = ic;
+    vertexWrites.reset();
+    vertexWrites.markDirty(vs, vc);
+    indexWrites.reset();
+    indexWrites.markDirty(is, ic);
+}
+
+template<typename T>
+void IndexBufferT<T>::addWriteRange(std::uint32_t vs, std::uint32_t vc, std::uint32_t is,
+                                    std::uint32_t ic) {
+    vertexWrites.markDirty(vs, vc);
+    indexWrites.markDirty(is, ic);
 }
 
 template<typename T>
@@ -329,66 +351,87 @@ void IndexBufferT<T>::createCommon(Renderer& renderer, std::uint32_t vc, std::ui
                           VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
                               VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                           0);
-    vertexWriteStart = 0;
-    vertexWriteCount = vc;
-    indexWriteStart  = 0;
-    indexWriteCount  = ic;
+    vertexWrites.reset();
+    vertexWrites.markDirty(0, vc);
+    indexWrites.reset();
+    indexWrites.markDirty(0, ic);
 }
 
 template<typename T>
 void IndexBufferT<T>::executeTransfer(VkCommandBuffer commandBuffer,
                                       tfr::TransferContext& context) {
-    VkBuffer stagingBuf;
-    void* stagingMem;
-    VkBufferCopy copyCmd{};
-    VkBufferMemoryBarrier barrier{};
-
     // vertex buffer
-    if (vertexWriteStart + vertexWriteCount <= cpuVertexBuffer.size() && !cpuVertexBuffer.empty()) {
-        const VkDeviceSize vertexOffset = vertexWriteStart * sizeof(T);
-        const VkDeviceSize vertexSize   = vertexWriteCount * sizeof(T);
-
-        if (vertexSize > 0) {
-            context.createTemporaryStagingBuffer(vertexSize, stagingBuf, &stagingMem);
-            std::memcpy(stagingMem, &cpuVertexBuffer[vertexWriteStart], vertexSize);
-
-            copyCmd.srcOffset = 0;
-            copyCmd.dstOffset = vertexOffset;
-            copyCmd.size      = vertexSize;
-            vkCmdCopyBuffer(commandBuffer, stagingBuf, gpuVertexBuffer.getBuffer(), 1, &copyCmd);
-
-            barrier.sType         = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-            barrier.buffer        = gpuVertexBuffer.getBuffer();
-            barrier.offset        = vertexOffset;
-            barrier.size          = vertexSize;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
-            context.registerBufferBarrier(barrier);
-        }
+    const DirtyRange vertexBounds = vertexWrites.getBounds();
+    if (vertexBounds.start + vertexBounds.size <= cpuVertexBuffer.size() &&
+        !cpuVertexBuffer.empty()) {
+        stageWrites(commandBuffer,
+                    context,
+                    vertexWrites,
+                    cpuVertexBuffer.data(),
+                    sizeof(T),
+                    gpuVertexBuffer.getBuffer(),
+                    VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
     }
     else { BL_LOG_WARN << "Invalid vertex buffer write, skipping"; }
 
     // index buffer
-    if (indexWriteStart + indexWriteCount <= cpuIndexBuffer.size() && !cpuIndexBuffer.empty()) {
-        const VkDeviceSize indexOffset = indexWriteStart * sizeof(IndexType);
-        const VkDeviceSize indexSize   = indexWriteCount * sizeof(IndexType);
-
-        if (indexSize > 0) {
-            context.createTemporaryStagingBuffer(indexSize, stagingBuf, &stagingMem);
-            std::memcpy(stagingMem, &cpuIndexBuffer[indexWriteStart], indexSize);
-
-            copyCmd.size      = indexSize;
-            copyCmd.dstOffset = indexOffset;
-            vkCmdCopyBuffer(commandBuffer, stagingBuf, gpuIndexBuffer.getBuffer(), 1, &copyCmd);
-
-            barrier.buffer = gpuIndexBuffer.getBuffer();
-            barrier.size   = indexSize;
-            context.registerBufferBarrier(barrier);
-        }
+    const DirtyRange indexBounds = indexWrites.getBounds();
+    if (indexBounds.start + indexBounds.size <= cpuIndexBuffer.size() && !cpuIndexBuffer.empty()) {
+        stageWrites(commandBuffer,
+                    context,
+                    indexWrites,
+                    cpuIndexBuffer.data(),
+                    sizeof(IndexType),
+                    gpuIndexBuffer.getBuffer(),
+                    VK_ACCESS_INDEX_READ_BIT);
     }
     else { BL_LOG_WARN << "Invalid index buffer write, skipping"; }
 }
 
+template<typename T>
+void IndexBufferT<T>::stageWrites(VkCommandBuffer commandBuffer, tfr::TransferContext& context,
+                                  const DirtySet& writes, const void* src,
+                                  std::uint32_t elementSize, VkBuffer dst,
+                                  VkAccessFlags dstAccess) {
+    if (writes.empty()) { return; }
+
+    VkDeviceSize stagingSize = 0;
+    copyRegions.clear();
+    writes.forEachRange([this, &stagingSize, elementSize](const DirtyRange& range) {
+        VkBufferCopy& region = copyRegions.emplace_back();
+        region.srcOffset     = stagingSize;
+        region.dstOffset     = range.start * elementSize;
+        region.size          = range.size * elementSize;
+        stagingSize += region.size;
+    });
+
+    VkBuffer stagingBuf;
+    VkDeviceSize stagingOffset;
+    void* stagingMem;
+    context.createTemporaryStagingBuffer(stagingSize, stagingBuf, stagingOffset, &stagingMem);
+    for (VkBufferCopy& region : copyRegions) {
+        std::memcpy(static_cast<char*>(stagingMem) + region.srcOffset,
+                    static_cast<const char*>(src) + region.dstOffset,
+                    region.size);
+        region.srcOffset += stagingOffset;
+    }
+    vkCmdCopyBuffer(commandBuffer,
+                    stagingBuf,
+                    dst,
+                    static_cast<std::uint32_t>(copyRegions.size()),
+                    copyRegions.data());
+
+    const DirtyRange bounds = writes.getBounds();
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType         = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.buffer        = dst;
+    barrier.offset        = bounds.start * elementSize;
+    barrier.size          = bounds.size * elementSize;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = dstAccess;
+    context.registerBufferBarrier(barrier);
+}
+
 template<typename T>
 void IndexBufferT<T>::insertBarrierBeforeWrite() {
     gpuVertexBuffer.insertPipelineBarrierBeforeChange();
@@ -3,7 +3,7 @@
 
 #include <BLIB/Logging.hpp>
 #include <BLIB/Render/Buffers/Alignment.hpp>
-#include <BLIB/Render/Buffers/DirtyRange.hpp>
+#include <BLIB/Render/Buffers/DirtySet.hpp>
 #include <BLIB/Render/Config/Limits.hpp>
 #include <BLIB/Render/HeaderHelpers.hpp>
 #include <BLIB/Render/Transfers/Transferable.hpp>
@@ -14,6 +14,8 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 namespace bl
 {
@@ -45,8 +47,8 @@ public:
      */
     BindableBuffer()
     : alignment(sizeof(T))
-    , dirtyRanges{}
-    , currentDirtyRange(0)
+    , dirtySets{}
+    , currentDirtySet(0)
     , copyFullRange(false) {}
 
     /**
@@ -146,14 +148,39 @@ public:
      * @param n The number of elements to mark dirty
      */
     void markDirty(std::uint32_t i, std::uint32_t n = 1) {
-        dirtyRanges[currentDirtyRange].markDirty(i, n);
+        dirtySets[currentDirtySet].markDirty(i, n);
         queueTransfer();
     }
 
+    /**
+     * @brief Marks every element in the given set dirty
+     *
+     * @param dirty The set of dirty elements
+     */
+    void markDirty(const DirtySet& dirty) {
+        if (!dirty.empty()) {
+            dirtySets[currentDirtySet].markDirty(dirty);
+            queueTransfer();
+        }
+    }
+
     /**
      * @brief Marks the entire buffer as dirty
      */
-    void markFullDirty() { dirtyRanges.fill(DirtyRange(0, getSize())); }
+    void markFullDirty() {
+        for (DirtySet& set : dirtySets) { set.markDirty(0, getSize()); }
+    }
+
+    /**
+     * @brief Sets the maximum number of clean elements between dirty elements that are merged
+     *        into a single copy region. Larger values trade redundant bytes for fewer regions
+     *
+     * @param threshold The number of clean elements to allow between merged ranges
+     */
+    void setDirtyGapThreshold(std::uint32_t threshold) {
+        for (DirtySet& set : dirtySets) { set.setGapThreshold(threshold); }
+        accumulatedSet.setGapThreshold(threshold);
+    }
 
     /**
      * @brief Sets whether to always copy the entire buffer on transfer. Default is false. When
@@ -196,35 +223,110 @@ protected:
     }
 
     /**
-     * @brief Returns the range of elements marked dirty in the current frame
+     * @brief Returns the bounds of the elements marked dirty in the current frame
      */
     DirtyRange getCurrentDirtyRange() const {
-        return copyFullRange ? DirtyRange{0, getSize()} : dirtyRanges[currentDirtyRange];
+        return copyFullRange ? DirtyRange{0, getSize()} : dirtySets[currentDirtySet].getBounds();
     }
 
     /**
-     * @brief Returns the total range of elements marked dirty for all frames in flight
+     * @brief Returns the bounds of the elements marked dirty for all frames in flight
      */
     DirtyRange getAccumulatedDirtyRange() const {
         if (copyFullRange) { return {0, getSize()}; }
 
         DirtyRange accum;
-        for (const auto& r : dirtyRanges) { accum.combine(r); }
+        for (const auto& set : dirtySets) { accum.combine(set.getBounds()); }
         return accum;
     }
 
+    /**
+     * @brief Returns the set of elements marked dirty in the current frame
+     */
+    const DirtySet& getCurrentDirtySet() {
+        if (!copyFullRange) { return dirtySets[currentDirtySet]; }
+        accumulatedSet.reset();
+        accumulatedSet.markDirty(0, getSize());
+        return accumulatedSet;
+    }
+
+    /**
+     * @brief Returns the union of the elements marked dirty for all frames in flight
+     */
+    const DirtySet& getAccumulatedDirtySet() {
+        accumulatedSet.reset();
+        if (copyFullRange) { accumulatedSet.markDirty(0, getSize()); }
+        else {
+            for (const auto& set : dirtySets) { accumulatedSet.markDirty(set); }
+        }
+        return accumulatedSet;
+    }
+
+    /**
+     * @brief Copies the dirty ranges of the source into a single staging buffer and records one
+     *        copy command with a region per range into the destination buffer
+     *
+     * @param dirty The dirty elements to copy
+     * @param source Pointer to the first element of the aligned host side source data
+     * @param dst The buffer to copy into
+     * @param commandBuffer The command buffer to record into
+     * @param context The transfer context
+     */
+    void stageDirtyRanges(const DirtySet& dirty, const void* source, VkBuffer dst,
+                          VkCommandBuffer commandBuffer, tfr::TransferContext& context) {
+        if (dirty.empty()) { return; }
+
+        VkDeviceSize copySize = 0;
+        copyRegions.clear();
+        dirty.forEachRange([this, &copySize](const DirtyRange& range) {
+            VkBufferCopy& region = copyRegions.emplace_back();
+            region.srcOffset     = copySize;
+            region.dstOffset     = range.start * getAlignedElementSize();
+            region.size          = range.size * getAlignedElementSize();
+            copySize += region.size;
+        });
+
+        VkBuffer stagingBuffer;
+        VkDeviceSize stagingOffset;
+        void* stagingMem;
+        context.createTemporaryStagingBuffer(copySize, stagingBuffer, stagingOffset, &stagingMem);
+        for (VkBufferCopy& region : copyRegions) {
+            std::memcpy(static_cast<char*>(stagingMem) + region.srcOffset,
+                        static_cast<const char*>(source) + region.dstOffset,
+                        region.size);
+            region.srcOffset += stagingOffset;
+        }
+        vkCmdCopyBuffer(commandBuffer,
+                        stagingBuffer,
+                        dst,
+                        static_cast<std::uint32_t>(copyRegions.size()),
+                        copyRegions.data());
+
+        const DirtyRange bounds = dirty.getBounds();
+        VkBufferMemoryBarrier bufBarrier{};
+        bufBarrier.sType         = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        bufBarrier.buffer        = dst;
+        bufBarrier.offset        = bounds.start * getAlignedElementSize();
+        bufBarrier.size          = bounds.size * getAlignedElementSize();
+        context.registerBufferBarrier(bufBarrier);
+    }
+
     /**
      * @brief Call after performing a transfer of a dirty range
      */
     void markClean() {
-        currentDirtyRange              = (currentDirtyRange + 1) % dirtyRanges.size();
-        dirtyRanges[currentDirtyRange] = DirtyRange();
+        currentDirtySet = (currentDirtySet + 1) % dirtySets.size();
+        dirtySets[currentDirtySet].reset();
     }
 
 private:
     std::uint32_t alignment;
-    std::array<DirtyRange, cfg::Limits::MaxConcurrentFrames> dirtyRanges;
-    std::uint32_t currentDirtyRange;
+    std::array<DirtySet, cfg::Limits::MaxConcurrentFrames> dirtySets;
+    std::uint32_t currentDirtySet;
+    DirtySet accumulatedSet;
+    std::vector<VkBufferCopy> copyRegions;
     bool copyFullRange;
 };
 
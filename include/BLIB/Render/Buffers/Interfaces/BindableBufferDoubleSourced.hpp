@@ -102,48 +102,25 @@ protected:
     }
 
     /**
-     * @brief Transfers the accumulated dirty range to the current buffer. Creates a staging buffer
-     *        if the data cannot be directly written
+     * @brief Transfers the accumulated dirty ranges to the current buffer. Creates a single staging
+     *        buffer with one copy region per range if the data cannot be directly written
      *
      * @param commandBuffer The command buffer to record into
      * @param context The transfer context
      */
     virtual void executeTransfer(VkCommandBuffer commandBuffer,
                                  tfr::TransferContext& context) override {
+        const DirtySet& dirty = this->getAccumulatedDirtySet();
         if (this->isDirectWritable()) {
-            const DirtyRange range = this->getAccumulatedDirtyRange();
-            if (range.size > 0) {
+            dirty.forEachRange([this](const DirtyRange& range) {
                 this->writeDirect(&sourceBuffer[range.start], range.size, range.start);
-            }
-            this->markClean();
+            });
         }
-        else {
-            const DirtyRange range = this->getAccumulatedDirtyRange();
-            if (range.size > 0) {
-                const VkDeviceSize copySize = range.size * this->getAlignedElementSize();
-                VkBuffer stagingBuffer;
-                void* stagingMem;
-                context.createTemporaryStagingBuffer(copySize, stagingBuffer, &stagingMem);
-                std::memcpy(stagingMem, &sourceBuffer[range.start], copySize);
-
-                VkBufferCopy copyCmd{};
-                copyCmd.dstOffset = range.start * this->getAlignedElementSize();
-                copyCmd.size      = copySize;
-                copyCmd.srcOffset = 0;
-                vkCmdCopyBuffer(
-                    commandBuffer, stagingBuffer, this->getCurrentFrameRawBuffer(), 1, &copyCmd);
-
-                VkBufferMemoryBarrier bufBarrier{};
-                bufBarrier.sType         = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-                bufBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                bufBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-                bufBarrier.buffer        = this->getCurrentFrameRawBuffer();
-                bufBarrier.offset        = copyCmd.dstOffset;
-                bufBarrier.size          = copyCmd.size;
-                context.registerBufferBarrier(bufBarrier);
-            }
-            this->markClean();
+        else if (!dirty.empty()) {
+            this->stageDirtyRanges(
+                dirty, &sourceBuffer[0], this->getCurrentFrameRawBuffer(), commandBuffer, context);
         }
+        this->markClean();
     }
 };
 
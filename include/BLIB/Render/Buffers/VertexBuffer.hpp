@@ -165,12 +165,14 @@ void VertexBufferT<T>::executeTransfer(VkCommandBuffer commandBuffer,
                                        tfr::TransferContext& context) {
     // vertex buffer
     VkBuffer stagingBuf;
+    VkDeviceSize stagingOffset;
     void* stagingMem;
-    context.createTemporaryStagingBuffer(gpuVertexBuffer.getSize(), stagingBuf, &stagingMem);
+    context.createTemporaryStagingBuffer(
+        gpuVertexBuffer.getSize(), stagingBuf, stagingOffset, &stagingMem);
     std::memcpy(stagingMem, cpuVertexBuffer.data(), gpuVertexBuffer.getSize());
 
     VkBufferCopy copyCmd{};
-    copyCmd.srcOffset = 0;
+    copyCmd.srcOffset = stagingOffset;
     copyCmd.dstOffset = 0;
     copyCmd.size      = gpuVertexBuffer.getSize();
     vkCmdCopyBuffer(commandBuffer, stagingBuf, gpuVertexBuffer.getBuffer(), 1, &copyCmd);
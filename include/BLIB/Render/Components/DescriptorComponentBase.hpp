@@ -90,7 +90,8 @@ public:
 
 protected:
     /**
-     * @brief Call this when the component is modified
+     * @brief Call this when the component is modified. Queues the component with its descriptor
+     *        set the first time it becomes dirty so that syncing only visits changed components
      *
      * @return True if the object was marked dirty, false if already dirty
      */
@@ -147,6 +148,7 @@ template<typename TCom, typename TFirstPayload, typename... TPayloads>
 bool DescriptorComponentBase<TCom, TFirstPayload, TPayloads...>::markDirty() {
     if (!dirty && descriptorSet != nullptr) {
         dirty = true;
+        descriptorSet->queueObjectRefresh(sceneKey);
         return true;
     }
     return false;
@@ -6,6 +6,7 @@
 #include <BLIB/Render/Primitives/DrawParameters.hpp>
 #include <BLIB/Render/UpdateSpeed.hpp>
 #include <cstdint>
+#include <glm/glm.hpp>
 #include <limits>
 
 namespace bl
@@ -93,6 +94,30 @@ struct DrawableBase {
      */
     bool* getVisibleFlagForToggler() { return &hidden; }
 
+    /**
+     * @brief Sets the bounding sphere used to cull this object. The sphere is in the local space
+     *        of the entity transform. Objects without bounds are never culled
+     *
+     * @param center The center of the bounding sphere in local space
+     * @param radius The radius of the bounding sphere
+     */
+    void setCullBounds(const glm::vec3& center, float radius);
+
+    /**
+     * @brief Removes the bounding sphere so that the object is never culled
+     */
+    void clearCullBounds();
+
+    /**
+     * @brief Returns whether or not this object has cull bounds
+     */
+    bool hasCullBounds() const { return cullBounds.w >= 0.f; }
+
+    /**
+     * @brief Returns the local bounding sphere. xyz is the center and w is the radius
+     */
+    const glm::vec4& getCullBounds() const { return cullBounds; }
+
     /**
      * @brief Returns the current scene object reference for this component
      */
@@ -133,7 +158,8 @@ struct DrawableBase {
     const prim::DrawParameters& getDrawParameters() const { return drawParams; }
 
     /**
-     * @brief Returns the current draw parameters for this component for editing
+     * @brief Returns the current draw parameters for this component for editing. Call
+     *        notifyDrawParametersChanged() after changing the geometry that is drawn
      */
     prim::DrawParameters& getDrawParametersForEdit() { return drawParams; }
 
@@ -142,6 +168,12 @@ struct DrawableBase {
      */
     void rebucket();
 
+    /**
+     * @brief Notifies the owning scene that the buffers or element ranges of the draw parameters
+     *        changed so that it may regroup the object for instancing
+     */
+    void notifyDrawParametersChanged();
+
     /**
      * @brief Derived components should return the default pipeline to use
      */
@@ -156,6 +188,7 @@ private:
     com::MaterialInstance* material;
     SceneObjectRef sceneRef;
     std::uint32_t pipelineSpecialization;
+    glm::vec4 cullBounds;
     bool hidden;
 
     friend class rc::Scene;
@@ -22,7 +22,7 @@ struct Limits {
 
     static constexpr std::size_t MaxDescriptorSets = 4;
 
-    static constexpr std::size_t MaxDescriptorBindings = 8;
+    static constexpr std::size_t MaxDescriptorBindings = 12;
 
     static constexpr std::uint32_t MaxRenderPasses = 8;
 
@@ -37,12 +37,12 @@ struct Limits {
 
     static constexpr std::uint32_t MaxCubemapCount = 16;
 
-    static constexpr std::uint32_t MaxPointLights  = 128;
-    static constexpr std::uint32_t MaxSpotLights   = 128;
     static constexpr std::uint32_t MaxPointShadows = 16;
     static constexpr std::uint32_t MaxSpotShadows  = 16;
 
     static constexpr std::uint32_t MaxBloomFilterSize = 20;
+
+    static constexpr std::uint32_t InstanceIndexBase = 1 << 24;
 };
 
 } // namespace cfg
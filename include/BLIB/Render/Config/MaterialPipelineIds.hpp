@@ -24,6 +24,7 @@ struct MaterialPipelineIds {
     static constexpr std::uint32_t Slideshow2D       = 7;
     static constexpr std::uint32_t Lines2D           = 8;
     static constexpr std::uint32_t Skybox            = 9;
+    static constexpr std::uint32_t TextDistanceField = 10;
 };
 
 } // namespace cfg
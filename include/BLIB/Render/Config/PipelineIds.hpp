@@ -45,10 +45,11 @@ struct PipelineIds {
     static constexpr std::uint32_t PointShadowMapRegular = 152;
     static constexpr std::uint32_t PointShadowMapSkinned = 153;
 
-    static constexpr std::uint32_t Text           = 200;
-    static constexpr std::uint32_t SlideshowLit   = 201;
-    static constexpr std::uint32_t SlideshowUnlit = 202;
-    static constexpr std::uint32_t Lines2D        = 203;
+    static constexpr std::uint32_t Text              = 200;
+    static constexpr std::uint32_t SlideshowLit      = 201;
+    static constexpr std::uint32_t SlideshowUnlit    = 202;
+    static constexpr std::uint32_t Lines2D           = 203;
+    static constexpr std::uint32_t TextDistanceField = 204;
 
     static constexpr std::uint32_t FadeEffect = 300;
 };
@@ -66,6 +66,9 @@ struct ShaderIds {
     static constexpr char PointShadowGeometry[]      = {36, 0};
     static constexpr char PointShadowFragment[]      = {37, 0};
 
+    static constexpr char TextDistanceFieldVertex[]   = {38, 0};
+    static constexpr char TextDistanceFieldFragment[] = {39, 0};
+
     static constexpr char AutoExposureAccumulate[] = {100, 0};
     static constexpr char AutoExposureAdjust[]     = {101, 0};
 
@@ -3,6 +3,7 @@
 
 #include <BLIB/Render/GraphicsSettings.hpp>
 #include <BLIB/Render/WindowSettings.hpp>
+#include <string>
 
 namespace bl
 {
@@ -42,6 +43,18 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Set the directory to persist compiled pipeline data to between runs. Defaults to a
+     *        folder in the system temp directory if not set
+     *
+     * @param directory The directory to store the pipeline cache in
+     * @return A reference to this object
+     */
+    CreationSettings& withPipelineCacheDirectory(const std::string& directory) {
+        pipelineCacheDirectory = directory;
+        return *this;
+    }
+
     /**
      * @brief Returns the window settings to use when creating the renderer window
      */
@@ -52,6 +65,11 @@ public:
      */
     const GraphicsSettings& getGraphicsSettings() const { return graphicsSettings; }
 
+    /**
+     * @brief Returns the directory to persist compiled pipeline data to. May be empty
+     */
+    const std::string& getPipelineCacheDirectory() const { return pipelineCacheDirectory; }
+
     /**
      * @brief Writes the contained settings to the engine config store
      *
@@ -75,6 +93,7 @@ public:
 private:
     WindowSettings windowSettings;
     GraphicsSettings graphicsSettings;
+    std::string pipelineCacheDirectory;
 };
 
 } // namespace rc
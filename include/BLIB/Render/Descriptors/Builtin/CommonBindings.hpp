@@ -11,6 +11,7 @@
 #include <BLIB/Render/Descriptors/Generic/ObjectBufferBinding.hpp>
 #include <BLIB/Render/Descriptors/GenericDescriptorSetInstance.hpp>
 #include <BLIB/Render/Materials/MaterialId.hpp>
+#include <BLIB/Render/ShaderResources/InstanceIndexResource.hpp>
 #include <BLIB/Render/ShaderResources/Key.hpp>
 #include <BLIB/Render/ShaderResources/SkeletalBonesResource.hpp>
 #include <glm/glm.hpp>
@@ -42,6 +43,9 @@ using MaterialIdBuffer =
                                       buf::BufferSingleDeviceLocalSourcedSSBO<mat::MaterialId>>;
 constexpr sr::Key<MaterialIdBuffer> MaterialIdBufferKey{"__builtin_MaterialIdBuffer"};
 
+constexpr sr::Key<sri::InstanceIndexResource> InstanceIndexBufferKey{
+    "__builtin_InstanceIndexBuffer"};
+
 constexpr sr::Key<sri::SkeletalBonesResource> SkeletalBonesBufferKey{
     "__builtin_SkeletalBonesBuffer"};
 
@@ -71,6 +75,10 @@ using TextureBinding = ds::ObjectBufferBinding<sri::TextureIdBuffer, sri::Textur
 using MaterialBinding = ds::ObjectBufferBinding<sri::MaterialIdBuffer, sri::MaterialIdBufferKey,
                                                 VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, true>;
 
+using InstanceIndexBinding =
+    ds::BufferBinding<sri::InstanceIndexResource, sri::InstanceIndexBufferKey, sr::StoreKey::Scene,
+                      VK_DESCRIPTOR_TYPE_STORAGE_BUFFER>;
+
 using SkeletalBonesBinding =
     ds::BufferBinding<sri::SkeletalBonesResource, sri::SkeletalBonesBufferKey, sr::StoreKey::Scene,
                       VK_DESCRIPTOR_TYPE_STORAGE_BUFFER>;
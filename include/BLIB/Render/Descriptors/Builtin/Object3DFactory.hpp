@@ -17,7 +17,8 @@ namespace dsi
  */
 using Object3DFactory =
     ds::GenericDescriptorSetFactory<priv::Object3DBindings, VK_SHADER_STAGE_VERTEX_BIT,
-                                    VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT>;
+                                    VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                                    VK_SHADER_STAGE_VERTEX_BIT>;
 
 } // namespace dsi
 } // namespace rc
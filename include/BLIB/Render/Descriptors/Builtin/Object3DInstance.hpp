@@ -11,7 +11,8 @@ namespace dsi
 {
 namespace priv
 {
-using Object3DBindings = ds::Bindings<Transform3DBinding, MaterialBinding>;
+using Object3DBindings =
+    ds::Bindings<Transform3DBinding, MaterialBinding, InstanceIndexBinding>;
 }
 
 /**
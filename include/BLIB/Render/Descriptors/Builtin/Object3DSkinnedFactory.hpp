@@ -18,7 +18,8 @@ namespace dsi
 using Object3DSkinnedFactory =
     ds::GenericDescriptorSetFactory<priv::Object3DSkinnedBindings, VK_SHADER_STAGE_VERTEX_BIT,
                                     VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                                    VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_VERTEX_BIT>;
+                                    VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_VERTEX_BIT,
+                                    VK_SHADER_STAGE_VERTEX_BIT>;
 
 } // namespace dsi
 } // namespace rc
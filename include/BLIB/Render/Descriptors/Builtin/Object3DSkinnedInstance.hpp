@@ -11,8 +11,9 @@ namespace dsi
 {
 namespace priv
 {
-using Object3DSkinnedBindings = ds::Bindings<Transform3DBinding, MaterialBinding,
-                                             SkeletalBonesBinding, SkeletalBonesOffsetBinding>;
+using Object3DSkinnedBindings =
+    ds::Bindings<Transform3DBinding, MaterialBinding, InstanceIndexBinding, SkeletalBonesBinding,
+                 SkeletalBonesOffsetBinding>;
 }
 
 /**
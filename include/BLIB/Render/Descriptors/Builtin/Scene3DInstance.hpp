@@ -1,10 +1,12 @@
 #ifndef BLIB_RENDER_DESCRIPTORS_SCENE3DINSTANCE_HPP
 #define BLIB_RENDER_DESCRIPTORS_SCENE3DINSTANCE_HPP
 
+#include <BLIB/Render/Buffers/BufferDoubleHostVisibleSourced.hpp>
 #include <BLIB/Render/Descriptors/DescriptorSetInstance.hpp>
 #include <BLIB/Render/Events/SettingsChanged.hpp>
 #include <BLIB/Render/Events/ShadowMapsInvalidated.hpp>
 #include <BLIB/Render/Graph/Assets/SSAOAsset.hpp>
+#include <BLIB/Render/Lighting/LightClusters.hpp>
 #include <BLIB/Render/Lighting/LightingDescriptor3D.hpp>
 #include <BLIB/Render/Lighting/PointLight3D.hpp>
 #include <BLIB/Render/Lighting/SpotLight3D.hpp>
@@ -22,6 +24,11 @@ namespace bl
 namespace rc
 {
 class Renderer;
+class RenderTarget;
+namespace lgt
+{
+class Scene3DLighting;
+}
 namespace vk
 {
 struct VulkanLayer;
@@ -34,7 +41,8 @@ class ShadowMapAsset;
 namespace dsi
 {
 /**
- * @brief Descriptor set instance for common scene data
+ * @brief Descriptor set instance for common scene data. Also assigns the point and spot lights of
+ *        the scene to view space clusters for the observer that owns the set
  *
  * @ingroup Renderer
  */
@@ -81,6 +89,15 @@ private:
     rgi::SSAOShaderResource* ssaoBuffer;
     unsigned int deferredImageUpdates;
 
+    RenderTarget* owner;
+    lgt::Scene3DLighting* lighting;
+    sri::PointLightBuffer3D* pointLightBuffer;
+    sri::SpotLightBuffer3D* spotLightBuffer;
+    lgt::LightClusters lightClusters;
+    buf::BufferDoubleHostVisibleSourced<lgt::LightClusters::Cluster> clusterBuffer;
+    buf::BufferDoubleHostVisibleSourced<std::uint32_t> clusterIndexBuffer;
+    std::array<std::array<VkBuffer, 4>, cfg::Limits::MaxConcurrentFrames> boundStorageBuffers;
+
     virtual void bindForPipeline(scene::SceneRenderContext& ctx, VkPipelineLayout layout,
                                  std::uint32_t setIndex, UpdateSpeed updateFreq) const override;
     virtual void bindForObject(scene::SceneRenderContext& ctx, VkPipelineLayout layout,
@@ -95,6 +112,8 @@ private:
 
     void updateImageDescriptors();
     void updateImageDescriptors(unsigned int i);
+    void updateLightClusters();
+    void updateStorageDescriptors(unsigned int frameIndex);
 };
 
 } // namespace dsi
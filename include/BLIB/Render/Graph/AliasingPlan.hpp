@@ -0,0 +1,122 @@
+#ifndef BLIB_RENDER_GRAPH_ALIASINGPLAN_HPP
+#define BLIB_RENDER_GRAPH_ALIASINGPLAN_HPP
+
+#include <BLIB/Vulkan.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace rg
+{
+struct GraphAsset;
+
+/**
+ * @brief Assigns transient graph assets to shared memory slots. Assets whose timeline lifetimes do
+ *        not overlap and whose memory types are compatible may be placed in the same slot. Each
+ *        slot is sized for its largest member
+ *
+ * @ingroup Renderer
+ */
+class AliasingPlan {
+public:
+    /// Returned for assets that are not part of the plan
+    static constexpr std::uint32_t NotAliased = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Appends one set of requirements to the combined requirements of items that are placed
+     *        back to back in the same memory
+     *
+     * @param packed The combined requirements to append to. Start from {0, 1, ~0u}
+     * @param next The requirements of the item to append
+     * @return The offset of the appended item from the start of the combined memory
+     */
+    static VkDeviceSize pack(VkMemoryRequirements& packed, const VkMemoryRequirements& next);
+
+    /**
+     * @brief Removes all assets and slots
+     */
+    void clear();
+
+    /**
+     * @brief Adds a transient asset to be placed by build()
+     *
+     * @param asset The asset to add
+     * @param requirements The memory requirements of the asset
+     * @param firstStep The first timeline step that the asset is written in
+     * @param lastStep The last timeline step that the asset is read or written in
+     */
+    void addAsset(const GraphAsset* asset, const VkMemoryRequirements& requirements,
+                  unsigned int firstStep, unsigned int lastStep);
+
+    /**
+     * @brief Assigns every added asset to a slot. Larger assets are placed first
+     */
+    void build();
+
+    /**
+     * @brief Returns the slot of the given asset, or NotAliased if it was not added
+     *
+     * @param asset The asset to get the slot for
+     */
+    std::uint32_t getSlot(const GraphAsset* asset) const;
+
+    /**
+     * @brief Returns the number of memory slots in the plan
+     */
+    std::uint32_t getSlotCount() const;
+
+    /**
+     * @brief Returns the size of the given slot in bytes
+     *
+     * @param slot The index of the slot
+     */
+    VkDeviceSize getSlotSize(std::uint32_t slot) const;
+
+    /**
+     * @brief Returns the memory requirements that satisfy every member of the given slot
+     *
+     * @param slot The index of the slot
+     */
+    VkMemoryRequirements getSlotRequirements(std::uint32_t slot) const;
+
+    /**
+     * @brief Returns the memory used by the added assets if each owns its own allocation
+     */
+    VkDeviceSize getUnaliasedSize() const;
+
+    /**
+     * @brief Returns the memory used by the added assets when placed in the planned slots
+     */
+    VkDeviceSize getAliasedSize() const;
+
+private:
+    struct Entry {
+        const GraphAsset* asset;
+        VkMemoryRequirements requirements;
+        unsigned int firstStep;
+        unsigned int lastStep;
+        std::uint32_t slot;
+
+        bool overlaps(const Entry& other) const;
+    };
+
+    struct Slot {
+        VkDeviceSize size;
+        VkDeviceSize alignment;
+        std::uint32_t memoryTypeBits;
+        std::vector<std::uint32_t> members;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<Slot> slots;
+};
+
+} // namespace rg
+} // namespace rc
+} // namespace bl
+
+#endif
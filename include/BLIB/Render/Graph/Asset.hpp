@@ -4,6 +4,7 @@
 #include <BLIB/Render/Graph/AssetRef.hpp>
 #include <BLIB/Render/Graph/ExecutionContext.hpp>
 #include <BLIB/Render/Graph/InitContext.hpp>
+#include <BLIB/Vulkan.hpp>
 #include <glm/glm.hpp>
 #include <string_view>
 #include <vector>
@@ -86,6 +87,29 @@ public:
      */
     virtual void onReset() {}
 
+    /**
+     * @brief Returns the memory requirements of the attachments owned by this asset. Assets that
+     *        are written and consumed within the same frame may report them here to be planned
+     *        for aliasing with other transient assets. Default size of 0 opts out of aliasing
+     */
+    virtual VkMemoryRequirements getTransientMemoryRequirements() const;
+
+    /**
+     * @brief Called when the graph places this asset in memory shared with other transient assets.
+     *        Assets that report transient memory requirements must re-create their attachments in
+     *        the given memory. Contents are undefined at the start of each output
+     *
+     * @param memory The shared allocation to place the attachments in
+     * @param offset The offset of this asset within the allocation
+     */
+    virtual void bindTransientMemory(VmaAllocation memory, VkDeviceSize offset);
+
+    /**
+     * @brief Called before the memory given to bindTransientMemory() is freed. Assets must move
+     *        their attachments back into memory of their own
+     */
+    virtual void releaseTransientMemory();
+
     /**
      * @brief Returns the tag of this asset
      */
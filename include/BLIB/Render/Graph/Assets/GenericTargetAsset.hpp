@@ -100,6 +100,7 @@ public:
     : FramebufferAsset(tag, terminal, RenderPassId, cachedViewport, cachedScissor,
                        clearColors.data(), RenderedAttachmentCount)
     , renderer(nullptr)
+    , images(nullptr)
     , depthBufferAsset(nullptr)
     , depthBufferView(VK_NULL_HANDLE)
     , cachedViewport{}
@@ -147,6 +148,33 @@ public:
      */
     virtual vk::Framebuffer& getFramebuffer(std::uint32_t) override { return framebuffer; }
 
+    /**
+     * @brief Returns the memory of the attachments so that they may share memory with other
+     *        attachments that are not in use at the same time
+     */
+    virtual VkMemoryRequirements getTransientMemoryRequirements() const override {
+        return images ? images->getImages().getMemoryRequirements() : VkMemoryRequirements{};
+    }
+
+    /**
+     * @brief Re-creates the attachments in memory shared with other transient assets
+     *
+     * @param memory The shared allocation to place the attachments in
+     * @param offset The offset of this asset within the allocation
+     */
+    virtual void bindTransientMemory(VmaAllocation memory, VkDeviceSize offset) override {
+        images->aliasMemory(memory, offset);
+        createAttachments();
+    }
+
+    /**
+     * @brief Moves the attachments back into memory of their own
+     */
+    virtual void releaseTransientMemory() override {
+        images->releaseAliasedMemory();
+        createAttachments();
+    }
+
 private:
     Renderer* renderer;
     Traits::TResourceType* images;
@@ -1,6 +1,7 @@
 #ifndef BLIB_RENDER_GRAPH_MULTIASSET_HPP
 #define BLIB_RENDER_GRAPH_MULTIASSET_HPP
 
+#include <BLIB/Render/Graph/AliasingPlan.hpp>
 #include <BLIB/Render/Graph/Asset.hpp>
 #include <array>
 #include <memory>
@@ -75,6 +76,25 @@ public:
      */
     constexpr std::uint32_t size() const;
 
+    /**
+     * @brief Returns the memory of all contained assets placed back to back. Opts out unless every
+     *        contained asset may be aliased
+     */
+    virtual VkMemoryRequirements getTransientMemoryRequirements() const override;
+
+    /**
+     * @brief Places the contained assets back to back in the given memory
+     *
+     * @param memory The shared allocation to place the assets in
+     * @param offset The offset of the first asset within the allocation
+     */
+    virtual void bindTransientMemory(VmaAllocation memory, VkDeviceSize offset) override;
+
+    /**
+     * @brief Moves the contained assets back into memory of their own
+     */
+    virtual void releaseTransientMemory() override;
+
 private:
     std::array<std::unique_ptr<T>, N> assets;
 
@@ -125,6 +145,32 @@ constexpr std::uint32_t MultiAsset<T, N>::size() const {
     return N;
 }
 
+template<typename T, std::uint32_t N>
+VkMemoryRequirements MultiAsset<T, N>::getTransientMemoryRequirements() const {
+    VkMemoryRequirements packed{0, 1, ~0u};
+    for (const auto& asset : assets) {
+        const VkMemoryRequirements requirements = asset->getTransientMemoryRequirements();
+        if (requirements.size == 0) { return VkMemoryRequirements{0, 1, 0}; }
+        AliasingPlan::pack(packed, requirements);
+    }
+    return packed;
+}
+
+template<typename T, std::uint32_t N>
+void MultiAsset<T, N>::bindTransientMemory(VmaAllocation memory, VkDeviceSize offset) {
+    VkMemoryRequirements packed{0, 1, ~0u};
+    for (auto& asset : assets) {
+        const VkDeviceSize assetOffset =
+            AliasingPlan::pack(packed, asset->getTransientMemoryRequirements());
+        asset->bindTransientMemory(memory, offset + assetOffset);
+    }
+}
+
+template<typename T, std::uint32_t N>
+void MultiAsset<T, N>::releaseTransientMemory() {
+    for (auto& asset : assets) { asset->releaseTransientMemory(); }
+}
+
 template<typename T, std::uint32_t N>
 void MultiAsset<T, N>::doCreate(const rg::InitContext& ctx) {
     unsigned int i = 0;
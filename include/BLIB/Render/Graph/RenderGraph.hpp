@@ -156,6 +156,11 @@ public:
      */
     bool needsRepopulation() const;
 
+    /**
+     * @brief Returns whether or not the timeline will be rebuilt on the next execution
+     */
+    bool needsBuild() const;
+
     /**
      * @brief Clears all tasks from the graph and marks it for re-population
      */
@@ -175,6 +180,12 @@ public:
      */
     void update(float dt);
 
+    /**
+     * @brief Returns the memory aliasing plan for the transient assets of the graph. Built with
+     *        the timeline
+     */
+    const AliasingPlan& getAliasingPlan() const;
+
 private:
     engine::Engine& engine;
     Renderer& renderer;
@@ -191,6 +202,12 @@ private:
     void createTask(Task* task);
 };
 
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const AliasingPlan& RenderGraph::getAliasingPlan() const {
+    return timeline.getAliasingPlan();
+}
+
 } // namespace rg
 } // namespace rc
 } // namespace bl
@@ -2,6 +2,7 @@
 #define BLIB_RENDER_GRAPH_TIMELINE_HPP
 
 #include <BLIB/Render/Events/GraphEvents.hpp>
+#include <BLIB/Render/Graph/AliasingPlan.hpp>
 #include <BLIB/Render/Graph/ExecutionContext.hpp>
 #include <BLIB/Render/Graph/TaskOutput.hpp>
 #include <BLIB/Signals/Emitter.hpp>
@@ -119,6 +120,11 @@ public:
     Timeline(engine::Engine& engine, Renderer& renderer, RenderTarget* target, Scene* scene,
              GraphAssetPool* pool);
 
+    /**
+     * @brief Moves aliased assets back into their own memory and frees the shared memory
+     */
+    ~Timeline();
+
     /**
      * @brief Builds the timeline from the given final asset. Assets must have already been
      *        traversed and populated by RenderGraph
@@ -135,6 +141,11 @@ public:
      */
     void execute(const ExecutionContext& ctx);
 
+    /**
+     * @brief Returns the memory aliasing plan for the transient assets of the most recent build
+     */
+    const AliasingPlan& getAliasingPlan() const;
+
 private:
     engine::Engine& engine;
     Renderer& renderer;
@@ -142,9 +153,20 @@ private:
     Scene* scene;
     GraphAssetPool* pool;
     std::vector<TimelineStage> timeline;
+    AliasingPlan aliasing;
+    std::vector<VmaAllocation> transientMemory;
+    std::vector<Asset*> aliasedAssets;
     sig::Emitter<event::SceneGraphAssetInitialized> emitter;
+
+    void planAliasing();
+    void bindTransientMemory(const std::vector<GraphAsset*>& planned);
+    void freeTransientMemory(std::vector<VmaAllocation>& memory);
 };
 
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const AliasingPlan& Timeline::getAliasingPlan() const { return aliasing; }
+
 } // namespace rg
 } // namespace rc
 } // namespace bl
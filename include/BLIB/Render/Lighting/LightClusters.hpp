@@ -0,0 +1,217 @@
+#ifndef BLIB_RENDER_LIGHTING_LIGHTCLUSTERS_HPP
+#define BLIB_RENDER_LIGHTING_LIGHTCLUSTERS_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace lgt
+{
+/**
+ * @brief Assigns point and spot lights to view space clusters (froxels) on the CPU. The view
+ *        frustum is split into screen space tiles and exponentially distributed depth slices. Each
+ *        cluster references a contiguous range of a compact light index list so that shaders only
+ *        need to evaluate the lights that can actually reach the fragment
+ *
+ * @ingroup Renderer
+ */
+class LightClusters {
+public:
+    /**
+     * @brief Dimensions of the cluster grid
+     */
+    struct Grid {
+        std::uint32_t tilesX;
+        std::uint32_t tilesY;
+        std::uint32_t depthSlices;
+
+        /**
+         * @brief Creates a grid with sane defaults for 16:9 viewports
+         */
+        Grid()
+        : tilesX(16)
+        , tilesY(9)
+        , depthSlices(24) {}
+
+        /**
+         * @brief Creates a grid with the given dimensions
+         *
+         * @param x The number of horizontal tiles
+         * @param y The number of vertical tiles
+         * @param z The number of depth slices
+         */
+        Grid(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+        : tilesX(x)
+        , tilesY(y)
+        , depthSlices(z) {}
+    };
+
+    /**
+     * @brief Per-cluster light range. Point light indices are stored first, followed by spot light
+     *        indices. Layout matches the shader struct
+     */
+    struct Cluster {
+        std::uint32_t offset;
+        std::uint32_t pointCount;
+        std::uint32_t spotCount;
+        std::uint32_t padding;
+    };
+
+    /**
+     * @brief Creates the cluster grid. setProjection() must be called before building
+     *
+     * @param grid The dimensions of the grid
+     */
+    LightClusters(const Grid& grid = {});
+
+    /**
+     * @brief Returns the dimensions of the grid
+     */
+    const Grid& getGrid() const;
+
+    /**
+     * @brief Returns the total number of clusters
+     */
+    std::uint32_t clusterCount() const;
+
+    /**
+     * @brief Updates the cluster bounds from a perspective projection. Depth is assumed to be in
+     *        the range [0, 1]. A negative y scale (flipped viewport) is supported
+     *
+     * @param projection The projection matrix of the observer
+     * @param nearPlane Distance to the near plane
+     * @param farPlane Distance to the far plane
+     */
+    void setProjection(const glm::mat4& projection, float nearPlane, float farPlane);
+
+    /**
+     * @brief Assigns the given lights to clusters. Previous results are discarded
+     *
+     * @param view The view matrix of the observer
+     * @param pointLights World space bounding spheres of point lights. w is the radius
+     * @param spotLights World space bounding spheres of spot lights. w is the radius
+     */
+    void build(const glm::mat4& view, std::span<const glm::vec4> pointLights,
+               std::span<const glm::vec4> spotLights);
+
+    /**
+     * @brief Returns the light ranges of every cluster
+     */
+    const std::vector<Cluster>& getClusters() const;
+
+    /**
+     * @brief Returns the compact light index list referenced by the clusters
+     */
+    const std::vector<std::uint32_t>& getLightIndices() const;
+
+    /**
+     * @brief Returns the indices of the point lights affecting the given cluster
+     *
+     * @param cluster The index of the cluster
+     */
+    std::span<const std::uint32_t> getPointLights(std::uint32_t cluster) const;
+
+    /**
+     * @brief Returns the indices of the spot lights affecting the given cluster
+     *
+     * @param cluster The index of the cluster
+     */
+    std::span<const std::uint32_t> getSpotLights(std::uint32_t cluster) const;
+
+    /**
+     * @brief Returns the cluster index for the given tile coordinates and depth slice
+     *
+     * @param x The horizontal tile index
+     * @param y The vertical tile index
+     * @param z The depth slice index
+     */
+    std::uint32_t getClusterIndex(std::uint32_t x, std::uint32_t y, std::uint32_t z) const;
+
+    /**
+     * @brief Returns the cluster containing the given fragment. Mirrors the shader lookup
+     *
+     * @param ndc The fragment position in normalized device coordinates
+     * @param viewDepth The positive view space depth of the fragment
+     */
+    std::uint32_t getClusterIndex(const glm::vec2& ndc, float viewDepth) const;
+
+    /**
+     * @brief Returns the depth slice containing the given view space depth. Clamped to the grid
+     *
+     * @param viewDepth The positive view space depth
+     */
+    std::uint32_t getDepthSlice(float viewDepth) const;
+
+    /**
+     * @brief Returns the scale to use in the shader slice formula: log(depth) * scale + bias
+     */
+    float getSliceScale() const;
+
+    /**
+     * @brief Returns the bias to use in the shader slice formula: log(depth) * scale + bias
+     */
+    float getSliceBias() const;
+
+private:
+    Grid grid;
+    float nearPlane;
+    float farPlane;
+    float sliceScale;
+    float sliceBias;
+    std::vector<glm::vec2> columnSlopes; // x / depth range of each column
+    std::vector<glm::vec2> rowSlopes;    // y / depth range of each row
+    std::vector<float> sliceDepths;      // depthSlices + 1 boundaries
+
+    std::vector<Cluster> clusters;
+    std::vector<std::uint32_t> indices;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pointPairs;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> spotPairs;
+
+    void assign(const glm::mat4& view, std::span<const glm::vec4> lights,
+                std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const LightClusters::Grid& LightClusters::getGrid() const { return grid; }
+
+inline std::uint32_t LightClusters::clusterCount() const {
+    return grid.tilesX * grid.tilesY * grid.depthSlices;
+}
+
+inline const std::vector<LightClusters::Cluster>& LightClusters::getClusters() const {
+    return clusters;
+}
+
+inline const std::vector<std::uint32_t>& LightClusters::getLightIndices() const {
+    return indices;
+}
+
+inline std::span<const std::uint32_t> LightClusters::getPointLights(std::uint32_t c) const {
+    return {indices.data() + clusters[c].offset, clusters[c].pointCount};
+}
+
+inline std::span<const std::uint32_t> LightClusters::getSpotLights(std::uint32_t c) const {
+    return {indices.data() + clusters[c].offset + clusters[c].pointCount, clusters[c].spotCount};
+}
+
+inline std::uint32_t LightClusters::getClusterIndex(std::uint32_t x, std::uint32_t y,
+                                                    std::uint32_t z) const {
+    return (z * grid.tilesY + y) * grid.tilesX + x;
+}
+
+inline float LightClusters::getSliceScale() const { return sliceScale; }
+
+inline float LightClusters::getSliceBias() const { return sliceBias; }
+
+} // namespace lgt
+} // namespace rc
+} // namespace bl
+
+#endif
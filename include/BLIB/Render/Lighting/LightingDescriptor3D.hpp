@@ -1,6 +1,7 @@
 #ifndef BLIB_RENDER_LIGHTING_LIGHTINGDESCRIPTOR3D_HPP
 #define BLIB_RENDER_LIGHTING_LIGHTINGDESCRIPTOR3D_HPP
 
+#include <BLIB/Render/Buffers/BufferDoubleHostVisibleSourced.hpp>
 #include <BLIB/Render/Buffers/BufferSingleDeviceLocalSourced.hpp>
 #include <BLIB/Render/Config/Limits.hpp>
 #include <BLIB/Render/Lighting/PointLight3D.hpp>
@@ -19,7 +20,8 @@ namespace rc
 namespace lgt
 {
 /**
- * @brief Basic struct containing lighting info for 3d scenes (excluding point & spot lights)
+ * @brief Basic struct containing lighting info for 3d scenes. Point and spot lights without
+ *        shadows are stored in separate storage buffers so that their count is not limited
  *
  * @ingroup Renderer
  */
@@ -30,9 +32,7 @@ struct alignas(16) LightingDescriptor3D {
     std::uint32_t nSpotLights;
     std::uint32_t nPointShadows;
     std::uint32_t nSpotShadows;
-    std::array<SpotLight3D, cfg::Limits::MaxSpotLights> spotlights;
     std::array<SpotLight3DShadow, cfg::Limits::MaxSpotShadows> spotlightsWithShadows;
-    std::array<PointLight3D, cfg::Limits::MaxPointLights> pointLights;
     std::array<PointLight3DShadow, cfg::Limits::MaxPointShadows> pointLightsWithShadows;
 
     /**
@@ -47,6 +47,20 @@ struct alignas(16) LightingDescriptor3D {
     , nSpotShadows(0) {}
 };
 
+/**
+ * @brief Storage buffer type for point lights without shadows
+ *
+ * @ingroup Renderer
+ */
+using PointLightStorage3D = buf::BufferDoubleHostVisibleSourced<PointLight3D>;
+
+/**
+ * @brief Storage buffer type for spot lights without shadows
+ *
+ * @ingroup Renderer
+ */
+using SpotLightStorage3D = buf::BufferDoubleHostVisibleSourced<SpotLight3D>;
+
 } // namespace lgt
 
 namespace sri
@@ -60,6 +74,24 @@ using LightingBuffer3D =
     sr::BufferShaderResource<buf::BufferSingleDeviceLocalSourcedUBO<lgt::LightingDescriptor3D>, 1>;
 
 constexpr sr::Key<LightingBuffer3D> Scene3DLightingKey("__builtin_Scene3DLighting");
+
+/**
+ * @brief Storage buffer shader resource containing the point lights of a 3d scene
+ *
+ * @ingroup Renderer
+ */
+using PointLightBuffer3D = sr::BufferShaderResource<lgt::PointLightStorage3D, 128>;
+
+constexpr sr::Key<PointLightBuffer3D> Scene3DPointLightsKey("__builtin_Scene3DPointLights");
+
+/**
+ * @brief Storage buffer shader resource containing the spot lights of a 3d scene
+ *
+ * @ingroup Renderer
+ */
+using SpotLightBuffer3D = sr::BufferShaderResource<lgt::SpotLightStorage3D, 128>;
+
+constexpr sr::Key<SpotLightBuffer3D> Scene3DSpotLightsKey("__builtin_Scene3DSpotLights");
 } // namespace sri
 
 } // namespace rc
@@ -9,8 +9,10 @@
 #include <BLIB/Render/Lighting/SpotLight3D.hpp>
 #include <BLIB/Render/Lighting/SpotLight3DShadow.hpp>
 #include <BLIB/Render/Lighting/SunLight3D.hpp>
-#include <BLIB/Util/IdAllocator.hpp>
+#include <BLIB/Util/IdAllocatorUnbounded.hpp>
 #include <BLIB/Util/Random.hpp>
+#include <cstring>
+#include <span>
 
 namespace bl
 {
@@ -29,8 +31,11 @@ public:
      * @brief Creates the lighting manager
      *
      * @param uniform The lighting uniform to update with light data
+     * @param pointStorage The storage buffer to copy point lights without shadows into
+     * @param spotStorage The storage buffer to copy spot lights without shadows into
      */
-    Scene3DLighting(LightingDescriptor3D& uniform);
+    Scene3DLighting(LightingDescriptor3D& uniform, PointLightStorage3D& pointStorage,
+                    SpotLightStorage3D& spotStorage);
 
     /**
      * @brief Returns the global ambient light color
@@ -49,6 +54,11 @@ public:
      */
     const SunLight3D& getSun() const;
 
+    /**
+     * @brief Returns the light data as it will be sent to shaders. Valid after sync()
+     */
+    const LightingDescriptor3D& getUniformData() const { return uniform; }
+
     /**
      * @brief Returns the sun light for modification
      */
@@ -143,6 +153,18 @@ public:
      */
     void updateSunCameraMatrix();
 
+    /**
+     * @brief Returns world space bounding spheres of the point lights without shadows, in the same
+     *        order as the point light storage buffer. Valid after sync()
+     */
+    std::span<const glm::vec4> getPointLightBounds() const;
+
+    /**
+     * @brief Returns world space bounding spheres of the spot lights without shadows, in the same
+     *        order as the spot light storage buffer. Valid after sync()
+     */
+    std::span<const glm::vec4> getSpotLightBounds() const;
+
     /**
      * @brief Called by owning scene prior to render. Do not call manually
      */
@@ -151,23 +173,28 @@ public:
 private:
     template<typename T>
     struct Lights {
-        util::IdAllocator<std::size_t> idAllocator;
+        util::IdAllocatorUnbounded<std::size_t> idAllocator;
         std::vector<T> lights;
         std::vector<std::uint32_t> active;
-
-        Lights(std::size_t maxCount)
-        : idAllocator(maxCount) {
-            lights.resize(maxCount);
-            active.reserve(maxCount);
+        std::vector<glm::vec4> bounds;
+        const std::size_t maxCount;
+
+        // maxCount of 0 means unbounded
+        Lights(std::size_t maxCount, std::size_t capacityHint)
+        : idAllocator(capacityHint)
+        , maxCount(maxCount) {
+            lights.resize(capacityHint);
+            active.reserve(capacityHint);
         }
 
         template<typename... TArgs>
         Light3D<T> createNew(Scene3DLighting* owner, TArgs&&... args) {
-            if (!idAllocator.available()) {
+            if (maxCount > 0 && active.size() >= maxCount) {
                 BL_LOG_ERROR << "Exceeded max light count";
                 return {owner, lights, util::Random::get<std::size_t>(0, lights.size() - 1)};
             }
             const std::size_t i = idAllocator.allocate();
+            if (i >= lights.size()) { lights.resize(i + 1); }
             new (&lights[i]) T(std::forward<TArgs>(args)...);
             active.emplace_back(i);
             return {owner, lights, i};
@@ -190,9 +217,30 @@ private:
             std::uint32_t ui = 0;
             for (std::uint32_t i : active) { dst[ui++].copyAsUniform(lights[i]); }
         }
+
+        template<typename TStorage>
+        void copyToStorage(TStorage& storage) {
+            if (storage.ensureSize(active.size())) { storage.markFullDirty(); }
+            bounds.resize(active.size());
+
+            // only lights that actually changed are marked for transfer
+            for (std::uint32_t ui = 0; ui < active.size(); ++ui) {
+                const T& light = lights[active[ui]];
+                T converted;
+                std::memset(static_cast<void*>(&converted), 0, sizeof(T));
+                converted.copyAsUniform(light);
+                if (std::memcmp(&converted, &storage[ui], sizeof(T)) != 0) {
+                    std::memcpy(static_cast<void*>(&storage[ui]), &converted, sizeof(T));
+                    storage.markDirty(ui);
+                }
+                bounds[ui] = computeBounds(light);
+            }
+        }
     };
 
     LightingDescriptor3D& uniform;
+    PointLightStorage3D& pointStorage;
+    SpotLightStorage3D& spotStorage;
     glm::vec3 sceneCenter;
     float sunDistance;
     Lights<SpotLight3D> spotLights;
@@ -206,6 +254,9 @@ private:
     void removeLight(const SpotLightShadowHandle& light);
     void addIndex(std::vector<std::uint32_t>& vec, std::uint32_t i);
 
+    static glm::vec4 computeBounds(const PointLight3D& light);
+    static glm::vec4 computeBounds(const SpotLight3D& light);
+
     template<typename T>
     friend class Light3D;
 };
@@ -255,6 +306,14 @@ inline std::uint32_t Scene3DLighting::getPointLightCount() const {
     return pointLights.active.size();
 }
 
+inline std::span<const glm::vec4> Scene3DLighting::getPointLightBounds() const {
+    return pointLights.bounds;
+}
+
+inline std::span<const glm::vec4> Scene3DLighting::getSpotLightBounds() const {
+    return spotLights.bounds;
+}
+
 } // namespace lgt
 } // namespace rc
 } // namespace bl
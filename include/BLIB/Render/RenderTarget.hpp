@@ -14,6 +14,7 @@
 #include <BLIB/Render/Vulkan/PerFrame.hpp>
 #include <BLIB/Util/NonCopyable.hpp>
 #include <BLIB/Vulkan.hpp>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -200,6 +201,12 @@ public:
      */
     const VkViewport& getViewport() const { return viewport; }
 
+    /**
+     * @brief Returns the CPU time spent recording the render commands of this target in the most
+     *        recent frame
+     */
+    std::chrono::nanoseconds getLastRecordTime() const;
+
 protected:
     struct SceneInstance {
         SceneRef scene;
@@ -230,6 +237,7 @@ protected:
     VkClearValue clearColors[2];
     cam::OverlayCamera overlayCamera;
     rgi::FramebufferAsset* renderingTo;
+    std::chrono::nanoseconds lastRecordTime;
 
     RenderTarget(engine::Engine& engine, Renderer& renderer, rg::AssetFactory& factory,
                  bool isRenderTexture);
@@ -238,6 +246,7 @@ protected:
     void syncSceneObjects();
     void update(float dt);
     void resetAssets();
+    void buildGraph();
 
     void renderScene(VkCommandBuffer commandBuffer);
 
@@ -298,6 +307,8 @@ inline std::size_t RenderTarget::sceneCount() const { return scenes.size(); }
 
 inline bool RenderTarget::hasScene() const { return !scenes.empty(); }
 
+inline std::chrono::nanoseconds RenderTarget::getLastRecordTime() const { return lastRecordTime; }
+
 inline Scene* RenderTarget::getCurrentScene() {
     return !scenes.empty() ? scenes.back().scene.get() : nullptr;
 }
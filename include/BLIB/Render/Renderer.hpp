@@ -218,6 +218,21 @@ public:
      */
     void setClearColor(const Color& color);
 
+    /**
+     * @brief Sets whether observers record their render commands in parallel. When enabled each
+     *        observer records into its own command buffer on the fast task thread pool and the
+     *        buffers are submitted in observer order. Observers that share a scene or overlay are
+     *        recorded on the same thread. Default is disabled
+     *
+     * @param enabled True to record in parallel, false to record on the render thread
+     */
+    void setParallelRecordingEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether observers record their render commands in parallel
+     */
+    bool isParallelRecordingEnabled() const;
+
     /**
      * @brief Returns the graph asset factory used by the renderer
      */
@@ -354,6 +369,9 @@ private:
     Observer commonObserver;
     std::vector<std::unique_ptr<Observer>> observers;
     std::vector<std::unique_ptr<Observer>> virtualObservers;
+    bool parallelRecording;
+    std::vector<RenderTarget*> recordTargets;
+    std::vector<std::uint32_t> recordGroups;
     VkClearValue clearColors[2];
     std::vector<std::unique_ptr<vk::RenderTexture>> renderTextures;
     rg::AssetFactory assetFactory;
@@ -382,6 +400,7 @@ private:
     void syncSceneObjects();
     void copyDataFromSources();
     void renderFrame();
+    void recordObserversInParallel();
 
     Observer& addObserver();
     void removeObserver(unsigned int i);
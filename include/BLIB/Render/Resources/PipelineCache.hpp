@@ -3,10 +3,19 @@
 
 #include <BLIB/Render/Vulkan/Pipeline.hpp>
 #include <cstdint>
+#include <future>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace bl
 {
+namespace engine
+{
+class Engine;
+}
+
 namespace rc
 {
 class Renderer;
@@ -14,7 +23,8 @@ class Renderer;
 namespace res
 {
 /**
- * @brief Basic cache to own and manage pipelines. Owned by the renderer
+ * @brief Basic cache to own and manage pipelines. Owned by the renderer. Compiled pipeline data is
+ *        kept in a VkPipelineCache that is persisted to disk between runs
  *
  * @ingroup Renderer
  */
@@ -23,6 +33,15 @@ public:
     /// The first id to try when creating dynamic pipeline ids
     static constexpr std::uint32_t DynamicPipelineIdStart = 10000;
 
+    /**
+     * @brief Describes a single pipeline variant to compile during warm-up
+     */
+    struct WarmupEntry {
+        std::uint32_t pipelineId;
+        std::uint32_t renderPassId;
+        std::uint32_t specialization;
+    };
+
     /**
      * @brief Creates a new pipeline in the cache. Id should be unique
      *
@@ -57,18 +76,53 @@ public:
      */
     bool pipelineExists(std::uint32_t pipelineId) const;
 
+    /**
+     * @brief Compiles the given pipeline variants on background threads. Intended to be called
+     *        during loading. Render passes must already exist and the pipelines being warmed up
+     *        should not be used until warm-up completes
+     *
+     * @param entries The pipeline variants to compile
+     */
+    void warmup(const std::vector<WarmupEntry>& entries);
+
+    /**
+     * @brief Returns whether or not any warm-up tasks are still running
+     */
+    bool isWarmingUp();
+
+    /**
+     * @brief Blocks until all warm-up tasks are complete
+     */
+    void waitForWarmup();
+
+    /**
+     * @brief Returns the Vulkan pipeline cache to create pipelines with
+     */
+    VkPipelineCache getVulkanCache() const;
+
 private:
+    engine::Engine& engine;
     Renderer& renderer;
+    std::string cacheDirectory;
     std::unordered_map<std::uint32_t, vk::Pipeline> cache;
+    std::unordered_multimap<std::size_t, vk::Pipeline*> paramLookup;
     std::uint32_t nextId;
+    VkPipelineCache vulkanCache;
+    std::mutex warmupMutex;
+    std::vector<std::future<void>> warmupTasks;
 
-    PipelineCache(Renderer& renderer);
+    PipelineCache(engine::Engine& engine, Renderer& renderer, const std::string& cacheDirectory);
+    void init();
     void cleanup();
     void createBuiltins();
 
     friend class bl::rc::Renderer;
 };
 
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline VkPipelineCache PipelineCache::getVulkanCache() const { return vulkanCache; }
+
 } // namespace res
 } // namespace rc
 } // namespace bl
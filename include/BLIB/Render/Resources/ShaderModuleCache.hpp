@@ -2,6 +2,7 @@
 #define BLIB_RENDER_RESOURCES_SHADERMODULECACHE_HPP
 
 #include <BLIB/Vulkan.hpp>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -31,7 +32,7 @@ namespace res
 class ShaderModuleCache {
 public:
     /**
-     * @brief Loads a new shader
+     * @brief Loads a new shader. Thread safe
      *
      * @param path The path to the shader
      * @return The new or existing shader. Nullptr on error
@@ -42,6 +43,7 @@ private:
     as::Repository* repo;
     VkDevice device;
     std::unordered_map<std::string, VkShaderModule> cache;
+    std::recursive_mutex mutex;
 
     ShaderModuleCache() = default;
     void init(as::Repository& repo, VkDevice device);
@@ -3,9 +3,19 @@
 
 #include <BLIB/Render/Descriptors/InstanceTable.hpp>
 #include <BLIB/Render/Events/SceneObjectRemoved.hpp>
+#include <BLIB/Render/Scenes/DrawSorter.hpp>
+#include <BLIB/Render/Scenes/ExtraContexts.hpp>
+#include <BLIB/Render/Scenes/IndirectDrawBuilder.hpp>
+#include <BLIB/Render/Scenes/InstanceGroups.hpp>
 #include <BLIB/Render/Scenes/Scene.hpp>
 #include <BLIB/Render/Scenes/SceneObjectStorage.hpp>
+#include <BLIB/Render/Scenes/VisibilityCuller.hpp>
+#include <BLIB/Render/ShaderResources/InstanceIndexResource.hpp>
+#include <BLIB/Render/Vulkan/Buffer.hpp>
+#include <BLIB/Render/Vulkan/PerFrame.hpp>
 #include <BLIB/Signals/Emitter.hpp>
+#include <limits>
+#include <mutex>
 
 namespace bl
 {
@@ -15,7 +25,11 @@ namespace scene
 {
 /**
  * @brief Primary scene class for the renderer. Provides batched rendering of objects by pipeline.
- *        Renders transparent objects after rendering all opaque objects
+ *        Renders transparent objects after rendering all opaque objects. Objects with cull bounds
+ *        are skipped when outside of the observer frustum or shadow casting light volume. Batches
+ *        with bindless descriptors may optionally be drawn with multi-draw indirect commands,
+ *        opaque objects that share the same geometry may be drawn instanced, and visible objects
+ *        may be sorted per observer to minimize state changes and draw in depth order
  *
  * @ingroup Renderer
  */
@@ -47,7 +61,149 @@ public:
      */
     virtual void renderTransparentObjects(scene::SceneRenderContext& context) override;
 
+    /**
+     * @brief Enables or disables visibility culling. Enabled by default. Only objects that have
+     *        cull bounds set are ever culled
+     *
+     * @param enabled True to cull objects, false to render everything
+     */
+    void setCullingEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether or not visibility culling is enabled
+     */
+    bool isCullingEnabled() const;
+
+    /**
+     * @brief Enables or disables indirect drawing. Disabled by default. When enabled, the draw
+     *        commands of each batch with bindless descriptors are built on the CPU, compacted to
+     *        the visible objects, and issued with indirect draws instead of one draw per object.
+     *        Requires the drawIndirectFirstInstance device feature
+     *
+     * @param enabled True to draw with indirect commands, false to draw per object
+     */
+    void setIndirectDrawEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether or not indirect drawing is enabled
+     */
+    bool isIndirectDrawEnabled() const;
+
+    /**
+     * @brief Enables or disables automatic instancing. Disabled by default. When enabled, opaque
+     *        objects in pipelines that use the built-in 3D object descriptor sets and draw the same
+     *        buffers and element ranges are grouped, and the visible members of each group are
+     *        drawn with a single instanced draw. Groups are updated when objects are added,
+     *        removed, or call notifyDrawParametersChanged()
+     *
+     * @param enabled True to draw shared geometry instanced, false to draw per object
+     */
+    void setInstancingEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether or not automatic instancing is enabled
+     */
+    bool isInstancingEnabled() const;
+
+    /**
+     * @brief Enables or disables draw sorting. Disabled by default. When enabled, the visible
+     *        objects of each observer are sorted once per frame. Opaque objects are ordered by
+     *        pipeline state, then front to back. Instance groups are drawn in the position of their
+     *        nearest visible member. Transparent objects are ordered back to front. Shadow maps are
+     *        never sorted. Distances are measured to cull bounds centers, or to the object
+     *        position if it has no cull bounds
+     *
+     * @param enabled True to sort draws, false to draw in batch order
+     */
+    void setDrawSortingEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether or not draw sorting is enabled
+     */
+    bool isDrawSortingEnabled() const;
+
+    /**
+     * @brief Returns the visible and culled object counts from the most recent cull
+     *
+     * @param observerIndex The index of the observer to get the counts for
+     */
+    VisibilitySet::Stats getCullStats(std::uint32_t observerIndex) const;
+
+    /**
+     * @brief Returns the visible and culled shadow caster counts from the most recent cull
+     *
+     * @param shadowContext The light to get the counts for
+     */
+    VisibilitySet::Stats getShadowCullStats(const ctx::ShadowMapContext& shadowContext) const;
+
 protected:
+    /**
+     * @brief Volume that shadow casters are culled against for a single light
+     */
+    struct ShadowCullVolume {
+        Frustum frustum;
+        glm::vec4 sphere;
+        bool isSphere;
+
+        /**
+         * @brief Creates a volume that culls nothing
+         */
+        ShadowCullVolume();
+
+        /**
+         * @brief Creates a volume from a light view projection matrix
+         *
+         * @param viewProj The view projection matrix of the light
+         */
+        ShadowCullVolume(const glm::mat4& viewProj);
+
+        /**
+         * @brief Creates a spherical volume for omnidirectional lights
+         *
+         * @param center The position of the light
+         * @param radius The radius of influence of the light
+         */
+        ShadowCullVolume(const glm::vec3& center, float radius);
+    };
+
+    /**
+     * @brief Returns the index of the shadow cull volume for the given light
+     *
+     * @param shadowContext The light to get the index for
+     */
+    static std::uint32_t shadowCullIndex(const ctx::ShadowMapContext& shadowContext);
+
+    /**
+     * @brief Refreshes object bounds and culls objects for all observers and lights. Derived
+     *        classes that override this must call it
+     */
+    virtual void onShaderResourceSync() override;
+
+    /// Transform version to report when the version can not be trusted. Forces a refresh
+    static constexpr std::uint32_t UnknownTransformVersion =
+        std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Called to fetch the world transform of an object with cull bounds. Objects that do
+     *        not have a transform are never culled. Bounds are only recomputed when the version
+     *        of the transform changes
+     *
+     * @param entity The entity to get the transform for
+     * @param version The version the bounds were computed with. Set to the current version
+     * @param transform The matrix to populate. Only populated if the version changed
+     * @return True if the entity has a transform, false otherwise
+     */
+    virtual bool getObjectTransform(ecs::Entity entity, std::uint32_t& version,
+                                    glm::mat4& transform);
+
+    /**
+     * @brief Called once per frame to populate the volumes to cull shadow casters with. Volumes
+     *        must be placed at the index given by shadowCullIndex(). Default culls no casters
+     *
+     * @param volumes The vector of volumes to populate
+     */
+    virtual void collectShadowCullVolumes(std::vector<ShadowCullVolume>& volumes);
+
     /**
      * @brief Called when an object is added to the scene. Derived should create the SceneObject
      *        here and initialize descriptor sets
@@ -80,6 +236,15 @@ protected:
     virtual void doBatchChange(const BatchChange& change,
                                mat::MaterialPipeline* ogPipeline) override;
 
+    /**
+     * @brief Regroups the object for instancing
+     *
+     * @param object The object whose draw parameters changed
+     * @param pipeline The pipeline used to render the object
+     */
+    virtual void doGeometryChange(scene::SceneObject* object,
+                                  mat::MaterialPipeline* pipeline) override;
+
     /**
      * @brief Called when a new observer is going to render the scene
      *
@@ -99,17 +264,30 @@ protected:
 private:
     struct SpecializationBatch {
         const std::uint32_t specializationId;
+        const bool instanced;
         std::vector<SceneObject*> objectsStatic;
         std::vector<SceneObject*> objectsDynamic;
+        std::uint32_t removedStatic;
+        std::uint32_t removedDynamic;
+        InstanceGroups instancesStatic;
+        InstanceGroups instancesDynamic;
 
-        SpecializationBatch(std::uint32_t specializationId);
+        SpecializationBatch(std::uint32_t specializationId, InstanceIndexPool& instancePool,
+                            bool instanced);
         void addObject(SceneObject* sceneObject);
-        bool removeObject(SceneObject* sceneObject);
+        bool removeObject(SceneObject* sceneObject, bool preserveOrder);
+        void compact();
+        void updateInstance(SceneObject* sceneObject);
+        const InstanceGroups& getInstances(UpdateSpeed speed) const;
+        const std::vector<SceneObject*>& getObjects(UpdateSpeed speed) const;
+        bool contains(const SceneObject* object) const;
     };
 
     struct PipelineBatch {
         PipelineBatch(const PipelineBatch& src);
-        PipelineBatch(Scene* scene, mat::MaterialPipeline& pipeline);
+        PipelineBatch(const PipelineBatch& src, bool preserveOrder);
+        PipelineBatch(Scene* scene, mat::MaterialPipeline& pipeline, bool preserveOrder,
+                      InstanceIndexPool& instancePool);
 
         void initObserversMaybe(TargetTable& targets);
         void registerObserver(unsigned int index, RenderTarget& observer);
@@ -118,10 +296,14 @@ private:
         void addForRebatch(SceneObject* object, std::uint32_t specialization);
         void removeObject(ecs::Entity entity, SceneObject* object, std::uint32_t specialization);
         bool removeForRebatch(SceneObject* object, std::uint32_t specialization);
+        void updateInstance(SceneObject* object, std::uint32_t specialization);
         void updateDescriptors(ecs::Entity entity, SceneObject* object, PipelineBatch& prevBatch);
 
         bool needsObserverInit;
+        const bool preserveOrder;
         mat::MaterialPipeline& pipeline;
+        InstanceIndexPool& instancePool;
+        const bool instanced;
         std::array<ds::InstanceTable, cfg::Limits::MaxRenderPhases> perPhaseDescriptors;
         ctr::StaticVector<SpecializationBatch, cfg::Limits::MaxPipelineSpecializations> specBatches;
         ctr::StaticVector<ds::DescriptorSetInstance*,
@@ -130,17 +312,40 @@ private:
     };
 
     struct ObjectBatch {
-        ObjectBatch() { batches.reserve(8); }
+        ObjectBatch(bool preserveOrder, InstanceIndexPool& instancePool)
+        : preserveOrder(preserveOrder)
+        , instancePool(instancePool) {
+            batches.reserve(8);
+        }
         void registerObserver(unsigned int index, RenderTarget& observer);
         PipelineBatch& getOrCreateBatch(Scene* scene, mat::MaterialPipeline& pipeline);
         PipelineBatch* getBatch(mat::MaterialPipeline* pipeline);
         PipelineBatch& getBatch(const PipelineBatch& src);
         void removeObject(ecs::Entity entity, SceneObject* object, mat::MaterialPipeline* pipeline,
                           std::uint32_t specialization);
+        void compact();
 
+        const bool preserveOrder;
+        InstanceIndexPool& instancePool;
         std::vector<PipelineBatch> batches;
     };
 
+    struct ObserverSort {
+        DrawSorter opaque;
+        DrawSorter transparent;
+        bool valid;
+
+        ObserverSort();
+    };
+
+    struct CullSource {
+        ecs::Entity entity;
+        std::uint32_t version;
+        glm::vec4 local;
+
+        CullSource();
+    };
+
     struct ObjectSettingsCache {
         std::vector<bool> transparency;
         std::vector<std::uint32_t> specializations;
@@ -151,15 +356,49 @@ private:
 
     engine::Engine& engine;
     SceneObjectStorage<SceneObject> objects;
+    InstanceIndexPool instanceIndices;
+    sri::InstanceIndexResource* instanceIndexBuffer;
     ObjectBatch opaqueObjects;
     ObjectBatch transparentObjects;
     ObjectSettingsCache staticCache;
     ObjectSettingsCache dynamicCache;
     sig::Emitter<event::SceneObjectRemoved> emitter;
+    bool cullingEnabled;
+    std::array<CullingBounds, 2> cullBounds;
+    std::array<std::vector<CullSource>, 2> cullSources;
+    std::vector<VisibilitySet> observerVisibility;
+    std::vector<VisibilitySet> shadowVisibility;
+    std::vector<ShadowCullVolume> shadowVolumes;
+    bool indirectEnabled;
+    std::uint32_t maxDrawsPerCall;
+    IndirectDrawBuilder indirectDraws;
+    std::vector<IndirectDrawBuilder> indirectChunks;
+    vk::PerFrame<vk::Buffer> indirectBuffers;
+    VkDeviceSize indirectCursor;
+    std::uint32_t indirectFrame;
+    std::mutex indirectMutex;
+    bool instancingEnabled;
+    bool sortingEnabled;
+    std::vector<ObserverSort> observerSorts;
 
-    void handleAddressChange(UpdateSpeed speed, SceneObject* oldBase);
+    void updateCullBounds();
+    void cullObjects();
+    const VisibilitySet* getVisibility(const SceneRenderContext& ctx) const;
     void releaseObject(SceneObject* object, mat::MaterialPipeline* pipeline);
+    void sortObjects();
+    void sortBatch(ObjectBatch& batch, DrawSorter& sorter, const VisibilitySet* visibility,
+                   const glm::vec3& eye);
+    const DrawSorter* getSorter(const SceneRenderContext& ctx, const ObjectBatch& batch) const;
     void renderBatch(scene::SceneRenderContext& ctx, ObjectBatch& batch);
+    void renderSorted(scene::SceneRenderContext& ctx, ObjectBatch& batch, const DrawSorter& sorter);
+    template<typename TSkip>
+    void buildIndirectDraws(const std::vector<SceneObject*>& objects, const TSkip& skip);
+    bool writeIndirectDraws(VkBuffer& buffer, VkDeviceSize& offset);
+    template<typename TSkip, typename TDraw>
+    auto makeInstanceFilter(UpdateSpeed speed, const TSkip& skip, const TDraw& draw);
+    template<typename TSkip>
+    void renderInstanced(scene::SceneRenderContext& ctx, const InstanceGroups& instances,
+                         UpdateSpeed speed, const TSkip& skip);
 };
 
 } // namespace scene
@@ -0,0 +1,200 @@
+#ifndef BLIB_RENDER_SCENES_DRAWSORTER_HPP
+#define BLIB_RENDER_SCENES_DRAWSORTER_HPP
+
+#include <BLIB/Render/UpdateSpeed.hpp>
+#include <BLIB/Util/ThreadPool.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+/**
+ * @brief Packs and unpacks 64 bit draw sort keys. Opaque keys sort by pipeline, specialization,
+ *        update speed, coarse depth front to back, then geometry. Transparent keys sort by depth
+ *        back to front first, then by the same state
+ *
+ * @ingroup Renderer
+ */
+struct DrawSortKey {
+    /// Largest pipeline index that can be stored in a key
+    static constexpr std::uint32_t MaxPipeline = (1 << 12) - 1;
+
+    /// Largest specialization index that can be stored in a key
+    static constexpr std::uint32_t MaxSpecialization = (1 << 4) - 1;
+
+    /// The state encoded into a key
+    struct Fields {
+        std::uint32_t pipeline;
+        std::uint32_t specialization;
+        UpdateSpeed speed;
+    };
+
+    /**
+     * @brief Creates a key for an opaque object
+     *
+     * @param fields The pipeline state of the object
+     * @param depth Non-negative distance from the camera to the object
+     * @param geometry Identifier of the geometry buffers of the object
+     * @return The sort key
+     */
+    static std::uint64_t opaque(const Fields& fields, float depth, std::uint64_t geometry);
+
+    /**
+     * @brief Creates a key for a transparent object
+     *
+     * @param fields The pipeline state of the object
+     * @param depth Non-negative distance from the camera to the object
+     * @param geometry Identifier of the geometry buffers of the object
+     * @return The sort key
+     */
+    static std::uint64_t transparent(const Fields& fields, float depth, std::uint64_t geometry);
+
+    /**
+     * @brief Extracts the pipeline state from a key
+     *
+     * @param key The key to unpack
+     * @param transparent True if the key was created with transparent(), false for opaque()
+     * @return The pipeline state stored in the key
+     */
+    static Fields unpack(std::uint64_t key, bool transparent);
+};
+
+/**
+ * @brief Sorts visible objects by 64 bit keys each frame. The order from the previous frame is
+ *        revisited first so that coherent frames are already sorted or nearly sorted. Large
+ *        changes fall back to a parallel LSD radix sort
+ *
+ * @ingroup Renderer
+ */
+class DrawSorter {
+public:
+    /// Sort inputs smaller than this are radix sorted on the calling thread
+    static constexpr std::uint32_t MinParallelCount = 16384;
+
+    /**
+     * @brief A single sorted object
+     */
+    struct Entry {
+        std::uint64_t key;
+        std::uint32_t value;
+    };
+
+    /**
+     * @brief How the most recent sort was performed
+     */
+    enum struct Method { AlreadySorted, Merged, RadixSorted };
+
+    /**
+     * @brief Creates an empty sorter
+     */
+    DrawSorter();
+
+    /**
+     * @brief Starts a new frame by revisiting the entries of the previous frame in their sorted
+     *        order. New entries may be added after
+     *
+     * @tparam TRefresh Callback with signature bool(std::uint32_t value, std::uint64_t& key)
+     * @param refresh Called with each previous value and key. Update the key and return true to
+     *                keep the entry, or return false to drop it
+     */
+    template<typename TRefresh>
+    void beginFrame(TRefresh&& refresh);
+
+    /**
+     * @brief Returns whether the given value was already kept or added this frame
+     *
+     * @param value The value to check
+     */
+    bool contains(std::uint32_t value) const;
+
+    /**
+     * @brief Adds a new entry for this frame. Must not already be contained
+     *
+     * @param value The value to add. Should be a small dense id
+     * @param key The sort key of the value
+     */
+    void add(std::uint32_t value, std::uint64_t key);
+
+    /**
+     * @brief Sorts the entries of this frame by key
+     *
+     * @param threadPool Optional thread pool to radix sort large inputs with
+     */
+    void sort(util::ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Returns the sorted entries
+     */
+    const std::vector<Entry>& getEntries() const;
+
+    /**
+     * @brief Returns how the most recent sort was performed
+     */
+    Method getLastMethod() const;
+
+    /**
+     * @brief Sorts the given entries by key using an 8 bit LSD radix sort. Passes where every key
+     *        has the same digit are skipped
+     *
+     * @param entries The entries to sort
+     * @param scratch Scratch storage. Resized as needed
+     * @param threadPool Optional thread pool to sort large inputs with
+     */
+    static void radixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch,
+                          util::ThreadPool* threadPool = nullptr);
+
+private:
+    std::vector<Entry> entries;
+    std::vector<Entry> scratch;
+    std::vector<Entry> outOfOrder;
+    std::vector<std::uint32_t> stamps;
+    std::uint32_t frame;
+    Method lastMethod;
+
+    void nextFrame();
+    void mark(std::uint32_t value);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline bool DrawSorter::contains(std::uint32_t value) const {
+    return value < stamps.size() && stamps[value] == frame;
+}
+
+inline void DrawSorter::mark(std::uint32_t value) {
+    if (value >= stamps.size()) {
+        stamps.resize(std::max<std::size_t>(value + 1, stamps.size() * 2), 0);
+    }
+    stamps[value] = frame;
+}
+
+inline const std::vector<DrawSorter::Entry>& DrawSorter::getEntries() const { return entries; }
+
+inline DrawSorter::Method DrawSorter::getLastMethod() const { return lastMethod; }
+
+template<typename TRefresh>
+void DrawSorter::beginFrame(TRefresh&& refresh) {
+    nextFrame();
+
+    std::size_t kept = 0;
+    for (Entry& entry : entries) {
+        if (contains(entry.value)) { continue; }
+
+        std::uint64_t key = entry.key;
+        if (!refresh(entry.value, key)) { continue; }
+        mark(entry.value);
+        entries[kept++] = Entry{key, entry.value};
+    }
+    entries.resize(kept);
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef BLIB_RENDER_SCENES_INDIRECTDRAWBUILDER_HPP
+#define BLIB_RENDER_SCENES_INDIRECTDRAWBUILDER_HPP
+
+#include <BLIB/Render/Primitives/DrawParameters.hpp>
+#include <BLIB/Vulkan.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+/**
+ * @brief Builds compacted arrays of indirect draw commands on the CPU. Draws are grouped into
+ *        runs that share the same vertex and index buffers so that each run can be issued with a
+ *        single multi-draw indirect command. Empty draws are dropped. Builders may be filled in
+ *        parallel and then appended together in order
+ *
+ * @ingroup Renderer
+ */
+class IndirectDrawBuilder {
+public:
+    /**
+     * @brief A run of consecutive commands that share the same draw type and buffers
+     */
+    struct DrawGroup {
+        prim::DrawParameters::DrawType type;
+        VkBuffer vertexBuffer;
+        VkBuffer indexBuffer;
+        std::uint32_t firstCommand; // index into the command array of the corresponding type
+        std::uint32_t commandCount;
+    };
+
+    /**
+     * @brief Removes all commands and groups. Capacity is retained
+     */
+    void clear();
+
+    /**
+     * @brief Adds a draw command for a single object. Draws with no vertex buffer or no elements
+     *        are skipped
+     *
+     * @param params The draw parameters of the object
+     * @param sceneId The scene id of the object. Used as the instance index for single instances
+     */
+    void addDraw(const prim::DrawParameters& params, std::uint32_t sceneId);
+
+    /**
+     * @brief Appends all commands from the given builder after the commands in this one. The
+     *        first group of the other builder is merged into the last group of this one if they
+     *        share the same buffers
+     *
+     * @param other The builder to append
+     */
+    void append(const IndirectDrawBuilder& other);
+
+    /**
+     * @brief Returns whether or not there are no commands
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the total number of indexed and non-indexed commands
+     */
+    std::uint32_t commandCount() const;
+
+    /**
+     * @brief Returns the groups of commands in the order they were added
+     */
+    const std::vector<DrawGroup>& getGroups() const;
+
+    /**
+     * @brief Returns the indexed draw commands
+     */
+    const std::vector<VkDrawIndexedIndirectCommand>& getIndexedCommands() const;
+
+    /**
+     * @brief Returns the non-indexed draw commands
+     */
+    const std::vector<VkDrawIndirectCommand>& getVertexCommands() const;
+
+    /**
+     * @brief Returns the number of bytes required to store all commands with writeCommands()
+     */
+    VkDeviceSize byteSize() const;
+
+    /**
+     * @brief Returns the byte offset of the non-indexed commands written by writeCommands()
+     */
+    VkDeviceSize vertexCommandOffset() const;
+
+    /**
+     * @brief Copies the indexed commands followed by the non-indexed commands into the given
+     *        memory. Must have at least byteSize() bytes available
+     *
+     * @param dst The memory to write the commands to
+     */
+    void writeCommands(void* dst) const;
+
+private:
+    std::vector<DrawGroup> groups;
+    std::vector<VkDrawIndexedIndirectCommand> indexedCommands;
+    std::vector<VkDrawIndirectCommand> vertexCommands;
+
+    DrawGroup& getGroup(prim::DrawParameters::DrawType type, VkBuffer vertexBuffer,
+                        VkBuffer indexBuffer, std::uint32_t firstCommand);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline bool IndirectDrawBuilder::empty() const { return groups.empty(); }
+
+inline std::uint32_t IndirectDrawBuilder::commandCount() const {
+    return indexedCommands.size() + vertexCommands.size();
+}
+
+inline const std::vector<IndirectDrawBuilder::DrawGroup>& IndirectDrawBuilder::getGroups() const {
+    return groups;
+}
+
+inline const std::vector<VkDrawIndexedIndirectCommand>& IndirectDrawBuilder::getIndexedCommands()
+    const {
+    return indexedCommands;
+}
+
+inline const std::vector<VkDrawIndirectCommand>& IndirectDrawBuilder::getVertexCommands() const {
+    return vertexCommands;
+}
+
+inline VkDeviceSize IndirectDrawBuilder::vertexCommandOffset() const {
+    return indexedCommands.size() * sizeof(VkDrawIndexedIndirectCommand);
+}
+
+inline VkDeviceSize IndirectDrawBuilder::byteSize() const {
+    return vertexCommandOffset() + vertexCommands.size() * sizeof(VkDrawIndirectCommand);
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
+
+#endif
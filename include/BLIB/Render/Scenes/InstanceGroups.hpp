@@ -0,0 +1,233 @@
+#ifndef BLIB_RENDER_SCENES_INSTANCEGROUPS_HPP
+#define BLIB_RENDER_SCENES_INSTANCEGROUPS_HPP
+
+#include <BLIB/Render/Config/Limits.hpp>
+#include <BLIB/Render/Primitives/DrawParameters.hpp>
+#include <BLIB/Render/Scenes/InstanceIndexPool.hpp>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+/**
+ * @brief Incrementally groups objects that draw the exact same geometry. The scene ids of the
+ *        members of each group are kept in a contiguous range of a shared InstanceIndexPool that
+ *        is only updated when objects are added, removed, or change geometry. Runs of members in a
+ *        range are drawn with a single instanced draw whose instances are resolved to scene ids
+ *        through the pool by the shaders. Objects that cannot be instanced are kept in a separate
+ *        loose list
+ *
+ * @ingroup Renderer
+ */
+class InstanceGroups {
+public:
+    /// Returned by getGroup() for objects that are not in a group
+    static constexpr std::uint32_t NoGroup = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Creates an empty set of groups
+     *
+     * @param pool The pool to store the member ids of groups in
+     */
+    InstanceGroups(InstanceIndexPool& pool);
+
+    /**
+     * @brief Returns whether or not the given draw parameters can be drawn instanced
+     *
+     * @param params The draw parameters of an object
+     */
+    static bool isInstanceable(const prim::DrawParameters& params);
+
+    /**
+     * @brief Returns whether or not the given draw parameters draw the same geometry as the key
+     *
+     * @param params The draw parameters of an object
+     * @param key The draw parameters of a group
+     */
+    static bool matches(const prim::DrawParameters& params, const prim::DrawParameters& key);
+
+    /**
+     * @brief Adds an object. Must not already be added
+     *
+     * @param id The scene id of the object
+     * @param params The current draw parameters of the object
+     */
+    void add(std::uint32_t id, const prim::DrawParameters& params);
+
+    /**
+     * @brief Removes an object. Does nothing if the object is not added
+     *
+     * @param id The scene id of the object to remove
+     */
+    void remove(std::uint32_t id);
+
+    /**
+     * @brief Moves the object to a different group if its draw parameters changed. Adds the object
+     *        if it is not already added
+     *
+     * @param id The scene id of the object
+     * @param params The current draw parameters of the object
+     */
+    void update(std::uint32_t id, const prim::DrawParameters& params);
+
+    /**
+     * @brief Returns whether or not the given object is added
+     *
+     * @param id The scene id of the object
+     */
+    bool contains(std::uint32_t id) const;
+
+    /**
+     * @brief Returns the group the given object is in
+     *
+     * @param id The scene id of the object
+     * @return The index of the group, or NoGroup if the object is loose or not added
+     */
+    std::uint32_t getGroup(std::uint32_t id) const;
+
+    /**
+     * @brief Returns the first pool slot of the given group. Slots of groups that share a pool are
+     *        unique and less than the capacity of the pool
+     *
+     * @param group The index of the group
+     */
+    std::uint32_t getGroupSlot(std::uint32_t group) const;
+
+    /**
+     * @brief Returns the number of groups with at least one member
+     */
+    std::uint32_t groupCount() const;
+
+    /**
+     * @brief Returns the ids of objects that cannot be drawn instanced
+     */
+    const std::vector<std::uint32_t>& getLoose() const;
+
+    /**
+     * @brief Calls the given callbacks to produce instanced draws for every group. Runs are broken
+     *        at members that are excluded
+     *
+     * @tparam TInclude Callback type with signature bool(std::uint32_t id, const DrawParameters&)
+     * @tparam TEmit Callback type with signature void(const DrawParameters&, std::uint32_t)
+     * @param include Called once per member in order. Return false to leave the member out
+     * @param emit Called with the draw parameters and first id of each run. The instance count of
+     *             the parameters is set to the run. The first instance is the pool slot of the run
+     *             offset by InstanceIndexBase
+     */
+    template<typename TInclude, typename TEmit>
+    void forEachRun(TInclude&& include, TEmit&& emit) const;
+
+    /**
+     * @brief Produces the instanced draws of a single group. See forEachRun() above
+     *
+     * @tparam TInclude Callback type with signature bool(std::uint32_t id, const DrawParameters&)
+     * @tparam TEmit Callback type with signature void(const DrawParameters&, std::uint32_t)
+     * @param group The index of the group to draw
+     * @param include Called once per member in order. Return false to leave the member out
+     * @param emit Called with the draw parameters and first id of each run
+     */
+    template<typename TInclude, typename TEmit>
+    void forEachRun(std::uint32_t group, TInclude&& include, TEmit&& emit) const;
+
+private:
+    static constexpr std::uint32_t LooseGroup  = NoGroup - 1;
+    static constexpr std::uint32_t MinCapacity = 4;
+
+    struct Slot {
+        std::uint32_t group;
+        std::uint32_t index;
+    };
+
+    struct Group {
+        prim::DrawParameters key;
+        InstanceIndexPool::Range range;
+        std::uint32_t count;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const prim::DrawParameters& key) const;
+    };
+
+    struct KeyEqual {
+        bool operator()(const prim::DrawParameters& left,
+                        const prim::DrawParameters& right) const {
+            return matches(left, right);
+        }
+    };
+
+    InstanceIndexPool* pool;
+    std::vector<Slot> slots;
+    std::vector<Group> groups;
+    std::vector<std::uint32_t> freeGroups;
+    std::unordered_map<prim::DrawParameters, std::uint32_t, KeyHash, KeyEqual> lookup;
+    std::vector<std::uint32_t> loose;
+    std::uint32_t activeGroups;
+
+    std::uint32_t getOrCreateGroup(const prim::DrawParameters& params);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline bool InstanceGroups::contains(std::uint32_t id) const {
+    return id < slots.size() && slots[id].group != NoGroup;
+}
+
+inline std::uint32_t InstanceGroups::getGroup(std::uint32_t id) const {
+    return contains(id) && slots[id].group != LooseGroup ? slots[id].group : NoGroup;
+}
+
+inline std::uint32_t InstanceGroups::getGroupSlot(std::uint32_t group) const {
+    return groups[group].range.offset;
+}
+
+inline std::uint32_t InstanceGroups::groupCount() const { return activeGroups; }
+
+inline const std::vector<std::uint32_t>& InstanceGroups::getLoose() const { return loose; }
+
+template<typename TInclude, typename TEmit>
+void InstanceGroups::forEachRun(TInclude&& include, TEmit&& emit) const {
+    for (std::uint32_t group = 0; group < groups.size(); ++group) {
+        forEachRun(group, include, emit);
+    }
+}
+
+template<typename TInclude, typename TEmit>
+void InstanceGroups::forEachRun(std::uint32_t g, TInclude&& include, TEmit&& emit) const {
+    const Group& group = groups[g];
+    if (group.count == 0) { return; }
+
+    prim::DrawParameters params = group.key;
+    std::uint32_t first         = 0;
+    std::uint32_t count         = 0;
+    const auto flush            = [this, &params, &first, &count, &emit]() {
+        if (count > 0) {
+            params.instanceCount = count;
+            params.firstInstance = cfg::Limits::InstanceIndexBase + first;
+            emit(params, (*pool)[first]);
+            count = 0;
+        }
+    };
+
+    const std::uint32_t end = group.range.offset + group.count;
+    for (std::uint32_t slot = group.range.offset; slot < end; ++slot) {
+        if (!include((*pool)[slot], group.key)) {
+            flush();
+            continue;
+        }
+        if (count == 0) { first = slot; }
+        ++count;
+    }
+    flush();
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef BLIB_RENDER_SCENES_INSTANCEINDEXPOOL_HPP
+#define BLIB_RENDER_SCENES_INSTANCEINDEXPOOL_HPP
+
+#include <BLIB/Util/OffsetAllocator.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+/**
+ * @brief Host side storage of the scene ids that instanced draws index into. Instance groups
+ *        allocate contiguous ranges of slots and keep the ids of their members in them. Changed
+ *        slots are tracked so that only they are copied to the GPU
+ *
+ * @ingroup Renderer
+ */
+class InstanceIndexPool {
+public:
+    using Range = util::OffsetAllocator::Allocation;
+
+    /**
+     * @brief Creates an empty pool
+     */
+    InstanceIndexPool();
+
+    /**
+     * @brief Allocates a range of slots. Grows the pool if there is no large enough free range
+     *
+     * @param size The number of slots to allocate
+     * @return The allocated range
+     */
+    Range allocate(std::uint32_t size);
+
+    /**
+     * @brief Returns a range to the pool
+     *
+     * @param range The range to release
+     */
+    void release(const Range& range);
+
+    /**
+     * @brief Sets the scene id in the given slot and marks it dirty
+     *
+     * @param slot The slot to set
+     * @param id The scene id to store
+     */
+    void set(std::uint32_t slot, std::uint32_t id);
+
+    /**
+     * @brief Copies a block of slots to a different location and marks the destination dirty
+     *
+     * @param dst The first slot to copy to
+     * @param src The first slot to copy from
+     * @param count The number of slots to copy
+     */
+    void copy(std::uint32_t dst, std::uint32_t src, std::uint32_t count);
+
+    /**
+     * @brief Returns the scene id stored in the given slot
+     *
+     * @param slot The slot to read. Not bounds checked
+     */
+    std::uint32_t operator[](std::uint32_t slot) const;
+
+    /**
+     * @brief Returns the number of slots in the pool
+     */
+    std::uint32_t capacity() const;
+
+    /**
+     * @brief Returns the first slot changed since the last call to markClean()
+     */
+    std::uint32_t dirtyBegin() const;
+
+    /**
+     * @brief Returns one past the last slot changed since the last call to markClean()
+     */
+    std::uint32_t dirtyEnd() const;
+
+    /**
+     * @brief Returns whether or not any slots changed since the last call to markClean()
+     */
+    bool isDirty() const;
+
+    /**
+     * @brief Resets the dirty range
+     */
+    void markClean();
+
+private:
+    util::OffsetAllocator allocator;
+    std::vector<std::uint32_t> ids;
+    std::uint32_t dirtyStart;
+    std::uint32_t dirtyStop;
+
+    void markDirty(std::uint32_t start, std::uint32_t count);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline std::uint32_t InstanceIndexPool::operator[](std::uint32_t slot) const { return ids[slot]; }
+
+inline std::uint32_t InstanceIndexPool::capacity() const { return ids.size(); }
+
+inline std::uint32_t InstanceIndexPool::dirtyBegin() const { return dirtyStart; }
+
+inline std::uint32_t InstanceIndexPool::dirtyEnd() const { return dirtyStop; }
+
+inline bool InstanceIndexPool::isDirty() const { return dirtyStart < dirtyStop; }
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
+
+#endif
@@ -169,6 +169,15 @@ protected:
      */
     virtual void doObjectRemoval(scene::SceneObject* object, mat::MaterialPipeline* pipeline) = 0;
 
+    /**
+     * @brief Called by Scene in syncObjects for objects whose draw parameters changed. Default
+     *        does nothing
+     *
+     * @param object The object whose draw parameters changed
+     * @param pipeline The pipeline used to render the object
+     */
+    virtual void doGeometryChange(scene::SceneObject* object, mat::MaterialPipeline* pipeline);
+
     /**
      * @brief Called when a new observer is going to render the scene
      *
@@ -212,6 +221,7 @@ private:
     std::vector<ObjectAdd> queuedAdds;
     std::vector<scene::SceneObject*> queuedRemovals;
     std::vector<BatchChange> queuedBatchChanges;
+    std::vector<scene::SceneObject*> queuedGeometryChanges;
 
     void addQueuedObject(ObjectAdd& object);
     void removeQueuedObject(scene::SceneObject* object);
@@ -221,6 +231,7 @@ private:
 
     // called by DrawableBase
     void rebucketObject(rcom::DrawableBase& object);
+    void updateObjectGeometry(rcom::DrawableBase& object);
 
     // called by Observer
     void syncShaderResources();
@@ -60,6 +60,17 @@ protected:
      */
     virtual void setDefaultNearAndFarPlanes(cam::Camera& camera) const override;
 
+    /**
+     * @brief Fetches the Transform2D of the given entity for culling
+     *
+     * @param entity The entity to get the transform for
+     * @param version The version the bounds were computed with. Set to the current version
+     * @param transform The matrix to populate. Only populated if the version changed
+     * @return True if the entity has a transform, false otherwise
+     */
+    virtual bool getObjectTransform(ecs::Entity entity, std::uint32_t& version,
+                                    glm::mat4& transform) override;
+
 private:
     lgt::Scene2DLighting lighting;
 };
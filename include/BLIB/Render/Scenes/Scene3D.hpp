@@ -65,6 +65,24 @@ protected:
      */
     virtual void onShaderResourceSync() override;
 
+    /**
+     * @brief Fetches the Transform3D of the given entity for culling
+     *
+     * @param entity The entity to get the transform for
+     * @param version The version the bounds were computed with. Set to the current version
+     * @param transform The matrix to populate. Only populated if the version changed
+     * @return True if the entity has a transform, false otherwise
+     */
+    virtual bool getObjectTransform(ecs::Entity entity, std::uint32_t& version,
+                                    glm::mat4& transform) override;
+
+    /**
+     * @brief Creates cull volumes for the sun and each shadow casting light
+     *
+     * @param volumes The vector of volumes to populate
+     */
+    virtual void collectShadowCullVolumes(std::vector<ShadowCullVolume>& volumes) override;
+
 private:
     lgt::Scene3DLighting lighting;
 };
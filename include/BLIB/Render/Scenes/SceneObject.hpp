@@ -33,14 +33,10 @@ struct SceneObject {
      */
     SceneObject();
 
-    /**
-     * @brief Called by BatchedScene when scene object addresses change
-     */
-    void updateRefToThis();
-
     ecs::Entity entity;
     Key sceneKey;
     rcom::DrawableBase* component;
+    std::uint32_t batchIndex; // index of this object within its batch for fast removal
 };
 
 } // namespace scene
@@ -8,6 +8,8 @@
 #include <BLIB/Render/Scenes/SceneObject.hpp>
 #include <BLIB/Render/ShaderResources/EntityComponentShaderResource.hpp>
 #include <BLIB/Util/IdAllocatorUnbounded.hpp>
+#include <algorithm>
+#include <memory>
 #include <queue>
 #include <type_traits>
 #include <vector>
@@ -19,7 +21,8 @@ namespace rc
 namespace scene
 {
 /**
- * @brief Storage for scene objects. Splits objects by update frequency
+ * @brief Storage for scene objects. Splits objects by update frequency. Objects are stored in
+ *        fixed size pages so that their addresses remain stable as the storage grows
  *
  * @tparam T The type of SceneObject to provide storage for
  * @ingroup Renderer
@@ -30,23 +33,24 @@ class SceneObjectStorage {
                   "T must be SceneObject or derived from SceneObject");
 
 public:
+    /// The number of objects in each page of storage
+    static constexpr std::uint32_t PageSize = cfg::Constants::DefaultSceneObjectCapacity;
+
     /**
      * @brief Represents the result of an allocation of an object
      */
     struct AllocateResult {
         T* newObject;
-        bool addressesChanged;
-        T* originalBaseAddress;
         std::uint32_t newCapacity;
     };
 
     /**
-     * @brief Reserves some memory
+     * @brief Creates empty storage
      */
     SceneObjectStorage() = default;
 
     /**
-     * @brief Allocates a new scene object, growing the buffer if required
+     * @brief Allocates a new scene object, adding a page if required. Existing objects never move
      *
      * @param updateFreq The update speed of the new object
      * @param entity The ECS id of the new object
@@ -85,22 +89,17 @@ public:
     template<typename TCallback>
     void forEach(TCallback&& callback);
 
-    /**
-     * @brief Gets a new pointer from an old pointer. Call after a pool grows
-     *
-     * @param speed The object pool to rebase on
-     * @param original The original pointer
-     * @param oldBase The original pool base pointer
-     * @return The new object pointer
-     */
-    T* rebase(UpdateSpeed speed, T* original, T* oldBase);
-
 private:
     struct Bucket {
-        std::vector<T> objects;
+        std::vector<std::unique_ptr<T[]>> pages;
         util::IdAllocatorUnbounded<std::uint32_t> idAllocator;
+        std::uint32_t size;
 
-        Bucket() { objects.reserve(cfg::Constants::DefaultSceneObjectCapacity); }
+        Bucket()
+        : size(0) {}
+
+        T& get(std::uint32_t id) { return pages[id / PageSize][id % PageSize]; }
+        std::uint32_t capacity() const { return pages.size() * PageSize; }
     };
 
     Bucket staticBucket;
@@ -114,18 +113,16 @@ typename SceneObjectStorage<T>::AllocateResult SceneObjectStorage<T>::allocate(
     UpdateSpeed updateFreq, ecs::Entity entity) {
     AllocateResult result{};
 
-    Bucket& bucket             = updateFreq == UpdateSpeed::Static ? staticBucket : dynamicBucket;
-    result.originalBaseAddress = bucket.objects.data();
-
+    Bucket& bucket         = updateFreq == UpdateSpeed::Static ? staticBucket : dynamicBucket;
     const std::uint32_t id = bucket.idAllocator.allocate();
-    if (id >= bucket.objects.size()) { bucket.objects.resize(id + 1); }
+    if (id >= bucket.capacity()) { bucket.pages.emplace_back(std::make_unique<T[]>(PageSize)); }
+    bucket.size = std::max(bucket.size, id + 1);
 
-    result.addressesChanged               = bucket.objects.data() != result.originalBaseAddress;
-    result.newObject                      = &bucket.objects[id];
+    result.newObject                      = &bucket.get(id);
     result.newObject->sceneKey.sceneId    = id;
     result.newObject->entity              = entity;
     result.newObject->sceneKey.updateFreq = updateFreq;
-    result.newCapacity                    = bucket.objects.capacity();
+    result.newCapacity                    = bucket.capacity();
 
     return result;
 }
@@ -133,7 +130,7 @@ typename SceneObjectStorage<T>::AllocateResult SceneObjectStorage<T>::allocate(
 template<typename T>
 inline T& SceneObjectStorage<T>::getObject(Key key) {
     Bucket& bucket = key.updateFreq == UpdateSpeed::Static ? staticBucket : dynamicBucket;
-    return bucket.objects[key.sceneId];
+    return bucket.get(key.sceneId);
 }
 
 template<typename T>
@@ -146,27 +143,21 @@ template<typename T>
 void SceneObjectStorage<T>::unlinkAll(ds::DescriptorSetInstanceCache& descriptors) {
     UpdateSpeed speed = UpdateSpeed::Static;
     for (Bucket* bucket : {&staticBucket, &dynamicBucket}) {
-        for (unsigned int i = 0; i < bucket->objects.size(); ++i) {
+        for (std::uint32_t i = 0; i < bucket->size; ++i) {
             if (bucket->idAllocator.isAllocated(i)) {
-                descriptors.unlinkSceneObject(bucket->objects[i].entity, {speed, i});
+                descriptors.unlinkSceneObject(bucket->get(i).entity, {speed, i});
             }
         }
         speed = UpdateSpeed::Dynamic;
     }
 }
 
-template<typename T>
-T* SceneObjectStorage<T>::rebase(UpdateSpeed speed, T* og, T* ob) {
-    auto& bucket = speed == UpdateSpeed::Static ? staticBucket : dynamicBucket;
-    return bucket.objects.data() + (og - ob);
-}
-
 template<typename T>
 template<typename TCallback>
 void SceneObjectStorage<T>::forEach(TCallback&& callback) {
     for (Bucket* bucket : {&staticBucket, &dynamicBucket}) {
-        for (unsigned int i = 0; i < bucket->objects.size(); ++i) {
-            if (bucket->idAllocator.isAllocated(i)) { callback(bucket->objects[i]); }
+        for (std::uint32_t i = 0; i < bucket->size; ++i) {
+            if (bucket->idAllocator.isAllocated(i)) { callback(bucket->get(i)); }
         }
     }
 }
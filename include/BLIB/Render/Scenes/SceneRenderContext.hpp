@@ -6,6 +6,7 @@
 #include <BLIB/Render/Materials/MaterialPipeline.hpp>
 #include <BLIB/Render/Primitives/DrawParameters.hpp>
 #include <BLIB/Render/RenderPhase.hpp>
+#include <BLIB/Render/Scenes/IndirectDrawBuilder.hpp>
 #include <BLIB/Render/Scenes/SceneObject.hpp>
 #include <BLIB/Vulkan.hpp>
 #include <array>
@@ -73,6 +74,26 @@ public:
      */
     void renderObject(const rcom::DrawableBase& object);
 
+    /**
+     * @brief Issues the required commands to draw with the given parameters
+     *
+     * @param params The draw parameters to render with
+     * @param sceneId The scene id to use as the instance index when drawing a single instance
+     */
+    void renderDraw(const prim::DrawParameters& params, std::uint32_t sceneId);
+
+    /**
+     * @brief Issues indirect draw commands for the given prebuilt commands. The commands must
+     *        have already been written to the given buffer with IndirectDrawBuilder::writeCommands
+     *
+     * @param draws The builder that the commands were built with
+     * @param buffer The buffer containing the written commands
+     * @param offset The byte offset of the commands in the buffer
+     * @param maxDrawsPerCall Maximum number of commands per draw call. 1 if multi-draw is absent
+     */
+    void renderIndirect(const IndirectDrawBuilder& draws, VkBuffer buffer, VkDeviceSize offset,
+                        std::uint32_t maxDrawsPerCall);
+
     /**
      * @brief Returns the current render phase
      */
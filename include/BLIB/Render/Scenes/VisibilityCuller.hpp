@@ -0,0 +1,233 @@
+#ifndef BLIB_RENDER_SCENES_VISIBILITYCULLER_HPP
+#define BLIB_RENDER_SCENES_VISIBILITYCULLER_HPP
+
+#include <BLIB/Render/Scenes/Key.hpp>
+#include <BLIB/Util/ThreadPool.hpp>
+#include <array>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+/**
+ * @brief Set of planes extracted from a view projection matrix. Plane normals point inwards
+ *
+ * @ingroup Renderer
+ */
+struct Frustum {
+    /// Plane ordering: left, right, bottom, top, near, far. xyz is the normal and w the distance
+    std::array<glm::vec4, 6> planes;
+
+    /**
+     * @brief Extracts the frustum planes from the given view projection matrix. Depth is assumed
+     *        to be in the range [0, 1]
+     *
+     * @param viewProj The combined projection and view matrix
+     * @param includeDepthPlanes False to only cull against the side planes
+     * @return The frustum for the given matrix
+     */
+    static Frustum fromMatrix(const glm::mat4& viewProj, bool includeDepthPlanes = true);
+
+    /**
+     * @brief Tests whether the given sphere is at least partially inside of the frustum
+     *
+     * @param center The center of the sphere
+     * @param radius The radius of the sphere
+     * @return True if the sphere is visible, false if it is fully outside
+     */
+    bool containsSphere(const glm::vec3& center, float radius) const;
+};
+
+/**
+ * @brief Per-object world space bounding spheres stored in SoA form so that culling loops can be
+ *        vectorized. Objects with a negative radius are never culled
+ *
+ * @ingroup Renderer
+ */
+class CullingBounds {
+public:
+    /**
+     * @brief Creates empty bounds
+     */
+    CullingBounds();
+
+    /**
+     * @brief Resizes the storage. New objects are never culled until their bounds are set
+     *
+     * @param size The number of objects to store bounds for
+     */
+    void resize(std::uint32_t size);
+
+    /**
+     * @brief Returns the number of objects stored
+     */
+    std::uint32_t size() const;
+
+    /**
+     * @brief Returns the number of objects that have bounds and may be culled
+     */
+    std::uint32_t boundedCount() const;
+
+    /**
+     * @brief Sets the world space bounding sphere of the given object
+     *
+     * @param i The index of the object
+     * @param center The center of the bounding sphere
+     * @param radius The radius of the bounding sphere
+     */
+    void set(std::uint32_t i, const glm::vec3& center, float radius);
+
+    /**
+     * @brief Marks the given object as never culled
+     *
+     * @param i The index of the object
+     * @param center The world space position of the object, used for draw sorting
+     */
+    void setAlwaysVisible(std::uint32_t i, const glm::vec3& center = glm::vec3(0.f));
+
+    /**
+     * @brief Returns the world space center of the given object
+     *
+     * @param i The index of the object
+     * @param center Populated with the center of the object
+     * @return True if the center was populated, false if the index is out of range
+     */
+    bool getCenter(std::uint32_t i, glm::vec3& center) const;
+
+private:
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> radius;
+    std::uint32_t bounded;
+
+    friend class VisibilityCuller;
+};
+
+/**
+ * @brief Visibility results for a single observer or light. Objects outside of the tested range
+ *        are considered visible
+ *
+ * @ingroup Renderer
+ */
+class VisibilitySet {
+public:
+    /// Counters from the most recent cull. Objects that are never culled are not counted
+    struct Stats {
+        std::uint32_t visible;
+        std::uint32_t culled;
+
+        Stats()
+        : visible(0)
+        , culled(0) {}
+    };
+
+    /**
+     * @brief Returns whether the object with the given key passed the most recent cull
+     *
+     * @param key The scene key of the object
+     */
+    bool isVisible(const Key& key) const;
+
+    /**
+     * @brief Returns the number of visible and culled objects from the most recent cull
+     */
+    const Stats& getStats() const;
+
+    /**
+     * @brief Marks every object as visible
+     */
+    void clear();
+
+private:
+    std::array<std::vector<std::uint8_t>, 2> visible;
+    Stats stats;
+
+    friend class VisibilityCuller;
+};
+
+/**
+ * @brief Culls object bounds against frustums or spheres. Has no device dependencies
+ *
+ * @ingroup Renderer
+ */
+class VisibilityCuller {
+public:
+    /// Ranges with fewer objects than this are culled on the calling thread
+    static constexpr std::uint32_t MinParallelCount = 4096;
+
+    /**
+     * @brief Tests every object in the given bounds against the frustum
+     *
+     * @param bounds The static and dynamic object bounds, indexed by UpdateSpeed
+     * @param frustum The frustum to test against
+     * @param result The visibility set to populate
+     * @param threadPool Optional thread pool to split large object counts across
+     */
+    static void cull(const std::array<CullingBounds, 2>& bounds, const Frustum& frustum,
+                     VisibilitySet& result, util::ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Tests every object in the given bounds against a sphere. Used for point lights
+     *
+     * @param bounds The static and dynamic object bounds, indexed by UpdateSpeed
+     * @param center The center of the sphere to test against
+     * @param radius The radius of the sphere to test against
+     * @param result The visibility set to populate
+     * @param threadPool Optional thread pool to split large object counts across
+     */
+    static void cull(const std::array<CullingBounds, 2>& bounds, const glm::vec3& center,
+                     float radius, VisibilitySet& result, util::ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Tests a range of objects against the frustum. Branch-free so that it vectorizes
+     *
+     * @param bounds The object bounds to test
+     * @param frustum The frustum to test against
+     * @param begin The first object index to test
+     * @param end One past the last object index to test
+     * @param out Output array indexed by object. Set to 1 if visible and 0 if culled
+     * @return The number of objects with bounds in the range that passed the test
+     */
+    static std::uint32_t cullRange(const CullingBounds& bounds, const Frustum& frustum,
+                                   std::uint32_t begin, std::uint32_t end, std::uint8_t* out);
+
+    /**
+     * @brief Tests a range of objects against a sphere. Branch-free so that it vectorizes
+     *
+     * @param bounds The object bounds to test
+     * @param center The center of the sphere to test against
+     * @param radius The radius of the sphere to test against
+     * @param begin The first object index to test
+     * @param end One past the last object index to test
+     * @param out Output array indexed by object. Set to 1 if visible and 0 if culled
+     * @return The number of objects with bounds in the range that passed the test
+     */
+    static std::uint32_t cullRange(const CullingBounds& bounds, const glm::vec3& center,
+                                   float radius, std::uint32_t begin, std::uint32_t end,
+                                   std::uint8_t* out);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline std::uint32_t CullingBounds::size() const { return radius.size(); }
+
+inline std::uint32_t CullingBounds::boundedCount() const { return bounded; }
+
+inline bool VisibilitySet::isVisible(const Key& key) const {
+    const auto& v = visible[static_cast<std::uint8_t>(key.updateFreq)];
+    return key.sceneId >= v.size() || v[key.sceneId] != 0;
+}
+
+inline const VisibilitySet::Stats& VisibilitySet::getStats() const { return stats; }
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
+
+#endif
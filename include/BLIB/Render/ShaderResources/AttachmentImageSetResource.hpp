@@ -52,6 +52,29 @@ public:
      */
     vk::AttachmentImageSet& getImages() { return images; }
 
+    /**
+     * @brief Provides access to the underlying images
+     */
+    const vk::AttachmentImageSet& getImages() const { return images; }
+
+    /**
+     * @brief Re-creates the images in memory shared with other transient attachments
+     *
+     * @param memory The allocation to place the images in
+     * @param offset The offset of the first image within the allocation
+     */
+    void aliasMemory(VmaAllocation memory, VkDeviceSize offset) {
+        dirtyFrameCount = 0x1 << cfg::Limits::MaxConcurrentFrames;
+        images.alias(memory, offset);
+    }
+
+    /**
+     * @brief Re-creates the images in their own memory if they were placed in shared memory
+     */
+    void releaseAliasedMemory() {
+        if (images.isAliased()) { create(); }
+    }
+
 private:
     Renderer* renderer;
     RenderTarget* owner;
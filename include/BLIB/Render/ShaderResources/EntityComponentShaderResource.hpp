@@ -5,6 +5,7 @@
 #include <BLIB/Engine/HeaderHelpers.hpp>
 #include <BLIB/Render/Buffers/BufferDoubleHostVisibleSourced.hpp>
 #include <BLIB/Render/Buffers/BufferSingleDeviceLocalSourced.hpp>
+#include <BLIB/Render/Buffers/DirtySet.hpp>
 #include <BLIB/Render/Config/Constants.hpp>
 #include <BLIB/Render/Config/Limits.hpp>
 #include <BLIB/Render/Scenes/Key.hpp>
@@ -13,6 +14,8 @@
 #include <BLIB/Render/Vulkan/VulkanLayer.hpp>
 #include <BLIB/Vulkan.hpp>
 #include <functional>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace bl
@@ -28,18 +31,6 @@ namespace sr
  */
 class EntityComponentShaderResourceBase : public sr::ShaderResource {
 public:
-    /**
-     * @brief Represents a range of dirty elements
-     */
-    struct DirtyRange {
-        std::uint32_t start;
-        std::uint32_t end;
-
-        DirtyRange()
-        : start(1)
-        , end(0) {}
-    };
-
     /**
      * @brief Does nothing
      */
@@ -53,18 +44,32 @@ public:
     void markObjectDirty(scene::Key key);
 
     /**
-     * @brief Returns the ranges of dirty dynamic elements
+     * @brief Queues the given object to have its component copied on the next sync. Called by
+     *        components when they become dirty. Thread safe
+     *
+     * @param key The scene key of the object whose component changed
      */
-    const DirtyRange& dirtyDynamicRange() const;
+    void queueObjectRefresh(scene::Key key);
 
     /**
-     * @brief Returns the ranges of static dynamic elements
+     * @brief Returns the set of dirty dynamic elements
      */
-    const DirtyRange& dirtyStaticRange() const;
+    const buf::DirtySet& dirtyDynamicSet() const;
+
+    /**
+     * @brief Returns the set of dirty static elements
+     */
+    const buf::DirtySet& dirtyStaticSet() const;
+
+    /// Number of queued refreshes required before copying on a worker thread
+    static constexpr std::size_t MinParallelRefreshCount = 512;
 
 protected:
-    DirtyRange dirtyDynamic;
-    DirtyRange dirtyStatic;
+    buf::DirtySet dirtyDynamic;
+    buf::DirtySet dirtyStatic;
+    std::mutex refreshMutex;
+    std::vector<std::uint32_t> refreshDynamic;
+    std::vector<std::uint32_t> refreshStatic;
 };
 
 /**
@@ -131,6 +136,11 @@ public:
      */
     virtual void copyFromSource() override;
 
+    /**
+     * @brief Returns true if enough components have been queued to copy on a worker thread
+     */
+    virtual bool copyFromSourceInParallel() override;
+
     /**
      * @brief Returns a reference to the underlying dynamic buffer
      */
@@ -159,29 +169,31 @@ private:
     TStaticStorage staticBuffer;
     std::uint8_t dynamicRefresh;
     std::uint8_t staticRefresh;
+    std::vector<std::uint32_t> refreshing;
+
+    template<typename TStorage>
+    void refreshComponents(std::vector<std::uint32_t>& queue, std::vector<TCom*>& components,
+                           TStorage& storage);
 };
 
 //////////////////////////// INLINE FUNCTIONS /////////////////////////////////
 
 inline void EntityComponentShaderResourceBase::markObjectDirty(scene::Key key) {
-    auto& range = key.updateFreq == UpdateSpeed::Dynamic ? dirtyDynamic : dirtyStatic;
-    if (range.start > range.end) {
-        range.start = key.sceneId;
-        range.end   = key.sceneId;
-    }
-    else {
-        range.start = key.sceneId < range.start ? key.sceneId : range.start;
-        range.end   = key.sceneId > range.end ? key.sceneId : range.end;
-    }
+    auto& set = key.updateFreq == UpdateSpeed::Dynamic ? dirtyDynamic : dirtyStatic;
+    set.markDirty(key.sceneId);
 }
 
-inline const EntityComponentShaderResourceBase::DirtyRange&
-EntityComponentShaderResourceBase::dirtyDynamicRange() const {
+inline void EntityComponentShaderResourceBase::queueObjectRefresh(scene::Key key) {
+    std::unique_lock lock(refreshMutex);
+    auto& queue = key.updateFreq == UpdateSpeed::Dynamic ? refreshDynamic : refreshStatic;
+    queue.emplace_back(key.sceneId);
+}
+
+inline const buf::DirtySet& EntityComponentShaderResourceBase::dirtyDynamicSet() const {
     return dirtyDynamic;
 }
 
-inline const EntityComponentShaderResourceBase::DirtyRange&
-EntityComponentShaderResourceBase::dirtyStaticRange() const {
+inline const buf::DirtySet& EntityComponentShaderResourceBase::dirtyStaticSet() const {
     return dirtyStatic;
 }
 
@@ -254,15 +266,11 @@ void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage, TStaticStora
 template<typename TCom, typename TPayload, typename TDynamicStorage, typename TStaticStorage>
 void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage,
                                    TStaticStorage>::performTransfer() {
-    if (dirtyStatic.end >= dirtyStatic.start) {
-        staticBuffer.markDirty(dirtyStatic.start, dirtyStatic.end - dirtyStatic.start + 1);
-        staticBuffer.queueTransfer();
-        dirtyStatic = DirtyRange();
-    }
-    if (dirtyDynamic.end >= dirtyDynamic.start) {
-        dynamicBuffer.markDirty(dirtyDynamic.start, dirtyDynamic.end - dirtyDynamic.start + 1);
-        dirtyDynamic = DirtyRange();
-    }
+    // only the touched objects are uploaded, not the span between them
+    staticBuffer.markDirty(dirtyStatic);
+    dirtyStatic.reset();
+    dynamicBuffer.markDirty(dirtyDynamic);
+    dirtyDynamic.reset();
     dynamicRefresh = dynamicRefresh >> 1;
     staticRefresh  = staticRefresh >> 1;
 }
@@ -270,17 +278,26 @@ void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage,
 template<typename TCom, typename TPayload, typename TDynamicStorage, typename TStaticStorage>
 void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage,
                                    TStaticStorage>::copyFromSource() {
-    for (TCom* com : srcDynamicComponents) {
-        if (com && com->isDirty()) {
-            auto& payload     = dynamicBuffer[com->getSceneKey().sceneId];
-            using PayloadType = std::remove_reference_t<decltype(payload)>;
-            com->template refresh<PayloadType>(payload);
-            markObjectDirty(com->getSceneKey());
-        }
+    refreshComponents(refreshDynamic, srcDynamicComponents, dynamicBuffer);
+    refreshComponents(refreshStatic, srcStaticComponents, staticBuffer);
+}
+
+template<typename TCom, typename TPayload, typename TDynamicStorage, typename TStaticStorage>
+template<typename TStorage>
+void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage, TStaticStorage>::
+    refreshComponents(std::vector<std::uint32_t>& queue, std::vector<TCom*>& components,
+                      TStorage& storage) {
+    refreshing.clear();
+    {
+        std::unique_lock lock(refreshMutex);
+        std::swap(refreshing, queue);
     }
-    for (TCom* com : srcStaticComponents) {
+
+    // entries may be stale if the object was released or its id reused since it was queued
+    for (const std::uint32_t id : refreshing) {
+        TCom* com = id < components.size() ? components[id] : nullptr;
         if (com && com->isDirty()) {
-            auto& payload     = staticBuffer[com->getSceneKey().sceneId];
+            auto& payload     = storage[com->getSceneKey().sceneId];
             using PayloadType = std::remove_reference_t<decltype(payload)>;
             com->template refresh<PayloadType>(payload);
             markObjectDirty(com->getSceneKey());
@@ -288,6 +305,13 @@ void EntityComponentShaderResource<TCom, TPayload, TDynamicStorage,
     }
 }
 
+template<typename TCom, typename TPayload, typename TDynamicStorage, typename TStaticStorage>
+bool EntityComponentShaderResource<TCom, TPayload, TDynamicStorage,
+                                   TStaticStorage>::copyFromSourceInParallel() {
+    std::unique_lock lock(refreshMutex);
+    return refreshDynamic.size() + refreshStatic.size() >= MinParallelRefreshCount;
+}
+
 template<typename TCom, typename TPayload, typename TDynamicStorage, typename TStaticStorage>
 TDynamicStorage&
 EntityComponentShaderResource<TCom, TPayload, TDynamicStorage, TStaticStorage>::getDynamicBuffer() {
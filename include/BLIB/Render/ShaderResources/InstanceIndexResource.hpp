@@ -0,0 +1,56 @@
+#ifndef BLIB_RENDER_SHADERRESOURCES_INSTANCEINDEXRESOURCE_HPP
+#define BLIB_RENDER_SHADERRESOURCES_INSTANCEINDEXRESOURCE_HPP
+
+#include <BLIB/Render/Buffers/BufferDoubleHostVisibleSourced.hpp>
+#include <BLIB/Render/ShaderResources/BufferShaderResource.hpp>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+class InstanceIndexPool;
+}
+
+namespace sri
+{
+/**
+ * @brief Shader resource holding the scene ids that instanced draws resolve their instances to.
+ *        Instance indices at or above cfg::Limits::InstanceIndexBase index into this buffer
+ *
+ * @ingroup Renderer
+ */
+class InstanceIndexResource
+: public sr::BufferShaderResource<buf::BufferDoubleHostVisibleSourced<std::uint32_t>, 256> {
+public:
+    /**
+     * @brief Creates the shader resource
+     */
+    InstanceIndexResource();
+
+    /**
+     * @brief Destroys the shader resource
+     */
+    virtual ~InstanceIndexResource() = default;
+
+    /**
+     * @brief Copies the changed slots of the pool into the buffer and marks the pool clean
+     *
+     * @param pool The pool of instance indices of the owning scene
+     */
+    void sync(scene::InstanceIndexPool& pool);
+
+private:
+    std::uint32_t dirtyFrames;
+
+    virtual bool dynamicDescriptorUpdateRequired() const override;
+    virtual bool staticDescriptorUpdateRequired() const override;
+    virtual void performTransfer() override;
+};
+
+} // namespace sri
+} // namespace rc
+} // namespace bl
+
+#endif
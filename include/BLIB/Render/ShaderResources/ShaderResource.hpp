@@ -59,6 +59,13 @@ public:
      */
     virtual void copyFromSource() = 0;
 
+    /**
+     * @brief Returns whether copyFromSource() has enough pending work to be worth running on a
+     *        worker thread. Resources returning true must be safe to copy concurrently with other
+     *        resources. Default is false
+     */
+    virtual bool copyFromSourceInParallel() { return false; }
+
     /**
      * @brief Returns true if the dynamic descriptor sets need to be updated this frame
      */
@@ -0,0 +1,122 @@
+#ifndef BLIB_RENDER_TRANSFERS_STAGINGRING_HPP
+#define BLIB_RENDER_TRANSFERS_STAGINGRING_HPP
+
+#include <cstdint>
+#include <deque>
+
+namespace bl
+{
+namespace rc
+{
+namespace tfr
+{
+/**
+ * @brief Allocation bookkeeping for a persistent ring of staging memory shared by the frames in
+ *        flight. Regions are sub-allocated linearly and released once the frame that allocated
+ *        them has completed. Memory is reclaimed in allocation order so that the free space is
+ *        always contiguous
+ *
+ * @ingroup Renderer
+ */
+class StagingRing {
+public:
+    /// Default size of the staging ring in bytes
+    static constexpr std::uint64_t DefaultCapacity = 16 * 1024 * 1024;
+
+    /// Default alignment of regions. Covers the texel block size of every format
+    static constexpr std::uint64_t DefaultAlignment = 16;
+
+    /**
+     * @brief Usage statistics of the ring
+     */
+    struct Stats {
+        std::uint64_t highWaterMark;
+        std::uint64_t frameBytes;
+        std::uint64_t frameHighWaterMark;
+        std::uint32_t fallbackCount;
+        std::uint64_t fallbackBytes;
+
+        Stats();
+    };
+
+    /**
+     * @brief Creates the ring
+     *
+     * @param capacity The size of the ring in bytes
+     */
+    StagingRing(std::uint64_t capacity = DefaultCapacity);
+
+    /**
+     * @brief Starts using the given frame slot. Releases the regions allocated the last time the
+     *        slot was used. Only call once the GPU is done with those regions
+     *
+     * @param frame The frame slot to begin
+     */
+    void beginFrame(std::uint32_t frame);
+
+    /**
+     * @brief Sub-allocates a region for the current frame
+     *
+     * @param size The size of the region in bytes
+     * @param offset Populated with the offset of the region within the ring
+     * @param alignment The required alignment of the region offset
+     * @return True if the region was allocated, false if the caller must use a dedicated buffer
+     */
+    bool allocate(std::uint64_t size, std::uint64_t& offset,
+                  std::uint64_t alignment = DefaultAlignment);
+
+    /**
+     * @brief Records that an allocation did not fit in the ring and used a dedicated buffer
+     *
+     * @param size The size of the dedicated buffer
+     */
+    void recordFallback(std::uint64_t size);
+
+    /**
+     * @brief Returns the size of the ring in bytes
+     */
+    std::uint64_t capacity() const;
+
+    /**
+     * @brief Returns the number of bytes currently in use, including alignment padding
+     */
+    std::uint64_t used() const;
+
+    /**
+     * @brief Returns the usage statistics of the ring
+     */
+    const Stats& getStats() const;
+
+    /**
+     * @brief Resets the high water marks and fallback counts
+     */
+    void resetStats();
+
+private:
+    struct Span {
+        std::uint32_t frame;
+        std::uint64_t bytes;
+        bool released;
+    };
+
+    const std::uint64_t size;
+    std::uint64_t head;
+    std::uint64_t inUse;
+    std::uint32_t currentFrame;
+    std::deque<Span> spans;
+    Stats stats;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline std::uint64_t StagingRing::capacity() const { return size; }
+
+inline std::uint64_t StagingRing::used() const { return inUse; }
+
+inline const StagingRing::Stats& StagingRing::getStats() const { return stats; }
+
+} // namespace tfr
+} // namespace rc
+} // namespace bl
+
+#endif
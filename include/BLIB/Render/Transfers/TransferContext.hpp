@@ -1,6 +1,7 @@
 #ifndef BLIB_RENDER_TRANSFERS_TRANSFERCONTEXT_HPP
 #define BLIB_RENDER_TRANSFERS_TRANSFERCONTEXT_HPP
 
+#include <BLIB/Render/Transfers/StagingRing.hpp>
 #include <BLIB/Vulkan.hpp>
 #include <mutex>
 #include <vector>
@@ -30,6 +31,20 @@ public:
     void createTemporaryStagingBuffer(VkDeviceSize size, VkBuffer& bufferResult,
                                       void** mappedMemory);
 
+    /**
+     * @brief Allocates a staging region of the given size from the persistent staging ring. Falls
+     *        back to a dedicated staging buffer if the region does not fit. Should only be called
+     *        from Transferable::executeTransferAndInsertBarriers. Regions are released once the
+     *        transfers of the frame have completed
+     *
+     * @param size Size of the staging region to allocate
+     * @param bufferResult Buffer handle to populate
+     * @param offset Populated with the offset of the region within the buffer
+     * @param mappedMemory Pointer to a void pointer which will be populated with the write address
+     */
+    void createTemporaryStagingBuffer(VkDeviceSize size, VkBuffer& bufferResult,
+                                      VkDeviceSize& offset, void** mappedMemory);
+
     /**
      * @brief Registers the given barrier to be recorded after all transfers are started
      *
@@ -60,6 +75,7 @@ public:
      * @brief Internal constructor, do not use
      */
     TransferContext(std::mutex& bucketMutex, vk::VulkanLayer& vulkanState,
+                    StagingRing& stagingRing, VkBuffer ringBuffer, void* ringMemory,
                     std::vector<VkBuffer>& stagingBuffers,
                     std::vector<VmaAllocation>& stagingAllocs,
                     std::vector<VkMemoryBarrier>& memoryBarriers,
@@ -69,6 +85,9 @@ public:
 private:
     std::mutex& bucketMutex;
     vk::VulkanLayer& vulkanState;
+    StagingRing& stagingRing;
+    VkBuffer ringBuffer;
+    void* ringMemory;
     std::vector<VkBuffer>& stagingBuffers;
     std::vector<VmaAllocation>& stagingAllocs;
     std::vector<VkMemoryBarrier>& memoryBarriers;
@@ -50,6 +50,16 @@ public:
      */
     std::uint32_t* createOneTimeIndexStorage(std::uint32_t count);
 
+    /**
+     * @brief Returns the staging ring usage of the transfers that run every frame
+     */
+    const StagingRing::Stats& getStagingStats() const;
+
+    /**
+     * @brief Returns the staging ring usage of the transfers that wait for the device to be idle
+     */
+    const StagingRing::Stats& getDeviceIdleStagingStats() const;
+
 private:
     struct Bucket {
         std::mutex mutex;
@@ -58,13 +68,17 @@ private:
         vk::PerFrame<VkFence> fence;
         vk::PerFrame<std::vector<VkBuffer>> stagingBuffers;
         vk::PerFrame<std::vector<VmaAllocation>> stagingAllocs;
+        StagingRing stagingRing;
+        VkBuffer ringBuffer;
+        VmaAllocation ringAlloc;
+        void* ringMemory;
         std::vector<VkMemoryBarrier> memoryBarriers;
         std::vector<VkBufferMemoryBarrier> bufferBarriers;
         std::vector<VkImageMemoryBarrier> imageBarriers;
         std::vector<Transferable*> oneTimeItems;
         std::vector<Transferable*> everyFrameItems;
 
-        Bucket(vk::VulkanLayer& vs);
+        Bucket(vk::VulkanLayer& vs, VkDeviceSize stagingCapacity);
         void init(VkCommandPool pool);
         void cleanup(VkCommandPool pool);
         bool hasTransfers() const;
@@ -102,6 +116,14 @@ inline bool TransferEngine::Bucket::hasTransfers() const {
     return !everyFrameItems.empty() || !oneTimeItems.empty();
 }
 
+inline const StagingRing::Stats& TransferEngine::getStagingStats() const {
+    return immediateBucket.stagingRing.getStats();
+}
+
+inline const StagingRing::Stats& TransferEngine::getDeviceIdleStagingStats() const {
+    return frameBucket.stagingRing.getStats();
+}
+
 } // namespace tfr
 } // namespace rc
 } // namespace bl
@@ -84,6 +84,25 @@ public:
      */
     bool recreateForFormatChange();
 
+    /**
+     * @brief Returns the memory needed to place every image back to back in a single allocation
+     */
+    VkMemoryRequirements getMemoryRequirements() const;
+
+    /**
+     * @brief Re-creates the images in the given memory instead of their own allocations. The
+     *        images are placed in the order of the attachments, as in getMemoryRequirements()
+     *
+     * @param memory The allocation to place the images in
+     * @param offset The offset of the first image within the allocation
+     */
+    void alias(VmaAllocation memory, VkDeviceSize offset);
+
+    /**
+     * @brief Returns whether the images are placed in memory that they do not own
+     */
+    bool isAliased() const;
+
 private:
     Renderer* owner;
     std::array<SemanticTextureFormat, MaxBufferCount> formats;
@@ -103,6 +122,10 @@ inline const VkExtent2D& AttachmentImageSet::bufferSize() const {
     return attachments.getRenderExtent();
 }
 
+inline bool AttachmentImageSet::isAliased() const {
+    return owner != nullptr && buffers[0].isAliased();
+}
+
 } // namespace vk
 } // namespace rc
 } // namespace bl
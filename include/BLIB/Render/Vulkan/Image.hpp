@@ -85,6 +85,23 @@ public:
      */
     void create(Renderer& vulkanState, const ImageOptions& options);
 
+    /**
+     * @brief Creates the image in memory owned elsewhere instead of allocating its own. The memory
+     *        may be shared with other images that are never in use at the same time
+     *
+     * @param vulkanState Renderer instance
+     * @param options The options to use for the image creation
+     * @param memory The allocation to place the image in
+     * @param offset The offset of the image within the allocation
+     */
+    void createAliased(Renderer& vulkanState, const ImageOptions& options, VmaAllocation memory,
+                       VkDeviceSize offset);
+
+    /**
+     * @brief Returns the memory requirements of the image. Only valid after creation
+     */
+    VkMemoryRequirements getMemoryRequirements() const;
+
     /**
      * @brief Resizes the image to the new size, optionally copying over the old contents
      *
@@ -237,6 +254,11 @@ public:
      */
     bool isCreated() const;
 
+    /**
+     * @brief Returns whether the image was created in memory that it does not own
+     */
+    bool isAliased() const;
+
     /**
      * @brief Returns the number of samples in the image
      */
@@ -264,6 +286,9 @@ private:
     VkImageView viewHandle;
     ImageOptions createOptions;
     VkImageLayout currentLayout;
+
+    VkImageCreateInfo makeCreateInfo() const;
+    void createView();
 };
 
 //////////////////////////// INLINE FUNCTIONS /////////////////////////////////
@@ -292,6 +317,8 @@ inline VkMemoryPropertyFlags Image::getMemoryLocation() const {
 
 inline bool Image::isCreated() const { return renderer != nullptr; }
 
+inline bool Image::isAliased() const { return renderer != nullptr && alloc == nullptr; }
+
 inline VkSampleCountFlagBits Image::getSampleCount() const { return createOptions.samples; }
 
 inline std::uint32_t Image::getLevelCount() const { return createOptions.mipLevels; }
@@ -11,6 +11,8 @@
 #include <BLIB/Signals/Listener.hpp>
 #include <BLIB/Vulkan.hpp>
 #include <array>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <variant>
 #include <vector>
@@ -62,6 +64,15 @@ public:
      */
     VkPipeline rawPipeline(std::uint32_t renderPassId, std::uint32_t specializationId);
 
+    /**
+     * @brief Creates the underlying Vulkan pipeline for the given render pass and specialization
+     *        if it has not been created yet. Safe to call from worker threads
+     *
+     * @param renderPassId The render pass to create the pipeline for
+     * @param specializationId The specialization id to create the pipeline for. 0 for none
+     */
+    void precompile(std::uint32_t renderPassId, std::uint32_t specializationId);
+
     /**
      * @brief Issues the command to bind the pipeline
      *
@@ -87,10 +98,11 @@ private:
     std::uint32_t id;
     Renderer& renderer;
     PipelineLayout* layout;
-    std::array<std::array<VkPipeline, cfg::Limits::MaxRenderPasses>,
+    std::array<std::array<std::atomic<VkPipeline>, cfg::Limits::MaxRenderPasses>,
                cfg::Limits::MaxPipelineSpecializations>
-        pipelines;
+        pipelines; // written under createMutex, read lock-free on the render path
     PipelineParameters createParams;
+    std::mutex createMutex;
 
     void recreateForRenderPass(std::uint32_t rpid);
     void createForRenderPass(std::uint32_t rpid, std::uint32_t spec);
@@ -106,8 +118,12 @@ private:
 inline const PipelineLayout& Pipeline::pipelineLayout() const { return *layout; }
 
 inline VkPipeline Pipeline::rawPipeline(std::uint32_t rpid, std::uint32_t spec) {
-    if (!pipelines[spec][rpid]) { createForRenderPass(rpid, spec); }
-    return pipelines[spec][rpid];
+    VkPipeline pipeline = pipelines[spec][rpid].load(std::memory_order_acquire);
+    if (!pipeline) {
+        precompile(rpid, spec);
+        pipeline = pipelines[spec][rpid].load(std::memory_order_acquire);
+    }
+    return pipeline;
 }
 
 inline const PipelineParameters& Pipeline::getCreationParameters() const { return createParams; }
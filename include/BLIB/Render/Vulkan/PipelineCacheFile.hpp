@@ -0,0 +1,66 @@
+#ifndef BLIB_RENDER_VULKAN_PIPELINECACHEFILE_HPP
+#define BLIB_RENDER_VULKAN_PIPELINECACHEFILE_HPP
+
+#include <BLIB/Vulkan.hpp>
+#include <string>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace vk
+{
+/**
+ * @brief Helper for persisting VkPipelineCache data to disk between runs. Files are keyed by the
+ *        vendor, device, and pipeline cache UUID of the physical device so that data from a
+ *        different GPU or driver version is never handed to the driver
+ *
+ * @ingroup Renderer
+ */
+struct PipelineCacheFile {
+    /**
+     * @brief Returns the filename to use for the given device
+     *
+     * @param props The properties of the physical device
+     */
+    static std::string getFilename(const VkPhysicalDeviceProperties& props);
+
+    /**
+     * @brief Returns whether the header of the given cache data matches the given device
+     *
+     * @param data The pipeline cache data to check
+     * @param props The properties of the physical device
+     * @return True if the data may be used to create a pipeline cache, false otherwise
+     */
+    static bool isCompatible(const std::vector<char>& data,
+                             const VkPhysicalDeviceProperties& props);
+
+    /**
+     * @brief Loads the cache data for the given device from the given directory
+     *
+     * @param directory The directory containing pipeline cache files
+     * @param props The properties of the physical device
+     * @return The cache data. Empty if missing or incompatible
+     */
+    static std::vector<char> load(const std::string& directory,
+                                  const VkPhysicalDeviceProperties& props);
+
+    /**
+     * @brief Saves the cache data for the given device to the given directory. The data is
+     *        written to a temporary file first so that a crash never leaves a partial cache
+     *
+     * @param directory The directory to write the pipeline cache file to
+     * @param props The properties of the physical device
+     * @param data The cache data to save
+     * @return True if the data was saved, false on error
+     */
+    static bool save(const std::string& directory, const VkPhysicalDeviceProperties& props,
+                     const std::vector<char>& data);
+};
+
+} // namespace vk
+} // namespace rc
+} // namespace bl
+
+#endif
@@ -68,6 +68,17 @@ public:
      */
     void completeFrame();
 
+    /**
+     * @brief Returns command buffers that may be recorded in parallel for the current frame. Each
+     *        buffer has its own command pool so that each may be recorded on a different thread.
+     *        The buffers are submitted after the primary command buffer, in order, in
+     *        completeFrame(). Must be called after beginFrame()
+     *
+     * @param count The number of command buffers to return
+     * @return Pointer to the first of count primary command buffers. Not yet begun
+     */
+    VkCommandBuffer* getParallelCommandBuffers(std::uint32_t count);
+
     /**
      * @brief Returns the current swap chain image index
      *
@@ -103,6 +114,9 @@ private:
         VkFence commandBufferFence;
         VkCommandPool commandPool;
         VkCommandBuffer commandBuffer;
+        std::vector<VkCommandPool> parallelPools;
+        std::vector<VkCommandBuffer> parallelBuffers;
+        std::uint32_t parallelCount;
 
         void init(VulkanLayer& vulkanState);
         void cleanup(VulkanLayer& vulkanState);
@@ -129,6 +143,7 @@ private:
     std::vector<AttachmentSet> renderFrames;
     vk::PerSwapFrame<Frame> frameData;
     Swapframes imageSemaphores;
+    std::vector<VkCommandBuffer> submitBuffers;
     std::uint32_t currentImageIndex;
     bool outOfDate;
 
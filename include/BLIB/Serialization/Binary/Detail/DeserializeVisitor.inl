@@ -9,6 +9,57 @@ namespace detail
 {
 constexpr unsigned int MaxFieldCount = 128;
 
+/**
+ * @brief Jump table from member id to a reader for that member. Readers are generated at compile
+ *        time per member. Member ids are runtime values so the id lookup is built on first use
+ *
+ * @tparam T The reflected type to read
+ */
+template<typename T>
+struct MemberTable {
+    using Reflected                    = refl::ReflectedObject<T>;
+    using Spec                         = std::decay_t<decltype(Reflected::spec)>;
+    using Reader                       = bool (*)(stream::InputStream&, T&);
+    static constexpr std::size_t Count = Spec::memberCount;
+    static constexpr std::uint8_t None = 0xFF;
+
+    static_assert(Count < None, "Too many reflected members for binary serialization");
+
+    template<std::size_t I>
+    static bool read(stream::InputStream& stream, T& value) {
+        auto& member     = std::get<I>(Reflected::spec.members).getMember(value);
+        using MemberType = std::decay_t<decltype(member)>;
+        return Serializer<MemberType>::deserialize(stream, member);
+    }
+
+    template<std::size_t... Is>
+    static constexpr std::array<Reader, Count> makeReaders(std::index_sequence<Is...>) {
+        return {&read<Is>...};
+    }
+
+    static constexpr std::array<Reader, Count> readers =
+        makeReaders(std::make_index_sequence<Count>());
+
+    static const std::array<std::uint8_t, MaxFieldCount>& indices() {
+        static const std::array<std::uint8_t, MaxFieldCount> table = []() {
+            std::array<std::uint8_t, MaxFieldCount> result;
+            result.fill(None);
+            std::apply(
+                [&result](const auto&... member) {
+                    std::uint8_t i = 0;
+                    const auto add = [&result, &i](std::uint16_t id) {
+                        if (id < MaxFieldCount && result[id] == None) { result[id] = i; }
+                        ++i;
+                    };
+                    (add(member.getId()), ...);
+                },
+                Reflected::spec.members);
+            return result;
+        }();
+        return table;
+    }
+};
+
 template<typename T>
 bool deserializeVisitor(stream::InputStream& stream, T& value) {
     bool result = true;
@@ -27,20 +78,11 @@ bool deserializeVisitor(stream::InputStream& stream, T& value) {
         if (memberId >= MaxFieldCount) { return false; }
         foundFields[memberId] = 1;
 
-        bool parsedField = false;
-        refl::visit(
-            value,
-            [&stream, &result, &parsedField, memberId](const auto& reflMember, auto& memberValue) {
-                if (parsedField || reflMember.getId() != memberId) { return; }
-
-                using MemberType = std::decay_t<decltype(memberValue)>;
-                parsedField      = true;
-                if (!Serializer<MemberType>::deserialize(stream, memberValue)) { result = false; }
-            });
-        if (!result) { return false; }
-        if (!parsedField) {
-            if (!wrapper.skip(memberSize)) { return false; }
+        const std::uint8_t index = MemberTable<T>::indices()[memberId];
+        if (index != MemberTable<T>::None) {
+            if (!MemberTable<T>::readers[index](stream, value)) { return false; }
         }
+        else if (!wrapper.skip(memberSize)) { return false; }
     }
 
     // default fields not found and fail if any are required
@@ -68,6 +68,19 @@ public:
      */
     bool write(const char* data);
 
+    /**
+     * @brief Overwrites an integral value that was already written. Only valid if the underlying
+     *        stream supports patching
+     *
+     * @tparam T The type to write. Must match the type that was originally written
+     * @param position The offset of the value in the stream
+     * @param data The value to write
+     * @return True if the value could be written
+     */
+    template<typename T>
+    typename std::enable_if<std::is_integral_v<T>, bool>::type patch(std::size_t position,
+                                                                      const T& data);
+
     /**
      * @brief Returns the status of the stream
      *
@@ -76,6 +89,9 @@ public:
 
 private:
     stream::OutputStream& buffer;
+
+    template<typename T>
+    static void encode(const T& data, char* bytes);
 };
 
 ///////////////////////////// INLINE FUNCTIONS ////////////////////////////////////
@@ -85,8 +101,22 @@ typename std::enable_if<std::is_integral_v<T>, bool>::type OutputStreamWrapper::
     const T& data) {
     if (!buffer.isValid()) return false;
 
+    char bytes[sizeof(T)];
+    encode(data, bytes);
+    return buffer.write(bytes, sizeof(T));
+}
+
+template<typename T>
+typename std::enable_if<std::is_integral_v<T>, bool>::type OutputStreamWrapper::patch(
+    std::size_t position, const T& data) {
+    char bytes[sizeof(T)];
+    encode(data, bytes);
+    return buffer.patch(position, bytes, sizeof(T));
+}
+
+template<typename T>
+void OutputStreamWrapper::encode(const T& data, char* bytes) {
     constexpr std::size_t size = sizeof(T);
-    char bytes[size];
     std::memcpy(bytes, &data, size);
     if constexpr (size > 1) {
         if (util::FileUtil::isBigEndian()) {
@@ -95,7 +125,6 @@ typename std::enable_if<std::is_integral_v<T>, bool>::type OutputStreamWrapper::
             }
         }
     }
-    return buffer.write(bytes, size);
 }
 
 inline bool OutputStreamWrapper::good() const { return buffer.isValid(); }
@@ -15,29 +15,43 @@ bool serializeVisitor(stream::OutputStream& stream, const T& value, bool packed)
     OutputStreamWrapper wrapper(stream);
     if (!packed && !wrapper.write<std::uint16_t>(Reflected::spec.memberCount)) { return false; }
 
+    // memory streams get member sizes backpatched so nested objects are only walked once
+    const bool backpatch = !packed && stream.canPatch();
+
     refl::visit(
         value,
-        [&stream, &wrapper, &result, packed](const auto& reflMember, const auto& memberValue) {
+        [&stream, &wrapper, &result, packed, backpatch](const auto& reflMember,
+                                                        const auto& memberValue) {
             if (!result) { return; }
 
-            using MemberType               = std::decay_t<decltype(memberValue)>;
-            const std::uint16_t memberId   = reflMember.getId();
-            const std::uint32_t memberSize = Serializer<MemberType>::size(memberValue);
+            using MemberType = std::decay_t<decltype(memberValue)>;
+            if (packed) {
+                result = Serializer<MemberType>::serialize(stream, memberValue);
+                return;
+            }
 
-            if (!packed) {
-                if (!wrapper.write<std::uint16_t>(memberId)) {
-                    result = false;
-                    return;
-                }
-                if (!wrapper.write<std::uint32_t>(memberSize)) {
+            if (!wrapper.write<std::uint16_t>(reflMember.getId())) {
+                result = false;
+                return;
+            }
+            if (backpatch) {
+                const std::size_t sizePos = stream.position();
+                if (!wrapper.write<std::uint32_t>(0) ||
+                    !Serializer<MemberType>::serialize(stream, memberValue)) {
                     result = false;
                     return;
                 }
+                const std::size_t memberSize = stream.position() - sizePos - sizeof(std::uint32_t);
+                result = wrapper.patch<std::uint32_t>(sizePos, memberSize);
+                return;
             }
-            if (!Serializer<MemberType>::serialize(stream, memberValue)) {
+
+            const std::uint32_t memberSize = Serializer<MemberType>::size(memberValue);
+            if (!wrapper.write<std::uint32_t>(memberSize)) {
                 result = false;
                 return;
             }
+            result = Serializer<MemberType>::serialize(stream, memberValue);
         });
 
     return result;
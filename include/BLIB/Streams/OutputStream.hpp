@@ -117,6 +117,27 @@ public:
      */
     bool write(const void* data, std::size_t len);
 
+    /**
+     * @brief Returns whether already written bytes may be overwritten with patch(). Only streams in
+     *        Memory mode may be patched
+     */
+    bool canPatch() const;
+
+    /**
+     * @brief Returns the number of bytes written so far. Only valid if canPatch() is true
+     */
+    std::size_t position() const;
+
+    /**
+     * @brief Overwrites bytes that were already written. Only valid if canPatch() is true
+     *
+     * @param position The offset of the bytes to overwrite
+     * @param data The data to write
+     * @param len The number of bytes to overwrite
+     * @return True if the data was overwritten, false if the range was not yet written
+     */
+    bool patch(std::size_t position, const void* data, std::size_t len);
+
     /**
      * @brief Returns the underlying buffer. Only valid if the stream is in Memory mode
      */
@@ -7,12 +7,14 @@
  */
 
 #include <BLIB/Systems/Animation2DSystem.hpp>
+#include <BLIB/Systems/AnimationLod.hpp>
 #include <BLIB/Systems/MarkedForDeath.hpp>
 #include <BLIB/Systems/OverlayScalerSystem.hpp>
 #include <BLIB/Systems/Physics2D.hpp>
 #include <BLIB/Systems/RendererUpdateSystem.hpp>
 #include <BLIB/Systems/SkeletalAnimationSystem.hpp>
 #include <BLIB/Systems/TogglerSystem.hpp>
+#include <BLIB/Systems/TransformHierarchySystem.hpp>
 #include <BLIB/Systems/VelocitySystem.hpp>
 
 #endif
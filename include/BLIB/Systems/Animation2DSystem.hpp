@@ -3,6 +3,7 @@
 
 #include <BLIB/Components/Animation2D.hpp>
 #include <BLIB/Components/Animation2DPlayer.hpp>
+#include <BLIB/Components/Transform2D.hpp>
 #include <BLIB/ECS/ComponentPool.hpp>
 #include <BLIB/ECS/Events.hpp>
 #include <BLIB/Engine/System.hpp>
@@ -12,6 +13,7 @@
 #include <BLIB/Render/Vulkan/DescriptorSet.hpp>
 #include <BLIB/Render/Vulkan/PerFrame.hpp>
 #include <BLIB/Signals/Listener.hpp>
+#include <BLIB/Systems/AnimationLod.hpp>
 #include <BLIB/Util/IdAllocatorUnbounded.hpp>
 #include <BLIB/Util/RangeAllocatorUnbounded.hpp>
 #include <glm/glm.hpp>
@@ -27,7 +29,8 @@ namespace sys
 {
 /**
  * @brief Systems that updates and advances all 2d animations. Also manages GPU local buffers
- *        containing animation data
+ *        containing animation data. Players that are off-screen or far from all observers are
+ *        updated at reduced rates according to the LOD policy
  *
  * @ingroup Systems
  */
@@ -57,6 +60,17 @@ public:
     void bindSlideshowSet(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
                           std::uint32_t setIndex);
 
+    /**
+     * @brief Returns the level of detail policy used to throttle animation updates. Distances are
+     *        measured from the visible area of each observer
+     */
+    AnimationLod& lod();
+
+    /**
+     * @brief Returns the number of players evaluated, throttled, and frozen last update
+     */
+    const AnimationLod::Stats& getLodStats() const;
+
 private:
     struct SlideshowFrame {
         alignas(16) glm::vec2 texCoords[4];
@@ -81,6 +95,9 @@ private:
     VkDescriptorSetLayout descriptorLayout;
     ecs::ComponentPool<com::Animation2DPlayer>* players;
     ecs::ComponentPool<com::Animation2D>* vertexPool;
+    ecs::ComponentPool<com::Transform2D>* transformPool;
+    AnimationLod lodPolicy;
+    AnimationLod::Stats lodStats;
     as::TypedRef<asi::Animation2DSetPayload> errorAnim;
 
     // slideshow data
@@ -0,0 +1,184 @@
+#ifndef BLIB_SYSTEMS_ANIMATIONLOD_HPP
+#define BLIB_SYSTEMS_ANIMATIONLOD_HPP
+
+#include <BLIB/Components/AnimationLodState.hpp>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <limits>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+class Renderer;
+}
+
+namespace sys
+{
+/**
+ * @brief Level of detail policy for animation systems. Selects a detail level for each animation
+ *        based on its distance to the nearest observer and throttles or freezes updates for far
+ *        away or off-screen animations. Skipped time is accumulated and applied on the next update
+ *
+ * @ingroup Systems
+ */
+class AnimationLod {
+public:
+    /// Update interval that prevents animations in a level from updating at all
+    static constexpr std::uint32_t Frozen = 0;
+
+    /// Bone depth that allows all bones to be animated
+    static constexpr std::uint32_t AllBones = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief A single level of detail
+     */
+    struct Level {
+        float minDistance;
+        std::uint32_t updateInterval;
+        std::uint32_t maxBoneDepth;
+    };
+
+    /// Per-animation level of detail state. Owned by the animated components
+    using State = com::AnimationLodState;
+
+    /**
+     * @brief Per-frame metrics on how many animations were evaluated
+     */
+    struct Stats {
+        std::uint32_t evaluated;
+        std::uint32_t throttled;
+        std::uint32_t frozen;
+
+        /**
+         * @brief Initializes all counters to zero
+         */
+        Stats() { reset(); }
+
+        /**
+         * @brief Resets all counters to zero
+         */
+        void reset() {
+            evaluated = 0;
+            throttled = 0;
+            frozen    = 0;
+        }
+    };
+
+    /**
+     * @brief Creates the policy with a single full detail level. Everything updates every tick
+     */
+    AnimationLod();
+
+    /**
+     * @brief Enables or disables level of detail. When disabled all animations update every tick
+     *        with all bones
+     *
+     * @param enabled True to enable LOD, false to disable
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether level of detail selection is enabled
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Adds a detail level. Levels are kept sorted by distance. A level applies to all
+     *        animations at least minDistance away from the nearest observer
+     *
+     * @param minDistance The distance at which the level starts to apply
+     * @param updateInterval Number of ticks between updates. Use Frozen to never update
+     * @param maxBoneDepth Maximum bone hierarchy depth to animate. Deeper bones keep their pose
+     */
+    void addLevel(float minDistance, std::uint32_t updateInterval,
+                  std::uint32_t maxBoneDepth = AllBones);
+
+    /**
+     * @brief Removes all levels except for the full detail level at distance 0
+     */
+    void clearLevels();
+
+    /**
+     * @brief Returns the number of detail levels
+     */
+    std::uint32_t levelCount() const;
+
+    /**
+     * @brief Returns the level at the given index
+     *
+     * @param index The index of the level to get
+     */
+    const Level& getLevel(std::uint32_t index) const;
+
+    /**
+     * @brief Returns the index of the level to use for the given observer distance
+     *
+     * @param distance The distance to the nearest observer
+     */
+    std::uint32_t selectLevel(float distance) const;
+
+    /**
+     * @brief Refreshes the set of observer positions from all observers in the renderer that
+     *        currently have a scene with a camera
+     *
+     * @param renderer The renderer to fetch observers from
+     */
+    void refreshObservers(rc::Renderer& renderer);
+
+    /**
+     * @brief Removes all observers. With no observers every animation is at full detail
+     */
+    void clearObservers();
+
+    /**
+     * @brief Manually adds an observer position
+     *
+     * @param position The position of the observer
+     * @param halfExtents Half of the visible area for 2d observers. Zero for 3d observers
+     */
+    void addObserver(const glm::vec3& position, const glm::vec2& halfExtents = {0.f, 0.f});
+
+    /**
+     * @brief Returns the distance from a 2d position to the visible area of the nearest observer.
+     *        Positions that are on screen have a distance of zero
+     *
+     * @param position The position to test
+     */
+    float distanceTo2D(const glm::vec2& position) const;
+
+    /**
+     * @brief Returns the distance from a 3d position to the nearest observer
+     *
+     * @param position The position to test
+     */
+    float distanceTo3D(const glm::vec3& position) const;
+
+    /**
+     * @brief Advances the LOD state of an animation for a single tick and determines whether it
+     *        should be evaluated this tick
+     *
+     * @param state The LOD state of the animation
+     * @param distance The distance to the nearest observer
+     * @param dt The elapsed time of this tick
+     * @param stats Counters to update
+     * @return The time to advance the animation by, or a negative value to skip evaluation
+     */
+    float advance(State& state, float distance, float dt, Stats& stats) const;
+
+private:
+    struct ObserverInfo {
+        glm::vec3 position;
+        glm::vec2 halfExtents;
+    };
+
+    std::vector<Level> levels;
+    std::vector<ObserverInfo> observers;
+    bool enabled;
+};
+
+} // namespace sys
+} // namespace bl
+
+#endif
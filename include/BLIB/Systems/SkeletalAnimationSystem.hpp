@@ -4,13 +4,15 @@
 #include <BLIB/Components/Skeleton.hpp>
 #include <BLIB/ECS/ComponentPool.hpp>
 #include <BLIB/Engine/System.hpp>
+#include <BLIB/Systems/AnimationLod.hpp>
 
 namespace bl
 {
 namespace sys
 {
 /**
- * @brief System that performs skeletal animation updates
+ * @brief System that performs skeletal animation updates. Skeletons far from all observers are
+ *        updated at reduced rates and with reduced bone sets according to the LOD policy
  *
  * @ingroup Systems
  */
@@ -19,7 +21,7 @@ public:
     /**
      * @brief Creates the system
      */
-    SkeletalAnimationSystem() = default;
+    SkeletalAnimationSystem();
 
     /**
      * @brief Destroys the system
@@ -47,8 +49,21 @@ public:
     virtual void update(std::mutex& stageMutex, float dt, float realDt, float residual,
                         float realResidual) override;
 
+    /**
+     * @brief Returns the level of detail policy used to throttle skeleton updates
+     */
+    AnimationLod& lod();
+
+    /**
+     * @brief Returns the number of skeletons evaluated, throttled, and frozen last update
+     */
+    const AnimationLod::Stats& getLodStats() const;
+
 private:
+    rc::Renderer* renderer;
     ecs::ComponentPool<com::Skeleton>* skeletons;
+    AnimationLod lodPolicy;
+    AnimationLod::Stats lodStats;
 };
 
 } // namespace sys
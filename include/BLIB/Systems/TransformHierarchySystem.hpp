@@ -0,0 +1,77 @@
+#ifndef BLIB_SYSTEMS_TRANSFORMHIERARCHYSYSTEM_HPP
+#define BLIB_SYSTEMS_TRANSFORMHIERARCHYSYSTEM_HPP
+
+#include <BLIB/Components/Transform2D.hpp>
+#include <BLIB/Components/Transform3D.hpp>
+#include <BLIB/ECS/ComponentPool.hpp>
+#include <BLIB/ECS/Events.hpp>
+#include <BLIB/ECS/HierarchyLevels.hpp>
+#include <BLIB/Engine/System.hpp>
+#include <BLIB/Signals/Listener.hpp>
+#include <atomic>
+
+namespace bl
+{
+namespace sys
+{
+/**
+ * @brief System that resolves global transforms for 2d and 3d transform hierarchies once per
+ *        frame. Transforms are kept sorted by depth in the parent tree and are refreshed level by
+ *        level, in parallel within a level, so each transform only looks at its direct parent.
+ *        Refreshed transforms are marked dirty so their descriptor payloads are copied this frame
+ *
+ * @ingroup Systems
+ */
+class TransformHierarchySystem
+: public engine::System
+, public sig::Listener<ecs::event::ComponentAdded<com::Transform2D>,
+                       ecs::event::ComponentRemoved<com::Transform2D>,
+                       ecs::event::ComponentAdded<com::Transform3D>,
+                       ecs::event::ComponentRemoved<com::Transform3D>,
+                       ecs::event::EntityParentSet, ecs::event::EntityParentRemoved> {
+public:
+    /**
+     * @brief Creates the system
+     */
+    TransformHierarchySystem();
+
+    /**
+     * @brief Destroys the system
+     */
+    virtual ~TransformHierarchySystem() = default;
+
+    /**
+     * @brief Returns the number of transforms that were recomputed last update
+     */
+    std::size_t getRefreshedCount() const;
+
+private:
+    util::ThreadPool* threadPool;
+    ecs::ComponentPool<com::Transform2D>* pool2d;
+    ecs::ComponentPool<com::Transform3D>* pool3d;
+    ecs::HierarchyLevels<com::Transform2D> levels2d;
+    ecs::HierarchyLevels<com::Transform3D> levels3d;
+    std::atomic_bool stale2d;
+    std::atomic_bool stale3d;
+    std::atomic<std::size_t> refreshedCount;
+
+    virtual void init(engine::Engine& engine) override;
+    virtual void update(std::mutex& stageMutex, float dt, float realDt, float residual,
+                        float realResidual) override;
+    virtual void earlyCleanup() override;
+    virtual void process(const ecs::event::ComponentAdded<com::Transform2D>& event) override;
+    virtual void process(const ecs::event::ComponentRemoved<com::Transform2D>& event) override;
+    virtual void process(const ecs::event::ComponentAdded<com::Transform3D>& event) override;
+    virtual void process(const ecs::event::ComponentRemoved<com::Transform3D>& event) override;
+    virtual void process(const ecs::event::EntityParentSet& event) override;
+    virtual void process(const ecs::event::EntityParentRemoved& event) override;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline std::size_t TransformHierarchySystem::getRefreshedCount() const { return refreshedCount; }
+
+} // namespace sys
+} // namespace bl
+
+#endif
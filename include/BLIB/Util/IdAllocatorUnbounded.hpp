@@ -2,6 +2,8 @@
 #define BLIB_UTIL_IDALLOCATORUNBOUNDED_HPP
 
 #include <algorithm>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -37,6 +39,15 @@ public:
      */
     T allocate();
 
+    /**
+     * @brief Allocates several ids at once. Free ids are reused lowest first and the pool is then
+     *        grown once for the remainder
+     *
+     * @param count The number of ids to allocate
+     * @param ids Vector to append the new ids to
+     */
+    void allocate(std::size_t count, std::vector<T>& ids);
+
     /**
      * @brief Releases the given id back into the pool. Double-release is an error
      *
@@ -44,6 +55,13 @@ public:
      */
     void release(T id);
 
+    /**
+     * @brief Releases several ids back into the pool at once. Double-release is an error
+     *
+     * @param ids The ids to release
+     */
+    void release(std::span<const T> ids);
+
     /**
      * @brief Releases all ids
      */
@@ -94,6 +112,8 @@ T IdAllocatorUnbounded<T>::allocate() {
         allocMap.resize(static_cast<std::size_t>(id) + 1, false);
     }
     else {
+        // free ids are kept in a min-heap so the lowest id is always reused first
+        std::pop_heap(freeStack.begin(), freeStack.end(), std::greater<T>());
         id = freeStack.back();
         freeStack.pop_back();
     }
@@ -101,12 +121,51 @@ T IdAllocatorUnbounded<T>::allocate() {
     return id;
 }
 
+template<typename T>
+void IdAllocatorUnbounded<T>::allocate(std::size_t count, std::vector<T>& ids) {
+    ids.reserve(ids.size() + count);
+
+    if (count >= freeStack.size()) {
+        std::sort(freeStack.begin(), freeStack.end());
+        for (const T id : freeStack) {
+            allocMap[id] = true;
+            ids.emplace_back(id);
+        }
+        count -= freeStack.size();
+        freeStack.clear();
+    }
+    else {
+        for (; count > 0; --count) {
+            std::pop_heap(freeStack.begin(), freeStack.end(), std::greater<T>());
+            allocMap[freeStack.back()] = true;
+            ids.emplace_back(freeStack.back());
+            freeStack.pop_back();
+        }
+    }
+
+    if (count > 0) {
+        const T first = nextId;
+        nextId += static_cast<T>(count);
+        allocMap.resize(static_cast<std::size_t>(nextId), false);
+        for (T id = first; id < nextId; ++id) {
+            allocMap[id] = true;
+            ids.emplace_back(id);
+        }
+    }
+}
+
 template<typename T>
 void IdAllocatorUnbounded<T>::release(T id) {
     allocMap[id] = false;
-    const auto it =
-        std::lower_bound(freeStack.begin(), freeStack.end(), id, std::cmp_greater<T, T>);
-    freeStack.emplace(it, id);
+    freeStack.emplace_back(id);
+    std::push_heap(freeStack.begin(), freeStack.end(), std::greater<T>());
+}
+
+template<typename T>
+void IdAllocatorUnbounded<T>::release(std::span<const T> ids) {
+    for (const T id : ids) { allocMap[id] = false; }
+    freeStack.insert(freeStack.end(), ids.begin(), ids.end());
+    std::make_heap(freeStack.begin(), freeStack.end(), std::greater<T>());
 }
 
 template<typename T>
@@ -0,0 +1,145 @@
+#ifndef BLIB_UTIL_OFFSETALLOCATOR_HPP
+#define BLIB_UTIL_OFFSETALLOCATOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bl
+{
+namespace util
+{
+/**
+ * @brief Constant time suballocator for ranges of a linear buffer. Free ranges are kept in
+ *        segregated size class bins (two level, similar to TLSF) with a bitmask to find a large
+ *        enough bin in O(1). Adjacent free ranges are coalesced on release in O(1). Allocations
+ *        never move
+ *
+ * @ingroup Util
+ */
+class OffsetAllocator {
+public:
+    /// Offset returned for failed allocations
+    static constexpr std::uint32_t InvalidOffset = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief An allocated range. Must be passed back to release()
+     */
+    struct Allocation {
+        std::uint32_t offset;
+        std::uint32_t size;
+        std::uint32_t node;
+
+        /**
+         * @brief Creates an invalid allocation
+         */
+        Allocation()
+        : offset(InvalidOffset)
+        , size(0)
+        , node(InvalidOffset) {}
+
+        /**
+         * @brief Returns whether or not the allocation succeeded
+         */
+        bool isValid() const { return offset != InvalidOffset; }
+    };
+
+    /**
+     * @brief Creates a new allocator managing the given number of elements
+     *
+     * @param capacity The number of elements to manage
+     */
+    OffsetAllocator(std::uint32_t capacity = 0);
+
+    /**
+     * @brief Allocates a range of the given size. Does not grow the pool
+     *
+     * @param size The number of elements to allocate
+     * @return The allocation. Invalid if there is no large enough free range
+     */
+    Allocation allocate(std::uint32_t size);
+
+    /**
+     * @brief Returns the given allocation to the pool and merges it with free neighbors
+     *
+     * @param allocation The allocation to release
+     */
+    void release(const Allocation& allocation);
+
+    /**
+     * @brief Grows the pool. The new space is appended to the end. Existing allocations are kept
+     *
+     * @param newCapacity The new number of elements to manage. Ignored if not larger
+     */
+    void grow(std::uint32_t newCapacity);
+
+    /**
+     * @brief Releases all allocations and resizes the pool
+     *
+     * @param capacity The new number of elements to manage
+     */
+    void reset(std::uint32_t capacity);
+
+    /**
+     * @brief Returns the number of elements managed by the allocator
+     */
+    std::uint32_t capacity() const;
+
+    /**
+     * @brief Returns the total number of free elements, including fragmented ranges
+     */
+    std::uint32_t freeSpace() const;
+
+    /**
+     * @brief Returns one past the highest allocated element. Elements past this are all free
+     */
+    std::uint32_t usedEnd() const;
+
+private:
+    static constexpr std::uint32_t InvalidNode = InvalidOffset;
+    static constexpr std::uint32_t BinCount    = 256;
+
+    struct Node {
+        std::uint32_t offset;
+        std::uint32_t size;
+        std::uint32_t prevAddress;
+        std::uint32_t nextAddress;
+        std::uint32_t prevInBin;
+        std::uint32_t nextInBin;
+        bool free;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> recycledNodes;
+    std::array<std::uint32_t, BinCount> binHeads;
+    std::array<std::uint64_t, BinCount / 64> binMask;
+    std::uint32_t totalSize;
+    std::uint32_t freeTotal;
+    std::uint32_t tailNode;
+
+    std::uint32_t createNode(std::uint32_t offset, std::uint32_t size);
+    void recycleNode(std::uint32_t node);
+    void insertFree(std::uint32_t node);
+    void removeFree(std::uint32_t node);
+    std::uint32_t findBin(std::uint32_t minBin) const;
+
+    static std::uint32_t binRoundDown(std::uint32_t size);
+    static std::uint32_t binRoundUp(std::uint32_t size);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline std::uint32_t OffsetAllocator::capacity() const { return totalSize; }
+
+inline std::uint32_t OffsetAllocator::freeSpace() const { return freeTotal; }
+
+inline std::uint32_t OffsetAllocator::usedEnd() const {
+    if (tailNode == InvalidNode) { return 0; }
+    return nodes[tailNode].free ? nodes[tailNode].offset : totalSize;
+}
+
+} // namespace util
+} // namespace bl
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef BLIB_UTIL_PROFILER_HPP
+#define BLIB_UTIL_PROFILER_HPP
+
+#include <BLIB/Util/NonCopyable.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bl
+{
+namespace util
+{
+/**
+ * @brief Global collector of timed scopes. Each thread records into its own fixed size ring of
+ *        events without locking. Events may be queried at runtime or exported in the Chrome trace
+ *        format, which can be opened in chrome://tracing or Perfetto. Use BL_PROFILE_SCOPE to
+ *        instrument code, which compiles to nothing unless BLIB_PROFILING_ENABLED is defined
+ *
+ * @ingroup Util
+ */
+class Profiler : private NonCopyable {
+public:
+    /// Number of events each thread keeps before the oldest are overwritten
+    static constexpr std::size_t BufferCapacity = 16384;
+
+    /// Number of frame boundaries to keep
+    static constexpr std::size_t FrameHistory = 128;
+
+    /**
+     * @brief A single timed scope. Times are in nanoseconds since the profiler was created
+     */
+    struct Event {
+        std::string_view name;
+        std::uint64_t start;
+        std::uint64_t duration;
+        std::uint32_t thread;
+    };
+
+    /**
+     * @brief Aggregated timing of all scopes with the same name
+     */
+    struct ScopeSummary {
+        std::string_view name;
+        std::uint32_t count;
+        std::uint64_t total;
+        std::uint64_t longest;
+    };
+
+    /**
+     * @brief Returns the global profiler
+     */
+    static Profiler& get();
+
+    /**
+     * @brief Enables or disables recording at runtime. Enabled by default
+     *
+     * @param enabled True to record scopes, false to ignore them
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether scopes are being recorded
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Returns the current time in nanoseconds since the profiler was created
+     */
+    std::uint64_t now() const;
+
+    /**
+     * @brief Records a completed scope on the calling thread. The name must outlive the profiler
+     *
+     * @param name The name of the scope
+     * @param start The start time of the scope
+     * @param end The end time of the scope
+     */
+    void record(std::string_view name, std::uint64_t start, std::uint64_t end);
+
+    /**
+     * @brief Marks the start of a new frame. Called by the engine once per loop
+     */
+    void markFrame();
+
+    /**
+     * @brief Returns the number of frames that have been marked
+     */
+    std::uint64_t getFrameCount() const;
+
+    /**
+     * @brief Copies the recorded events from every thread into the given vector
+     *
+     * @param events Vector to populate with events, sorted by start time
+     * @param since Only events starting at or after this time are returned
+     */
+    void collect(std::vector<Event>& events, std::uint64_t since = 0) const;
+
+    /**
+     * @brief Aggregates the events of the last completed frame by name, longest total first
+     *
+     * @param summary Vector to populate with the aggregated scopes
+     */
+    void summarizeLastFrame(std::vector<ScopeSummary>& summary) const;
+
+    /**
+     * @brief Writes the recorded events in the Chrome trace JSON format
+     *
+     * @param os The stream to write to
+     */
+    void writeChromeTrace(std::ostream& os) const;
+
+    /**
+     * @brief Writes the recorded events to a Chrome trace JSON file
+     *
+     * @param path The file to write to
+     * @return True if the file was written, false on error
+     */
+    bool exportChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief Discards all events and frames recorded so far
+     */
+    void clear();
+
+private:
+    struct ThreadBuffer {
+        const std::uint32_t thread;
+        std::unique_ptr<Event[]> events;
+        std::atomic<std::uint64_t> head;
+
+        ThreadBuffer(std::uint32_t thread);
+    };
+
+    const std::chrono::steady_clock::time_point epoch;
+    std::atomic_bool enabled;
+    std::atomic<std::uint64_t> floor;
+    mutable std::mutex bufferMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    mutable std::mutex frameMutex;
+    std::deque<std::uint64_t> frames;
+    std::uint64_t frameCount;
+
+    Profiler();
+    ThreadBuffer& localBuffer();
+};
+
+/**
+ * @brief RAII helper that records the lifetime of a scope in the global Profiler. Prefer the
+ *        BL_PROFILE_SCOPE macro
+ *
+ * @ingroup Util
+ */
+class ProfileScope : private NonCopyable {
+public:
+    /**
+     * @brief Starts timing the scope if the profiler is enabled
+     *
+     * @param name The name of the scope. Must outlive the profiler
+     */
+    ProfileScope(std::string_view name);
+
+    /**
+     * @brief Records the scope
+     */
+    ~ProfileScope();
+
+private:
+    const std::string_view name;
+    const bool active;
+    const std::uint64_t start;
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline bool Profiler::isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+inline std::uint64_t Profiler::now() const {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now() - epoch).count();
+}
+
+inline ProfileScope::ProfileScope(std::string_view name)
+: name(name)
+, active(Profiler::get().isEnabled())
+, start(active ? Profiler::get().now() : 0) {}
+
+inline ProfileScope::~ProfileScope() {
+    if (active) {
+        Profiler& profiler = Profiler::get();
+        profiler.record(name, start, profiler.now());
+    }
+}
+
+} // namespace util
+} // namespace bl
+
+#define BL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define BL_PROFILE_CONCAT(a, b) BL_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef BLIB_PROFILING_ENABLED
+/// Records the enclosing scope in the global Profiler under the given name
+#define BL_PROFILE_SCOPE(name) \
+    const ::bl::util::ProfileScope BL_PROFILE_CONCAT(blProfileScope, __LINE__)(name)
+/// Marks the start of a new frame in the global Profiler
+#define BL_PROFILE_FRAME() ::bl::util::Profiler::get().markFrame()
+#else
+#define BL_PROFILE_SCOPE(name)
+#define BL_PROFILE_FRAME()
+#endif
+
+#endif
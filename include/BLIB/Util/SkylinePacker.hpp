@@ -0,0 +1,90 @@
+#ifndef BLIB_UTIL_SKYLINEPACKER_HPP
+#define BLIB_UTIL_SKYLINEPACKER_HPP
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <optional>
+#include <vector>
+
+namespace bl
+{
+namespace util
+{
+/**
+ * @brief Rectangle packer that tracks the top edge of packed rectangles as a skyline. Rectangles
+ *        are placed at the lowest position where they fit, preferring the narrowest segment on
+ *        ties. Packs tighter than a row based packer for rectangles of mixed heights, such as
+ *        glyphs of different characters and sizes
+ *
+ * @ingroup Util
+ */
+class SkylinePacker {
+public:
+    /**
+     * @brief Creates the packer with the given bounds
+     *
+     * @param width The width of the area to pack into
+     * @param height The height of the area to pack into
+     */
+    SkylinePacker(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Finds a place for a rectangle of the given size and marks it as used
+     *
+     * @param width The width of the rectangle to place
+     * @param height The height of the rectangle to place
+     * @return The top left corner of the placed rectangle, or nothing if it does not fit
+     */
+    std::optional<glm::u32vec2> pack(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Enlarges the area to pack into. Existing placements remain valid
+     *
+     * @param width The new width. Must be at least the current width
+     * @param height The new height. Must be at least the current height
+     */
+    void grow(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Removes all placements and sets the bounds of the area to pack into
+     *
+     * @param width The width of the area to pack into
+     * @param height The height of the area to pack into
+     */
+    void reset(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Returns the size of the area being packed into
+     */
+    const glm::u32vec2& getSize() const;
+
+    /**
+     * @brief Returns the fraction of the area that is covered by packed rectangles
+     */
+    float getOccupancy() const;
+
+private:
+    struct Segment {
+        unsigned int x;
+        unsigned int y;
+        unsigned int width;
+    };
+
+    glm::u32vec2 size;
+    std::vector<Segment> skyline;
+    std::uint64_t usedArea;
+
+    std::optional<unsigned int> fitAt(std::size_t i, unsigned int width,
+                                      unsigned int height) const;
+    void place(std::size_t i, unsigned int x, unsigned int y, unsigned int width,
+               unsigned int height);
+};
+
+//////////////////////////// INLINE FUNCTIONS /////////////////////////////////
+
+inline const glm::u32vec2& SkylinePacker::getSize() const { return size; }
+
+} // namespace util
+} // namespace bl
+
+#endif
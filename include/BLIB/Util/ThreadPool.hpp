@@ -50,6 +50,11 @@ public:
      */
     bool running() const;
 
+    /**
+     * @brief Returns the number of worker threads in the pool
+     */
+    unsigned int workerCount() const;
+
     /**
      * @brief Blocks until the task queue is empty and all workers are idle. If more tasks are
      *        submitted during this call it will continue to block until those are completed as well
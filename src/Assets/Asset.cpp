@@ -4,6 +4,7 @@
 #include <BLIB/Assets/Repository.hpp>
 #include <BLIB/Logging.hpp>
 #include <BLIB/Util/FileUtil.hpp>
+#include <BLIB/Util/Profiler.hpp>
 #include <stdexcept>
 
 namespace bl
@@ -95,6 +96,7 @@ bool Asset::load() {
     detail::DriverBase* driver = getDriver();
     if (!driver) { return false; }
 
+    BL_PROFILE_SCOPE("as::Asset::load");
     state = State::Loading;
     ReadContext context(*repo, repo->bundleRuntime, *this);
     payload = driver->read(context);
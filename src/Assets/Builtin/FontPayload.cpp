@@ -9,9 +9,11 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 
 namespace bl
 {
@@ -27,6 +29,83 @@ inline T reinterpret(const U& input) {
     return output;
 }
 
+constexpr float Infinity = 1e20f;
+
+// 1D squared euclidean distance transform (Felzenszwalb and Huttenlocher)
+void distanceTransform(float* grid, std::size_t stride, unsigned int length, float* f, float* z,
+                       int* v) {
+    v[0] = 0;
+    z[0] = -Infinity;
+    z[1] = Infinity;
+    f[0] = grid[0];
+    for (int q = 1, k = 0; q < static_cast<int>(length); ++q) {
+        f[q]           = grid[q * stride];
+        const float q2 = static_cast<float>(q * q);
+        float s        = 0.f;
+        do {
+            const int r = v[k];
+            s = (f[q] - f[r] + q2 - static_cast<float>(r * r)) / static_cast<float>(2 * (q - r));
+        } while (s <= z[k] && --k > -1);
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = Infinity;
+    }
+    for (int q = 0, k = 0; q < static_cast<int>(length); ++q) {
+        while (z[k + 1] < static_cast<float>(q)) { ++k; }
+        const float d    = static_cast<float>(q - v[k]);
+        grid[q * stride] = f[v[k]] + d * d;
+    }
+}
+
+void distanceTransform(std::vector<float>& grid, unsigned int width, unsigned int height) {
+    const unsigned int n = std::max(width, height);
+    std::vector<float> f(n);
+    std::vector<float> z(n + 1);
+    std::vector<int> v(n);
+    for (unsigned int x = 0; x < width; ++x) {
+        distanceTransform(&grid[x], width, height, f.data(), z.data(), v.data());
+    }
+    for (unsigned int y = 0; y < height; ++y) {
+        distanceTransform(&grid[y * width], 1, width, f.data(), z.data(), v.data());
+    }
+}
+
+// Replaces the coverage in the alpha channel with the signed distance to the glyph edge. Partial
+// coverage is treated as a sub-texel edge offset
+void generateDistanceField(std::vector<std::uint8_t>& pixels, unsigned int width,
+                           unsigned int height, unsigned int spread) {
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    std::vector<float> outside(count);
+    std::vector<float> inside(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float a = static_cast<float>(pixels[i * 4 + 3]) / 255.f;
+        if (a >= 1.f) {
+            outside[i] = 0.f;
+            inside[i]  = Infinity;
+        }
+        else if (a <= 0.f) {
+            outside[i] = Infinity;
+            inside[i]  = 0.f;
+        }
+        else {
+            const float d = 0.5f - a;
+            outside[i]    = d > 0.f ? d * d : 0.f;
+            inside[i]     = d < 0.f ? d * d : 0.f;
+        }
+    }
+
+    distanceTransform(outside, width, height);
+    distanceTransform(inside, width, height);
+
+    const float range = 2.f * static_cast<float>(spread);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float dist = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+        const float a     = std::clamp(0.5f - dist / range, 0.f, 1.f);
+        pixels[i * 4 + 3] = static_cast<std::uint8_t>(std::lround(a * 255.f));
+    }
+}
+
 // Combine outline thickness, boldness and font glyph index into a single 64-bit key
 std::uint64_t combine(std::uint8_t size, float outlineThickness, bool bold, std::uint32_t index) {
     return (static_cast<std::uint64_t>(reinterpret<std::uint32_t>(outlineThickness)) << 32) |
@@ -37,6 +116,7 @@ std::uint64_t combine(std::uint8_t size, float outlineThickness, bool bold, std:
 
 FontPayload::FontPayload(const as::Payload::ConstructContext& ctx)
 : Payload(ctx)
+, renderMode(RenderMode::Bitmap)
 , needsUpload(true)
 , m_library(NULL)
 , m_face(NULL)
@@ -44,15 +124,8 @@ FontPayload::FontPayload(const as::Payload::ConstructContext& ctx)
 , m_stroker(NULL)
 , m_isSmooth(true)
 , m_info()
-, nextRow(3) {
-    texture.resize({128, 128}, sf::Color(255, 255, 255, 0));
-
-    // Reserve a 2x2 white square for texturing underlines
-    for (unsigned int x = 0; x < 2; ++x) {
-        for (unsigned int y = 0; y < 2; ++y) {
-            texture.setPixel({x, y}, sf::Color(255, 255, 255, 255));
-        }
-    }
+, packer(128, 128) {
+    resetAtlas();
 
 #ifdef SFML_SYSTEM_ANDROID
     m_stream = NULL;
@@ -118,6 +191,33 @@ const FontPayload::Info& FontPayload::getInfo() const { return m_info; }
 
 const sf::Glyph& FontPayload::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
                                        bool bold, float outlineThickness) const {
+    if (renderMode == RenderMode::DistanceField) {
+        // outlines come from the same distance field so only the size and style matter
+        const FT_UInt index           = FT_Get_Char_Index(static_cast<FT_Face>(m_face), codePoint);
+        const std::uint64_t key       = combine(characterSize, 0.f, bold, index);
+        GlyphTable::const_iterator it = glyphs.find(key);
+        if (it != glyphs.end()) { return it->second; }
+
+        // rasterize once at the reference size and scale the metrics for other sizes
+        const std::uint64_t refKey = combine(DistanceFieldSize, 0.f, bold, index);
+        it                         = glyphs.find(refKey);
+        if (it == glyphs.end()) {
+            needsUpload               = true;
+            const sf::Glyph reference = loadGlyph(codePoint, DistanceFieldSize, bold, 0.f);
+            it                        = glyphs.insert(std::make_pair(refKey, reference)).first;
+        }
+        if (characterSize == DistanceFieldSize) { return it->second; }
+
+        const float scale = static_cast<float>(characterSize) / DistanceFieldSize;
+        sf::Glyph glyph   = it->second;
+        glyph.advance *= scale;
+        glyph.lsbDelta = static_cast<int>(static_cast<float>(glyph.lsbDelta) * scale);
+        glyph.rsbDelta = static_cast<int>(static_cast<float>(glyph.rsbDelta) * scale);
+        glyph.bounds.position *= scale;
+        glyph.bounds.size *= scale;
+        return glyphs.insert(std::make_pair(key, glyph)).first->second;
+    }
+
     // Build the key by combining the glyph index (based on code point), bold flag, and outline
     // thickness
     std::uint64_t key = combine(characterSize,
@@ -139,6 +239,44 @@ const sf::Glyph& FontPayload::getGlyph(std::uint32_t codePoint, unsigned int cha
     }
 }
 
+const FontPayload::AsciiTable& FontPayload::getAsciiTable(unsigned int characterSize, bool bold,
+                                                          float outlineThickness) const {
+    const auto key = std::make_tuple(characterSize, bold, outlineThickness);
+    auto it        = asciiTables.find(key);
+    if (it == asciiTables.end()) {
+        it = asciiTables
+                 .emplace(std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(*this, characterSize, bold, outlineThickness))
+                 .first;
+    }
+    return it->second;
+}
+
+void FontPayload::setRenderMode(RenderMode mode) {
+    if (mode == renderMode) { return; }
+
+    renderMode = mode;
+    asciiTables.clear();
+    glyphs.clear();
+    resetAtlas();
+    needsUpload = true;
+}
+
+FontPayload::RenderMode FontPayload::getRenderMode() const { return renderMode; }
+
+float FontPayload::getDistanceFieldPadding(unsigned int characterSize) const {
+    return static_cast<float>(DistanceFieldSpread) * static_cast<float>(characterSize) /
+           static_cast<float>(DistanceFieldSize);
+}
+
+float FontPayload::getDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const {
+    // the field maps [-spread, spread] texels at the reference size to [1, 0]
+    const float scale  = static_cast<float>(characterSize) / static_cast<float>(DistanceFieldSize);
+    const float texels = scale > 0.f ? outlineThickness / scale : 0.f;
+    return std::clamp(0.5f - texels / (2.f * DistanceFieldSpread), 0.f, 1.f);
+}
+
 bool FontPayload::hasGlyph(std::uint32_t codePoint) const {
     return FT_Get_Char_Index(static_cast<FT_Face>(m_face), codePoint) != 0;
 }
@@ -240,9 +378,9 @@ void FontPayload::cleanup(bool freeBuffer) {
     m_face      = NULL;
     m_stroker   = NULL;
     m_streamRec = NULL;
+    asciiTables.clear();
     glyphs.clear();
-    rows.clear();
-    nextRow     = 3;
+    resetAtlas();
     needsUpload = true;
     vulkanTexture.release();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
@@ -319,8 +457,9 @@ sf::Glyph FontPayload::loadGlyph(std::uint32_t codePoint, unsigned int character
 
     if ((width > 0) && (height > 0)) {
         // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        // pollute them with pixels from neighbors. Distance fields extend into the padding
+        const unsigned int padding =
+            renderMode == RenderMode::DistanceField ? DistanceFieldSpread : 2;
 
         width += 2 * padding;
         height += 2 * padding;
@@ -380,6 +519,11 @@ sf::Glyph FontPayload::loadGlyph(std::uint32_t codePoint, unsigned int character
             }
         }
 
+        // Convert coverage to distance from the glyph edge
+        if (renderMode == RenderMode::DistanceField) {
+            generateDistanceField(m_pixelBuffer, width, height, DistanceFieldSpread);
+        }
+
         // Write the pixels to the texture
         unsigned int x = static_cast<unsigned int>(glyph.textureRect.position.x) - padding;
         unsigned int y = static_cast<unsigned int>(glyph.textureRect.position.y) - padding;
@@ -402,54 +546,37 @@ sf::Glyph FontPayload::loadGlyph(std::uint32_t codePoint, unsigned int character
 }
 
 sf::IntRect FontPayload::findGlyphRect(unsigned int width, unsigned int height) const {
-    // Find the line that fits well the glyph
-    Row* row        = NULL;
-    float bestRatio = 0;
-    for (std::vector<Row>::iterator it = rows.begin(); it != rows.end() && !row; ++it) {
-        float ratio = static_cast<float>(height) / static_cast<float>(it->height);
-
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f)) continue;
-
-        // Check if there's enough horizontal space left in the row
-        if (width > texture.getSize().x - it->width) continue;
+    std::optional<glm::u32vec2> pos = packer.pack(width, height);
+    while (!pos.has_value()) {
+        // Not enough space: make the texture 2 times bigger
+        const unsigned int textureWidth  = texture.getSize().x;
+        const unsigned int textureHeight = texture.getSize().y;
+
+        sf::Image newTexture;
+        newTexture.resize({textureWidth * 2, textureHeight * 2}, sf::Color(255, 255, 255, 0));
+        newTexture.copy(texture, {0, 0});
+        texture = std::move(newTexture);
+
+        packer.grow(textureWidth * 2, textureHeight * 2);
+        pos = packer.pack(width, height);
+    }
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio) continue;
+    return sf::IntRect({static_cast<int>(pos.value().x), static_cast<int>(pos.value().y)},
+                       {static_cast<int>(width), static_cast<int>(height)});
+}
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
-    }
+void FontPayload::resetAtlas() const {
+    texture.resize({128, 128}, sf::Color(255, 255, 255, 0));
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row) {
-        unsigned int rowHeight = height + height / 10;
-        while ((nextRow + rowHeight >= texture.getSize().y) || (width >= texture.getSize().x)) {
-            // Not enough space: resize the texture if possible
-            unsigned int textureWidth  = texture.getSize().x;
-            unsigned int textureHeight = texture.getSize().y;
-
-            // Make the texture 2 times bigger
-            sf::Image newTexture;
-            newTexture.resize({textureWidth * 2, textureHeight * 2}, sf::Color(255, 255, 255, 0));
-            newTexture.copy(texture, {0, 0});
-            texture = std::move(newTexture);
+    // Reserve a 2x2 white square for texturing underlines
+    for (unsigned int x = 0; x < 2; ++x) {
+        for (unsigned int y = 0; y < 2; ++y) {
+            texture.setPixel({x, y}, sf::Color(255, 255, 255, 255));
         }
-
-        // We can now create the new row
-        rows.emplace_back(nextRow, rowHeight);
-        nextRow += rowHeight;
-        row = &rows.back();
     }
 
-    // Find the glyph's rectangle on the selected row
-    sf::IntRect rect(sf::Rect<unsigned int>({row->width, row->top}, {width, height}));
-
-    // Update the row informations
-    row->width += width;
-
-    return rect;
+    packer.reset(texture.getSize().x, texture.getSize().y);
+    packer.pack(3, 3);
 }
 
 bool FontPayload::setCurrentSize(unsigned int characterSize) const {
@@ -493,5 +620,33 @@ bl::rc::res::TextureRef FontPayload::syncTexture(bl::rc::Renderer& renderer) con
     return vulkanTexture;
 }
 
+FontPayload::AsciiTable::AsciiTable(const FontPayload& font, unsigned int characterSize, bool bold,
+                                    float outlineThickness)
+: font(font)
+, characterSize(characterSize)
+, bold(bold)
+, outlineThickness(outlineThickness) {
+    // glyph table entries are never moved so the pointers stay valid until cleanup()
+    for (std::uint32_t i = 0; i < Count; ++i) {
+        glyphs[i] = &font.getGlyph(First + i, characterSize, bold, outlineThickness);
+    }
+}
+
+const sf::Glyph& FontPayload::AsciiTable::getGlyph(std::uint32_t codePoint) const {
+    if (codePoint >= First && codePoint <= Last) { return *glyphs[codePoint - First]; }
+    return font.getGlyph(codePoint, characterSize, bold, outlineThickness);
+}
+
+float FontPayload::AsciiTable::getKerning(std::uint32_t first, std::uint32_t second) const {
+    if (first < First || first > Last || second < First || second > Last) {
+        return font.getKerning(first, second, characterSize, bold);
+    }
+
+    if (kerning.empty()) { kerning.resize(Count * Count, std::numeric_limits<float>::quiet_NaN()); }
+    float& k = kerning[(first - First) * Count + (second - First)];
+    if (std::isnan(k)) { k = font.getKerning(first, second, characterSize, bold); }
+    return k;
+}
+
 } // namespace asi
 } // namespace bl
@@ -1,5 +1,6 @@
 #include <BLIB/Audio/AudioSystem.hpp>
 
+#include <BLIB/Audio/StreamOutput.hpp>
 #include <BLIB/Engine/Configuration.hpp>
 #include <BLIB/Engine/Engine.hpp>
 #include <BLIB/Engine/System.hpp>
@@ -21,21 +22,12 @@ namespace
 {
 struct Sound {
     as::TypedRef<asi::SoundPayload> buffer;
-    sf::Sound sound;
+    SoundData data;
     float lastInteractTime;
 
     Sound(as::TypedRef<asi::SoundPayload>&& buffer);
 };
 
-struct SoundFader {
-    sf::Sound& sound;
-    const float fvel;
-    std::list<SoundFader>::iterator me;
-
-    SoundFader(sf::Sound& s, float fvel);
-    void update();
-};
-
 struct PlaylistFader {
     std::optional<Playlist> localPlaylist;
     Playlist* playlist;
@@ -62,9 +54,9 @@ public:
     std::unordered_map<util::UUID, AudioSystem::Handle> soundHandles;
     std::unordered_map<AudioSystem::Handle, util::UUID> soundSources;
     std::unordered_map<AudioSystem::Handle, Sound> sounds;
-    std::list<SoundFader> fadingSounds;
-    sf::Clock soundTimer;
     std::shared_mutex soundMutex;
+    Mixer mixer;
+    std::unique_ptr<OutputDevice> output;
 
     std::unordered_map<util::UUID, AudioSystem::Handle> playlistHandles;
     std::unordered_map<AudioSystem::Handle, util::UUID> playlistSources;
@@ -153,21 +145,16 @@ bool AudioSystem::playSound(Handle sound, float fadeIn, bool loop) {
 
     const auto it = r.validateAndLoadSound(sound);
     if (it == r.sounds.end()) return false;
-
-    // play the sound
-    it->second.sound.setLooping(loop);
     it->second.lastInteractTime = r.timer.getElapsedTime().asSeconds();
-    if (it->second.sound.getStatus() == sf::Sound::Status::Playing) return true;
 
-    if (fadeIn > 0.f) {
-        it->second.sound.setVolume(0.f);
-        r.fadingSounds.emplace_back(it->second.sound, 100.f / fadeIn);
-        r.fadingSounds.back().me = --r.fadingSounds.end();
-    }
-    else { it->second.sound.setVolume(100.f); }
+    // looping sounds are not layered on top of themselves
+    auto voices = r.mixer.voices();
+    if (loop && voices->isSoundPlaying(sound)) return true;
 
-    it->second.sound.play();
-    return true;
+    VoiceSettings settings;
+    settings.loop   = loop;
+    settings.fadeIn = fadeIn;
+    return voices->play(it->second.data, sound, settings) != VoicePool::InvalidVoice;
 }
 
 bool AudioSystem::playOrRestartSound(Handle sound) {
@@ -178,12 +165,31 @@ bool AudioSystem::playOrRestartSound(Handle sound) {
     const auto it = r.validateAndLoadSound(sound);
     if (it == r.sounds.end()) return false;
 
-    // play the sound
-    it->second.sound.setLooping(false);
-    it->second.sound.setVolume(100.f);
     it->second.lastInteractTime = r.timer.getElapsedTime().asSeconds();
-    it->second.sound.play();
-    return true;
+
+    auto voices = r.mixer.voices();
+    voices->stopSound(sound);
+    return voices->play(it->second.data, sound, {}) != VoicePool::InvalidVoice;
+}
+
+AudioSystem::VoiceId AudioSystem::startVoice(Handle sound, const VoiceSettings& settings) {
+    std::shared_lock slock(Runner::get().soundMutex);
+    auto& r = Runner::get();
+    if (r.paused) return VoicePool::InvalidVoice;
+
+    const auto it = r.validateAndLoadSound(sound);
+    if (it == r.sounds.end()) return VoicePool::InvalidVoice;
+
+    it->second.lastInteractTime = r.timer.getElapsedTime().asSeconds();
+    return r.mixer.voices()->play(it->second.data, sound, settings);
+}
+
+void AudioSystem::moveVoice(VoiceId voice, const glm::vec3& position) {
+    Runner::get().mixer.voices()->setPosition(voice, position);
+}
+
+void AudioSystem::stopVoice(VoiceId voice, float fadeOut) {
+    Runner::get().mixer.voices()->stop(voice, fadeOut);
 }
 
 void AudioSystem::stopSound(Handle sound, float fadeOut) {
@@ -192,24 +198,30 @@ void AudioSystem::stopSound(Handle sound, float fadeOut) {
     const auto it = Runner::get().sounds.find(sound);
     if (it != Runner::get().sounds.end()) {
         it->second.lastInteractTime = Runner::get().timer.getElapsedTime().asSeconds();
-        if (it->second.sound.getStatus() == sf::Sound::Status::Playing) {
-            if (fadeOut <= 0.f) { it->second.sound.stop(); }
-            else {
-                Runner::get().fadingSounds.emplace_back(it->second.sound,
-                                                        -it->second.sound.getVolume() / fadeOut);
-                Runner::get().fadingSounds.back().me = --Runner::get().fadingSounds.end();
-            }
-        }
+        Runner::get().mixer.voices()->stopSound(sound, fadeOut);
     }
 }
 
-void AudioSystem::stopAllSounds() {
-    std::unique_lock lock(Runner::get().soundMutex);
+void AudioSystem::stopAllSounds() { Runner::get().mixer.voices()->stopAll(); }
 
-    for (auto& sound : Runner::get().sounds) {
-        if (sound.second.sound.getStatus() == sf::Sound::Status::Playing) {
-            sound.second.sound.stop();
-        }
+void AudioSystem::setListener(const Listener& listener) {
+    Runner::get().mixer.voices()->setListener(listener);
+}
+
+void AudioSystem::setPolyphony(unsigned int voices) {
+    Runner::get().mixer.voices()->setPolyphony(voices);
+}
+
+void AudioSystem::setSoundVoiceLimit(Handle sound, unsigned int limit) {
+    Runner::get().mixer.voices()->setVoiceLimit(sound, limit);
+}
+
+void AudioSystem::setOutputDevice(std::unique_ptr<OutputDevice>&& device) {
+    auto& r = Runner::get();
+    if (r.output) { r.output->stop(); }
+    r.output = std::move(device);
+    if (r.output && !r.output->start(r.mixer)) {
+        BL_LOG_ERROR << "Failed to start audio output device";
     }
 }
 
@@ -350,11 +362,7 @@ void AudioSystem::pause() {
     if (r.paused) return;
     r.paused = true;
 
-    for (auto& sound : r.sounds) {
-        if (sound.second.sound.getStatus() == sf::Sound::Status::Playing) {
-            sound.second.sound.pause();
-        }
-    }
+    r.mixer.setPaused(true);
     if (!r.playlistStack.empty() && r.playlistStack.back().isPlaying()) {
         r.playlistStack.back().pause();
     }
@@ -368,11 +376,7 @@ void AudioSystem::resume() {
     if (!r.paused) return;
     r.paused = false;
 
-    for (auto& sound : r.sounds) {
-        if (sound.second.sound.getStatus() == sf::Sound::Status::Paused) {
-            sound.second.sound.play();
-        }
-    }
+    r.mixer.setPaused(false);
     if (!r.playlistStack.empty()) { r.playlistStack.back().play(); }
     if (r.fadeIn.playlist) { r.fadeIn.playlist->play(); }
     if (r.fadeOut.playlist) { r.fadeOut.playlist->play(); }
@@ -396,7 +400,7 @@ void AudioSystem::stop(bool fade) {
     auto& r = Runner::get();
     {
         std::unique_lock lock(r.soundMutex);
-        for (auto& sound : r.sounds) { sound.second.sound.stop(); }
+        r.mixer.voices()->stopAll();
     }
 
     {
@@ -419,15 +423,23 @@ void AudioSystem::registerSystem(engine::Engine& engine) {
 
 namespace
 {
-Sound::Sound(as::TypedRef<asi::SoundPayload>&& buffer)
-: buffer(std::move(buffer))
-, sound(this->buffer->get())
-, lastInteractTime(Runner::get().timer.getElapsedTime().asSeconds()) {}
+Sound::Sound(as::TypedRef<asi::SoundPayload>&& b)
+: buffer(std::move(b))
+, lastInteractTime(Runner::get().timer.getElapsedTime().asSeconds()) {
+    const sf::SoundBuffer& samples = buffer->get();
+    const unsigned int channels    = samples.getChannelCount();
+
+    data.samples      = samples.getSamples();
+    data.frameCount   = channels > 0 ? samples.getSampleCount() / channels : 0;
+    data.channelCount = channels;
+    data.sampleRate   = samples.getSampleRate();
+}
 
 Runner::Runner()
 : paused(false) {}
 
 Runner::~Runner() {
+    if (output) { output->stop(); }
     if (instance == this) { instance = nullptr; }
 }
 
@@ -444,19 +456,21 @@ void Runner::init(engine::Engine&) {
     }
     instance = this;
     AudioSystem::loadFromConfig();
+    AudioSystem::setOutputDevice(std::make_unique<StreamOutput>());
 }
 
 void Runner::earlyCleanup() {
     BL_LOG_INFO << "Shutting down AudioSystem";
     AudioSystem::stop(true);
     sf::sleep(sf::milliseconds(500)); // for music threads to stop
+    if (output) { output->stop(); }
     BL_LOG_INFO << "AudioSystem shutdown";
 }
 
 void Runner::update(std::mutex&, float, float, float, float) {
     if (paused) { return; }
 
-    // sound cleanup and fadeouts
+    // sound cleanup
     {
         std::unique_lock slock(soundMutex);
 
@@ -466,18 +480,12 @@ void Runner::update(std::mutex&, float, float, float, float) {
             if (it != sounds.end()) {
                 if (timer.getElapsedTime().asSeconds() - it->second.lastInteractTime >=
                         unloadTimeout + it->second.buffer->get().getDuration().asSeconds() &&
-                    it->second.sound.getStatus() != sf::Sound::Status::Playing) {
+                    !mixer.voices()->isSoundPlaying(j->second)) {
                     sounds.erase(it);
                     soundHandles.erase(j);
                 }
             }
         }
-
-        for (auto i = fadingSounds.begin(); i != fadingSounds.end();) {
-            auto j = i++;
-            j->update();
-        }
-        soundTimer.restart();
     }
 
     // playlist crossfade update and song update
@@ -555,24 +563,6 @@ void PlaylistFader::update() {
     }
 }
 
-SoundFader::SoundFader(sf::Sound& s, float v)
-: sound(s)
-, fvel(v) {}
-
-void SoundFader::update() {
-    const float v =
-        sound.getVolume() + fvel * Runner::get().soundTimer.getElapsedTime().asSeconds();
-    if (v <= 0.f) {
-        sound.stop();
-        Runner::get().fadingSounds.erase(me);
-    }
-    else if (v >= 100.f) {
-        sound.setVolume(100.f);
-        Runner::get().fadingSounds.erase(me);
-    }
-    else { sound.setVolume(v); }
-}
-
 } // namespace
 } // namespace audio
 } // namespace bl
@@ -0,0 +1,166 @@
+#include <BLIB/Audio/Mixer.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace bl
+{
+namespace audio
+{
+namespace
+{
+constexpr float SampleScale = 1.f / 32768.f;
+
+// the kernels below are kept free of branches and work on contiguous float arrays so that they
+// vectorize
+
+void readFrames(const std::int16_t* src, unsigned int stride, unsigned int second, float* left,
+                float* right, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        left[i]  = static_cast<float>(src[i * stride]) * SampleScale;
+        right[i] = static_cast<float>(src[i * stride + second]) * SampleScale;
+    }
+}
+
+void downmix(float* left, const float* right, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) { left[i] = (left[i] + right[i]) * 0.5f; }
+}
+
+// blocks are small so a 32 bit index is used, which converts to float in vector registers
+void accumulate(float* out, const float* in, int count, float gain, float gainStep) {
+    for (int i = 0; i < count; ++i) { out[i] += in[i] * (gain + gainStep * static_cast<float>(i)); }
+}
+
+// clamping as integers keeps the loop free of branches
+std::int16_t toSample(float s) {
+    const std::int32_t v = static_cast<std::int32_t>(s * 32767.f);
+    return static_cast<std::int16_t>(std::clamp(v, -32767, 32767));
+}
+
+void interleave(const float* left, const float* right, std::int16_t* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i * 2]     = toSample(left[i]);
+        out[i * 2 + 1] = toSample(right[i]);
+    }
+}
+} // namespace
+
+Mixer::VoiceAccess::VoiceAccess(std::mutex& mutex, VoicePool& pool)
+: lock(mutex)
+, pool(pool) {}
+
+Mixer::Mixer(unsigned int sampleRate, unsigned int capacity, unsigned int polyphony)
+: sampleRate(std::max(sampleRate, 1u))
+, pool(capacity, polyphony)
+, paused(false)
+, mixLeft(BlockFrames)
+, mixRight(BlockFrames)
+, voiceLeft(BlockFrames)
+, voiceRight(BlockFrames) {}
+
+Mixer::VoiceAccess Mixer::voices() { return VoiceAccess(mutex, pool); }
+
+void Mixer::setPaused(bool p) { paused = p; }
+
+void Mixer::mix(std::int16_t* samples, std::size_t frameCount) {
+    std::unique_lock lock(mutex);
+
+    if (paused) {
+        std::fill(samples, samples + frameCount * ChannelCount, 0);
+        return;
+    }
+
+    for (std::size_t offset = 0; offset < frameCount; offset += BlockFrames) {
+        const std::size_t count = std::min(BlockFrames, frameCount - offset);
+        pool.prepare(count, sampleRate);
+
+        std::fill(mixLeft.begin(), mixLeft.begin() + count, 0.f);
+        std::fill(mixRight.begin(), mixRight.begin() + count, 0.f);
+        for (const std::uint32_t slot : pool.audibleSlots) { mixVoice(pool.voices[slot], count); }
+
+        interleave(mixLeft.data(), mixRight.data(), samples + offset * ChannelCount, count);
+    }
+}
+
+void Mixer::mixVoice(VoicePool::Voice& voice, std::size_t frameCount) {
+    const std::size_t count = readVoice(voice, frameCount);
+    if (count < frameCount) { voice.finished = true; }
+
+    // positional voices are panned as a single source
+    const float* right = voice.sound.channelCount > 1 ? voiceRight.data() : voiceLeft.data();
+    if (voice.settings.position.has_value() && voice.sound.channelCount > 1) {
+        downmix(voiceLeft.data(), voiceRight.data(), count);
+        right = voiceLeft.data();
+    }
+
+    const float steps = static_cast<float>(frameCount);
+    accumulate(mixLeft.data(),
+               voiceLeft.data(),
+               static_cast<int>(count),
+               voice.prevGain[0],
+               (voice.gain[0] - voice.prevGain[0]) / steps);
+    accumulate(mixRight.data(),
+               right,
+               static_cast<int>(count),
+               voice.prevGain[1],
+               (voice.gain[1] - voice.prevGain[1]) / steps);
+}
+
+std::size_t Mixer::readVoice(VoicePool::Voice& voice, std::size_t frameCount) {
+    const SoundData& sound    = voice.sound;
+    const unsigned int stride = sound.channelCount;
+    const unsigned int second = sound.channelCount > 1 ? 1 : 0;
+    const double end          = static_cast<double>(sound.frameCount);
+    float* left               = voiceLeft.data();
+    float* right              = voiceRight.data();
+
+    // matching sample rates read whole spans straight from the sound
+    std::size_t produced = 0;
+    if (voice.step == 1.0 && voice.cursor == std::floor(voice.cursor)) {
+        while (produced < frameCount) {
+            const std::uint64_t pos = static_cast<std::uint64_t>(voice.cursor);
+            const std::size_t span =
+                static_cast<std::size_t>(std::min<std::uint64_t>(frameCount - produced,
+                                                                 sound.frameCount - pos));
+            readFrames(sound.samples + pos * stride,
+                       stride,
+                       second,
+                       left + produced,
+                       right + produced,
+                       span);
+            produced += span;
+            voice.cursor += static_cast<double>(span);
+            if (voice.cursor >= end) {
+                if (!voice.settings.loop) { break; }
+                voice.cursor = 0.0;
+            }
+        }
+        return produced;
+    }
+
+    // otherwise resample with linear interpolation
+    for (; produced < frameCount; ++produced) {
+        if (voice.cursor >= end) {
+            if (!voice.settings.loop) { break; }
+            voice.cursor = std::fmod(voice.cursor, end);
+        }
+
+        const std::uint64_t i0 = static_cast<std::uint64_t>(voice.cursor);
+        const std::uint64_t i1 = i0 + 1 < sound.frameCount ? i0 + 1 :
+                                 voice.settings.loop        ? 0 :
+                                                              i0;
+        const float t = static_cast<float>(voice.cursor - static_cast<double>(i0));
+
+        const float l0  = sound.samples[i0 * stride];
+        const float l1  = sound.samples[i1 * stride];
+        const float r0  = sound.samples[i0 * stride + second];
+        const float r1  = sound.samples[i1 * stride + second];
+        left[produced]  = (l0 + (l1 - l0) * t) * SampleScale;
+        right[produced] = (r0 + (r1 - r0) * t) * SampleScale;
+        voice.cursor += voice.step;
+    }
+    return produced;
+}
+
+} // namespace audio
+} // namespace bl
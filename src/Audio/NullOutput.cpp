@@ -0,0 +1,28 @@
+#include <BLIB/Audio/NullOutput.hpp>
+
+#include <BLIB/Audio/Mixer.hpp>
+#include <algorithm>
+
+namespace bl
+{
+namespace audio
+{
+NullOutput::NullOutput()
+: mixer(nullptr) {}
+
+bool NullOutput::start(Mixer& m) {
+    mixer = &m;
+    return true;
+}
+
+void NullOutput::stop() { mixer = nullptr; }
+
+const std::vector<std::int16_t>& NullOutput::render(std::size_t frameCount) {
+    samples.resize(frameCount * Mixer::ChannelCount);
+    if (mixer) { mixer->mix(samples.data(), frameCount); }
+    else { std::fill(samples.begin(), samples.end(), 0); }
+    return samples;
+}
+
+} // namespace audio
+} // namespace bl
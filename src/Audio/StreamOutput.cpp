@@ -0,0 +1,51 @@
+#include <BLIB/Audio/StreamOutput.hpp>
+
+#include <BLIB/Audio/Mixer.hpp>
+#include <BLIB/Logging.hpp>
+
+namespace bl
+{
+namespace audio
+{
+StreamOutput::~StreamOutput() { stop(); }
+
+bool StreamOutput::start(Mixer& mixer) {
+    stream.stop();
+    stream.open(mixer);
+    stream.play();
+    if (stream.getStatus() != sf::SoundSource::Status::Playing) {
+        BL_LOG_ERROR << "Failed to start audio output stream";
+        return false;
+    }
+    return true;
+}
+
+void StreamOutput::stop() { stream.stop(); }
+
+StreamOutput::Stream::Stream()
+: mixer(nullptr)
+, buffer(Mixer::BlockFrames * Mixer::ChannelCount) {}
+
+void StreamOutput::Stream::open(Mixer& m) {
+    mixer = &m;
+    initialize(Mixer::ChannelCount,
+               m.getSampleRate(),
+               {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight});
+
+    // the mixer already attenuates and pans positional voices
+    setRelativeToListener(true);
+    setPosition({0.f, 0.f, 0.f});
+    setSpatializationEnabled(false);
+}
+
+bool StreamOutput::Stream::onGetData(Chunk& data) {
+    mixer->mix(buffer.data(), Mixer::BlockFrames);
+    data.samples     = buffer.data();
+    data.sampleCount = buffer.size();
+    return true;
+}
+
+void StreamOutput::Stream::onSeek(sf::Time) {}
+
+} // namespace audio
+} // namespace bl
@@ -0,0 +1,313 @@
+#include <BLIB/Audio/VoicePool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace bl
+{
+namespace audio
+{
+namespace
+{
+constexpr unsigned int MaxCapacity  = std::numeric_limits<std::uint16_t>::max();
+constexpr std::uint32_t NoSlot      = std::numeric_limits<std::uint32_t>::max();
+constexpr float MinDistanceEpsilon  = 0.0001f;
+constexpr float DefaultAudibleLevel = 0.001f;
+} // namespace
+
+VoicePool::VoicePool(unsigned int capacity, unsigned int p)
+: voices(std::clamp(capacity, 1u, MaxCapacity))
+, polyphony(std::min(p, static_cast<unsigned int>(voices.size())))
+, defaultVoiceLimit(DefaultVoiceLimit)
+, audibilityThreshold(DefaultAudibleLevel)
+, nextStartOrder(0) {
+    freeSlots.reserve(voices.size());
+    activeSlots.reserve(voices.size());
+    audibleSlots.reserve(voices.size());
+    for (std::uint32_t i = voices.size(); i > 0; --i) {
+        Voice& v     = voices[i - 1];
+        v.generation = 0;
+        v.active     = false;
+        v.audible    = false;
+        v.finished   = false;
+        v.fresh      = false;
+        freeSlots.emplace_back(i - 1);
+    }
+}
+
+VoicePool::VoiceId VoicePool::play(const SoundData& sound, std::uint32_t soundId,
+                                   const VoiceSettings& settings) {
+    if (!sound.samples || sound.frameCount == 0 || sound.channelCount == 0 ||
+        sound.sampleRate == 0) {
+        return InvalidVoice;
+    }
+
+    // enforce the per sound limit by stealing the oldest voice of the sound
+    const auto lit           = voiceLimits.find(soundId);
+    const unsigned int limit = lit != voiceLimits.end() ? lit->second : defaultVoiceLimit;
+    if (limit > 0) {
+        unsigned int count   = 0;
+        std::uint32_t oldest = NoSlot;
+        for (const std::uint32_t slot : activeSlots) {
+            const Voice& v = voices[slot];
+            if (v.soundId != soundId || v.finished) { continue; }
+            ++count;
+            if (oldest == NoSlot || v.startOrder < voices[oldest].startOrder) { oldest = slot; }
+        }
+        if (count >= limit) { release(oldest); }
+    }
+
+    if (freeSlots.empty()) {
+        if (steal(settings.priority) == NoSlot) { return InvalidVoice; }
+    }
+
+    const std::uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    activeSlots.emplace_back(slot);
+
+    Voice& v = voices[slot];
+
+    v.sound                = sound;
+    v.soundId              = soundId;
+    v.settings             = settings;
+    v.settings.minDistance = std::max(settings.minDistance, MinDistanceEpsilon);
+    v.settings.attenuation = std::max(settings.attenuation, 0.f);
+    v.cursor               = 0.0;
+    v.step                 = 1.0;
+    v.fadeGain             = settings.fadeIn > 0.f ? 0.f : 1.f;
+    v.fadeRate             = settings.fadeIn > 0.f ? 1.f / settings.fadeIn : 0.f;
+    v.gain[0]              = 0.f;
+    v.gain[1]              = 0.f;
+    v.prevGain[0]          = 0.f;
+    v.prevGain[1]          = 0.f;
+    v.audibility           = 0.f;
+    v.startOrder           = nextStartOrder++;
+    v.generation           = v.generation == MaxCapacity ? 1 : v.generation + 1;
+    v.active               = true;
+    v.audible              = false;
+    v.finished             = false;
+    v.fresh                = true;
+
+    return (static_cast<VoiceId>(v.generation) << 16) | (slot + 1);
+}
+
+void VoicePool::stop(VoiceId id, float fadeOut) {
+    Voice* v = find(id);
+    if (v) { stopVoice(*v, fadeOut); }
+}
+
+void VoicePool::stopSound(std::uint32_t soundId, float fadeOut) {
+    // iterate backwards because stopping immediately swaps the last voice into the released slot
+    for (std::size_t i = activeSlots.size(); i > 0; --i) {
+        Voice& v = voices[activeSlots[i - 1]];
+        if (v.soundId == soundId && !v.finished) { stopVoice(v, fadeOut); }
+    }
+}
+
+void VoicePool::stopAll() {
+    while (!activeSlots.empty()) { release(activeSlots.back()); }
+}
+
+bool VoicePool::isPlaying(VoiceId id) const { return find(id) != nullptr; }
+
+bool VoicePool::isSoundPlaying(std::uint32_t soundId) const {
+    for (const std::uint32_t slot : activeSlots) {
+        if (voices[slot].soundId == soundId && !voices[slot].finished) { return true; }
+    }
+    return false;
+}
+
+bool VoicePool::isAudible(VoiceId id) const {
+    const Voice* v = find(id);
+    return v && v->audible;
+}
+
+void VoicePool::setPosition(VoiceId id, const glm::vec3& position) {
+    Voice* v = find(id);
+    if (v) { v->settings.position = position; }
+}
+
+void VoicePool::setListener(const Listener& l) { listener = l; }
+
+void VoicePool::setPolyphony(unsigned int p) {
+    polyphony = std::min(p, static_cast<unsigned int>(voices.size()));
+}
+
+void VoicePool::setDefaultVoiceLimit(unsigned int limit) { defaultVoiceLimit = limit; }
+
+void VoicePool::setVoiceLimit(std::uint32_t soundId, unsigned int limit) {
+    voiceLimits[soundId] = limit;
+}
+
+void VoicePool::setAudibilityThreshold(float t) { audibilityThreshold = std::max(t, 0.f); }
+
+void VoicePool::prepare(std::size_t frameCount, unsigned int sampleRate) {
+    for (std::size_t i = activeSlots.size(); i > 0; --i) {
+        if (voices[activeSlots[i - 1]].finished) { release(activeSlots[i - 1]); }
+    }
+
+    // update fades and gains. New voices start at their gain so that their attack is preserved
+    // while voices returning from being virtual ramp in from silence
+    const float dt = static_cast<float>(frameCount) / static_cast<float>(sampleRate);
+    audibleSlots.clear();
+    for (const std::uint32_t slot : activeSlots) {
+        Voice& v              = voices[slot];
+        const bool wasAudible = v.audible;
+
+        v.step        = static_cast<double>(v.settings.pitch) * v.sound.sampleRate / sampleRate;
+        v.prevGain[0] = wasAudible ? v.gain[0] : 0.f;
+        v.prevGain[1] = wasAudible ? v.gain[1] : 0.f;
+        v.audible     = false;
+
+        v.fadeGain += v.fadeRate * dt;
+        if (v.fadeRate < 0.f && v.fadeGain <= 0.f) {
+            v.fadeGain = 0.f;
+            v.finished = true;
+        }
+        else if (v.fadeRate > 0.f && v.fadeGain >= 1.f) {
+            v.fadeGain = 1.f;
+            v.fadeRate = 0.f;
+        }
+
+        computeGains(v);
+        if (v.fresh) {
+            v.prevGain[0] = v.gain[0];
+            v.prevGain[1] = v.gain[1];
+            v.fresh       = false;
+        }
+        // voices that just faded out are mixed one last time to ramp down to silence
+        if (v.audibility >= audibilityThreshold || (wasAudible && v.finished)) {
+            audibleSlots.emplace_back(slot);
+        }
+    }
+
+    // keep the highest priority and loudest voices within the polyphony
+    if (audibleSlots.size() > polyphony) {
+        const auto louder = [this](std::uint32_t l, std::uint32_t r) {
+            const Voice& a = voices[l];
+            const Voice& b = voices[r];
+            if (a.settings.priority != b.settings.priority) {
+                return a.settings.priority > b.settings.priority;
+            }
+            if (a.audibility != b.audibility) { return a.audibility > b.audibility; }
+            return a.startOrder < b.startOrder;
+        };
+        std::nth_element(
+            audibleSlots.begin(), audibleSlots.begin() + polyphony, audibleSlots.end(), louder);
+        audibleSlots.resize(polyphony);
+    }
+    for (const std::uint32_t slot : audibleSlots) { voices[slot].audible = true; }
+
+    // virtual voices keep their place in the sound without being mixed
+    for (const std::uint32_t slot : activeSlots) {
+        Voice& v = voices[slot];
+        if (!v.audible && !advance(v, frameCount)) { v.finished = true; }
+    }
+}
+
+VoicePool::Voice* VoicePool::find(VoiceId id) {
+    const std::uint32_t slot = (id & 0xFFFF) - 1;
+    if (id == InvalidVoice || slot >= voices.size()) { return nullptr; }
+    Voice& v = voices[slot];
+    return v.active && !v.finished && v.generation == (id >> 16) ? &v : nullptr;
+}
+
+const VoicePool::Voice* VoicePool::find(VoiceId id) const {
+    return const_cast<VoicePool*>(this)->find(id);
+}
+
+void VoicePool::release(std::uint32_t slot) {
+    Voice& v   = voices[slot];
+    v.active   = false;
+    v.audible  = false;
+    v.finished = false;
+
+    const auto it = std::find(activeSlots.begin(), activeSlots.end(), slot);
+    if (it != activeSlots.end()) {
+        *it = activeSlots.back();
+        activeSlots.pop_back();
+    }
+    const auto ait = std::find(audibleSlots.begin(), audibleSlots.end(), slot);
+    if (ait != audibleSlots.end()) {
+        *ait = audibleSlots.back();
+        audibleSlots.pop_back();
+    }
+    freeSlots.emplace_back(slot);
+}
+
+void VoicePool::stopVoice(Voice& v, float fadeOut) {
+    if (fadeOut > 0.f && v.fadeGain > 0.f) { v.fadeRate = -v.fadeGain / fadeOut; }
+    else { release(static_cast<std::uint32_t>(&v - voices.data())); }
+}
+
+std::uint32_t VoicePool::steal(int priority) {
+    // prefer finished voices, then the lowest priority, quietest, and oldest voice
+    std::uint32_t victim = NoSlot;
+    for (const std::uint32_t slot : activeSlots) {
+        const Voice& v = voices[slot];
+        if (v.finished) {
+            victim = slot;
+            break;
+        }
+        if (v.settings.priority > priority) { continue; }
+        if (victim == NoSlot) {
+            victim = slot;
+            continue;
+        }
+
+        const Voice& c = voices[victim];
+        if (v.settings.priority != c.settings.priority) {
+            if (v.settings.priority < c.settings.priority) { victim = slot; }
+        }
+        else if (v.audibility != c.audibility) {
+            if (v.audibility < c.audibility) { victim = slot; }
+        }
+        else if (v.startOrder < c.startOrder) { victim = slot; }
+    }
+
+    if (victim != NoSlot) { release(victim); }
+    return victim;
+}
+
+void VoicePool::computeGains(Voice& v) const {
+    const float gain = v.settings.volume * v.fadeGain;
+    if (!v.settings.position.has_value()) {
+        v.gain[0]    = gain;
+        v.gain[1]    = gain;
+        v.audibility = gain;
+        return;
+    }
+
+    // inverse distance attenuation, clamped at the min distance
+    const glm::vec3 offset = v.settings.position.value() - listener.position;
+    const float distance   = glm::length(offset);
+    const float minDist    = v.settings.minDistance;
+    const float attenuated =
+        minDist / (minDist + v.settings.attenuation * (std::max(distance, minDist) - minDist));
+
+    // balance law panning so that centered voices play at full volume in both channels
+    const float pan =
+        distance > MinDistanceEpsilon ?
+            std::clamp(glm::dot(offset / distance, listener.right), -1.f, 1.f) :
+            0.f;
+    v.gain[0]    = gain * attenuated * std::min(1.f, 1.f - pan);
+    v.gain[1]    = gain * attenuated * std::min(1.f, 1.f + pan);
+    v.audibility = std::max(v.gain[0], v.gain[1]);
+}
+
+bool VoicePool::advance(Voice& v, std::size_t frameCount) {
+    const double end = static_cast<double>(v.sound.frameCount);
+    v.cursor += v.step * static_cast<double>(frameCount);
+    if (v.cursor >= end) {
+        if (!v.settings.loop) {
+            v.cursor = end;
+            return false;
+        }
+        v.cursor = std::fmod(v.cursor, end);
+    }
+    return true;
+}
+
+} // namespace audio
+} // namespace bl
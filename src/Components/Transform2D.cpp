@@ -40,13 +40,8 @@ void Transform2D::move(const glm::vec2& delta) {
 }
 
 glm::vec2 Transform2D::getGlobalPosition() const {
-    glm::vec2 result     = position;
-    const Transform2D* t = this;
-    while (t->hasParent()) {
-        t = &t->getParent();
-        result += t->getLocalPosition();
-    }
-    return result;
+    const glm::vec3 global = computeGlobalPosition();
+    return {global.x, global.y};
 }
 
 void Transform2D::setDepth(float d) {
@@ -61,10 +56,7 @@ void Transform2D::addDepth(float delta) {
 
 float Transform2D::getDepth() const { return depth; }
 
-float Transform2D::getGlobalDepth() const {
-    if (hasParent()) { return getParent().getGlobalDepth() + depth; }
-    return depth;
-}
+float Transform2D::getGlobalDepth() const { return computeGlobalPosition().z; }
 
 void Transform2D::setScale(const glm::vec2& factors) {
     scaleFactors = factors;
@@ -122,24 +114,49 @@ const glm::mat4& Transform2D::getGlobalTransform() {
 }
 
 void Transform2D::makeDirty() {
-    if (markDirty()) { incrementVersion(); }
+    // bump the version once per refresh, even if not linked, so cached globals stay correct
+    if (markDirty() || !localRefreshRequired()) { incrementVersion(); }
 }
 
 void Transform2D::ensureUpdated() {
     if (ParentAwareVersioned::refreshRequired()) {
-        incrementVersion(); // for children to pick up change
-        DescriptorComponentBase::markDirty();
-        markRefreshed();
-
-        if (hasParent()) {
-            // TODO - only parent position? how to anchor in case of scaled/rotated parent?
-            //      - use parentTform*pos to compute anchor point?
-            cachedGlobalTransform = computeGlobalTransform();
-        }
-        else { cachedGlobalTransform = getLocalTransform(); }
+        if (hasParent()) { getParent().ensureUpdated(); }
+        refreshGlobalTransform();
     }
 }
 
+bool Transform2D::propagateGlobalTransform() {
+    if (!ParentAwareVersioned::localRefreshRequired()) { return false; }
+    refreshGlobalTransform();
+    return true;
+}
+
+void Transform2D::refreshGlobalTransform() {
+    incrementVersion(); // for children to pick up change
+    DescriptorComponentBase::markDirty();
+    markRefreshed();
+
+    // TODO - only parent position? how to anchor in case of scaled/rotated parent?
+    //      - use parentTform*pos to compute anchor point?
+    const glm::vec3 local(position, depth);
+    cachedGlobalPosition = hasParent() ? getParent().cachedGlobalPosition + local : local;
+    cachedGlobalTransform =
+        createTransformMatrix(origin, cachedGlobalPosition, scaleFactors, rotation);
+}
+
+glm::vec3 Transform2D::computeGlobalPosition() const {
+    // const getters may run concurrently, so a stale cache is bypassed rather than refreshed
+    if (!refreshRequired()) { return cachedGlobalPosition; }
+
+    glm::vec3 result(position, depth);
+    const Transform2D* t = this;
+    while (t->hasParent()) {
+        t = &t->getParent();
+        result += glm::vec3(t->position, t->depth);
+    }
+    return result;
+}
+
 glm::vec3 Transform2D::transformPoint(const glm::vec3& src) const {
     glm::mat4 localMat(1.f);
     const glm::mat4* mat = &localMat;
@@ -151,8 +168,8 @@ glm::vec3 Transform2D::transformPoint(const glm::vec3& src) const {
 }
 
 glm::mat4 Transform2D::computeGlobalTransform() const {
-    return createTransformMatrix(
-        origin, glm::vec3(getGlobalPosition(), getGlobalDepth()), scaleFactors, rotation);
+    if (!refreshRequired()) { return cachedGlobalTransform; }
+    return createTransformMatrix(origin, computeGlobalPosition(), scaleFactors, rotation);
 }
 
 void Transform2D::clampAngle() {
@@ -70,12 +70,36 @@ glm::vec3 Transform3D::getRightDir() const { return rotation * glm::vec3(1.f, 0.
 glm::vec3 Transform3D::getUpDir() const { return rotation * glm::vec3(0.f, 1.f, 0.f); }
 
 void Transform3D::refreshDescriptor(rc::dsi::Transform3DPayload& dest) {
-    dest = getGlobalTransform();
-    markRefreshed();
+    ensureUpdated();
+    dest = cachedGlobalTransform;
 }
 
 void Transform3D::makeDirty() {
-    if (markDirty()) { incrementVersion(); }
+    // bump the version once per refresh, even if not linked, so cached globals stay correct
+    if (markDirty() || !localRefreshRequired()) { incrementVersion(); }
+}
+
+void Transform3D::ensureUpdated() {
+    if (ParentAwareVersioned::refreshRequired()) {
+        if (hasParent()) { getParent().ensureUpdated(); }
+        refreshGlobalTransform();
+    }
+}
+
+bool Transform3D::propagateGlobalTransform() {
+    if (!ParentAwareVersioned::localRefreshRequired()) { return false; }
+    refreshGlobalTransform();
+    return true;
+}
+
+void Transform3D::refreshGlobalTransform() {
+    incrementVersion(); // for children to pick up change
+    DescriptorComponentBase::markDirty();
+    markRefreshed();
+
+    cachedGlobalTransform = hasParent() ?
+                                getParent().cachedGlobalTransform * getLocalTransform() :
+                                getLocalTransform();
 }
 
 glm::mat4 Transform3D::getLocalTransform() const {
@@ -83,6 +107,7 @@ glm::mat4 Transform3D::getLocalTransform() const {
 }
 
 glm::mat4 Transform3D::getGlobalTransform() const {
+    if (!refreshRequired()) { return cachedGlobalTransform; }
     if (hasParent()) { return getParent().getGlobalTransform() * getLocalTransform(); }
     return getLocalTransform();
 }
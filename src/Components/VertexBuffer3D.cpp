@@ -18,6 +18,7 @@ void VertexBuffer3D::resize(unsigned int vc, bool copy) {
 
 void VertexBuffer3D::commit() {
     drawParams = buffer.getDrawParameters();
+    notifyDrawParametersChanged();
     buffer.queueTransfer();
 }
 
@@ -49,6 +49,42 @@ Entity Registry::createEntity(unsigned int worldIndex, Flags flags,
     return ent;
 }
 
+void Registry::allocateEntitiesLocked(unsigned int worldIndex, Flags flags, std::size_t count,
+                                      std::vector<Entity>& entities) {
+    allocatedIds.clear();
+    entityAllocator.allocate(count, allocatedIds);
+    const std::size_t required = entityAllocator.endId();
+    if (required > entityMasks.size()) {
+        entityMasks.resize(required, ComponentMask::EmptyMask);
+        entityVersions.resize(required, 1);
+        parentDestructionBehaviors.resize(required,
+                                          ParentDestructionBehavior::DestroyedWithParent);
+        entityFlags.resize(required, Flags::None);
+        entityWorlds.resize(required, 0);
+    }
+
+    entities.reserve(entities.size() + count);
+    for (const std::uint32_t index : allocatedIds) {
+        entityMasks[index]                = ComponentMask::EmptyMask;
+        parentDestructionBehaviors[index] = ParentDestructionBehavior::DestroyedWithParent;
+        entityFlags[index]                = flags;
+        entityWorlds[index]               = worldIndex;
+
+        const Entity ent(index, entityVersions[index], flags, worldIndex);
+        entities.emplace_back(ent);
+        emitter.emit<event::EntityCreated>({ent});
+    }
+}
+
+void Registry::finishBulkAdd(std::span<const Entity> entities, ComponentMask::SimpleMask mask) {
+    if (mask == ComponentMask::EmptyMask) { return; }
+
+    for (const Entity ent : entities) { entityMasks[ent.getIndex()] = mask; }
+    for (auto& view : views) {
+        if (view->mask.passes(mask)) { view->tryAddEntities(entities); }
+    }
+}
+
 bool Registry::entityExists(Entity ent) const {
     return entityExists(ent, Transaction<tx::EntityRead>(const_cast<Registry&>(*this)));
 }
@@ -78,6 +114,28 @@ bool Registry::destroyEntity(Entity start, const Transaction<tx::EntityRead>& tx
     else { return queueEntityDestroy(start); }
 }
 
+unsigned int Registry::destroyEntities(std::span<const Entity> entities) {
+    return destroyEntities(entities, Transaction<tx::EntityRead>(*this));
+}
+
+unsigned int Registry::destroyEntities(std::span<const Entity> entities,
+                                       const Transaction<tx::EntityRead>& tx) {
+    std::unique_lock deleteLock(deletionState.mutex);
+
+    // if we are already traversing then just add to queue
+    const bool traversing  = !deletionState.toVisit.empty();
+    unsigned int destroyed = 0;
+    for (const Entity ent : entities) {
+        if (!entityExists(ent, tx)) { continue; }
+        if (traversing) {
+            deletionState.toVisit.emplace_back(ent);
+            ++destroyed;
+        }
+        else if (queueEntityDestroy(ent)) { ++destroyed; }
+    }
+    return destroyed;
+}
+
 bool Registry::queueEntityDestroy(Entity start) {
     // check if we can remove due to dependencies
     if (dependencyGraph.hasDependencies(start)) {
@@ -149,35 +207,6 @@ bool Registry::queueEntityDestroy(Entity start) {
     return true;
 }
 
-void Registry::doEntityDestroyLocked(Entity ent) {
-    removeEntityParentLocked(ent, true);
-
-    const std::uint32_t index            = ent.getIndex();
-    const ComponentMask::SimpleMask mask = entityMasks[index];
-
-    // reset metadata
-    entityAllocator.release(index);
-    entityMasks[index]  = ComponentMask::EmptyMask;
-    entityFlags[index]  = Flags::None;
-    entityWorlds[index] = 0;
-
-    // remove from views
-    for (auto& view : views) {
-        if (view->mask.passes(mask)) { view->removeEntity(ent); }
-    }
-
-    // destroy components
-    for (ComponentPoolBase* pool : componentPools) {
-        if (ComponentMask::has(mask, pool->ComponentIndex)) { pool->remove(ent, false); }
-    }
-
-    // remove parenting info
-    parentGraph.removeEntity(ent);
-
-    // remove dependency info
-    if (index < markedForRemoval.size()) { markedForRemoval[index] = false; }
-}
-
 void Registry::flushDeletions() {
     std::unique_lock lock(entityLock);
     std::unique_lock queueLock(deletionState.mutex);
@@ -186,8 +215,48 @@ void Registry::flushDeletions() {
     for (auto& pool : componentPools) { pool->flushRemovals(); }
 
     // destroy queued entities
-    for (const Entity& ent : deletionState.toRemove) { doEntityDestroyLocked(ent); }
-    deletionState.toRemove.clear();
+    std::vector<Entity>& toRemove = deletionState.toRemove;
+    if (toRemove.empty()) { return; }
+
+    // parents are detached while every entity being destroyed is still valid
+    for (const Entity ent : toRemove) { removeEntityParentLocked(ent, true); }
+
+    // remove from views and pools in bulk so that each is only locked once
+    std::vector<Entity>& batch = deletionState.batch;
+    const auto collect         = [this, &toRemove, &batch](const auto& filter) {
+        batch.clear();
+        for (const Entity ent : toRemove) {
+            if (filter(entityMasks[ent.getIndex()])) { batch.emplace_back(ent); }
+        }
+        return !batch.empty();
+    };
+    for (auto& view : views) {
+        const auto inView = [&view](ComponentMask::SimpleMask mask) {
+            return view->mask.passes(mask);
+        };
+        if (collect(inView)) { view->removeEntities(batch); }
+    }
+    for (ComponentPoolBase* pool : componentPools) {
+        const auto inPool = [pool](ComponentMask::SimpleMask mask) {
+            return ComponentMask::has(mask, pool->ComponentIndex);
+        };
+        if (collect(inPool)) { pool->removeMany(batch); }
+    }
+
+    // reset metadata and release ids
+    std::vector<std::uint32_t>& ids = deletionState.ids;
+    ids.clear();
+    for (const Entity ent : toRemove) {
+        const std::uint32_t index = ent.getIndex();
+        ids.emplace_back(index);
+        entityMasks[index]  = ComponentMask::EmptyMask;
+        entityFlags[index]  = Flags::None;
+        entityWorlds[index] = 0;
+        parentGraph.removeEntity(ent);
+        if (index < markedForRemoval.size()) { markedForRemoval[index] = false; }
+    }
+    entityAllocator.release(ids);
+    toRemove.clear();
 }
 
 unsigned int Registry::destroyAllEntitiesWithFlags(Flags flags) {
@@ -6,6 +6,7 @@
 #include <BLIB/Signals/Table.hpp>
 #include <BLIB/Systems.hpp>
 #include <BLIB/Systems/MarkedForDeath.hpp>
+#include <BLIB/Util/Profiler.hpp>
 #include <BLIB/Util/Visitor.hpp>
 #include <SFML/Window.hpp>
 #include <cmath>
@@ -54,6 +55,13 @@ Engine::Engine(const Settings& settings)
     systems().registerSystem<pcl::ParticleSystem>(FrameStage::Update0, StateMask::All);
     systems().registerSystem<sys::MarkedForDeath>(FrameStage::Update0, StateMask::All);
     systems().registerSystem<sys::Physics2D>(FrameStage::Physics, StateMask::Running);
+
+    // systems that only touch their components may overlap other stages. The rest either block
+    // on the thread pool or touch the whole registry and keep the stage barrier
+    systems().declareAccess<sys::TogglerSystem, ecs::tx::ComponentWrite<com::Toggler>>();
+    systems().declareAccess<sys::VelocitySystem,
+                            ecs::tx::ComponentRead<com::Velocity2D>,
+                            ecs::tx::ComponentWrite<com::Transform2D>>();
     audio::AudioSystem::registerSystem(*this);
 
     eventEmitter.connect(signalChannel);
@@ -246,6 +254,7 @@ bool Engine::loop() {
             }
         }
 
+        BL_PROFILE_FRAME();
         ecsSystems.notifyFrameStart();
 
         // Update and render
@@ -258,6 +267,8 @@ bool Engine::loop() {
 
         // update until caught up
         while (lag >= updateTimestep) {
+            BL_PROFILE_SCOPE("Engine::tick");
+
             // track tick time
             totalDt += updateTimestep;
             lag -= updateTimestep;
@@ -0,0 +1,56 @@
+#include <BLIB/Engine/SystemAccess.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace bl
+{
+namespace engine
+{
+namespace
+{
+using List = std::vector<std::type_index>;
+
+bool intersects(const List& left, const List& right) {
+    auto l = left.begin();
+    auto r = right.begin();
+    while (l != left.end() && r != right.end()) {
+        if (*l < *r) { ++l; }
+        else if (*r < *l) { ++r; }
+        else { return true; }
+    }
+    return false;
+}
+
+void sortUnique(List& list) {
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+}
+} // namespace
+
+SystemAccess::SystemAccess()
+: declared(false) {}
+
+void SystemAccess::finalize() {
+    sortUnique(writes);
+    sortUnique(reads);
+
+    // written components are implicitly read
+    List readOnly;
+    readOnly.reserve(reads.size());
+    std::set_difference(reads.begin(),
+                        reads.end(),
+                        writes.begin(),
+                        writes.end(),
+                        std::back_inserter(readOnly));
+    reads.swap(readOnly);
+}
+
+bool SystemAccess::conflictsWith(const SystemAccess& other) const {
+    if (!declared || !other.declared) { return true; }
+    return intersects(writes, other.writes) || intersects(writes, other.reads) ||
+           intersects(reads, other.writes);
+}
+
+} // namespace engine
+} // namespace bl
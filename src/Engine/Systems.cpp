@@ -1,6 +1,9 @@
 #include <BLIB/Engine/Systems.hpp>
 
 #include <BLIB/Engine/Engine.hpp>
+#include <BLIB/Util/Profiler.hpp>
+#include <algorithm>
+#include <limits>
 
 namespace bl
 {
@@ -8,8 +11,12 @@ namespace engine
 {
 namespace
 {
-constexpr std::size_t MaxTaskCapacity = 64;
-}
+constexpr std::size_t MaxTaskCapacity    = 64;
+constexpr std::size_t MaxCachedSchedules = 16;
+constexpr std::uint32_t NoNode           = std::numeric_limits<std::uint32_t>::max();
+
+const SystemAccess Undeclared;
+} // namespace
 
 Systems::StageSet::StageSet()
 : version(0) {
@@ -18,7 +25,9 @@ Systems::StageSet::StageSet()
 
 Systems::Systems(Engine& e)
 : engine(e)
-, inited(false) {}
+, inited(false)
+, schedule(nullptr)
+, remainingCapacity(0) {}
 
 void Systems::init() {
     inited = true;
@@ -33,32 +42,221 @@ void Systems::notifyFrameStart() {
     }
 }
 
+void Systems::setAccess(System* system, SystemAccess&& access) {
+    for (auto& set : systems) {
+        for (auto& instance : set.systems) {
+            if (instance.system.get() == system) {
+                instance.access = std::forward<SystemAccess>(access);
+                invalidateSchedules();
+                return;
+            }
+        }
+    }
+}
+
+void Systems::invalidateSchedules() {
+    schedules.clear();
+    schedule = nullptr;
+}
+
+Systems::Schedule& Systems::getSchedule(FrameStage::V startStage, FrameStage::V endStage,
+                                        StateMask::V stateMask) {
+    // frame tasks add a stage barrier so which stages have them is part of the key
+    std::uint32_t taskStages = 0;
+    for (std::uint32_t stage = startStage; stage < endStage; ++stage) {
+        if (!systems[stage].tasks.empty()) { taskStages |= 0x1 << stage; }
+    }
+
+    for (Schedule& cached : schedules) {
+        if (cached.startStage == startStage && cached.endStage == endStage &&
+            cached.stateMask == stateMask && cached.taskStages == taskStages) {
+            return cached;
+        }
+    }
+
+    if (schedules.size() >= MaxCachedSchedules) { schedules.clear(); }
+    Schedule& created  = schedules.emplace_back();
+    created.startStage = startStage;
+    created.endStage   = endStage;
+    created.stateMask  = stateMask;
+    created.taskStages = taskStages;
+    buildSchedule(created);
+    return created;
+}
+
+void Systems::buildSchedule(Schedule& result) {
+    std::vector<ScheduleNode>& nodes = result.nodes;
+    const auto addNode = [this, &nodes](std::uint32_t stage, SystemInstance* system) {
+        ScheduleNode& node   = nodes.emplace_back();
+        node.stage           = stage;
+        node.set             = &systems[stage];
+        node.system          = system;
+        node.dependencyCount = 0;
+        node.onCaller        = false;
+    };
+
+    for (std::uint32_t stage = result.startStage; stage < result.endStage; ++stage) {
+        StageSet& set = systems[stage];
+        if ((result.taskStages & (0x1 << stage)) != 0) { addNode(stage, nullptr); }
+        const std::size_t stageBegin = nodes.size();
+        for (auto& system : set.systems) {
+            if ((system.mask & result.stateMask) != 0) { addNode(stage, &system); }
+        }
+
+        // undeclared systems alone in their stage run on the calling thread so that they may
+        // block on work queued to the thread pool without starving it
+        if (nodes.size() - stageBegin == 1) {
+            ScheduleNode& node = nodes[stageBegin];
+            node.onCaller      = !node.system->access.isDeclared();
+        }
+    }
+
+    // nodes are in stage order so edges always point forward
+    const std::uint32_t nodeCount = nodes.size();
+    for (std::uint32_t j = 1; j < nodeCount; ++j) {
+        ScheduleNode& later          = nodes[j];
+        const SystemAccess& laterAcc = later.system ? later.system->access : Undeclared;
+        for (std::uint32_t i = 0; i < j; ++i) {
+            ScheduleNode& earlier          = nodes[i];
+            const SystemAccess& earlierAcc = earlier.system ? earlier.system->access : Undeclared;
+
+            // undeclared systems keep the stage barrier but run freely within their stage
+            const bool ordered = earlierAcc.isDeclared() && laterAcc.isDeclared() ?
+                                     earlierAcc.conflictsWith(laterAcc) :
+                                     earlier.stage != later.stage;
+            if (ordered) {
+                earlier.dependents.emplace_back(j);
+                ++later.dependencyCount;
+            }
+        }
+    }
+}
+
 void Systems::update(FrameStage::V startStage, FrameStage::V endStage, StateMask::V stateMask,
                      float dt, float realDt, float lag, float realLag) {
-    const auto beg = systems.begin() + startStage;
-    const auto end = systems.begin() + endStage;
-    auto& tp       = engine.engineLoopThreadpool();
+    BL_PROFILE_SCOPE("Systems::update");
+    schedule                         = &getSchedule(startStage, endStage, stateMask);
+    std::vector<ScheduleNode>& nodes = schedule->nodes;
+    const std::uint32_t nodeCount    = nodes.size();
+    if (nodeCount == 0) { return; }
+
+    times    = {dt, realDt, lag, realLag};
+    auto& tp = engine.engineLoopThreadpool();
+    if (nodeCount == 1 || !tp.running()) {
+        for (std::uint32_t i = 0; i < nodeCount; ++i) { runNode(i); }
+        return;
+    }
 
-    for (auto it = beg; it != end; ++it) {
-        if (!it->tasks.empty()) {
-            tp.queueTask([it]() { it->drainTasks(); });
+    if (remainingCapacity < nodeCount) {
+        remaining         = std::make_unique<std::atomic_uint32_t[]>(nodeCount);
+        remainingCapacity = nodeCount;
+    }
+    for (std::uint32_t i = 0; i < nodeCount; ++i) {
+        remaining[i].store(nodes[i].dependencyCount);
+    }
+
+    for (std::uint32_t i = 0; i < nodeCount; ++i) {
+        if (nodes[i].dependencyCount == 0 && !nodes[i].onCaller) {
+            tp.queueTask([this, i]() { dispatch(i); });
         }
-        if (it->systems.size() > 1) {
-            for (auto& system : it->systems) {
-                if ((system.mask & stateMask) != 0) {
-                    tp.queueTask([&system, it, dt, realDt, lag, realLag]() {
-                        system.system->update(it->mutex, dt, realDt, lag, realLag);
-                    });
-                }
-            }
+    }
+
+    // caller thread nodes are ordered by the stage barrier so they become ready in order
+    for (std::uint32_t i = 0; i < nodeCount; ++i) {
+        if (!nodes[i].onCaller) { continue; }
+        if (remaining[i].load() != 0) {
+            std::unique_lock lock(callerMutex);
+            callerCv.wait(lock, [this, i]() { return remaining[i].load() == 0; });
         }
-        else if (!it->systems.empty()) {
-            auto& system = it->systems.front();
-            if ((system.mask & stateMask) != 0) {
-                system.system->update(it->mutex, dt, realDt, lag, realLag);
-            }
+        runNode(i);
+        releaseDependents(i, false);
+    }
+    tp.drain();
+}
+
+void Systems::dispatch(std::uint32_t node) {
+    while (node != NoNode) {
+        runNode(node);
+        node = releaseDependents(node, true);
+    }
+}
+
+std::uint32_t Systems::releaseDependents(std::uint32_t node, bool continueOnThread) {
+    auto& tp = engine.engineLoopThreadpool();
+
+    // optionally continue with the first pool dependent that became ready and queue the others
+    std::uint32_t next = NoNode;
+    for (const std::uint32_t dep : schedule->nodes[node].dependents) {
+        if (remaining[dep].fetch_sub(1) != 1) { continue; }
+        if (schedule->nodes[dep].onCaller) {
+            std::unique_lock lock(callerMutex);
+            callerCv.notify_one();
+        }
+        else if (continueOnThread && next == NoNode) { next = dep; }
+        else {
+            tp.queueTask([this, dep]() { dispatch(dep); });
+        }
+    }
+    return next;
+}
+
+void Systems::runNode(std::uint32_t i) {
+    ScheduleNode& node = schedule->nodes[i];
+    if (!node.system) {
+        BL_PROFILE_SCOPE("Systems::frameTasks");
+        node.set->drainTasks();
+        return;
+    }
+
+    SystemInstance& system = *node.system;
+    BL_PROFILE_SCOPE(system.name);
+    const auto start = std::chrono::steady_clock::now();
+    system.system->update(node.set->mutex, times.dt, times.realDt, times.lag, times.realLag);
+    system.lastUpdate = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    system.totalUpdate += system.lastUpdate;
+    ++system.updateCount;
+}
+
+void Systems::getTimingReport(std::vector<SystemTiming>& report) const {
+    report.clear();
+    for (std::uint32_t stage = 0; stage < systems.size(); ++stage) {
+        for (const auto& system : systems[stage].systems) {
+            report.emplace_back(SystemTiming{system.name,
+                                             static_cast<FrameStage::V>(stage),
+                                             system.lastUpdate,
+                                             system.totalUpdate,
+                                             system.updateCount});
+        }
+    }
+}
+
+void Systems::logTimingReport() const {
+    std::vector<SystemTiming> report;
+    getTimingReport(report);
+    std::sort(report.begin(), report.end(), [](const SystemTiming& l, const SystemTiming& r) {
+        return l.totalUpdate > r.totalUpdate;
+    });
+
+    BL_LOG_INFO << "System timings:";
+    for (const SystemTiming& timing : report) {
+        const double avg = timing.updateCount > 0 ?
+                               static_cast<double>(timing.totalUpdate.count()) /
+                                   static_cast<double>(timing.updateCount) / 1000.0 :
+                               0.0;
+        BL_LOG_INFO << "  " << timing.name << " (stage " << timing.stage
+                    << "): " << timing.updateCount << " updates, avg " << avg << "us, last "
+                    << timing.lastUpdate.count() / 1000 << "us";
+    }
+}
+
+void Systems::resetTimings() {
+    for (auto& set : systems) {
+        for (auto& system : set.systems) {
+            system.lastUpdate  = std::chrono::nanoseconds(0);
+            system.totalUpdate = std::chrono::nanoseconds(0);
+            system.updateCount = 0;
         }
-        tp.drain();
     }
 }
 
@@ -74,6 +272,7 @@ void Systems::earlyCleanup() {
 }
 
 void Systems::cleanup() {
+    invalidateSchedules();
     for (auto& set : systems) { set.systems.clear(); }
 }
 
@@ -47,7 +47,8 @@ bool ModelSkeletal::create(engine::World& world, as::TypedRef<asi::ModelPayload>
                 *skeleton,
                 model,
                 model->getRoot(),
-                entity());
+                entity(),
+                0);
     tx.unlock();
 
     // validate that all bones populated
@@ -71,7 +72,7 @@ void ModelSkeletal::processNode(engine::World& world, Tx& tx,
                                 std::uint32_t skinnedMaterialPipelineId,
                                 std::uint32_t nonSkinnedMaterialPipelineId, com::Skeleton& skeleton,
                                 const as::TypedRef<asi::ModelPayload>& model, const mdl::Node& node,
-                                ecs::Entity parentEntity) {
+                                ecs::Entity parentEntity, std::uint32_t depth) {
     ecs::Entity nodeEntity = world.createEntity(tx);
     world.engine().ecs().setEntityParent(nodeEntity, parentEntity, tx);
 
@@ -89,6 +90,7 @@ void ModelSkeletal::processNode(engine::World& world, Tx& tx,
         bone->boneOffset        = model->getBones().getBone(bone->boneIndex).transform;
         skeleton.bones[bone->boneIndex].transform = transform;
         skeleton.bones[bone->boneIndex].bone      = bone;
+        skeleton.bones[bone->boneIndex].depth     = depth;
     }
 
     // create entities per mesh
@@ -173,7 +175,8 @@ void ModelSkeletal::processNode(engine::World& world, Tx& tx,
                     skeleton,
                     model,
                     childNode,
-                    nodeEntity);
+                    nodeEntity,
+                    depth + 1);
     }
 }
 
@@ -27,6 +27,7 @@ bool ModelStatic::create(engine::World& world, as::TypedRef<asi::ModelPayload> m
     Outline3D::init(world.engine().ecs(), entity(), &component());
 
     drawableEntities.reserve(model->getMeshes().getMeshCount());
+    sharedMeshes = getSharedMeshes(model);
 
     Tx tx(world.engine().ecs());
     processNode(world, tx, entity(), mpid, model, model->getRoot());
@@ -43,7 +44,7 @@ com::BasicMesh* ModelStatic::createComponents(engine::World& world, Tx& tx, ecs:
     transform->setTransform(tfrm);
 
     auto* mesh = world.engine().ecs().emplaceComponentWithTx<com::BasicMesh>(entity, tx);
-    mesh->create(world.engine().renderer(), src);
+    mesh->createShared(getSharedMesh(world.engine().renderer(), src));
 
     auto mat = world.engine().renderer().materialPool().getOrCreateFromAsset(
         model->getMaterialRef(src.getMaterialIndex()));
@@ -94,6 +95,35 @@ void ModelStatic::processNode(engine::World& world, Tx& tx, ecs::Entity parent,
     }
 }
 
+std::shared_ptr<ModelStatic::SharedMeshes> ModelStatic::getSharedMeshes(
+    const as::TypedRef<asi::ModelPayload>& model) {
+    static std::mutex mutex;
+    static std::unordered_map<const asi::ModelPayload*, std::weak_ptr<SharedMeshes>> cache;
+
+    std::unique_lock lock(mutex);
+    std::erase_if(cache, [](const auto& entry) { return entry.second.expired(); });
+    auto& weak  = cache[&*model];
+    auto meshes = weak.lock();
+    if (!meshes) {
+        meshes        = std::make_shared<SharedMeshes>();
+        meshes->model = model;
+        weak          = meshes;
+    }
+    return meshes;
+}
+
+std::shared_ptr<const com::BasicMesh> ModelStatic::getSharedMesh(rc::Renderer& renderer,
+                                                                 const mdl::Mesh& src) {
+    std::unique_lock lock(sharedMeshes->mutex);
+    auto& mesh = sharedMeshes->meshes[&src];
+    if (!mesh) {
+        auto created = std::make_shared<com::BasicMesh>();
+        created->create(renderer, src);
+        mesh = std::move(created);
+    }
+    return mesh;
+}
+
 void ModelStatic::onAdd(rc::Scene* scene, rc::UpdateSpeed updateFreq) {
     for (auto& child : drawableEntities) {
         child.mesh->addToScene(*ecs, child.entity, scene, updateFreq);
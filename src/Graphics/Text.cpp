@@ -11,7 +11,10 @@ Text::Text()
 : font()
 , wrapType(WrapType::None)
 , wordWrapWidth(-1.f)
-, boundsComputedWhileDirty(false) {
+, wrappedWidth(-1.f)
+, boundsComputedWhileDirty(false)
+, cachedGlobalTransform(1.f)
+, cachedInverseTransform(1.f) {
     sections.reserve(4);
 }
 
@@ -26,6 +29,7 @@ void Text::create(engine::World& world, as::TypedRef<asi::FontPayload> f, const
     queueCommit();
 
     Drawable::create(world);
+    syncPipeline();
     Textured::create(
         world.engine().renderer(), &material(), font->syncTexture(world.engine().renderer()));
     OverlayScalable::create(world.engine(), entity());
@@ -53,6 +57,8 @@ txt::BasicText& Text::addSection(const sf::String& content, unsigned int fontSiz
 
 void Text::setFont(as::TypedRef<asi::FontPayload> f) {
     font = f;
+    for (auto& section : sections) { section.layoutDirty = true; }
+    if (exists()) { syncPipeline(); }
     queueCommit();
 }
 
@@ -72,7 +78,7 @@ void Text::computeBoundsIfNeeded() const {
         glm::vec2 cornerPos(0.f, 0.f);
         for (const auto& section : sections) {
             txt::BasicText& sec = const_cast<txt::BasicText&>(section);
-            sec.refreshVertices(font, nullptr, cornerPos);
+            sec.refreshVertices(font, cornerPos);
         }
     }
 }
@@ -84,10 +90,10 @@ void Text::commit() {
     // word wrap
     computeWordWrap();
 
-    // count required vertex amount
+    // lay out sections. Unchanged sections that did not move keep their cached vertices
     std::uint32_t vertexCount = 0;
-    glm::vec2 trash;
-    for (auto& section : sections) { vertexCount += section.refreshVertices(font, nullptr, trash); }
+    glm::vec2 cornerPos(0.f, 0.f);
+    for (auto& section : sections) { vertexCount += section.refreshVertices(font, cornerPos); }
 
     // create larger buffer if required
     if (component().vertices.vertexCount() < vertexCount) {
@@ -96,9 +102,8 @@ void Text::commit() {
 
     // assign vertices
     std::uint32_t vi = 0;
-    glm::vec2 cornerPos(0.f, 0.f);
     for (auto& section : sections) {
-        vi += section.refreshVertices(font, &component().vertices.vertices()[vi], cornerPos);
+        vi += section.writeVertices(&component().vertices.vertices()[vi]);
     }
 
     // upload vertices
@@ -119,7 +124,7 @@ void Text::commit() {
 
 glm::vec2 Text::findCharacterPosition(unsigned int section, unsigned int index) const {
     computeBoundsIfNeeded();
-    return sections[section].findCharacterPos(font, index);
+    return sections[section].findCharacterPos(index);
 }
 
 void Text::wordWrap(float w) {
@@ -140,12 +145,8 @@ void Text::stopWordWrap() {
     queueCommit();
 }
 
-void Text::computeWordWrap() {
-    for (auto& section : sections) {
-        section.wordWrappedContent = section.content;
-        section.cachedLineHeight   = section.computeLineSpacing(font);
-    }
-    if (wrapType == WrapType::None || wordWrapWidth <= 0.f) { return; }
+float Text::computeWrapWidth() {
+    if (wrapType == WrapType::None || wordWrapWidth <= 0.f) { return -1.f; }
 
     float pw = 1.f;
     if (wrapType == WrapType::Relative && getTransform().hasParent()) {
@@ -158,58 +159,102 @@ void Text::computeWordWrap() {
                  cset.get<com::Transform2D>()->getScale().x;
         }
     }
-    const float maxWidth = wordWrapWidth * pw / getTransform().getScale().x;
-    const Iter EndIter   = Iter::end(sections);
-
-    glm::vec2 nextPos(0.f, 0.f);
-    float maxLineHeight = 0.f;
-    Iter prevSpace      = EndIter;
-    glm::vec2 wordStartPos(0.f, 0.f);
-    bool lineOnNextSpace   = false;
-    std::uint32_t prevChar = 0;
-
-    const auto resetLine = [this, &maxLineHeight, &prevSpace, &lineOnNextSpace, EndIter](Iter it) {
-        prevSpace                     = EndIter;
-        lineOnNextSpace               = false;
-        it.getText().cachedLineHeight = it.getText().computeLineSpacing(font);
-        maxLineHeight                 = it.getText().cachedLineHeight;
-    };
-
-    for (Iter it = Iter::begin(sections); it != EndIter; ++it) {
-        maxLineHeight = std::max(it.getText().computeLineSpacing(font), maxLineHeight);
-        it.getText().cachedLineHeight = maxLineHeight;
-        glm::vec2 advance = it.getText().advanceCharacterPos(font, nextPos, it.getChar(), prevChar);
-        prevChar          = it.getChar();
-
-        if (it.getChar() == ' ') {
-            if (lineOnNextSpace) {
-                it.makeNewline();
-                resetLine(it);
-                wordStartPos = glm::vec2{0.f, advance.y + maxLineHeight};
+    return wordWrapWidth * pw / getTransform().getScale().x;
+}
+
+void Text::computeWordWrap() {
+    const float maxWidth    = computeWrapWidth();
+    const bool widthChanged = maxWidth != wrappedWidth;
+    wrappedWidth            = maxWidth;
+
+    bool contentChanged = false;
+    for (const auto& section : sections) { contentChanged = contentChanged || section.layoutDirty; }
+    if (!widthChanged && !contentChanged) { return; }
+
+    // keep the previous line breaks so that sections which wrap the same keep their layout
+    prevWrap.resize(sections.size());
+    for (unsigned int i = 0; i < sections.size(); ++i) {
+        txt::BasicText& section = sections[i];
+        std::swap(prevWrap[i].first, section.wordWrappedContent);
+        prevWrap[i].second         = section.cachedLineHeight;
+        section.wordWrappedContent = section.content;
+        section.cachedLineHeight   = section.computeLineSpacing(font);
+    }
+
+    if (maxWidth > 0.f) {
+        const Iter EndIter = Iter::end(sections);
+
+        glm::vec2 nextPos(0.f, 0.f);
+        float maxLineHeight = 0.f;
+        Iter prevSpace      = EndIter;
+        glm::vec2 wordStartPos(0.f, 0.f);
+        bool lineOnNextSpace   = false;
+        std::uint32_t prevChar = 0;
+
+        // metrics only change between sections, not per character
+        const txt::BasicText* metricsSection = nullptr;
+        txt::BasicText::Metrics metrics{};
+        float lineSpacing = 0.f;
+
+        const auto resetLine =
+            [&maxLineHeight, &prevSpace, &lineOnNextSpace, &lineSpacing, EndIter](Iter it) {
+            prevSpace                     = EndIter;
+            lineOnNextSpace               = false;
+            it.getText().cachedLineHeight = lineSpacing;
+            maxLineHeight                 = lineSpacing;
+        };
+
+        for (Iter it = Iter::begin(sections); it != EndIter; ++it) {
+            if (metricsSection != &it.getText()) {
+                metricsSection = &it.getText();
+                metrics        = metricsSection->computeMetrics(font);
+                lineSpacing    = metricsSection->computeLineSpacing(font);
             }
-            else {
-                prevSpace    = it;
+
+            maxLineHeight                 = std::max(lineSpacing, maxLineHeight);
+            it.getText().cachedLineHeight = maxLineHeight;
+            glm::vec2 advance =
+                it.getText().advanceCharacterPos(metrics, nextPos, it.getChar(), prevChar);
+            prevChar = it.getChar();
+
+            if (it.getChar() == ' ') {
+                if (lineOnNextSpace) {
+                    it.makeNewline();
+                    resetLine(it);
+                    wordStartPos = glm::vec2{0.f, advance.y + maxLineHeight};
+                }
+                else {
+                    prevSpace    = it;
+                    wordStartPos = advance;
+                }
+            }
+            else if (it.getChar() == '\n') {
+                resetLine(it);
                 wordStartPos = advance;
             }
-        }
-        else if (it.getChar() == '\n') {
-            resetLine(it);
-            wordStartPos = advance;
-        }
-        else {
-            if (nextPos.x > maxWidth) { // nextPos == prevPos here
-                if (prevSpace != EndIter) {
-                    prevSpace.makeNewline();
-                    resetLine(it);
-                    const float wordWidth = advance.x - wordStartPos.x;
-                    advance               = glm::vec2{wordWidth, advance.y + maxLineHeight};
-                    wordStartPos          = advance;
+            else {
+                if (nextPos.x > maxWidth) { // nextPos == prevPos here
+                    if (prevSpace != EndIter) {
+                        prevSpace.makeNewline();
+                        resetLine(it);
+                        const float wordWidth = advance.x - wordStartPos.x;
+                        advance               = glm::vec2{wordWidth, advance.y + maxLineHeight};
+                        wordStartPos          = advance;
+                    }
+                    else { lineOnNextSpace = true; }
                 }
-                else { lineOnNextSpace = true; }
             }
+
+            nextPos = advance;
         }
+    }
 
-        nextPos = advance;
+    for (unsigned int i = 0; i < sections.size(); ++i) {
+        txt::BasicText& section = sections[i];
+        if (section.wordWrappedContent != prevWrap[i].first ||
+            section.cachedLineHeight != prevWrap[i].second) {
+            section.layoutDirty = true;
+        }
     }
 }
 
@@ -249,41 +294,24 @@ Text::CharSearchResult Text::findCharacterAtWindowPosition(const glm::vec2& targ
 }
 
 Text::CharSearchResult Text::findCharacterAtPosition(const glm::vec2& position) const {
-    const glm::mat4 inv = glm::inverse(getTransform().computeGlobalTransform());
-    const glm::vec4 rev = inv * glm::vec4(position, 0.f, 1.f);
+    // the inverse only needs to be recomputed when the transform changes
+    const glm::mat4 global = getTransform().computeGlobalTransform();
+    if (global != cachedGlobalTransform) {
+        cachedGlobalTransform  = global;
+        cachedInverseTransform = glm::inverse(global);
+    }
+    const glm::vec4 rev = cachedInverseTransform * glm::vec4(position, 0.f, 1.f);
     return findCharacterAtLocalPosition({rev.x, rev.y});
 }
 
 Text::CharSearchResult Text::findCharacterAtLocalPosition(const glm::vec2& position) const {
-    const sf::Vector2f localPos(position.x, position.y);
+    computeBoundsIfNeeded();
 
-    glm::vec2 nextPos(0.f, 0.f);
-    std::uint32_t prevChar = 0;
+    // character positions are cached by the layout of each section
     for (std::uint32_t si = 0; si < sections.size(); ++si) {
-        for (std::uint32_t i = 0; i < sections[si].wordWrappedContent.getSize(); ++i) {
-            const std::uint32_t curChar = sections[si].wordWrappedContent[i];
-            const glm::vec2 advance =
-                sections[si].advanceCharacterPos(font, nextPos, curChar, prevChar);
-            const sf::FloatRect bounds(
-                {nextPos.x, nextPos.y},
-                {advance.x - nextPos.x, sections[si].computeLineSpacing(font)});
-
-            if (bounds.contains(localPos)) { return {si, i}; }
-
-            nextPos  = advance;
-            prevChar = curChar;
-        }
-
-        // transition to next section
-        switch (prevChar) {
-        case ' ':
-        case '\t':
-        case '\n':
-            break;
-        default:
-            nextPos.x += sections[si].computeWhitespaceWidth(font);
-            break;
-        }
+        const std::uint32_t i =
+            sections[si].findCharacterAt(position, sections[si].computeLineSpacing(font));
+        if (i != txt::BasicText::NotFound) { return {si, i}; }
     }
 
     BL_LOG_DEBUG << "Could not find character position";
@@ -298,6 +326,12 @@ void Text::queueCommit() {
     }
 }
 
+void Text::syncPipeline() {
+    material().setPipeline(font->getRenderMode() == asi::FontPayload::RenderMode::DistanceField ?
+                               rc::cfg::MaterialPipelineIds::TextDistanceField :
+                               rc::cfg::MaterialPipelineIds::Text);
+}
+
 void Text::scaleToSize(const glm::vec2& size) {
     getTransform().setScale(size / OverlayScalable::getLocalSize());
 }
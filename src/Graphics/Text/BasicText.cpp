@@ -1,6 +1,7 @@
 #include <BLIB/Graphics/Text/BasicText.hpp>
 
 #include <BLIB/Graphics/Text.hpp>
+#include <algorithm>
 
 namespace bl
 {
@@ -10,80 +11,64 @@ namespace txt
 {
 namespace
 {
-std::uint32_t addLine(rc::prim::Vertex* vertices, std::uint32_t i, float lineLength, float lineTop,
-                      const glm::vec4& color, float offset, float thickness,
-                      float outlineThickness = 0) {
+void addLine(std::vector<rc::prim::Vertex>& vertices, float lineLength, float lineTop,
+             const glm::vec4& color, float offset, float thickness, float outlineThickness = 0) {
     const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
     const float bottom = top + std::floor(thickness + 0.5f);
 
-    if (vertices) {
-        const glm::vec2 texCoords(1.f, 1.f);
-        vertices[i] = rc::prim::Vertex(
-            glm::vec3(-outlineThickness, top - outlineThickness, 0.f), color, glm::vec2(1, 1));
-        vertices[i + 1] =
-            rc::prim::Vertex(glm::vec3(lineLength + outlineThickness, top - outlineThickness, 0.f),
-                             color,
-                             texCoords);
-        vertices[i + 2] = rc::prim::Vertex(
-            glm::vec3(-outlineThickness, bottom + outlineThickness, 0.f), color, texCoords);
-        vertices[i + 3] = rc::prim::Vertex(
-            glm::vec3(-outlineThickness, bottom + outlineThickness, 0.f), color, texCoords);
-        vertices[i + 4] =
-            rc::prim::Vertex(glm::vec3(lineLength + outlineThickness, top - outlineThickness, 0.f),
-                             color,
-                             texCoords);
-        vertices[i + 5] = rc::prim::Vertex(
-            glm::vec3(lineLength + outlineThickness, bottom + outlineThickness, 0.f),
-            color,
-            texCoords);
-    }
-    return i + 6;
+    const glm::vec2 texCoords(1.f, 1.f);
+    vertices.emplace_back(
+        glm::vec3(-outlineThickness, top - outlineThickness, 0.f), color, texCoords);
+    vertices.emplace_back(
+        glm::vec3(lineLength + outlineThickness, top - outlineThickness, 0.f), color, texCoords);
+    vertices.emplace_back(
+        glm::vec3(-outlineThickness, bottom + outlineThickness, 0.f), color, texCoords);
+    vertices.emplace_back(
+        glm::vec3(-outlineThickness, bottom + outlineThickness, 0.f), color, texCoords);
+    vertices.emplace_back(
+        glm::vec3(lineLength + outlineThickness, top - outlineThickness, 0.f), color, texCoords);
+    vertices.emplace_back(
+        glm::vec3(lineLength + outlineThickness, bottom + outlineThickness, 0.f), color, texCoords);
 }
 
-std::uint32_t addGlyphQuad(rc::prim::Vertex* vertices, std::uint32_t i, glm::vec2 position,
-                           const glm::vec4& color, const sf::Glyph& glyph, float italicShear) {
-    constexpr float padding = 1.0;
-
+// padding is in pixels around the glyph bounds and texPadding in texels around the atlas rect. The
+// z coordinate is unused for positioning and carries the distance field edge to the shader
+void addGlyphQuad(std::vector<rc::prim::Vertex>& vertices, glm::vec2 position,
+                  const glm::vec4& color, const sf::Glyph& glyph, float italicShear, float padding,
+                  float texPadding, float z) {
     const float left   = glyph.bounds.position.x - padding;
     const float top    = glyph.bounds.position.y - padding;
     const float right  = glyph.bounds.position.x + glyph.bounds.size.x + padding;
     const float bottom = glyph.bounds.position.y + glyph.bounds.size.y + padding;
 
-    const float u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
-    const float v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+    const float u1 = static_cast<float>(glyph.textureRect.position.x) - texPadding;
+    const float v1 = static_cast<float>(glyph.textureRect.position.y) - texPadding;
     const float u2 =
-        static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding;
+        static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + texPadding;
     const float v2 =
-        static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding;
-
-    if (vertices) {
-        vertices[i] = rc::prim::Vertex(
-            glm::vec3(position.x + left - italicShear * top, position.y + top, 0.f),
-            color,
-            glm::vec2(u1, v1));
-        vertices[i + 1] = rc::prim::Vertex(
-            glm::vec3(position.x + right - italicShear * top, position.y + top, 0.f),
-            color,
-            glm::vec2(u2, v1));
-        vertices[i + 2] = rc::prim::Vertex(
-            glm::vec3(position.x + left - italicShear * bottom, position.y + bottom, 0.f),
-            color,
-            glm::vec2(u1, v2));
-        vertices[i + 3] = rc::prim::Vertex(
-            glm::vec3(position.x + left - italicShear * bottom, position.y + bottom, 0.f),
-            color,
-            glm::vec2(u1, v2));
-        vertices[i + 4] = rc::prim::Vertex(
-            glm::vec3(position.x + right - italicShear * top, position.y + top, 0.f),
-            color,
-            glm::vec2(u2, v1));
-        vertices[i + 5] = rc::prim::Vertex(
-            glm::vec3(position.x + right - italicShear * bottom, position.y + bottom, 0.f),
-            color,
-            glm::vec2(u2, v2));
-    }
-
-    return i + 6;
+        static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + texPadding;
+
+    vertices.emplace_back(glm::vec3(position.x + left - italicShear * top, position.y + top, z),
+                          color,
+                          glm::vec2(u1, v1));
+    vertices.emplace_back(glm::vec3(position.x + right - italicShear * top, position.y + top, z),
+                          color,
+                          glm::vec2(u2, v1));
+    vertices.emplace_back(
+        glm::vec3(position.x + left - italicShear * bottom, position.y + bottom, z),
+        color,
+        glm::vec2(u1, v2));
+    vertices.emplace_back(
+        glm::vec3(position.x + left - italicShear * bottom, position.y + bottom, z),
+        color,
+        glm::vec2(u1, v2));
+    vertices.emplace_back(glm::vec3(position.x + right - italicShear * top, position.y + top, z),
+                          color,
+                          glm::vec2(u2, v1));
+    vertices.emplace_back(
+        glm::vec3(position.x + right - italicShear * bottom, position.y + bottom, z),
+        color,
+        glm::vec2(u2, v2));
 }
 } // namespace
 
@@ -95,46 +80,102 @@ BasicText::BasicText(bl::gfx::Text& owner)
 , fontSize(18)
 , outlineThickness(0)
 , letterSpacingFactor(1.f)
-, lineSpacingFactor(1.f) {}
+, lineSpacingFactor(1.f)
+, cachedLineHeight(0.f)
+, layoutDirty(true)
+, colorDirty(false)
+, cachedPos(0.f, 0.f)
+, cachedEndPos(0.f, 0.f) {}
 
 void BasicText::setString(const sf::String& s) {
+    // frequently updated text is often set to the same value, skip the relayout entirely
+    if (s == content) { return; }
     content = s;
-    owner.queueCommit();
+    markLayoutDirty();
 }
 
 void BasicText::setStyle(std::uint32_t s) {
     style = s;
-    owner.queueCommit();
+    markLayoutDirty();
 }
 
 void BasicText::setFillColor(const rc::Color& c) {
-    fillColor = c;
+    fillColor  = c;
+    colorDirty = true;
     owner.queueCommit();
 }
 
 void BasicText::setOutlineColor(const rc::Color& c) {
     outlineColor = c;
+    colorDirty   = true;
     owner.queueCommit();
 }
 
 void BasicText::setCharacterSize(unsigned int s) {
     fontSize = s;
-    owner.queueCommit();
+    markLayoutDirty();
 }
 
 void BasicText::setOutlineThickness(unsigned int t) {
     outlineThickness = t;
+    markLayoutDirty();
+}
+
+void BasicText::markLayoutDirty() {
+    layoutDirty = true;
     owner.queueCommit();
 }
 
+BasicText::Metrics BasicText::computeMetrics(as::TypedRef<asi::FontPayload> font) const {
+    const asi::FontPayload::AsciiTable& glyphs =
+        font->getAsciiTable(fontSize, (style & sf::Text::Bold) != 0);
+    const float glyphWidth = glyphs.getGlyph(L' ').advance;
+
+    Metrics metrics;
+    metrics.glyphs          = &glyphs;
+    metrics.letterSpacing   = (glyphWidth / 3.f) * (letterSpacingFactor - 1.f);
+    metrics.whitespaceWidth = glyphWidth + metrics.letterSpacing;
+    return metrics;
+}
+
 std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
-                                         rc::prim::Vertex* vertices, glm::vec2& cornerPos) {
+                                         glm::vec2& cornerPos) {
+    if (layoutDirty || cornerPos != cachedPos) {
+        cachedPos = cornerPos;
+        layout(font);
+    }
+    else if (colorDirty) { recolor(); }
+    layoutDirty = false;
+    colorDirty  = false;
+
+    cornerPos = cachedEndPos;
+    return static_cast<std::uint32_t>(outlineVertices.size() + fillVertices.size());
+}
+
+std::uint32_t BasicText::writeVertices(rc::prim::Vertex* vertices) const {
+    // outlines go first so that they are always behind the fill of neighboring glyphs
+    vertices = std::copy(outlineVertices.begin(), outlineVertices.end(), vertices);
+    std::copy(fillVertices.begin(), fillVertices.end(), vertices);
+    return static_cast<std::uint32_t>(outlineVertices.size() + fillVertices.size());
+}
+
+void BasicText::recolor() {
+    const glm::vec4 fill    = fillColor;
+    const glm::vec4 outline = outlineColor;
+    for (rc::prim::Vertex& v : fillVertices) { v.color = fill; }
+    for (rc::prim::Vertex& v : outlineVertices) { v.color = outline; }
+}
+
+void BasicText::layout(as::TypedRef<asi::FontPayload> font) {
     // Clear the previous geometry
     cachedBounds = sf::FloatRect();
-    cachedPos    = cornerPos;
+    cachedEndPos = cachedPos;
+    outlineVertices.clear();
+    fillVertices.clear();
+    charPositions.clear();
 
     // No text: nothing to draw
-    if (content.isEmpty()) return 0;
+    if (content.isEmpty()) return;
 
     // use word wrapped content
     if (wordWrappedContent.isEmpty()) { wordWrappedContent = content; }
@@ -147,18 +188,43 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
     const float underlineOffset    = font->getUnderlinePosition(fontSize);
     const float underlineThickness = font->getUnderlineThickness(fontSize);
 
+    // Glyphs and kerning for ASCII characters come from the fast table of the font
+    const Metrics metrics                      = computeMetrics(font);
+    const asi::FontPayload::AsciiTable& glyphs = *metrics.glyphs;
+
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
-    const sf::FloatRect xBounds     = font->getGlyph(L'x', fontSize, isBold).bounds;
+    const sf::FloatRect xBounds     = glyphs.getGlyph(L'x').bounds;
     const float strikeThroughOffset = xBounds.position.y + xBounds.size.y / 2.f;
 
+    // Outlined glyphs are rasterized separately unless the font renders distance fields, in which
+    // case the outline is the same glyph drawn with a lower edge threshold in the shader
+    const bool distanceField =
+        font->getRenderMode() == asi::FontPayload::RenderMode::DistanceField;
+    const asi::FontPayload::AsciiTable* outlineGlyphs = nullptr;
+    if (outlineThickness != 0) {
+        outlineGlyphs =
+            distanceField ?
+                &glyphs :
+                &font->getAsciiTable(fontSize, isBold, static_cast<float>(outlineThickness));
+    }
+    const float quadPadding = distanceField ? font->getDistanceFieldPadding(fontSize) : 1.f;
+    const float texPadding =
+        distanceField ? static_cast<float>(asi::FontPayload::DistanceFieldSpread) : 1.f;
+    const float fillEdge = distanceField ? 0.5f : 0.f;
+    const float outlineEdge =
+        distanceField ? font->getDistanceFieldEdge(fontSize, static_cast<float>(outlineThickness)) :
+                        0.f;
+
     // Precompute the variables needed by the algorithm
-    const float letterSpacing   = computeLetterSpacing(font);
-    const float whitespaceWidth = computeWhitespaceWidth(font);
+    const float letterSpacing   = metrics.letterSpacing;
+    const float whitespaceWidth = metrics.whitespaceWidth;
     const float lineSpacing     = cachedLineHeight;
-    float x                     = cornerPos.x;
-    float y                     = cornerPos.y + static_cast<float>(fontSize);
+    const float size            = static_cast<float>(fontSize);
+    float x                     = cachedPos.x;
+    float y                     = cachedPos.y + size;
+    charPositions.reserve(wordWrappedContent.getSize() + 1);
 
     // Create one quad for each character
     float minX             = static_cast<float>(fontSize);
@@ -166,46 +232,44 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
     float maxX             = 0.f;
     float maxY             = 0.f;
     std::uint32_t prevChar = 0;
-    std::uint32_t vi       = 0;
     for (std::size_t i = 0; i < wordWrappedContent.getSize(); ++i) {
         const std::uint32_t curChar = wordWrappedContent[i];
+        charPositions.emplace_back(x, y - size);
 
         // Skip the \r char to avoid weird graphical issues
         if (curChar == L'\r') continue;
 
         // Apply the kerning offset
-        x += font->getKerning(prevChar, curChar, fontSize, isBold);
+        x += glyphs.getKerning(prevChar, curChar);
 
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == L'\n' && prevChar != L'\n')) {
-            vi = addLine(vertices, vi, x, y, fillColor, underlineOffset, underlineThickness);
+            addLine(fillVertices, x, y, fillColor, underlineOffset, underlineThickness);
 
             if (outlineThickness != 0) {
-                vi = addLine(vertices,
-                             vi,
-                             x,
-                             y,
-                             outlineColor,
-                             underlineOffset,
-                             underlineThickness,
-                             outlineThickness);
+                addLine(outlineVertices,
+                        x,
+                        y,
+                        outlineColor,
+                        underlineOffset,
+                        underlineThickness,
+                        outlineThickness);
             }
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all
         // characters
         if (isStrikeThrough && (curChar == L'\n' && prevChar != L'\n')) {
-            vi = addLine(vertices, vi, x, y, fillColor, strikeThroughOffset, underlineThickness);
+            addLine(fillVertices, x, y, fillColor, strikeThroughOffset, underlineThickness);
 
             if (outlineThickness != 0)
-                vi = addLine(vertices,
-                             vi,
-                             x,
-                             y,
-                             outlineColor,
-                             strikeThroughOffset,
-                             underlineThickness,
-                             outlineThickness);
+                addLine(outlineVertices,
+                        x,
+                        y,
+                        outlineColor,
+                        strikeThroughOffset,
+                        underlineThickness,
+                        outlineThickness);
         }
 
         prevChar = curChar;
@@ -238,18 +302,32 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
         }
 
         // Apply the outline
-        if (outlineThickness != 0) {
-            const sf::Glyph& glyph = font->getGlyph(curChar, fontSize, isBold, outlineThickness);
+        if (outlineGlyphs) {
+            const sf::Glyph& glyph = outlineGlyphs->getGlyph(curChar);
 
             // Add the outline glyph to the vertices
-            vi = addGlyphQuad(vertices, vi, glm::vec2(x, y), outlineColor, glyph, italicShear);
+            addGlyphQuad(outlineVertices,
+                         glm::vec2(x, y),
+                         outlineColor,
+                         glyph,
+                         italicShear,
+                         quadPadding,
+                         texPadding,
+                         outlineEdge);
         }
 
         // Extract the current glyph's description
-        const sf::Glyph& glyph = font->getGlyph(curChar, fontSize, isBold);
+        const sf::Glyph& glyph = glyphs.getGlyph(curChar);
 
         // Add the glyph to the vertices
-        vi = addGlyphQuad(vertices, vi, glm::vec2(x, y), fillColor, glyph, italicShear);
+        addGlyphQuad(fillVertices,
+                     glm::vec2(x, y),
+                     fillColor,
+                     glyph,
+                     italicShear,
+                     quadPadding,
+                     texPadding,
+                     fillEdge);
 
         // Update the current bounds
         const float left   = glyph.bounds.position.x;
@@ -266,6 +344,8 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
         x += glyph.advance + letterSpacing;
     }
 
+    charPositions.emplace_back(x, y - size);
+
     // If we're using outline, update the current bounds
     if (outlineThickness != 0) {
         float outline = std::abs(std::ceil(outlineThickness));
@@ -277,32 +357,30 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
 
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0)) {
-        vi = addLine(vertices, vi, x, y, fillColor, underlineOffset, underlineThickness);
+        addLine(fillVertices, x, y, fillColor, underlineOffset, underlineThickness);
 
         if (outlineThickness != 0)
-            vi = addLine(vertices,
-                         vi,
-                         x,
-                         y,
-                         outlineColor,
-                         underlineOffset,
-                         underlineThickness,
-                         outlineThickness);
+            addLine(outlineVertices,
+                    x,
+                    y,
+                    outlineColor,
+                    underlineOffset,
+                    underlineThickness,
+                    outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0)) {
-        vi = addLine(vertices, vi, x, y, fillColor, strikeThroughOffset, underlineThickness);
+        addLine(fillVertices, x, y, fillColor, strikeThroughOffset, underlineThickness);
 
         if (outlineThickness != 0) {
-            vi = addLine(vertices,
-                         vi,
-                         x,
-                         y,
-                         outlineColor,
-                         strikeThroughOffset,
-                         underlineThickness,
-                         outlineThickness);
+            addLine(outlineVertices,
+                    x,
+                    y,
+                    outlineColor,
+                    strikeThroughOffset,
+                    underlineThickness,
+                    outlineThickness);
         }
     }
 
@@ -313,46 +391,38 @@ std::uint32_t BasicText::refreshVertices(as::TypedRef<asi::FontPayload> font,
     cachedBounds.size.y     = maxY - minY;
 
     // store next character pos
-    cornerPos.x = x;
-    cornerPos.y = y - static_cast<float>(fontSize);
+    cachedEndPos.x = x;
+    cachedEndPos.y = y - size;
     switch (wordWrappedContent[wordWrappedContent.getSize() - 1]) {
     case ' ':
     case '\t':
     case '\n':
         break;
     default:
-        cornerPos.x += whitespaceWidth;
+        cachedEndPos.x += whitespaceWidth;
     }
-
-    return vi;
 }
 
-glm::vec2 BasicText::advanceCharacterPos(as::TypedRef<asi::FontPayload> font, glm::vec2 pos,
+glm::vec2 BasicText::advanceCharacterPos(const Metrics& metrics, glm::vec2 pos,
                                          std::uint32_t curChar, std::uint32_t prevChar) const {
-    // Precompute the variables needed by the algorithm
-    const bool isBold           = style & sf::Text::Bold;
-    const float letterSpacing   = computeLetterSpacing(font);
-    const float whitespaceWidth = computeWhitespaceWidth(font);
-    const float lineSpacing     = cachedLineHeight;
-
     // Apply the kerning offset
-    pos.x += font->getKerning(prevChar, curChar, fontSize, isBold);
+    pos.x += metrics.glyphs->getKerning(prevChar, curChar);
 
     // Handle special characters
     switch (curChar) {
     case ' ':
-        pos.x += whitespaceWidth;
+        pos.x += metrics.whitespaceWidth;
         break;
     case '\t':
-        pos.x += whitespaceWidth * 4.f;
+        pos.x += metrics.whitespaceWidth * 4.f;
         break;
     case '\n':
-        pos.y += lineSpacing;
+        pos.y += cachedLineHeight;
         pos.x = 0.f;
         break;
     default:
         // For regular characters, add the advance offset of the glyph
-        pos.x += font->getGlyph(curChar, fontSize, isBold).advance + letterSpacing;
+        pos.x += metrics.glyphs->getGlyph(curChar).advance + metrics.letterSpacing;
         break;
     }
 
@@ -365,43 +435,37 @@ const sf::Glyph& BasicText::getGlyph(as::TypedRef<asi::FontPayload> font,
         code, fontSize, (style & sf::Text::Bold) != 0, static_cast<float>(outlineThickness));
 }
 
-glm::vec2 BasicText::findCharacterPos(as::TypedRef<asi::FontPayload> font,
-                                      unsigned int index) const {
-    index = index > content.getSize() ? content.getSize() : index;
+glm::vec2 BasicText::findCharacterPos(unsigned int index) const {
+    if (charPositions.empty()) { return {0.f, 0.f}; }
 
-    const bool isBold           = style & sf::Text::Bold;
-    const float letterSpacing   = computeLetterSpacing(font);
-    const float whitespaceWidth = computeWhitespaceWidth(font);
-    const float lineSpacing     = cachedLineHeight;
+    // positions are cached during layout and include any newlines added by word wrapping
+    index = std::min(index, static_cast<unsigned int>(content.getSize()));
+    index = std::min(index, static_cast<unsigned int>(charPositions.size() - 1));
+    return charPositions[index] - cachedPos;
+}
 
-    glm::vec2 position{};
-    std::uint32_t prevChar = 0;
-    for (unsigned int i = 0; i < index; ++i) {
-        const std::uint32_t curChar = content[i];
+std::uint32_t BasicText::findCharacterAt(const glm::vec2& position, float lineHeight) const {
+    if (charPositions.size() < 2) { return NotFound; }
 
-        // Apply the kerning offset
-        position.x += font->getKerning(prevChar, curChar, fontSize, isBold);
-        prevChar = curChar;
+    // lines are laid out top to bottom so we can skip straight to the first candidate line
+    const std::size_t charCount = charPositions.size() - 1;
+    const auto lineStart        = std::partition_point(
+        charPositions.begin(),
+        charPositions.begin() + charCount,
+        [&position, lineHeight](const glm::vec2& p) { return p.y + lineHeight <= position.y; });
 
-        // Handle special characters
-        switch (curChar) {
-        case U' ':
-            position.x += whitespaceWidth;
-            continue;
-        case U'\t':
-            position.x += whitespaceWidth * 4;
-            continue;
-        case U'\n':
-            position.y += lineSpacing;
-            position.x = 0;
-            continue;
-        }
+    const sf::Vector2f localPos(position.x, position.y);
+    for (auto it = lineStart; it != charPositions.begin() + charCount; ++it) {
+        if (it->y > position.y) { break; }
 
-        // For regular characters, add the advance offset of the glyph
-        position.x += font->getGlyph(curChar, fontSize, isBold).advance + letterSpacing;
+        const glm::vec2& next = *(it + 1);
+        const sf::FloatRect bounds({it->x, it->y}, {next.x - it->x, lineHeight});
+        if (bounds.contains(localPos)) {
+            return static_cast<std::uint32_t>(it - charPositions.begin());
+        }
     }
 
-    return position;
+    return NotFound;
 }
 
 } // namespace txt
@@ -16,36 +16,51 @@ constexpr unsigned int NoSelection = std::numeric_limits<unsigned int>::max();
 SelectBox::Ptr SelectBox::create() { return Ptr(new SelectBox()); }
 
 SelectBox::SelectBox()
-: content(ScrollArea::create(LinePacker::create(LinePacker::Vertical)))
+: content(VirtualList::create(std::bind(&SelectBox::createRow, this),
+                              std::bind(&SelectBox::bindRow,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2)))
 , selected(NoSelection) {
-    content->includeScrollbarsInRequisition(true);
     content->setColor(sf::Color::White, sf::Color::Black);
     content->setOutlineThickness(1.5f);
     Element* c[] = {content.get()};
     registerChildren(c);
 }
 
+Element::Ptr SelectBox::createRow() {
+    Box::Ptr row       = Box::create(LinePacker::create());
+    Label::Ptr label   = Label::create("");
+    const auto onClick = std::bind(
+        &SelectBox::onLabelClick, this, std::placeholders::_1, std::placeholders::_2);
+    row->pack(label);
+    row->getSignal(Event::LeftClicked).willAlwaysCall(onClick);
+    label->getSignal(Event::LeftClicked).willAlwaysCall(onClick);
+    rowLabels.try_emplace(row.get(), label);
+    return row;
+}
+
+void SelectBox::bindRow(Element& row, std::size_t i) {
+    rowLabels[&row]->setText(values[i]);
+    if (i == selected) { row.setColor(sf::Color(40, 80, 255), sf::Color::Blue); }
+    else { row.setColor(sf::Color::Transparent, sf::Color::Transparent); }
+}
+
 void SelectBox::addOption(const std::string& o) {
-    values.emplace_back(Box::create(LinePacker::create()), Label::create(o));
-    values.back().first->pack(values.back().second);
-    values.back()
-        .first->getSignal(Event::LeftClicked)
-        .willAlwaysCall(std::bind(
-            &SelectBox::onLabelClick, this, std::placeholders::_1, std::placeholders::_2));
-    values.back()
-        .second->getSignal(Event::LeftClicked)
-        .willAlwaysCall(std::bind(
-            &SelectBox::onLabelClick, this, std::placeholders::_1, std::placeholders::_2));
-    content->pack(values.back().first, true, false);
+    values.emplace_back(o);
+    content->setItemCount(values.size());
 }
 
 void SelectBox::editOptionText(unsigned int i, const std::string& t) {
-    values[i].second->setText(t);
+    if (i < values.size()) {
+        values[i] = t;
+        content->refreshItem(i);
+    }
 }
 
 void SelectBox::removeOption(const std::string& o) {
     for (unsigned int i = 0; i < values.size(); ++i) {
-        if (values[i].second->getText() == o) {
+        if (values[i] == o) {
             removeOption(i);
             break;
         }
@@ -54,10 +69,10 @@ void SelectBox::removeOption(const std::string& o) {
 
 void SelectBox::removeOption(unsigned int i) {
     if (i < values.size()) {
-        values[i].first->remove();
         values.erase(values.begin() + i);
-        if (selected > i) { selected -= 1; }
-        else if (selected == i) { removeSelection(); }
+        if (selected == i) { selected = NoSelection; }
+        else if (selected > i && selected != NoSelection) { selected -= 1; }
+        content->setItemCount(values.size());
     }
 }
 
@@ -65,13 +80,13 @@ unsigned int SelectBox::optionCount() const { return values.size(); }
 
 const std::string& SelectBox::getOption(unsigned int i) const {
     static const std::string empty;
-    return i < values.size() ? values[i].second->getText() : empty;
+    return i < values.size() ? values[i] : empty;
 }
 
 void SelectBox::clearOptions() {
-    for (auto& o : values) { o.first->remove(); }
     values.clear();
     selected = NoSelection;
+    content->setItemCount(0);
 }
 
 std::optional<unsigned int> SelectBox::getSelectedOption() const {
@@ -80,20 +95,23 @@ std::optional<unsigned int> SelectBox::getSelectedOption() const {
 
 void SelectBox::setSelectedOption(const std::string& o) {
     for (unsigned int i = 0; i < values.size(); ++i) {
-        if (values[i].second->getText() == o) {
-            onLabelClick({Event::LeftClicked}, values[i].first.get());
+        if (values[i] == o) {
+            setSelectedOption(i);
             break;
         }
     }
 }
 
 void SelectBox::setSelectedOption(unsigned int i) {
-    onLabelClick({Event::LeftClicked}, values[i].first.get());
+    if (i < values.size()) {
+        selected = i;
+        content->refreshItems();
+    }
 }
 
 void SelectBox::removeSelection() {
     selected = NoSelection;
-    for (auto& l : values) { l.first->setColor(sf::Color::Transparent, sf::Color::Transparent); }
+    content->refreshItems();
 }
 
 void SelectBox::setMaxSize(const sf::Vector2f& s) { content->setMaxSize(s); }
@@ -107,22 +125,14 @@ rdr::Component* SelectBox::doPrepareRender(rdr::Renderer& renderer) {
 }
 
 void SelectBox::onLabelClick(const Event&, Element* l) {
-    removeSelection();
-    for (unsigned int i = 0; i < values.size(); ++i) {
-        if (values[i].first.get() == l || values[i].second.get() == l) {
-            selected = i;
-            values[i].first->setColor(sf::Color(40, 80, 255), sf::Color::Blue);
-            break;
-        }
-    }
+    const std::size_t i = content->getRowIndex(l);
+    if (i != VirtualList::NoIndex) { setSelectedOption(static_cast<unsigned int>(i)); }
 }
 
 bool SelectBox::propagateEvent(const Event& e) { return sendEventToChildren(e); }
 
 void SelectBox::getAllOptions(std::vector<std::string>& output) const {
-    output.clear();
-    output.reserve(values.size());
-    for (const auto& v : values) { output.emplace_back(v.second->getText()); }
+    output = values;
 }
 
 } // namespace gui
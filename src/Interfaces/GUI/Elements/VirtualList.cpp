@@ -0,0 +1,284 @@
+#include <BLIB/Interfaces/GUI/Elements/VirtualList.hpp>
+
+#include <BLIB/Interfaces/GUI/Packers/LinePacker.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace bl
+{
+namespace gui
+{
+namespace
+{
+constexpr float BarSize                = 16.f;
+constexpr float DefaultOutline         = 1.f;
+constexpr unsigned int DefaultOverscan = 2;
+} // namespace
+
+VirtualList::Ptr VirtualList::create(RowFactory&& factory, RowBinder&& binder) {
+    return Ptr(new VirtualList(std::move(factory), std::move(binder)));
+}
+
+VirtualList::VirtualList(RowFactory&& factory, RowBinder&& binder)
+: Box(LinePacker::create(LinePacker::Vertical))
+, factory(std::move(factory))
+, binder(std::move(binder))
+, scrollbar(Slider::create(Slider::Vertical))
+, itemCount(0)
+, itemHeight(0.f)
+, estimatedHeight(0.f)
+, rowWidth(0.f)
+, overscan(DefaultOverscan)
+, offset(0.f)
+, binding(false) {
+    scrollbar->getSignal(Event::ValueChanged)
+        .willAlwaysCall(std::bind(&VirtualList::scrolled, this));
+    scrollbar->skipPacking(true);
+    scrollbar->setExpandsHeight(true);
+    scrollbar->setExpandsWidth(true);
+    scrollbar->setVisible(false, false);
+    add(scrollbar);
+}
+
+void VirtualList::setItemCount(std::size_t count) {
+    itemCount = count;
+    estimateHeight();
+    makeDirty();
+    onAcquisition();
+    refreshItems();
+}
+
+std::size_t VirtualList::getItemCount() const { return itemCount; }
+
+void VirtualList::setItemHeight(float height) {
+    itemHeight = std::max(height, 0.f);
+    estimateHeight();
+    makeDirty();
+    onAcquisition();
+}
+
+void VirtualList::setOverscan(unsigned int rows) {
+    overscan = rows;
+    layoutRows();
+}
+
+void VirtualList::setMaxSize(const sf::Vector2f& s) {
+    if (s.x <= 0.f || s.y <= 0.f) { maxSize.reset(); }
+    else { maxSize = s; }
+    makeDirty();
+}
+
+void VirtualList::scrollToItem(std::size_t index) {
+    const float h    = rowHeight();
+    const float view = viewHeight();
+    if (h <= 0.f || view <= 0.f || index >= itemCount) { return; }
+
+    const float top = h * static_cast<float>(index);
+    if (top < offset) { offset = top; }
+    else if (top + h > offset + view) { offset = top + h - view; }
+
+    const float freeSpace = totalHeight() - view;
+    if (freeSpace > 0.f) { scrollbar->setValue(offset / freeSpace, false); }
+    layoutRows();
+}
+
+void VirtualList::refreshItems() {
+    for (Row& row : rows) { bindRow(*row.element, row.index); }
+}
+
+void VirtualList::refreshItem(std::size_t index) {
+    for (Row& row : rows) {
+        if (row.index == index) {
+            bindRow(*row.element, row.index);
+            break;
+        }
+    }
+}
+
+std::size_t VirtualList::getRowIndex(const Element* element) const {
+    for (const Element* e = element; e != nullptr && e != this; e = e->getParent()) {
+        for (const Row& row : rows) {
+            if (row.element.get() == e) { return row.index; }
+        }
+    }
+    return NoIndex;
+}
+
+std::size_t VirtualList::getCreatedRowCount() const { return rows.size() + freeRows.size(); }
+
+sf::Vector2f VirtualList::minimumRequisition() const {
+    const float outline = getRenderSettings().outlineThickness.value_or(DefaultOutline);
+    sf::Vector2f req(rowWidth + BarSize, totalHeight());
+    if (maxSize.has_value()) {
+        req = {std::min(req.x, maxSize.value().x), std::min(req.y, maxSize.value().y)};
+    }
+    return req + 2.f * sf::Vector2f(outline, outline);
+}
+
+void VirtualList::onAcquisition() {
+    updateScrollbar();
+    layoutRows();
+}
+
+bool VirtualList::handleScroll(const Event& scroll) {
+    if (!getAcquisition().contains(scroll.mousePosition())) { return false; }
+    if (Box::handleScroll(scroll)) { return true; }
+    if (scrollbar->visible()) { scrollbar->incrementValue(-scroll.scrollDelta()); }
+    return true;
+}
+
+void VirtualList::prepareChildrenRender(rdr::Renderer& renderer) {
+    // rows measured before their components existed report placeholder sizes
+    Box::prepareChildrenRender(renderer);
+    remeasure();
+}
+
+void VirtualList::requestMakeDirty(const Element* child) {
+    if (child != scrollbar.get()) { remeasure(); }
+}
+
+float VirtualList::rowHeight() const { return itemHeight > 0.f ? itemHeight : estimatedHeight; }
+
+float VirtualList::totalHeight() const { return rowHeight() * static_cast<float>(itemCount); }
+
+float VirtualList::viewHeight() const {
+    const float outline = getRenderSettings().outlineThickness.value_or(DefaultOutline);
+    return getAcquisition().size.y - outline * 2.f;
+}
+
+void VirtualList::estimateHeight() {
+    if (itemHeight > 0.f || estimatedHeight > 0.f || itemCount == 0) { return; }
+
+    // measure a single row instead of creating one per item
+    Element::Ptr row = takeRow();
+    bindRow(*row, 0);
+    estimatedHeight = row->getRequisition().y;
+    freeRows.emplace_back(row);
+}
+
+bool VirtualList::measureRows() {
+    if (binding) { return false; }
+
+    // measure from scratch so that stale or placeholder sizes do not latch
+    sf::Vector2f size(0.f, 0.f);
+    const auto measure = [&size](const Element& row) {
+        const sf::Vector2f req = row.getRequisition();
+        size.x                 = std::max(size.x, req.x);
+        size.y                 = std::max(size.y, req.y);
+    };
+    for (const Row& row : rows) { measure(*row.element); }
+    if (rows.empty()) {
+        for (const Element::Ptr& row : freeRows) { measure(*row); }
+    }
+    if (size.x <= 0.f && size.y <= 0.f) { return false; }
+
+    const float height = itemHeight > 0.f ? estimatedHeight : size.y;
+    if (size.x == rowWidth && height == estimatedHeight) { return false; }
+    rowWidth        = size.x;
+    estimatedHeight = height;
+    return true;
+}
+
+void VirtualList::remeasure() {
+    if (measureRows()) {
+        makeDirty();
+        onAcquisition();
+    }
+}
+
+Element::Ptr VirtualList::takeRow() {
+    if (!freeRows.empty()) {
+        Element::Ptr row = freeRows.back();
+        freeRows.pop_back();
+        return row;
+    }
+
+    Element::Ptr row = factory();
+    row->setVisible(false, false);
+    add(row);
+    return row;
+}
+
+void VirtualList::bindRow(Element& row, std::size_t index) {
+    // rows dirtied by the binder are measured here instead of through requestMakeDirty
+    binding = true;
+    binder(row, index);
+    binding = false;
+
+    const float width = row.getRequisition().x;
+    if (width > rowWidth) {
+        rowWidth = width;
+        makeDirty();
+    }
+}
+
+void VirtualList::scrolled() {
+    const float freeSpace = totalHeight() - viewHeight();
+    offset                = freeSpace > 0.f ? freeSpace * scrollbar->getValue() : 0.f;
+    layoutRows();
+}
+
+void VirtualList::updateScrollbar() {
+    const float outline   = getRenderSettings().outlineThickness.value_or(DefaultOutline);
+    const float view      = viewHeight();
+    const float total     = totalHeight();
+    const float freeSpace = std::max(total - view, 0.f);
+    offset                = std::clamp(offset, 0.f, freeSpace);
+
+    if (view > 0.f && freeSpace > 0.f) {
+        const sf::FloatRect& acq = getAcquisition();
+        const sf::Vector2f barPos(acq.position.x + acq.size.x - outline - BarSize,
+                                  acq.position.y + outline);
+        scrollbar->setVisible(true, false);
+        scrollbar->setSliderSize(std::clamp(view / total, 0.14f, 1.f));
+        scrollbar->setSliderIncrement(rowHeight() / freeSpace);
+        scrollbar->setValue(offset / freeSpace, false);
+        Packer::manuallyPackElement(scrollbar, {barPos, {BarSize, view}}, true);
+    }
+    else { scrollbar->setVisible(false, false); }
+}
+
+void VirtualList::layoutRows() {
+    const float h    = rowHeight();
+    const float view = std::max(viewHeight(), 0.f);
+
+    std::size_t first = 0;
+    std::size_t last  = 0;
+    if (h > 0.f && itemCount > 0) {
+        first = static_cast<std::size_t>(std::floor(offset / h));
+        first = std::min(first > overscan ? first - overscan : 0, itemCount);
+        last  = static_cast<std::size_t>(std::ceil((offset + view) / h)) + overscan;
+        last  = std::min(std::max(last, first), itemCount);
+    }
+
+    // recycle rows that left the window and keep the rest bound to their item
+    std::vector<Element::Ptr> bound(last - first);
+    for (Row& row : rows) {
+        if (row.index >= first && row.index < last) { bound[row.index - first] = row.element; }
+        else {
+            row.element->setVisible(false, false);
+            freeRows.emplace_back(row.element);
+        }
+    }
+    rows.clear();
+
+    const sf::FloatRect& acq = getAcquisition();
+    const float outline      = getRenderSettings().outlineThickness.value_or(DefaultOutline);
+    const float barWidth     = scrollbar->visible() ? BarSize : 0.f;
+    const float width        = std::max(acq.size.x - outline * 2.f - barWidth, 0.f);
+    for (std::size_t i = first; i < last; ++i) {
+        Element::Ptr& element = bound[i - first];
+        if (!element) {
+            element = takeRow();
+            bindRow(*element, i);
+            element->setVisible(true, false);
+        }
+        rows.emplace_back(Row{element, i});
+
+        const float y = acq.position.y + outline + h * static_cast<float>(i) - offset;
+        Packer::manuallyPackElement(element, {{acq.position.x + outline, y}, {width, h}}, true);
+    }
+}
+
+} // namespace gui
+} // namespace bl
@@ -0,0 +1,35 @@
+#include <BLIB/Interfaces/GUI/Renderer/Batched/BoxComponent.hpp>
+
+#include <BLIB/Interfaces/GUI/Elements/Box.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+BoxComponent::BoxComponent()
+: BatchedComponent(HighlightState::IgnoresMouse) {}
+
+void BoxComponent::onElementUpdated() {
+    Box& owner = getOwnerAs<Box>();
+    getAnchor().getOverlayScaler().setScissorMode(owner.isViewConstrained() ?
+                                                      com::OverlayScaler::ScissorSelfConstrained :
+                                                      com::OverlayScaler::ScissorInherit);
+}
+
+void BoxComponent::onRenderSettingChange() { rebuild(); }
+
+void BoxComponent::buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) {
+    const Element& owner           = getOwnerAs<Element>();
+    const RenderSettings& settings = owner.getRenderSettings();
+    addBox(quads,
+           {{0.f, 0.f}, owner.getAcquisition().size},
+           settings.fillColor.value_or(sf::Color::Transparent),
+           settings.outlineColor.value_or(sf::Color::Transparent),
+           settings.outlineThickness.value_or(0.f));
+}
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
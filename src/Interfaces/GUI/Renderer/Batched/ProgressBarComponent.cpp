@@ -0,0 +1,59 @@
+#include <BLIB/Interfaces/GUI/Renderer/Batched/ProgressBarComponent.hpp>
+
+#include <BLIB/Interfaces/GUI/Elements/ProgressBar.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+ProgressBarComponent::ProgressBarComponent()
+: BatchedComponent(HighlightState::IgnoresMouse) {}
+
+void ProgressBarComponent::onElementUpdated() { rebuild(); }
+
+void ProgressBarComponent::onRenderSettingChange() { rebuild(); }
+
+void ProgressBarComponent::buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) {
+    const ProgressBar& owner       = getOwnerAs<ProgressBar>();
+    const RenderSettings& settings = owner.getRenderSettings();
+    const sf::Vector2f& acqSize    = owner.getAcquisition().size;
+    const float ot                 = settings.outlineThickness.value_or(1.f);
+
+    addBox(quads,
+           {{0.f, 0.f}, acqSize},
+           settings.fillColor.value_or(sf::Color(120, 120, 120)),
+           settings.outlineColor.value_or(sf::Color(20, 20, 20)),
+           ot);
+
+    // size and position bar based on progress and fill dir
+    const sf::Vector2f bsize(acqSize.x - ot * 2.f, acqSize.y - ot * 2.f);
+    const bool hor = owner.getFillDirection() == ProgressBar::LeftToRight ||
+                     owner.getFillDirection() == ProgressBar::RightToLeft;
+    const sf::Vector2f size(hor ? bsize.x * owner.getProgress() : bsize.x,
+                            hor ? bsize.y : bsize.y * owner.getProgress());
+    sf::Vector2f pos(ot, ot);
+    switch (owner.getFillDirection()) {
+    case ProgressBar::RightToLeft:
+        pos.x += bsize.x - size.x;
+        break;
+    case ProgressBar::BottomToTop:
+        pos.y += bsize.y - size.y;
+        break;
+    case ProgressBar::TopToBottom:
+    case ProgressBar::LeftToRight:
+    default:
+        break;
+    }
+
+    addBox(quads,
+           {pos, size},
+           settings.secondaryFillColor.value_or(sf::Color(114, 219, 72)),
+           settings.secondaryOutlineColor.value_or(sf::Color::Transparent),
+           settings.secondaryOutlineThickness.value_or(0.f));
+}
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
@@ -0,0 +1,38 @@
+#include <BLIB/Interfaces/GUI/Renderer/Batched/SeparatorComponent.hpp>
+
+#include <BLIB/Interfaces/GUI/Elements/Separator.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+SeparatorComponent::SeparatorComponent()
+: BatchedComponent(HighlightState::IgnoresMouse) {}
+
+void SeparatorComponent::onElementUpdated() { rebuild(); }
+
+void SeparatorComponent::onRenderSettingChange() { rebuild(); }
+
+void SeparatorComponent::buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) {
+    const Separator& owner         = getOwnerAs<Separator>();
+    const RenderSettings& settings = owner.getRenderSettings();
+    const sf::Vector2f size(owner.getDirection() == Separator::Horizontal ?
+                                owner.getAcquisition().size.x :
+                                owner.getThickness(),
+                            owner.getDirection() == Separator::Vertical ?
+                                owner.getAcquisition().size.y :
+                                owner.getThickness());
+    const sf::Vector2f pos = RenderSettings::calculatePosition(
+        settings.horizontalAlignment.value_or(RenderSettings::Center),
+        settings.verticalAlignment.value_or(RenderSettings::Center),
+        owner.getAcquisition(),
+        size);
+    quads.emplace_back(
+        rdr::QuadBatch::Quad{{pos, size}, settings.fillColor.value_or(sf::Color::Black)});
+}
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
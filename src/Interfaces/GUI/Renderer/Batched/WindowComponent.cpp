@@ -0,0 +1,34 @@
+#include <BLIB/Interfaces/GUI/Renderer/Batched/WindowComponent.hpp>
+
+#include <BLIB/Interfaces/GUI/Elements/Window.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace batcoms
+{
+WindowComponent::WindowComponent()
+: BatchedComponent(HighlightState::IgnoresMouse) {}
+
+void WindowComponent::onElementUpdated() {
+    // noop
+}
+
+void WindowComponent::onRenderSettingChange() { rebuild(); }
+
+void WindowComponent::buildQuads(std::vector<rdr::QuadBatch::Quad>& quads) {
+    const Element& owner           = getOwnerAs<Element>();
+    const RenderSettings& settings = owner.getRenderSettings();
+    addBox(quads,
+           {{0.f, 0.f}, owner.getAcquisition().size},
+           settings.fillColor.value_or(sf::Color(75, 75, 75)),
+           settings.outlineColor.value_or(sf::Color(20, 20, 20)),
+           settings.outlineThickness.value_or(1.f));
+}
+
+bool WindowComponent::isBatchScope() const { return true; }
+
+} // namespace batcoms
+} // namespace gui
+} // namespace bl
@@ -0,0 +1,162 @@
+#include <BLIB/Interfaces/GUI/Renderer/BatchedComponent.hpp>
+
+#include <BLIB/Components/Transform2D.hpp>
+#include <BLIB/Engine/Engine.hpp>
+#include <BLIB/Interfaces/GUI/Elements/Box.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/Renderer.hpp>
+#include <algorithm>
+#include <optional>
+
+namespace bl
+{
+namespace gui
+{
+namespace rdr
+{
+BatchedComponent::BatchedComponent(HighlightState hs)
+: Component(hs)
+, engine(nullptr)
+, renderer(nullptr)
+, scope(nullptr)
+, visible(true) {}
+
+void BatchedComponent::setVisible(bool v) {
+    visible = v;
+    handle.setHidden(!v);
+    handle.commit();
+}
+
+ecs::Entity BatchedComponent::getEntity() const { return anchor.entity(); }
+
+void BatchedComponent::assignDepth(float depth) {
+    Component::assignDepth(depth);
+    updatePlacement();
+    handle.commit();
+}
+
+bool BatchedComponent::isBatchScope() const {
+    return getOwnerAs<Element>().getParent() == nullptr;
+}
+
+void BatchedComponent::rebuild() {
+    quads.clear();
+    buildQuads(quads);
+    handle.setQuads(quads);
+    updatePlacement();
+    handle.commit();
+}
+
+void BatchedComponent::addBox(std::vector<QuadBatch::Quad>& quads, const sf::FloatRect& rect,
+                              const sf::Color& fill, const sf::Color& outline, float thickness) {
+    const float t = std::clamp(thickness, 0.f, std::min(rect.size.x, rect.size.y) * 0.5f);
+
+    if (fill.a > 0) {
+        const sf::Vector2f pos(rect.position.x + t, rect.position.y + t);
+        const sf::Vector2f size(rect.size.x - t * 2.f, rect.size.y - t * 2.f);
+        quads.emplace_back(QuadBatch::Quad{{pos, size}, fill});
+    }
+
+    if (t > 0.f && outline.a > 0) {
+        const float right  = rect.position.x + rect.size.x - t;
+        const float bottom = rect.position.y + rect.size.y - t;
+        const float inner  = rect.size.y - t * 2.f;
+        quads.emplace_back(QuadBatch::Quad{{rect.position, {rect.size.x, t}}, outline});
+        quads.emplace_back(QuadBatch::Quad{{{rect.position.x, bottom}, {rect.size.x, t}}, outline});
+        quads.emplace_back(
+            QuadBatch::Quad{{{rect.position.x, rect.position.y + t}, {t, inner}}, outline});
+        quads.emplace_back(QuadBatch::Quad{{{right, rect.position.y + t}, {t, inner}}, outline});
+    }
+}
+
+gfx::Dummy2D& BatchedComponent::getAnchor() { return anchor; }
+
+void BatchedComponent::doCreate(engine::World& world, Renderer& r) {
+    engine   = &world.engine();
+    renderer = &r;
+    anchor.create(world);
+    joinBatch();
+}
+
+void BatchedComponent::doSceneAdd(rc::Overlay*) {
+    if (!handle.isAssigned()) { joinBatch(); }
+    handle.setHidden(!visible);
+    rebuild();
+}
+
+void BatchedComponent::doSceneRemove() { handle.release(); }
+
+void BatchedComponent::handleAcquisition() {
+    const Element& owner = getOwnerAs<Element>();
+    anchor.setSize({owner.getAcquisition().size.x, owner.getAcquisition().size.y});
+    anchor.getTransform().setPosition({owner.getLocalPosition().x, owner.getLocalPosition().y});
+    rebuild();
+}
+
+void BatchedComponent::handleMove() {
+    const Element& owner = getOwnerAs<Element>();
+    anchor.getTransform().setPosition({owner.getLocalPosition().x, owner.getLocalPosition().y});
+    updatePlacement();
+    handle.commit();
+}
+
+void BatchedComponent::joinBatch() {
+    const Element& owner    = getOwnerAs<Element>();
+    ecs::Entity scopeAnchor = anchor.entity();
+    scope                   = &owner;
+
+    if (!isBatchScope()) {
+        for (const Element* e = owner.getParent(); e != nullptr; e = e->getParent()) {
+            const Component* component = e->getComponent();
+            if (!component) { continue; }
+
+            const BatchedComponent* batched = dynamic_cast<const BatchedComponent*>(component);
+            if (!batched || batched->isBatchScope()) {
+                scope       = e;
+                scopeAnchor = component->getEntity();
+                break;
+            }
+        }
+    }
+
+    handle.assign(renderer->getQuadBatch(*scope, scopeAnchor));
+}
+
+void BatchedComponent::updatePlacement() {
+    if (!scope || !engine) { return; }
+
+    const Element& owner      = getOwnerAs<Element>();
+    const sf::Vector2f origin = scope->getPosition();
+    const sf::Vector2f offset = scope == &owner ? sf::Vector2f() : owner.getPosition() - origin;
+    handle.setOffset({offset.x, offset.y});
+
+    // batched ancestors within the scope do not have their own scissor for our quads. The scope
+    // itself and everything above it clip the batch entity through the scissor of the anchor
+    std::optional<sf::FloatRect> clip;
+    float depth = 0.f;
+    for (const Element* e = &owner; e != nullptr && e != scope; e = e->getParent()) {
+        const Component* component = e == &owner ? this : e->getComponent();
+        if (component) {
+            const com::Transform2D* transform =
+                engine->ecs().getComponent<com::Transform2D>(component->getEntity());
+            if (transform) { depth += transform->getDepth(); }
+        }
+
+        const Box* box = dynamic_cast<const Box*>(e);
+        if (e != &owner && box && box->isViewConstrained()) {
+            sf::FloatRect area = e->getAcquisition();
+            area.position -= origin;
+            if (clip.has_value()) {
+                clip = clip.value().findIntersection(area).value_or(sf::FloatRect());
+            }
+            else { clip = area; }
+        }
+    }
+
+    handle.setDepth(depth);
+    if (clip.has_value()) { handle.setClip(clip.value()); }
+    else { handle.clearClip(); }
+}
+
+} // namespace rdr
+} // namespace gui
+} // namespace bl
@@ -28,6 +28,11 @@
 #include <BLIB/Interfaces/GUI/Renderer/Basic/TextEntryComponent.hpp>
 #include <BLIB/Interfaces/GUI/Renderer/Basic/WindowComponent.hpp>
 
+#include <BLIB/Interfaces/GUI/Renderer/Batched/BoxComponent.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/Batched/ProgressBarComponent.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/Batched/SeparatorComponent.hpp>
+#include <BLIB/Interfaces/GUI/Renderer/Batched/WindowComponent.hpp>
+
 namespace bl
 {
 namespace gui
@@ -69,6 +74,23 @@ FactoryTable& FactoryTable::getDefaultTable() {
     return table;
 }
 
+FactoryTable& FactoryTable::getBatchedTable() {
+    static FactoryTable table = []() {
+        FactoryTable t(true);
+        t.useBatchedComponents();
+        return t;
+    }();
+    return table;
+}
+
+void FactoryTable::useBatchedComponents() {
+    registerFactoryForElement<Box, batcoms::BoxComponent>();
+    registerFactoryForElement<GUI, batcoms::BoxComponent>();
+    registerFactoryForElement<ProgressBar, batcoms::ProgressBarComponent>();
+    registerFactoryForElement<Separator, batcoms::SeparatorComponent>();
+    registerFactoryForElement<Window, batcoms::WindowComponent>();
+}
+
 void FactoryTable::setFlashProviderFactory(FlashProvider::Factory&& factory) {
     flashFactory = std::move(factory);
 }
@@ -0,0 +1,187 @@
+#include <BLIB/Interfaces/GUI/Renderer/QuadBatch.hpp>
+
+#include <BLIB/Engine/Engine.hpp>
+#include <BLIB/Render/Color.hpp>
+
+namespace bl
+{
+namespace gui
+{
+namespace rdr
+{
+namespace
+{
+constexpr std::uint32_t InitialQuadCapacity = 256;
+}
+
+QuadBatch::Handle::Handle()
+: owner(nullptr)
+, offset(0.f, 0.f)
+, clipped(false)
+, depth(0.f)
+, hidden(false)
+, dirty(false) {}
+
+QuadBatch::Handle::~Handle() { release(); }
+
+void QuadBatch::Handle::assign(QuadBatch& batch) {
+    release();
+    owner      = &batch;
+    ownerAlive = batch.alive;
+    dirty      = true;
+}
+
+bool QuadBatch::Handle::isAssigned() const { return owner != nullptr && ownerAlive && *ownerAlive; }
+
+void QuadBatch::Handle::setQuads(const std::vector<Quad>& q) {
+    quads = q;
+    dirty = true;
+}
+
+void QuadBatch::Handle::setOffset(const glm::vec2& o) {
+    if (o != offset) {
+        offset = o;
+        dirty  = true;
+    }
+}
+
+void QuadBatch::Handle::setClip(const sf::FloatRect& c) {
+    if (!clipped || c != clip) {
+        clip    = c;
+        clipped = true;
+        dirty   = true;
+    }
+}
+
+void QuadBatch::Handle::clearClip() {
+    if (clipped) {
+        clipped = false;
+        dirty   = true;
+    }
+}
+
+void QuadBatch::Handle::setDepth(float d) {
+    if (d != depth) {
+        depth = d;
+        dirty = true;
+    }
+}
+
+void QuadBatch::Handle::setHidden(bool h) {
+    if (h != hidden) {
+        hidden = h;
+        dirty  = true;
+    }
+}
+
+void QuadBatch::Handle::commit() {
+    if (dirty && isAssigned()) {
+        dirty = false;
+        write();
+    }
+}
+
+void QuadBatch::Handle::release() {
+    if (isAssigned() && alloc.isValid()) {
+        alloc.release();
+        owner->queueCommit();
+    }
+    owner = nullptr;
+    ownerAlive.reset();
+}
+
+void QuadBatch::Handle::write() {
+    const std::uint32_t vertexCount = static_cast<std::uint32_t>(quads.size()) * 4;
+    const std::uint32_t indexCount  = static_cast<std::uint32_t>(quads.size()) * 6;
+
+    if (vertexCount == 0) {
+        if (alloc.isValid()) {
+            alloc.release();
+            owner->queueCommit();
+        }
+        return;
+    }
+
+    // only reallocate when the quad count changes so the range stays put
+    if (!alloc.isValid() || alloc.getInfo().vertexSize != vertexCount) {
+        alloc = owner->batch.component().indexBuffer.allocate(vertexCount, indexCount);
+        owner->queueCommit();
+    }
+
+    rc::prim::Vertex* vertices = alloc.getVertices();
+    std::uint32_t* indices     = alloc.getIndices();
+    const std::uint32_t base   = alloc.getInfo().vertexStart;
+    for (std::uint32_t i = 0; i < quads.size(); ++i) {
+        sf::FloatRect rect = quads[i].rect;
+        rect.position.x += offset.x;
+        rect.position.y += offset.y;
+
+        // clipped and hidden quads collapse to a point so that the range does not change
+        bool visible = !hidden;
+        if (visible && clipped) {
+            const auto overlap = rect.findIntersection(clip);
+            if (overlap.has_value()) { rect = overlap.value(); }
+            else { visible = false; }
+        }
+        if (!visible) { rect.size = {0.f, 0.f}; }
+
+        const glm::vec4 color = rc::Color(quads[i].color).toVec4();
+        const float left      = rect.position.x;
+        const float top       = rect.position.y;
+        const float right     = rect.position.x + rect.size.x;
+        const float bottom    = rect.position.y + rect.size.y;
+
+        rc::prim::Vertex* v = vertices + i * 4;
+        v[0]                = rc::prim::Vertex({left, top, depth}, color);
+        v[1]                = rc::prim::Vertex({right, top, depth}, color);
+        v[2]                = rc::prim::Vertex({right, bottom, depth}, color);
+        v[3]                = rc::prim::Vertex({left, bottom, depth}, color);
+
+        std::uint32_t* j = indices + i * 6;
+        j[0]             = base + i * 4;
+        j[1]             = base + i * 4 + 1;
+        j[2]             = base + i * 4 + 2;
+        j[3]             = base + i * 4;
+        j[4]             = base + i * 4 + 2;
+        j[5]             = base + i * 4 + 3;
+    }
+
+    alloc.commit();
+}
+
+QuadBatch::QuadBatch(engine::World& world, ecs::Entity anchor)
+: engine(world.engine())
+, alive(std::make_shared<bool>(true)) {
+    batch.create(world, InitialQuadCapacity * 4);
+    batch.getOverlayScaler().setScissorMode(com::OverlayScaler::ScissorInherit);
+    engine.ecs().setEntityParent(batch.entity(), anchor);
+}
+
+QuadBatch::~QuadBatch() {
+    *alive = false;
+    if (commitHandle.isQueued()) { commitHandle.cancel(); }
+}
+
+void QuadBatch::addToScene(rc::Overlay* overlay) {
+    batch.addToScene(overlay, rc::UpdateSpeed::Static);
+}
+
+void QuadBatch::removeFromScene() { batch.removeFromScene(); }
+
+std::uint32_t QuadBatch::vertexCount() const {
+    return batch.component().indexBuffer.vertexCount();
+}
+
+void QuadBatch::queueCommit() {
+    // allocation changes are coalesced into a single draw parameter refresh per frame
+    if (!commitHandle.isQueued()) {
+        commitHandle = engine.systems().addFrameTask(engine::FrameStage::RendererDataSync,
+                                                     std::bind(&QuadBatch::commit, this));
+    }
+}
+
+void QuadBatch::commit() { batch.component().commit(); }
+
+} // namespace rdr
+} // namespace gui
+} // namespace bl
@@ -34,11 +34,22 @@ void Renderer::destroyComponent(const Element& owner) {
         it->second->doSceneRemove();
         components.erase(it);
     }
+    batches.erase(&owner);
+}
+
+QuadBatch& Renderer::getQuadBatch(const Element& scope, ecs::Entity anchor) {
+    auto it = batches.find(&scope);
+    if (it == batches.end()) {
+        it = batches.try_emplace(&scope, std::make_unique<QuadBatch>(world, anchor)).first;
+        if (overlay) { it->second->addToScene(overlay); }
+    }
+    return *it->second;
 }
 
 void Renderer::addToOverlay(rc::Overlay* o) {
     if (overlay) { removeFromScene(); }
     overlay = o;
+    for (auto& pair : batches) { pair.second->addToScene(o); }
     flashProvider->doSceneAdd(o);
     highlightProvider->doSceneAdd(o);
     tooltipProvider->doSceneAdd(o);
@@ -47,6 +58,7 @@ void Renderer::addToOverlay(rc::Overlay* o) {
 void Renderer::removeFromScene() {
     if (overlay) {
         for (auto& pair : components) { pair.second->doSceneRemove(); }
+        for (auto& pair : batches) { pair.second->removeFromScene(); }
         overlay = nullptr;
     }
     flashProvider->doSceneRemove();
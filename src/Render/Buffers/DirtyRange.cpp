@@ -17,6 +17,12 @@ DirtyRange::DirtyRange(std::uint32_t i, std::uint32_t n)
 , size(n) {}
 
 void DirtyRange::combine(const DirtyRange& other) {
+    if (other.size == 0) { return; }
+    if (size == 0) {
+        *this = other;
+        return;
+    }
+
     const std::uint32_t end = std::max(start + size, other.start + other.size);
     start                   = std::min(start, other.start);
     size                    = end - start;
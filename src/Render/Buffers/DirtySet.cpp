@@ -0,0 +1,85 @@
+#include <BLIB/Render/Buffers/DirtySet.hpp>
+
+#include <algorithm>
+
+namespace bl
+{
+namespace rc
+{
+namespace buf
+{
+DirtySet::DirtySet(std::uint32_t gapThreshold)
+: first(0)
+, last(0)
+, gapThreshold(gapThreshold) {}
+
+void DirtySet::markDirty(std::uint32_t i, std::uint32_t n) {
+    if (n == 0) { return; }
+
+    const std::uint32_t end = i + n;
+    if (words.size() * WordBits < end) { words.resize((end + WordBits - 1) / WordBits, 0); }
+    if (empty()) {
+        first = i;
+        last  = end;
+    }
+    else {
+        first = std::min(first, i);
+        last  = std::max(last, end);
+    }
+
+    const std::uint32_t wFirst = i / WordBits;
+    const std::uint32_t wLast  = (end - 1) / WordBits;
+    const std::uint64_t lo     = ~std::uint64_t(0) << (i % WordBits);
+    const std::uint64_t hi     = ~std::uint64_t(0) >> (WordBits - 1 - (end - 1) % WordBits);
+    if (wFirst == wLast) { words[wFirst] |= lo & hi; }
+    else {
+        words[wFirst] |= lo;
+        std::fill(words.begin() + wFirst + 1, words.begin() + wLast, ~std::uint64_t(0));
+        words[wLast] |= hi;
+    }
+}
+
+void DirtySet::markDirty(const DirtySet& other) {
+    if (other.empty()) { return; }
+
+    if (words.size() < other.words.size()) { words.resize(other.words.size(), 0); }
+    const std::uint32_t wordEnd = (other.last + WordBits - 1) / WordBits;
+    for (std::uint32_t w = other.first / WordBits; w < wordEnd; ++w) {
+        words[w] |= other.words[w];
+    }
+    if (empty()) {
+        first = other.first;
+        last  = other.last;
+    }
+    else {
+        first = std::min(first, other.first);
+        last  = std::max(last, other.last);
+    }
+}
+
+void DirtySet::reset() {
+    if (!empty()) {
+        const std::uint32_t wordEnd = (last + WordBits - 1) / WordBits;
+        std::fill(words.begin() + first / WordBits, words.begin() + wordEnd, 0);
+    }
+    first = 0;
+    last  = 0;
+}
+
+std::uint32_t DirtySet::dirtyCount() const {
+    if (empty()) { return 0; }
+
+    std::uint32_t count         = 0;
+    const std::uint32_t wordEnd = (last + WordBits - 1) / WordBits;
+    for (std::uint32_t w = first / WordBits; w < wordEnd; ++w) { count += std::popcount(words[w]); }
+    return count;
+}
+
+void DirtySet::getRanges(std::vector<DirtyRange>& result) const {
+    result.clear();
+    forEachRange([&result](const DirtyRange& range) { result.emplace_back(range); });
+}
+
+} // namespace buf
+} // namespace rc
+} // namespace bl
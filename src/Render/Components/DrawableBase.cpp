@@ -17,6 +17,7 @@ DrawableBase::DrawableBase()
 , renderComponent(nullptr)
 , material(nullptr)
 , pipelineSpecialization(0)
+, cullBounds(0.f, 0.f, 0.f, -1.f)
 , hidden(false) {}
 
 DrawableBase::~DrawableBase() {
@@ -27,10 +28,20 @@ void DrawableBase::init(com::MaterialInstance* m) { material = m; }
 
 void DrawableBase::setHidden(bool hide) { hidden = hide; }
 
+void DrawableBase::setCullBounds(const glm::vec3& center, float radius) {
+    cullBounds = glm::vec4(center, radius);
+}
+
+void DrawableBase::clearCullBounds() { cullBounds.w = -1.f; }
+
 void DrawableBase::rebucket() {
     if (sceneRef.scene) { sceneRef.scene->rebucketObject(*this); }
 }
 
+void DrawableBase::notifyDrawParametersChanged() {
+    if (sceneRef.scene) { sceneRef.scene->updateObjectGeometry(*this); }
+}
+
 void DrawableBase::setContainsTransparency(bool t) {
     if (containsTransparency != t) {
         containsTransparency = t;
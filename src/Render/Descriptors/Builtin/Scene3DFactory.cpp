@@ -16,7 +16,7 @@ void Scene3DFactory::init(engine::Engine&, Renderer& r) {
     vulkanState = &r.vulkanState();
 
     vk::DescriptorPool::SetBindingInfo bindingInfo;
-    bindingInfo.bindingCount = 5;
+    bindingInfo.bindingCount = 9;
 
     // camera info
     bindingInfo.bindings[0].binding         = 0;
@@ -24,7 +24,7 @@ void Scene3DFactory::init(engine::Engine&, Renderer& r) {
     bindingInfo.bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     bindingInfo.bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 
-    // sunlight & spot lights & point lights & global lighting
+    // sunlight & shadow casting lights & global lighting
     bindingInfo.bindings[1].descriptorCount = 1;
     bindingInfo.bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     bindingInfo.bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -44,6 +44,26 @@ void Scene3DFactory::init(engine::Engine&, Renderer& r) {
     bindingInfo.bindings[4].descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     bindingInfo.bindings[4].stageFlags      = VK_SHADER_STAGE_FRAGMENT_BIT;
 
+    // point lights
+    bindingInfo.bindings[5].descriptorCount = 1;
+    bindingInfo.bindings[5].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindingInfo.bindings[5].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    // spot lights
+    bindingInfo.bindings[6].descriptorCount = 1;
+    bindingInfo.bindings[6].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindingInfo.bindings[6].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    // light clusters
+    bindingInfo.bindings[7].descriptorCount = 1;
+    bindingInfo.bindings[7].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindingInfo.bindings[7].stageFlags      = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    // clustered light indices
+    bindingInfo.bindings[8].descriptorCount = 1;
+    bindingInfo.bindings[8].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindingInfo.bindings[8].stageFlags      = VK_SHADER_STAGE_FRAGMENT_BIT;
+
     descriptorSetLayout = r.getDescriptorPool().createLayout(bindingInfo);
 }
 
@@ -5,10 +5,12 @@
 #include <BLIB/Render/Graph/Assets/ShadowMapAsset.hpp>
 #include <BLIB/Render/Graph/Purpose.hpp>
 #include <BLIB/Render/Lighting/Scene3DLighting.hpp>
+#include <BLIB/Render/RenderTarget.hpp>
 #include <BLIB/Render/Renderer.hpp>
 #include <BLIB/Render/Scenes/Scene3D.hpp>
 #include <BLIB/Render/Scenes/SceneRenderContext.hpp>
 #include <array>
+#include <bit>
 
 namespace bl
 {
@@ -16,13 +18,26 @@ namespace rc
 {
 namespace dsi
 {
+namespace
+{
+// grid size, depth slice params, and viewport are stored before the clusters
+constexpr std::uint32_t ClusterHeaderSize    = 3;
+constexpr std::uint32_t FirstStorageBinding  = 5;
+constexpr std::uint32_t ClusterIndexCapacity = 1024;
+} // namespace
+
 Scene3DInstance::Scene3DInstance(Renderer& renderer, VkDescriptorSetLayout layout)
 : DescriptorSetInstance(Bindless, SpeedAgnostic)
 , renderer(renderer)
 , setLayout(layout)
 , shadowMaps(nullptr)
 , ssaoBuffer(nullptr)
-, deferredImageUpdates(0) {}
+, deferredImageUpdates(0)
+, owner(nullptr)
+, lighting(nullptr)
+, pointLightBuffer(nullptr)
+, spotLightBuffer(nullptr)
+, boundStorageBuffers{} {}
 
 Scene3DInstance::~Scene3DInstance() { allocHandle.release(descriptorSets.rawData()); }
 
@@ -68,6 +83,16 @@ void Scene3DInstance::init(ds::InitContext& ctx) {
     ssaoBuffer = ctx.observerShaderResources.getShaderResourceWithKey(
         rgi::makeShaderResourceKey<rgi::SSAOShaderResource>(
             rg::AssetTags::SSAOBuffer, rgi::Purpose::SSAOBuffer, 0));
+    pointLightBuffer = ctx.sceneShaderResources.getShaderResourceWithKey(sri::Scene3DPointLightsKey);
+    spotLightBuffer  = ctx.sceneShaderResources.getShaderResourceWithKey(sri::Scene3DSpotLightsKey);
+
+    owner                 = &ctx.owner;
+    scene::Scene3D* scene = dynamic_cast<scene::Scene3D*>(&ctx.scene);
+    lighting              = scene ? &scene->getLighting() : nullptr;
+    clusterBuffer.create(renderer, ClusterHeaderSize + lightClusters.clusterCount());
+    clusterBuffer.transferEveryFrame();
+    clusterIndexBuffer.create(renderer, ClusterIndexCapacity);
+    clusterIndexBuffer.transferEveryFrame();
 
     emptySpotShadowMap.create(
         renderer,
@@ -142,6 +167,9 @@ void Scene3DInstance::init(ds::InitContext& ctx) {
     }
 
     setWriter.performWrite(renderer.vulkanState().getDevice());
+    for (std::uint32_t j = 0; j < cfg::Limits::MaxConcurrentFrames; ++j) {
+        updateStorageDescriptors(j);
+    }
 
     cameraBuffer->getBuffer().transferEveryFrame();
     cameraBuffer->getBuffer().setCopyFullRange(true);
@@ -218,6 +246,73 @@ void Scene3DInstance::updateImageDescriptors(unsigned int frameIndex) {
     setWriter.performWrite(renderer.vulkanState().getDevice());
 }
 
+void Scene3DInstance::updateStorageDescriptors(unsigned int frameIndex) {
+    // storage buffers may be recreated when they grow
+    const std::array<VkBuffer, 4> buffers = {pointLightBuffer->getBuffer().getRawBuffer(frameIndex),
+                                             spotLightBuffer->getBuffer().getRawBuffer(frameIndex),
+                                             clusterBuffer.getRawBuffer(frameIndex),
+                                             clusterIndexBuffer.getRawBuffer(frameIndex)};
+    if (buffers == boundStorageBuffers[frameIndex]) { return; }
+    boundStorageBuffers[frameIndex] = buffers;
+
+    ds::SetWriteHelper setWriter;
+    setWriter.hintWriteCount(buffers.size());
+    setWriter.hintBufferInfoCount(buffers.size());
+
+    const auto set = descriptorSets.getRaw(frameIndex);
+    for (std::uint32_t i = 0; i < buffers.size(); ++i) {
+        VkDescriptorBufferInfo& bufferInfo = setWriter.getNewBufferInfo();
+        bufferInfo.buffer                  = buffers[i];
+        bufferInfo.offset                  = 0;
+        bufferInfo.range                   = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet& write = setWriter.getNewSetWrite(set);
+        write.descriptorCount       = 1;
+        write.dstBinding            = FirstStorageBinding + i;
+        write.dstArrayElement       = 0;
+        write.pBufferInfo           = &bufferInfo;
+        write.descriptorType        = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    }
+
+    setWriter.performWrite(renderer.vulkanState().getDevice());
+}
+
+void Scene3DInstance::updateLightClusters() {
+    cam::Camera* camera = owner->getCurrentCamera();
+    if (!lighting || !camera) { return; }
+
+    const VkViewport& viewport = owner->getViewport();
+    lightClusters.setProjection(
+        camera->getProjectionMatrix(viewport), camera->nearPlane(), camera->farPlane());
+    lightClusters.build(camera->getViewMatrix(),
+                        lighting->getPointLightBounds(),
+                        lighting->getSpotLightBounds());
+
+    const auto& grid     = lightClusters.getGrid();
+    const auto& clusters = lightClusters.getClusters();
+    clusterBuffer.ensureSize(ClusterHeaderSize + clusters.size());
+    clusterBuffer[0] = {grid.tilesX, grid.tilesY, grid.depthSlices, 0};
+    clusterBuffer[1] = {std::bit_cast<std::uint32_t>(lightClusters.getSliceScale()),
+                        std::bit_cast<std::uint32_t>(lightClusters.getSliceBias()),
+                        0,
+                        0};
+    clusterBuffer[2] = {std::bit_cast<std::uint32_t>(viewport.x),
+                        std::bit_cast<std::uint32_t>(viewport.y),
+                        std::bit_cast<std::uint32_t>(viewport.width),
+                        std::bit_cast<std::uint32_t>(viewport.height)};
+    for (std::uint32_t i = 0; i < clusters.size(); ++i) {
+        clusterBuffer[ClusterHeaderSize + i] = clusters[i];
+    }
+    clusterBuffer.markDirty(0, ClusterHeaderSize + clusters.size());
+
+    const auto& indices = lightClusters.getLightIndices();
+    if (!indices.empty()) {
+        clusterIndexBuffer.ensureSize(indices.size());
+        for (std::uint32_t i = 0; i < indices.size(); ++i) { clusterIndexBuffer[i] = indices[i]; }
+        clusterIndexBuffer.markDirty(0, indices.size());
+    }
+}
+
 void Scene3DInstance::process(const event::ShadowMapsInvalidated& e) {
     if (shadowMaps == e.maps) { deferredImageUpdates = 1 << cfg::Limits::MaxConcurrentFrames; }
 }
@@ -250,6 +345,9 @@ void Scene3DInstance::updateDescriptors() {
         for (unsigned int j = 0; j < 6; ++j) { cam.viewProj[j] = light.viewProjectionMatrices[j]; }
     }
 
+    updateLightClusters();
+    updateStorageDescriptors(renderer.vulkanState().currentFrameIndex());
+
     if (deferredImageUpdates != 0) {
         deferredImageUpdates = deferredImageUpdates << 1;
         updateImageDescriptors(renderer.vulkanState().currentFrameIndex());
@@ -0,0 +1,121 @@
+#include <BLIB/Render/Graph/AliasingPlan.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace bl
+{
+namespace rc
+{
+namespace rg
+{
+namespace
+{
+VkDeviceSize alignUp(VkDeviceSize size, VkDeviceSize alignment) {
+    return alignment > 1 ? (size + alignment - 1) / alignment * alignment : size;
+}
+} // namespace
+
+VkDeviceSize AliasingPlan::pack(VkMemoryRequirements& packed, const VkMemoryRequirements& next) {
+    const VkDeviceSize offset = alignUp(packed.size, next.alignment);
+    packed.size               = offset + next.size;
+    packed.alignment          = std::max(packed.alignment, next.alignment);
+    packed.memoryTypeBits &= next.memoryTypeBits;
+    return offset;
+}
+
+void AliasingPlan::clear() {
+    entries.clear();
+    slots.clear();
+}
+
+void AliasingPlan::addAsset(const GraphAsset* asset, const VkMemoryRequirements& requirements,
+                            unsigned int firstStep, unsigned int lastStep) {
+    entries.emplace_back(Entry{asset, requirements, firstStep, lastStep, NotAliased});
+}
+
+bool AliasingPlan::Entry::overlaps(const Entry& other) const {
+    return firstStep <= other.lastStep && other.firstStep <= lastStep;
+}
+
+void AliasingPlan::build() {
+    slots.clear();
+
+    std::vector<std::uint32_t> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::uint32_t l, std::uint32_t r) {
+        return entries[l].requirements.size > entries[r].requirements.size;
+    });
+
+    for (const std::uint32_t i : order) {
+        Entry& entry = entries[i];
+
+        // pick the compatible slot that grows the least
+        std::uint32_t best      = NotAliased;
+        VkDeviceSize bestGrowth = 0;
+        for (std::uint32_t s = 0; s < slots.size(); ++s) {
+            const Slot& slot = slots[s];
+            if ((slot.memoryTypeBits & entry.requirements.memoryTypeBits) == 0) { continue; }
+
+            const bool overlaps =
+                std::any_of(slot.members.begin(), slot.members.end(), [this, &entry](auto m) {
+                    return entries[m].overlaps(entry);
+                });
+            if (overlaps) { continue; }
+
+            const VkDeviceSize alignment = std::max(slot.alignment, entry.requirements.alignment);
+            const VkDeviceSize needed    = std::max(slot.size, entry.requirements.size);
+            const VkDeviceSize growth    = alignUp(needed, alignment) - slot.size;
+            if (best == NotAliased || growth < bestGrowth) {
+                best       = s;
+                bestGrowth = growth;
+            }
+        }
+
+        if (best == NotAliased) {
+            best = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back(Slot{0, 1, entry.requirements.memoryTypeBits, {}});
+        }
+
+        Slot& slot     = slots[best];
+        slot.alignment = std::max(slot.alignment, entry.requirements.alignment);
+        slot.size      = alignUp(std::max(slot.size, entry.requirements.size), slot.alignment);
+        slot.memoryTypeBits &= entry.requirements.memoryTypeBits;
+        slot.members.emplace_back(i);
+        entry.slot = best;
+    }
+}
+
+std::uint32_t AliasingPlan::getSlot(const GraphAsset* asset) const {
+    for (const Entry& entry : entries) {
+        if (entry.asset == asset) { return entry.slot; }
+    }
+    return NotAliased;
+}
+
+std::uint32_t AliasingPlan::getSlotCount() const {
+    return static_cast<std::uint32_t>(slots.size());
+}
+
+VkDeviceSize AliasingPlan::getSlotSize(std::uint32_t slot) const { return slots[slot].size; }
+
+VkMemoryRequirements AliasingPlan::getSlotRequirements(std::uint32_t slot) const {
+    const Slot& s = slots[slot];
+    return VkMemoryRequirements{s.size, s.alignment, s.memoryTypeBits};
+}
+
+VkDeviceSize AliasingPlan::getUnaliasedSize() const {
+    VkDeviceSize total = 0;
+    for (const Entry& entry : entries) { total += entry.requirements.size; }
+    return total;
+}
+
+VkDeviceSize AliasingPlan::getAliasedSize() const {
+    VkDeviceSize total = 0;
+    for (const Slot& slot : slots) { total += slot.size; }
+    return total;
+}
+
+} // namespace rg
+} // namespace rc
+} // namespace bl
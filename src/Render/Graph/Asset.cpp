@@ -109,6 +109,14 @@ void Asset::reset() {
 
 void Asset::onResize(glm::u32vec2) {}
 
+VkMemoryRequirements Asset::getTransientMemoryRequirements() const {
+    return VkMemoryRequirements{0, 1, 0};
+}
+
+void Asset::bindTransientMemory(VmaAllocation, VkDeviceSize) {}
+
+void Asset::releaseTransientMemory() {}
+
 } // namespace rg
 } // namespace rc
 } // namespace bl
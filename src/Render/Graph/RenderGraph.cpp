@@ -212,6 +212,8 @@ bool RenderGraph::needsRepopulation() const {
            (strategy && strategyVersion != strategy->getVersion());
 }
 
+bool RenderGraph::needsBuild() const { return needsRebuild; }
+
 void RenderGraph::createTask(Task* task) {
     const rg::InitContext ctx{engine, renderer, renderer.vulkanState(), *observer, scene};
     task->create(ctx);
@@ -1,10 +1,14 @@
 #include <BLIB/Render/Graph/Timeline.hpp>
 
+#include <BLIB/Logging.hpp>
 #include <BLIB/Render/Graph/Asset.hpp>
 #include <BLIB/Render/Graph/ExecutionContext.hpp>
 #include <BLIB/Render/Graph/GraphAssetPool.hpp>
 #include <BLIB/Render/Graph/Task.hpp>
 #include <BLIB/Render/Renderer.hpp>
+#include <BLIB/Render/Vulkan/VkCheck.hpp>
+#include <BLIB/Util/Profiler.hpp>
+#include <algorithm>
 #include <limits>
 #include <queue>
 #include <unordered_map>
@@ -32,6 +36,12 @@ struct VisitorStep {
     , step(s) {}
 };
 
+struct AssetLifetime {
+    GraphAsset* asset;
+    unsigned int firstStep;
+    unsigned int lastStep;
+};
+
 } // namespace
 
 Timeline::TaskGroup::TaskGroup(GraphAsset* output)
@@ -52,7 +62,13 @@ Timeline::Timeline(engine::Engine& engine, Renderer& renderer, RenderTarget* tar
     emitter.connect(renderer.getSignalChannel());
 }
 
+Timeline::~Timeline() {
+    for (Asset* asset : aliasedAssets) { asset->releaseTransientMemory(); }
+    freeTransientMemory(transientMemory);
+}
+
 void Timeline::execute(const ExecutionContext& ctx) {
+    BL_PROFILE_SCOPE("rg::Timeline::execute");
     for (auto& stage : timeline) { stage.execute(ctx); }
 }
 
@@ -68,7 +84,10 @@ void Timeline::TimelineStage::execute(const ExecutionContext& ctx) {
 
 void Timeline::TaskGroup::execute(const ExecutionContext& ctx) {
     output->asset->startOutput(ctx);
-    for (auto& task : tasks) { task.first->execute(ctx, &output->asset.get()); }
+    for (auto& task : tasks) {
+        BL_PROFILE_SCOPE(task.first->getId());
+        task.first->execute(ctx, &output->asset.get());
+    }
     output->asset->endOutput(ctx);
 }
 
@@ -179,6 +198,104 @@ void Timeline::build(std::vector<std::unique_ptr<Task>>& tasks, GraphAsset* fina
             group->addTask(task.get(), task->assetTags.outputs[i++].order);
         }
     }
+
+    planAliasing();
+}
+
+void Timeline::planAliasing() {
+    aliasing.clear();
+
+    std::vector<AssetLifetime> lifetimes;
+    const auto use = [&lifetimes](GraphAsset* asset, unsigned int step) {
+        for (AssetLifetime& lifetime : lifetimes) {
+            if (lifetime.asset == asset) {
+                lifetime.firstStep = std::min(lifetime.firstStep, step);
+                lifetime.lastStep  = std::max(lifetime.lastStep, step);
+                return;
+            }
+        }
+        lifetimes.emplace_back(AssetLifetime{asset, step, step});
+    };
+
+    for (unsigned int step = 0; step < timeline.size(); ++step) {
+        for (TaskGroup& group : timeline[step].taskGroups) {
+            use(group.output, step);
+            for (auto& task : group.tasks) {
+                for (GraphAsset* input : task.first->assets.requiredInputs) { use(input, step); }
+                for (GraphAsset* input : task.first->assets.optionalInputs) {
+                    if (input) { use(input, step); }
+                }
+            }
+        }
+    }
+
+    // only assets that live entirely within this graph's frame may share memory
+    std::vector<GraphAsset*> planned;
+    for (const AssetLifetime& lifetime : lifetimes) {
+        const Asset& asset = lifetime.asset->asset.get();
+        if (asset.isExternal() || asset.isTerminal() || asset.owners.size() > 1) { continue; }
+
+        const VkMemoryRequirements requirements = asset.getTransientMemoryRequirements();
+        if (requirements.size == 0) { continue; }
+        aliasing.addAsset(lifetime.asset, requirements, lifetime.firstStep, lifetime.lastStep);
+        planned.emplace_back(lifetime.asset);
+    }
+    aliasing.build();
+    bindTransientMemory(planned);
+
+    if (aliasing.getSlotCount() > 0) {
+        BL_LOG_DEBUG << "Render graph transient memory: " << aliasing.getUnaliasedSize()
+                     << " bytes unaliased, " << aliasing.getAliasedSize() << " bytes in "
+                     << aliasing.getSlotCount() << " aliased slots";
+    }
+}
+
+void Timeline::bindTransientMemory(const std::vector<GraphAsset*>& planned) {
+    std::vector<VmaAllocation> previousMemory = std::move(transientMemory);
+    std::vector<Asset*> previousAssets        = std::move(aliasedAssets);
+    transientMemory.clear();
+    aliasedAssets.clear();
+
+    // the plan is still built without a device so that it may be inspected
+    if (renderer.vulkanState().isInitialized()) {
+        VmaAllocationCreateInfo allocInfo{};
+        allocInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        allocInfo.flags         = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+
+        transientMemory.resize(aliasing.getSlotCount(), nullptr);
+        for (std::uint32_t slot = 0; slot < aliasing.getSlotCount(); ++slot) {
+            const VkMemoryRequirements requirements = aliasing.getSlotRequirements(slot);
+            vkCheck(vmaAllocateMemory(renderer.vulkanState().getVmaAllocator(),
+                                      &requirements,
+                                      &allocInfo,
+                                      &transientMemory[slot],
+                                      nullptr));
+        }
+
+        for (GraphAsset* graphAsset : planned) {
+            Asset* asset = &graphAsset->asset.get();
+            asset->bindTransientMemory(transientMemory[aliasing.getSlot(graphAsset)], 0);
+            aliasedAssets.emplace_back(asset);
+        }
+    }
+
+    // assets that are no longer aliased must leave the old memory before it is freed
+    for (Asset* asset : previousAssets) {
+        if (std::find(aliasedAssets.begin(), aliasedAssets.end(), asset) == aliasedAssets.end()) {
+            asset->releaseTransientMemory();
+        }
+    }
+    freeTransientMemory(previousMemory);
+}
+
+void Timeline::freeTransientMemory(std::vector<VmaAllocation>& memory) {
+    // images placed in the memory are destroyed with the same deferral
+    for (VmaAllocation allocation : memory) {
+        renderer.getCleanupManager().add([vs = &renderer.vulkanState(), allocation]() {
+            vmaFreeMemory(vs->getVmaAllocator(), allocation);
+        });
+    }
+    memory.clear();
 }
 
 Timeline::TaskGroup* Timeline::TimelineStage::getGroupForAsset(GraphAsset* asset) {
@@ -0,0 +1,150 @@
+#include <BLIB/Render/Lighting/LightClusters.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace bl
+{
+namespace rc
+{
+namespace lgt
+{
+namespace
+{
+constexpr float MinNearPlane = 0.0001f;
+
+float distanceToRange(float v, float lo, float hi) {
+    return v < lo ? lo - v : (v > hi ? v - hi : 0.f);
+}
+} // namespace
+
+LightClusters::LightClusters(const Grid& grid)
+: grid(grid)
+, nearPlane(MinNearPlane)
+, farPlane(1.f)
+, sliceScale(0.f)
+, sliceBias(0.f) {
+    clusters.resize(clusterCount(), Cluster{});
+}
+
+void LightClusters::setProjection(const glm::mat4& projection, float np, float fp) {
+    nearPlane = std::max(np, MinNearPlane);
+    farPlane  = std::abs(fp);
+    if (farPlane <= nearPlane) { farPlane = nearPlane + 1.f; }
+
+    const float logRatio = std::log(farPlane / nearPlane);
+    sliceScale           = static_cast<float>(grid.depthSlices) / logRatio;
+    sliceBias            = -static_cast<float>(grid.depthSlices) * std::log(nearPlane) / logRatio;
+
+    sliceDepths.resize(grid.depthSlices + 1);
+    for (std::uint32_t z = 0; z <= grid.depthSlices; ++z) {
+        const float t  = static_cast<float>(z) / static_cast<float>(grid.depthSlices);
+        sliceDepths[z] = nearPlane * std::pow(farPlane / nearPlane, t);
+    }
+
+    // view space x / depth for an ndc coordinate: (ndc + P[2][0]) / P[0][0]. Same for y
+    const auto computeSlopes = [](std::vector<glm::vec2>& slopes, std::uint32_t count, float scale,
+                                  float offset) {
+        slopes.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const float ndcLo = -1.f + 2.f * static_cast<float>(i) / static_cast<float>(count);
+            const float ndcHi = -1.f + 2.f * static_cast<float>(i + 1) / static_cast<float>(count);
+            const float a     = (ndcLo + offset) / scale;
+            const float b     = (ndcHi + offset) / scale;
+            slopes[i]         = {std::min(a, b), std::max(a, b)};
+        }
+    };
+    computeSlopes(columnSlopes, grid.tilesX, projection[0][0], projection[2][0]);
+    computeSlopes(rowSlopes, grid.tilesY, projection[1][1], projection[2][1]);
+}
+
+void LightClusters::build(const glm::mat4& view, std::span<const glm::vec4> pointLights,
+                          std::span<const glm::vec4> spotLights) {
+    clusters.assign(clusterCount(), Cluster{});
+    pointPairs.clear();
+    spotPairs.clear();
+    if (!sliceDepths.empty()) {
+        assign(view, pointLights, pointPairs);
+        assign(view, spotLights, spotPairs);
+    }
+
+    for (const auto& pair : pointPairs) { ++clusters[pair.first].pointCount; }
+    for (const auto& pair : spotPairs) { ++clusters[pair.first].spotCount; }
+
+    std::uint32_t offset = 0;
+    for (Cluster& cluster : clusters) {
+        cluster.offset = offset;
+        offset += cluster.pointCount + cluster.spotCount;
+    }
+    indices.resize(offset);
+
+    // padding is used as the write cursor then reset
+    for (const auto& pair : pointPairs) {
+        Cluster& cluster                            = clusters[pair.first];
+        indices[cluster.offset + cluster.padding++] = pair.second;
+    }
+    for (Cluster& cluster : clusters) { cluster.padding = cluster.pointCount; }
+    for (const auto& pair : spotPairs) {
+        Cluster& cluster                            = clusters[pair.first];
+        indices[cluster.offset + cluster.padding++] = pair.second;
+    }
+    for (Cluster& cluster : clusters) { cluster.padding = 0; }
+}
+
+void LightClusters::assign(const glm::mat4& view, std::span<const glm::vec4> lights,
+                           std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs) {
+    for (std::uint32_t li = 0; li < lights.size(); ++li) {
+        const float radius = lights[li].w;
+        if (radius <= 0.f) { continue; }
+
+        const glm::vec4 center = view * glm::vec4(glm::vec3(lights[li]), 1.f);
+        const float depth      = -center.z;
+        if (depth + radius < nearPlane || depth - radius > farPlane) { continue; }
+
+        const float r2             = radius * radius;
+        const std::uint32_t zBegin = getDepthSlice(depth - radius);
+        const std::uint32_t zEnd   = getDepthSlice(depth + radius);
+        for (std::uint32_t z = zBegin; z <= zEnd; ++z) {
+            const float dn  = sliceDepths[z];
+            const float df  = sliceDepths[z + 1];
+            const float dz  = distanceToRange(depth, dn, df);
+            const float rz2 = r2 - dz * dz;
+            if (rz2 < 0.f) { continue; }
+
+            for (std::uint32_t y = 0; y < grid.tilesY; ++y) {
+                const glm::vec2& s = rowSlopes[y];
+                const float dy     = distanceToRange(
+                    center.y, std::min(s.x * dn, s.x * df), std::max(s.y * dn, s.y * df));
+                const float ryz2 = rz2 - dy * dy;
+                if (ryz2 < 0.f) { continue; }
+
+                for (std::uint32_t x = 0; x < grid.tilesX; ++x) {
+                    const glm::vec2& c = columnSlopes[x];
+                    const float dx     = distanceToRange(
+                        center.x, std::min(c.x * dn, c.x * df), std::max(c.y * dn, c.y * df));
+                    if (dx * dx <= ryz2) { pairs.emplace_back(getClusterIndex(x, y, z), li); }
+                }
+            }
+        }
+    }
+}
+
+std::uint32_t LightClusters::getClusterIndex(const glm::vec2& ndc, float viewDepth) const {
+    const auto tile = [](float v, std::uint32_t count) {
+        const float t = std::floor((v + 1.f) * 0.5f * static_cast<float>(count));
+        return static_cast<std::uint32_t>(std::clamp(t, 0.f, static_cast<float>(count - 1)));
+    };
+    return getClusterIndex(
+        tile(ndc.x, grid.tilesX), tile(ndc.y, grid.tilesY), getDepthSlice(viewDepth));
+}
+
+std::uint32_t LightClusters::getDepthSlice(float viewDepth) const {
+    if (viewDepth <= nearPlane) { return 0; }
+    const float slice = std::floor(std::log(viewDepth) * sliceScale + sliceBias);
+    return static_cast<std::uint32_t>(
+        std::clamp(slice, 0.f, static_cast<float>(grid.depthSlices - 1)));
+}
+
+} // namespace lgt
+} // namespace rc
+} // namespace bl
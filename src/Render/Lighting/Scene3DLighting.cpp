@@ -9,15 +9,25 @@ namespace rc
 {
 namespace lgt
 {
-Scene3DLighting::Scene3DLighting(LightingDescriptor3D& uniform)
+namespace
+{
+constexpr std::size_t LightCapacityHint = 128;
+}
+
+Scene3DLighting::Scene3DLighting(LightingDescriptor3D& uniform, PointLightStorage3D& pointStorage,
+                                 SpotLightStorage3D& spotStorage)
 : uniform(uniform)
-, spotLights(cfg::Limits::MaxSpotLights)
-, spotShadows(cfg::Limits::MaxSpotShadows)
-, pointLights(cfg::Limits::MaxPointLights)
-, pointShadows(cfg::Limits::MaxPointShadows)
+, pointStorage(pointStorage)
+, spotStorage(spotStorage)
+, spotLights(0, LightCapacityHint)
+, spotShadows(cfg::Limits::MaxSpotShadows, cfg::Limits::MaxSpotShadows)
+, pointLights(0, LightCapacityHint)
+, pointShadows(cfg::Limits::MaxPointShadows, cfg::Limits::MaxPointShadows)
 , sceneCenter(0.f, 0.f, 0.f)
 , sunDistance(10.f) {
     uniform = LightingDescriptor3D();
+    pointStorage.transferEveryFrame();
+    spotStorage.transferEveryFrame();
 }
 
 glm::vec3 Scene3DLighting::getAmbientLightColor() const { return uniform.globalAmbient; }
@@ -37,19 +47,26 @@ void Scene3DLighting::removeLight(const SpotLightHandle& l) { spotLights.remove(
 void Scene3DLighting::removeLight(const SpotLightShadowHandle& l) { spotShadows.remove(l); }
 
 void Scene3DLighting::sync() {
-    // TODO - consider allowing more lights then only copying a subset via culling
     updateSunCameraMatrix();
     uniform.nPointLights  = getPointLightCount();
     uniform.nSpotLights   = getSpotLightCount();
     uniform.nSpotShadows  = getSpotShadowCount();
     uniform.nPointShadows = getPointShadowCount();
 
-    spotLights.copyToUniformBuffer(uniform.spotlights.data());
+    spotLights.copyToStorage(spotStorage);
     spotShadows.copyToUniformBuffer(uniform.spotlightsWithShadows.data());
-    pointLights.copyToUniformBuffer(uniform.pointLights.data());
+    pointLights.copyToStorage(pointStorage);
     pointShadows.copyToUniformBuffer(uniform.pointLightsWithShadows.data());
 }
 
+glm::vec4 Scene3DLighting::computeBounds(const PointLight3D& light) {
+    return {light.pos, light.attenuation.radius};
+}
+
+glm::vec4 Scene3DLighting::computeBounds(const SpotLight3D& light) {
+    return {light.pos, light.attenuation.radius};
+}
+
 void Scene3DLighting::addIndex(std::vector<std::uint32_t>& vec, std::uint32_t i) {
     vec.insert(std::lower_bound(vec.begin(), vec.end(), i), i);
 }
@@ -44,7 +44,8 @@ RenderTarget::RenderTarget(engine::Engine& e, Renderer& r, rg::AssetFactory& f,
 , descriptorFactories(renderer.descriptorFactoryCache())
 , shaderResources(e, *this)
 , resourcesFreed(false)
-, renderingTo(nullptr) {
+, renderingTo(nullptr)
+, lastRecordTime(0) {
     viewport.minDepth = 0.f;
     viewport.maxDepth = 1.f;
 
@@ -267,6 +268,7 @@ void RenderTarget::setCamera(std::unique_ptr<cam::Camera>&& cam) {
 }
 
 void RenderTarget::renderScene(VkCommandBuffer commandBuffer) {
+    const auto startTime = std::chrono::steady_clock::now();
     if (hasScene()) {
         auto& currentScene = scenes.back();
 #ifdef BLIB_DEBUG
@@ -277,10 +279,15 @@ void RenderTarget::renderScene(VkCommandBuffer commandBuffer) {
 
         currentScene.graph.execute(commandBuffer, currentScene.observerIndex, isRenderTexture);
     }
+    lastRecordTime = std::chrono::steady_clock::now() - startTime;
 }
 
 void RenderTarget::resetAssets() { graphAssets.startFrame(); }
 
+void RenderTarget::buildGraph() {
+    if (hasScene() && scenes.back().graph.needsBuild()) { scenes.back().graph.build(); }
+}
+
 ds::DescriptorSetInstanceCache* RenderTarget::getDescriptorSetCache(Scene* scene) {
     for (auto& s : scenes) {
         if (s.scene.get() == scene) { return &s.descriptorCache; }
@@ -1,5 +1,6 @@
 #include <BLIB/Render/Renderer.hpp>
 
+#include <BLIB/Components/Transform3D.hpp>
 #include <BLIB/Engine/Engine.hpp>
 #include <BLIB/Render/Config/RenderPassIds.hpp>
 #include <BLIB/Render/Graph/AssetTags.hpp>
@@ -16,7 +17,10 @@
 #include <BLIB/Render/Overlays/Overlay.hpp>
 #include <BLIB/Render/Scenes/Scene2D.hpp>
 #include <BLIB/Render/Scenes/Scene3D.hpp>
+#include <BLIB/Render/Vulkan/VkCheck.hpp>
 #include <BLIB/Systems.hpp>
+#include <BLIB/Util/Profiler.hpp>
+#include <algorithm>
 #include <cmath>
 
 namespace bl
@@ -38,13 +42,14 @@ Renderer::Renderer(engine::Engine& engine, const CreationSettings& createSetting
 , descriptorSetFactoryCache(engine, *this)
 , renderPasses(*this)
 , pipelineLayouts(*this)
-, pipelines(*this)
+, pipelines(engine, *this, createSettings.getPipelineCacheDirectory())
 , computePipelines(*this)
 , materialPipelines(*this)
 , scenes(engine)
 , imageExporter(*this)
 , splitscreenDirection(SplitscreenDirection::TopAndBottom)
 , commonObserver(engine, *this, assetFactory, true, false)
+, parallelRecording(false)
 , globalShaderResources(engine, commonObserver)
 , sceneSync(engine.ecs()) {
     renderTextures.reserve(16);
@@ -81,6 +86,17 @@ bool Renderer::initialize() {
     engine.systems().registerSystem<sys::SkeletalAnimationSystem>(
         FrameStage::Animate,
         engine::StateMask::Running | engine::StateMask::Menu | engine::StateMask::Editor);
+    engine.systems().registerSystem<sys::TransformHierarchySystem>(
+        FrameStage::TransformPropagation, AllMask);
+
+    // animation only touches its own components. The hierarchy system blocks on the thread pool
+    // and the sync systems touch renderer state so they keep the stage barrier
+    engine.systems().declareAccess<
+        sys::Animation2DSystem,
+        ecs::tx::ComponentRead<com::Transform2D>,
+        ecs::tx::ComponentWrite<com::Animation2DPlayer, com::Animation2D>>();
+    engine.systems().declareAccess<sys::SkeletalAnimationSystem,
+                                   ecs::tx::ComponentWrite<com::Skeleton, com::Transform3D>>();
 
     // create renderer instance data
     state.init();
@@ -92,6 +108,7 @@ bool Renderer::initialize() {
     samplers.init();
     renderPasses.addDefaults();
     globalDescriptors.init();
+    pipelines.init();
     pipelines.createBuiltins();
     computePipelines.createBuiltins();
     materialPipelines.createBuiltins();
@@ -297,6 +314,7 @@ void Renderer::copyDataFromSources() {
 }
 
 void Renderer::renderFrame() {
+    BL_PROFILE_SCOPE("Renderer::renderFrame");
     std::unique_lock lock(renderMutex);
 
     // begin frame
@@ -330,11 +348,14 @@ void Renderer::renderFrame() {
     for (auto& rt : renderTextures) { rt->render(); }
 
     // record commands to render scenes
-    for (auto& o : observers) { o->renderScene(commandBuffer); }
-    if (!virtualObservers.empty()) {
-        for (auto& o : virtualObservers) { o->renderScene(commandBuffer); }
+    if (parallelRecording) { recordObserversInParallel(); }
+    else {
+        for (auto& o : observers) { o->renderScene(commandBuffer); }
+        if (!virtualObservers.empty()) {
+            for (auto& o : virtualObservers) { o->renderScene(commandBuffer); }
+        }
+        if (commonObserver.hasScene()) { commonObserver.renderScene(commandBuffer); }
     }
-    if (commonObserver.hasScene()) { commonObserver.renderScene(commandBuffer); }
 
     // complete frame
     swapchain.completeFrame();
@@ -344,6 +365,77 @@ void Renderer::renderFrame() {
     imageExporter.onFrameEnd();
 }
 
+void Renderer::recordObserversInParallel() {
+    recordTargets.clear();
+    for (auto& o : observers) { recordTargets.emplace_back(o.get()); }
+    for (auto& o : virtualObservers) { recordTargets.emplace_back(o.get()); }
+    if (commonObserver.hasScene()) { recordTargets.emplace_back(&commonObserver); }
+    if (recordTargets.empty()) { return; }
+
+    // targets sharing a scene or overlay share its per-frame draw state and must record serially
+    const auto sharesScene = [](RenderTarget* a, RenderTarget* b) {
+        Scene* as = a->getCurrentScene();
+        Scene* ao = a->getCurrentOverlay();
+        Scene* bs = b->getCurrentScene();
+        Scene* bo = b->getCurrentOverlay();
+        return (as && (as == bs || as == bo)) || (ao && (ao == bs || ao == bo));
+    };
+    const std::uint32_t targetCount = static_cast<std::uint32_t>(recordTargets.size());
+    recordGroups.resize(targetCount);
+    for (std::uint32_t i = 0; i < targetCount; ++i) {
+        recordGroups[i] = i;
+        for (std::uint32_t j = 0; j < i; ++j) {
+            if (!sharesScene(recordTargets[i], recordTargets[j])) { continue; }
+
+            // groups are identified by their first target
+            const std::uint32_t keep  = std::min(recordGroups[i], recordGroups[j]);
+            const std::uint32_t merge = std::max(recordGroups[i], recordGroups[j]);
+            for (std::uint32_t k = 0; k <= i; ++k) {
+                if (recordGroups[k] == merge) { recordGroups[k] = keep; }
+            }
+        }
+
+        // building the graph may create shared assets, so do it before recording
+        recordTargets[i]->buildGraph();
+    }
+
+    // each target records into its own command buffer. submission follows target order
+    VkCommandBuffer* commandBuffers = swapchain.getParallelCommandBuffers(targetCount);
+    const auto recordGroup = [this, commandBuffers, targetCount](std::uint32_t group) {
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        for (std::uint32_t i = 0; i < targetCount; ++i) {
+            if (recordGroups[i] != group) { continue; }
+            if (vkBeginCommandBuffer(commandBuffers[i], &beginInfo) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to begin recording command buffer");
+            }
+            recordTargets[i]->renderScene(commandBuffers[i]);
+            vkCheck(vkEndCommandBuffer(commandBuffers[i]));
+        }
+    };
+
+    // scenes queue culling work to the engine pool while recording, so record on the fast pool
+    util::ThreadPool& threadPool = engine.fastTaskThreadpool();
+    std::vector<std::future<void>> futures;
+    for (std::uint32_t i = 1; i < targetCount; ++i) {
+        if (recordGroups[i] != i) { continue; }
+        if (threadPool.running()) {
+            futures.emplace_back(threadPool.queueTask([&recordGroup, i]() { recordGroup(i); }));
+        }
+        else { recordGroup(i); }
+    }
+    recordGroup(0);
+    for (auto& f : futures) { f.get(); }
+}
+
+void Renderer::setParallelRecordingEnabled(bool enabled) {
+    std::unique_lock lock(renderMutex);
+    parallelRecording = enabled;
+}
+
+bool Renderer::isParallelRecordingEnabled() const { return parallelRecording; }
+
 Observer& Renderer::addObserver() {
     std::unique_lock lock(renderMutex);
 
@@ -452,6 +544,7 @@ CreationSettings Renderer::getCreationSettings() const {
     CreationSettings s;
     s.withGraphicsSettings(settings.graphicsSettings);
     s.withWindowSettings(settings.windowSettings);
+    s.withPipelineCacheDirectory(pipelines.cacheDirectory);
     return s;
 }
 
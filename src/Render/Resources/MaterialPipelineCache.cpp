@@ -102,6 +102,7 @@ void MaterialPipelineCache::createBuiltins() {
     makeOverlayPair(MId::Geometry2DSkinned, PId::LitSkinned2DGeometry, PId::UnlitSkinned2DGeometry);
     makeOverlayPair(MId::Slideshow2D, PId::SlideshowLit, PId::SlideshowUnlit);
     make(MId::Text, PId::Text);
+    make(MId::TextDistanceField, PId::TextDistanceField);
     make(MId::Lines2D, PId::Lines2D);
     createPipeline(
         MId::Skybox,
@@ -1,5 +1,6 @@
 #include <BLIB/Render/Resources/PipelineCache.hpp>
 
+#include <BLIB/Engine/Engine.hpp>
 #include <BLIB/Logging.hpp>
 #include <BLIB/Render/Config/PipelineIds.hpp>
 #include <BLIB/Render/Config/ShaderIds.hpp>
@@ -19,6 +20,11 @@
 #include <BLIB/Render/Primitives/Vertex3D.hpp>
 #include <BLIB/Render/Primitives/Vertex3DSkinned.hpp>
 #include <BLIB/Render/Renderer.hpp>
+#include <BLIB/Render/Vulkan/PipelineCacheFile.hpp>
+#include <BLIB/Render/Vulkan/VkCheck.hpp>
+#include <BLIB/Util/FileUtil.hpp>
+#include <chrono>
+#include <filesystem>
 
 namespace bl
 {
@@ -26,18 +32,70 @@ namespace rc
 {
 namespace res
 {
-PipelineCache::PipelineCache(Renderer& r)
-: renderer(r)
-, nextId(DynamicPipelineIdStart) {
-    // TODO - leverage VkPipelineCache?
+PipelineCache::PipelineCache(engine::Engine& engine, Renderer& r, const std::string& dir)
+: engine(engine)
+, renderer(r)
+, cacheDirectory(dir)
+, nextId(DynamicPipelineIdStart)
+, vulkanCache(nullptr) {}
+
+void PipelineCache::init() {
+    if (cacheDirectory.empty()) {
+        std::error_code ec;
+        const auto temp = std::filesystem::temp_directory_path(ec);
+        if (!ec) { cacheDirectory = util::FileUtil::joinPath(temp.generic_string(), "BLIB"); }
+    }
+
+    const VkPhysicalDeviceProperties& props = vk::VulkanLayer::getPhysicalDeviceProperties();
+    std::vector<char> data;
+    if (!cacheDirectory.empty()) { data = vk::PipelineCacheFile::load(cacheDirectory, props); }
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = data.size();
+    createInfo.pInitialData    = data.empty() ? nullptr : data.data();
+    const VkDevice device = renderer.vulkanState().getDevice();
+    if (vkCreatePipelineCache(device, &createInfo, nullptr, &vulkanCache) != VK_SUCCESS) {
+        BL_LOG_WARN << "Failed to create pipeline cache from saved data, starting empty";
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData    = nullptr;
+        vkCheck(vkCreatePipelineCache(device, &createInfo, nullptr, &vulkanCache));
+    }
+    else if (!data.empty()) { BL_LOG_INFO << "Loaded pipeline cache from " << cacheDirectory; }
 }
 
-void PipelineCache::cleanup() { cache.clear(); }
+void PipelineCache::cleanup() {
+    waitForWarmup();
+    paramLookup.clear();
+    cache.clear();
+
+    if (vulkanCache) {
+        const VkDevice device = renderer.vulkanState().getDevice();
+        std::size_t size      = 0;
+        std::vector<char> data;
+        if (!cacheDirectory.empty() &&
+            vkGetPipelineCacheData(device, vulkanCache, &size, nullptr) == VK_SUCCESS) {
+            data.resize(size);
+            if (vkGetPipelineCacheData(device, vulkanCache, &size, data.data()) == VK_SUCCESS) {
+                data.resize(size);
+                vk::PipelineCacheFile::save(
+                    cacheDirectory, vk::VulkanLayer::getPhysicalDeviceProperties(), data);
+            }
+        }
+        vkDestroyPipelineCache(device, vulkanCache, nullptr);
+        vulkanCache = nullptr;
+    }
+}
 
 vk::Pipeline& PipelineCache::createPipeline(std::uint32_t id, vk::PipelineParameters&& params) {
     const auto insertResult =
         cache.try_emplace(id, renderer, id, std::forward<vk::PipelineParameters>(params));
     if (!insertResult.second) { BL_LOG_WARN << "Pipeline with id " << id << " already exists"; }
+    else {
+        vk::Pipeline& pipeline = insertResult.first->second;
+        paramLookup.emplace(std::hash<vk::PipelineParameters>()(pipeline.getCreationParameters()),
+                            &pipeline);
+    }
     return insertResult.first->second;
 }
 
@@ -55,8 +113,9 @@ bool PipelineCache::pipelineExists(std::uint32_t pid) const {
 }
 
 vk::Pipeline& PipelineCache::getOrCreatePipeline(vk::PipelineParameters&& params) {
-    for (auto& p : cache) {
-        if (p.second.getCreationParameters() == params) { return p.second; }
+    const auto range = paramLookup.equal_range(std::hash<vk::PipelineParameters>()(params));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->getCreationParameters() == params) { return *it->second; }
     }
 
     std::uint32_t newId = nextId;
@@ -65,6 +124,61 @@ vk::Pipeline& PipelineCache::getOrCreatePipeline(vk::PipelineParameters&& params
     return createPipeline(newId, std::forward<vk::PipelineParameters>(params));
 }
 
+void PipelineCache::warmup(const std::vector<WarmupEntry>& entries) {
+    // one task per pipeline, variants of the same pipeline share creation state
+    std::unordered_map<vk::Pipeline*, std::vector<WarmupEntry>> perPipeline;
+    for (const WarmupEntry& entry : entries) {
+        const auto it = cache.find(entry.pipelineId);
+        if (it == cache.end()) {
+            BL_LOG_WARN << "Skipping warm-up of unknown pipeline: " << entry.pipelineId;
+            continue;
+        }
+        perPipeline[&it->second].emplace_back(entry);
+    }
+
+    const auto compile = [](vk::Pipeline* pipeline, const std::vector<WarmupEntry>& variants) {
+        for (const WarmupEntry& variant : variants) {
+            try {
+                pipeline->precompile(variant.renderPassId, variant.specialization);
+            } catch (const std::exception& e) {
+                BL_LOG_ERROR << "Failed to warm up pipeline " << variant.pipelineId << ": "
+                             << e.what();
+            }
+        }
+    };
+
+    util::ThreadPool& pool = engine.slowTaskThreadpool();
+    std::unique_lock lock(warmupMutex);
+    for (auto& pair : perPipeline) {
+        if (!pool.running()) {
+            compile(pair.first, pair.second);
+            continue;
+        }
+        vk::Pipeline* pipeline = pair.first;
+        warmupTasks.emplace_back(
+            pool.queueTask([compile, pipeline, variants = std::move(pair.second)]() {
+                compile(pipeline, variants);
+            }));
+    }
+}
+
+bool PipelineCache::isWarmingUp() {
+    std::unique_lock lock(warmupMutex);
+    std::erase_if(warmupTasks, [](const std::future<void>& task) {
+        return !task.valid() ||
+               task.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+    return !warmupTasks.empty();
+}
+
+void PipelineCache::waitForWarmup() {
+    std::unique_lock lock(warmupMutex);
+    for (std::future<void>& task : warmupTasks) {
+        if (task.valid()) { task.wait(); }
+    }
+    warmupTasks.clear();
+}
+
 void PipelineCache::createBuiltins() {
     VkPipelineDepthStencilStateCreateInfo depthStencilDepthEnabled{};
     depthStencilDepthEnabled.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
@@ -586,6 +700,18 @@ void PipelineCache::createBuiltins() {
                        .addDescriptorSet<dsi::Object2DFactory>()
                        .build());
 
+    createPipeline(cfg::PipelineIds::TextDistanceField,
+                   vk::PipelineParameters()
+                       .withShaders(cfg::ShaderIds::TextDistanceFieldVertex,
+                                    cfg::ShaderIds::TextDistanceFieldFragment)
+                       .withPrimitiveType(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+                       .withRasterizer(rasterizer)
+                       .withDepthStencilState(&depthStencilDepthEnabled)
+                       .addDescriptorSet<dsi::GlobalDataFactory>()
+                       .addDescriptorSet<dsi::Scene2DFactory>()
+                       .addDescriptorSet<dsi::Object2DFactory>()
+                       .build());
+
     createPipeline(
         cfg::PipelineIds::SlideshowLit,
         vk::PipelineParameters()
@@ -17,6 +17,8 @@ namespace rc
 namespace res
 {
 VkShaderModule ShaderModuleCache::loadShader(const std::string& path) {
+    std::unique_lock lock(mutex);
+
     const auto it = cache.find(path);
     if (it != cache.end()) { return it->second; }
 
@@ -111,6 +113,10 @@ VkShaderModule ShaderModuleCache::loadShader(const std::string& path) {
             return loadShader(BUILTIN_SHADER("2D/text.frag.spv"));
         case cfg::ShaderIds::SlideshowVert[0]:
             return loadShader(BUILTIN_SHADER("2D/slideshow.vert.spv"));
+        case cfg::ShaderIds::TextDistanceFieldVertex[0]:
+            return loadShader(BUILTIN_SHADER("2D/textDistanceField.vert.spv"));
+        case cfg::ShaderIds::TextDistanceFieldFragment[0]:
+            return loadShader(BUILTIN_SHADER("2D/textDistanceField.frag.spv"));
 
         case cfg::ShaderIds::AutoExposureAccumulate[0]:
             return loadShader(BUILTIN_SHADER("3D/AutoExposure/accumulate.comp.spv"));
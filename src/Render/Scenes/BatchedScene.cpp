@@ -5,7 +5,13 @@
 #include <BLIB/Logging.hpp>
 #include <BLIB/Render/Config/Constants.hpp>
 #include <BLIB/Render/Config/Limits.hpp>
+#include <BLIB/Render/Descriptors/Builtin/Object3DFactory.hpp>
+#include <BLIB/Render/Descriptors/Builtin/Object3DSkinnedFactory.hpp>
 #include <BLIB/Render/Renderer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
 
 namespace bl
 {
@@ -13,15 +19,69 @@ namespace rc
 {
 namespace scene
 {
+namespace
+{
+constexpr std::size_t MinParallelIndirectCount  = 4096;
+constexpr VkDeviceSize InitialIndirectBufferSize = 64 * 1024;
+constexpr std::uint32_t NoIndirectFrame          = std::numeric_limits<std::uint32_t>::max();
+constexpr std::uint32_t NoSortState              = std::numeric_limits<std::uint32_t>::max();
+
+static_assert(cfg::Limits::MaxPipelineSpecializations <= DrawSortKey::MaxSpecialization + 1,
+              "Specialization indices must fit in draw sort keys");
+
+std::uint32_t sortValue(const Key& key) {
+    return (key.sceneId << 1) | static_cast<std::uint32_t>(key.updateFreq);
+}
+
+Key sortValueKey(std::uint32_t value) {
+    return Key(static_cast<UpdateSpeed>(value & 1), value >> 1);
+}
+
+bool bindsInstanceIndices(mat::MaterialPipeline& pipeline) {
+    // instanced draws are resolved through the instance buffer of the built-in 3D object sets
+    bool found = false;
+    for (RenderPhase phase = 0; phase < cfg::Limits::MaxRenderPhaseId; ++phase) {
+        vk::Pipeline* phasePipeline = pipeline.getPipeline(phase);
+        if (!phasePipeline) { continue; }
+
+        const vk::PipelineLayout& layout = phasePipeline->pipelineLayout();
+        bool hasSet                      = false;
+        for (std::uint32_t i = 0; i < layout.getDescriptorSetCount(); ++i) {
+            ds::DescriptorSetFactory* factory = layout.getDescriptorSetFactory(i);
+            if (dynamic_cast<dsi::Object3DFactory*>(factory) ||
+                dynamic_cast<dsi::Object3DSkinnedFactory*>(factory)) {
+                hasSet = true;
+                break;
+            }
+        }
+        if (!hasSet) { return false; }
+        found = true;
+    }
+    return found;
+}
+} // namespace
+
 BatchedScene::BatchedScene(engine::Engine& engine)
 : Scene(engine)
 , engine(engine)
-, objects() {
+, objects()
+, instanceIndexBuffer(nullptr)
+, opaqueObjects(false, instanceIndices)
+, transparentObjects(true, instanceIndices)
+, cullingEnabled(true)
+, indirectEnabled(false)
+, maxDrawsPerCall(1)
+, indirectCursor(0)
+, indirectFrame(NoIndirectFrame)
+, instancingEnabled(false)
+, sortingEnabled(false) {
     emitter.connect(engine.renderer().getSignalChannel());
 }
 
 BatchedScene::~BatchedScene() {
-    // noop
+    if (indirectBuffers.valid()) {
+        indirectBuffers.cleanup([](vk::Buffer& buffer) { buffer.deferDestruction(); });
+    }
 }
 
 scene::SceneObject* BatchedScene::doAdd(ecs::Entity entity, rcom::DrawableBase& obj,
@@ -30,10 +90,10 @@ scene::SceneObject* BatchedScene::doAdd(ecs::Entity entity, rcom::DrawableBase&
     const std::uint32_t sceneId = alloc.newObject->sceneKey.sceneId;
     auto& cache                 = updateFreq == UpdateSpeed::Static ? staticCache : dynamicCache;
 
-    if (alloc.addressesChanged) {
-        cache.ensureSize(alloc.newCapacity);
-        handleAddressChange(updateFreq, alloc.originalBaseAddress);
-    }
+    if (sceneId >= cache.transparency.size()) { cache.ensureSize(alloc.newCapacity); }
+
+    // set early so that batches can read the draw parameters of the object
+    alloc.newObject->component = &obj;
 
     cache.transparency[sceneId]    = obj.getContainsTransparency();
     cache.specializations[sceneId] = obj.getPipelineSpecialization();
@@ -81,6 +141,13 @@ void BatchedScene::releaseObject(SceneObject* object, mat::MaterialPipeline* pip
     // remove from batch
     batch.removeObject(entity, object, pipeline, cache.specializations[object->sceneKey.sceneId]);
 
+    // freed slots are not culled until they are reused
+    const auto speed = static_cast<std::uint8_t>(object->sceneKey.updateFreq);
+    if (object->sceneKey.sceneId < cullBounds[speed].size()) {
+        cullBounds[speed].setAlwaysVisible(object->sceneKey.sceneId);
+        cullSources[speed][object->sceneKey.sceneId] = CullSource();
+    }
+
     // cleanup scene link
     engine.ecs().removeComponent<com::BatchSceneLink>(entity);
 }
@@ -131,7 +198,43 @@ void BatchedScene::doBatchChange(const BatchChange& change, mat::MaterialPipelin
     }
 }
 
+void BatchedScene::doGeometryChange(SceneObject* object, mat::MaterialPipeline* pipeline) {
+    const bool isStatic      = object->sceneKey.updateFreq == UpdateSpeed::Static;
+    const auto& cache        = isStatic ? staticCache : dynamicCache;
+    const std::uint32_t i    = object->sceneKey.sceneId;
+    PipelineBatch* pipeBatch = cache.transparency[i] ? nullptr : opaqueObjects.getBatch(pipeline);
+    if (pipeBatch) { pipeBatch->updateInstance(object, cache.specializations[i]); }
+}
+
+template<typename TSkip, typename TDraw>
+auto BatchedScene::makeInstanceFilter(UpdateSpeed speed, const TSkip& skip, const TDraw& draw) {
+    return [this, speed, &skip, &draw](std::uint32_t id, const prim::DrawParameters& key) {
+        const SceneObject& obj = objects.getObject(Key(speed, id));
+        if (skip(&obj)) { return false; }
+
+        // draw parameters changed without notifying the scene, draw alone
+        const prim::DrawParameters& params = obj.component->getDrawParameters();
+        if (!InstanceGroups::matches(params, key)) {
+            draw(params, id);
+            return false;
+        }
+        return true;
+    };
+}
+
 void BatchedScene::renderBatch(scene::SceneRenderContext& ctx, ObjectBatch& batch) {
+    const DrawSorter* sorter = getSorter(ctx, batch);
+    if (sorter) {
+        renderSorted(ctx, batch, *sorter);
+        return;
+    }
+
+    const VisibilitySet* visibility = getVisibility(ctx);
+    const auto skip                 = [visibility](const SceneObject* obj) {
+        return obj->component->isHidden() ||
+               (visibility && !visibility->isVisible(obj->sceneKey));
+    };
+
     for (auto& pipelineBatch : batch.batches) {
         for (auto& specBatch : pipelineBatch.specBatches) {
             if (!pipelineBatch.pipeline.bind(ctx.getCommandBuffer(),
@@ -154,7 +257,7 @@ void BatchedScene::renderBatch(scene::SceneRenderContext& ctx, ObjectBatch& batc
 
                 if (!descriptors.isBindless()) {
                     for (SceneObject* obj : *objectBatch) {
-                        if (obj->component->isHidden()) { continue; }
+                        if (skip(obj)) { continue; }
                         for (std::uint8_t i = descriptors.getPerObjectStart();
                              i < descriptors.getDescriptorSetCount();
                              ++i) {
@@ -164,9 +267,22 @@ void BatchedScene::renderBatch(scene::SceneRenderContext& ctx, ObjectBatch& batc
                         ctx.renderObject(*obj);
                     }
                 }
+                else if (instancingEnabled && pipelineBatch.instanced) {
+                    renderInstanced(ctx, specBatch.getInstances(speed), speed, skip);
+                }
+                else if (indirectEnabled) {
+                    VkBuffer indirectBuffer     = nullptr;
+                    VkDeviceSize indirectOffset = 0;
+                    buildIndirectDraws(*objectBatch, skip);
+                    if (!indirectDraws.empty() &&
+                        writeIndirectDraws(indirectBuffer, indirectOffset)) {
+                        ctx.renderIndirect(
+                            indirectDraws, indirectBuffer, indirectOffset, maxDrawsPerCall);
+                    }
+                }
                 else {
                     for (SceneObject* obj : *objectBatch) {
-                        if (obj->component->isHidden()) { continue; }
+                        if (skip(obj)) { continue; }
                         ctx.renderObject(*obj);
                     }
                 }
@@ -185,19 +301,471 @@ void BatchedScene::renderOpaqueObjects(scene::SceneRenderContext& ctx) {
     renderBatch(ctx, opaqueObjects);
 }
 
-void BatchedScene::handleAddressChange(UpdateSpeed speed, SceneObject* base) {
-    for (ObjectBatch* ob : {&opaqueObjects, &transparentObjects}) {
-        for (PipelineBatch& pb : ob->batches) {
-            for (SpecializationBatch& sb : pb.specBatches) {
-                auto& objectSet =
-                    speed == UpdateSpeed::Static ? sb.objectsStatic : sb.objectsDynamic;
-                for (SceneObject*& so : objectSet) {
-                    so = objects.rebase(speed, so, base);
-                    so->updateRefToThis();
+void BatchedScene::setCullingEnabled(bool e) {
+    std::unique_lock lock(objectMutex);
+    cullingEnabled = e;
+    if (!e) {
+        observerVisibility.clear();
+        shadowVisibility.clear();
+    }
+}
+
+bool BatchedScene::isCullingEnabled() const { return cullingEnabled; }
+
+void BatchedScene::setIndirectDrawEnabled(bool e) {
+    std::unique_lock lock(objectMutex);
+    const VkPhysicalDeviceFeatures& features = renderer.vulkanState().getPhysicalDeviceFeatures();
+    if (e && features.drawIndirectFirstInstance != VK_TRUE) {
+        BL_LOG_WARN << "Device does not support drawIndirectFirstInstance, using direct draws";
+        e = false;
+    }
+
+    const auto& limits = vk::VulkanLayer::getPhysicalDeviceProperties().limits;
+    indirectEnabled    = e;
+    maxDrawsPerCall    = features.multiDrawIndirect == VK_TRUE ? limits.maxDrawIndirectCount : 1;
+    if (e && !indirectBuffers.valid()) { indirectBuffers.emptyInit(renderer.vulkanState()); }
+}
+
+bool BatchedScene::isIndirectDrawEnabled() const { return indirectEnabled; }
+
+void BatchedScene::setInstancingEnabled(bool e) {
+    std::unique_lock lock(objectMutex);
+    instancingEnabled = e;
+}
+
+bool BatchedScene::isInstancingEnabled() const { return instancingEnabled; }
+
+void BatchedScene::setDrawSortingEnabled(bool e) {
+    std::unique_lock lock(objectMutex);
+    sortingEnabled = e;
+    if (!e) { observerSorts.clear(); }
+}
+
+bool BatchedScene::isDrawSortingEnabled() const { return sortingEnabled; }
+
+const DrawSorter* BatchedScene::getSorter(const SceneRenderContext& ctx,
+                                          const ObjectBatch& batch) const {
+    if (!sortingEnabled || batch.batches.size() > DrawSortKey::MaxPipeline + 1) { return nullptr; }
+    if (ctx.getExtraContext<ctx::ShadowMapContext>()) { return nullptr; }
+
+    const std::uint32_t i = ctx.currentObserverIndex();
+    if (i >= observerSorts.size() || !observerSorts[i].valid) { return nullptr; }
+    return &batch == &opaqueObjects ? &observerSorts[i].opaque : &observerSorts[i].transparent;
+}
+
+void BatchedScene::renderSorted(scene::SceneRenderContext& ctx, ObjectBatch& batch,
+                                const DrawSorter& sorter) {
+    const bool transparent         = &batch == &transparentObjects;
+    std::uint32_t currentPipeline  = NoSortState;
+    std::uint32_t currentSpec      = NoSortState;
+    std::uint32_t currentSpeed     = NoSortState;
+    bool bound                     = false;
+    vk::Pipeline* pipeline         = nullptr;
+    ds::InstanceTable* descriptors = nullptr;
+    VkBuffer indirectBuffer        = nullptr;
+    VkDeviceSize indirectOffset    = 0;
+    const auto flushIndirect       = [&]() {
+        if (!indirectDraws.empty() && writeIndirectDraws(indirectBuffer, indirectOffset)) {
+            ctx.renderIndirect(indirectDraws, indirectBuffer, indirectOffset, maxDrawsPerCall);
+        }
+        indirectDraws.clear();
+    };
+
+    // groups are drawn whole at their nearest member, keyed by their unique pool slot
+    const VisibilitySet* visibility = getVisibility(ctx);
+    const auto skip                 = [visibility](const SceneObject* obj) {
+        return obj->component->isHidden() ||
+               (visibility && !visibility->isVisible(obj->sceneKey));
+    };
+    const auto draw = [this, &ctx](const prim::DrawParameters& params, std::uint32_t sceneId) {
+        if (indirectEnabled) { indirectDraws.addDraw(params, sceneId); }
+        else { ctx.renderDraw(params, sceneId); }
+    };
+    std::vector<bool> drawnGroups;
+    if (instancingEnabled && !transparent) { drawnGroups.resize(instanceIndices.capacity()); }
+
+    indirectDraws.clear();
+    for (const DrawSorter::Entry& entry : sorter.getEntries()) {
+        const DrawSortKey::Fields state = DrawSortKey::unpack(entry.key, transparent);
+        if (state.pipeline != currentPipeline || state.specialization != currentSpec) {
+            flushIndirect();
+            currentPipeline = state.pipeline;
+            currentSpec     = state.specialization;
+            currentSpeed    = NoSortState;
+
+            PipelineBatch& pb = batch.batches[state.pipeline];
+            pipeline          = pb.pipeline.getPipeline(ctx.getRenderPhase());
+            descriptors       = &pb.perPhaseDescriptors[ctx.getRenderPhase()];
+
+            bound = pb.pipeline.bind(ctx.getCommandBuffer(),
+                                     ctx.getRenderPhase(),
+                                     ctx.currentRenderPass(),
+                                     pb.specBatches[state.specialization].specializationId);
+        }
+        if (!bound) { continue; }
+
+        if (static_cast<std::uint32_t>(state.speed) != currentSpeed) {
+            flushIndirect();
+            currentSpeed = static_cast<std::uint32_t>(state.speed);
+            ctx.bindDescriptors(pipeline->pipelineLayout().rawLayout(),
+                                state.speed,
+                                descriptors->get(ctx.currentObserverIndex()).data(),
+                                descriptors->getDescriptorSetCount());
+        }
+
+        // objects removed or hidden since the sort are skipped
+        SceneObject& obj = objects.getObject(sortValueKey(entry.value));
+        const SpecializationBatch& specBatch =
+            batch.batches[state.pipeline].specBatches[state.specialization];
+        if (!specBatch.contains(&obj) || obj.component->isHidden()) { continue; }
+
+        const InstanceGroups& instances = specBatch.getInstances(state.speed);
+        const std::uint32_t group       = instancingEnabled && specBatch.instanced ?
+                                              instances.getGroup(obj.sceneKey.sceneId) :
+                                              InstanceGroups::NoGroup;
+
+        if (!descriptors->isBindless()) {
+            for (std::uint8_t i = descriptors->getPerObjectStart();
+                 i < descriptors->getDescriptorSetCount();
+                 ++i) {
+                descriptors->get(ctx.currentObserverIndex())[i]->bindForObject(
+                    ctx, pipeline->pipelineLayout().rawLayout(), i, obj.sceneKey);
+            }
+            ctx.renderObject(obj);
+        }
+        else if (group != InstanceGroups::NoGroup) {
+            const std::uint32_t slot = instances.getGroupSlot(group);
+            if (!drawnGroups[slot]) {
+                drawnGroups[slot] = true;
+                instances.forEachRun(group, makeInstanceFilter(state.speed, skip, draw), draw);
+            }
+        }
+        else if (indirectEnabled) {
+            indirectDraws.addDraw(obj.component->getDrawParameters(), obj.sceneKey.sceneId);
+        }
+        else { ctx.renderObject(obj); }
+    }
+    flushIndirect();
+}
+
+template<typename TSkip>
+void BatchedScene::buildIndirectDraws(const std::vector<SceneObject*>& objects,
+                                      const TSkip& skip) {
+    const auto buildRange = [&objects, &skip](
+                                IndirectDrawBuilder& draws, std::size_t begin, std::size_t end) {
+        draws.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            const SceneObject* obj = objects[i];
+            if (skip(obj)) { continue; }
+            draws.addDraw(obj->component->getDrawParameters(), obj->sceneKey.sceneId);
+        }
+    };
+
+    util::ThreadPool& threadPool = engine.engineLoopThreadpool();
+    if (objects.size() < MinParallelIndirectCount || !threadPool.running()) {
+        buildRange(indirectDraws, 0, objects.size());
+        return;
+    }
+
+    const std::size_t taskCount = std::max(threadPool.workerCount(), 1u) * 2;
+    const std::size_t chunkSize =
+        std::max((objects.size() + taskCount - 1) / taskCount, MinParallelIndirectCount);
+    const std::size_t chunkCount = (objects.size() + chunkSize - 1) / chunkSize;
+    if (indirectChunks.size() < chunkCount) { indirectChunks.resize(chunkCount); }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(chunkCount);
+    for (std::size_t c = 0; c < chunkCount; ++c) {
+        const std::size_t begin = c * chunkSize;
+        const std::size_t end   = std::min(begin + chunkSize, objects.size());
+        futures.emplace_back(
+            threadPool.queueTask([&buildRange, &draws = indirectChunks[c], begin, end]() {
+                buildRange(draws, begin, end);
+            }));
+    }
+
+    // merge in order so that transparent objects keep their draw order
+    indirectDraws.clear();
+    for (std::size_t c = 0; c < chunkCount; ++c) {
+        futures[c].get();
+        indirectDraws.append(indirectChunks[c]);
+    }
+}
+
+template<typename TSkip>
+void BatchedScene::renderInstanced(scene::SceneRenderContext& ctx, const InstanceGroups& instances,
+                                   UpdateSpeed speed, const TSkip& skip) {
+    const auto draw = [this, &ctx](const prim::DrawParameters& params, std::uint32_t sceneId) {
+        if (indirectEnabled) { indirectDraws.addDraw(params, sceneId); }
+        else { ctx.renderDraw(params, sceneId); }
+    };
+    if (indirectEnabled) { indirectDraws.clear(); }
+    instances.forEachRun(makeInstanceFilter(speed, skip, draw), draw);
+    for (const std::uint32_t id : instances.getLoose()) {
+        const SceneObject& obj = objects.getObject(Key(speed, id));
+        if (!skip(&obj)) { draw(obj.component->getDrawParameters(), id); }
+    }
+
+    VkBuffer indirectBuffer     = nullptr;
+    VkDeviceSize indirectOffset = 0;
+    if (indirectEnabled && !indirectDraws.empty() &&
+        writeIndirectDraws(indirectBuffer, indirectOffset)) {
+        ctx.renderIndirect(indirectDraws, indirectBuffer, indirectOffset, maxDrawsPerCall);
+    }
+}
+
+bool BatchedScene::writeIndirectDraws(VkBuffer& buffer, VkDeviceSize& offset) {
+    std::unique_lock lock(indirectMutex);
+
+    // commands from prior frames in this slot have completed by the time the frame comes back
+    const std::uint32_t frame = renderer.vulkanState().currentFrameIndex();
+    if (indirectFrame != frame) {
+        indirectFrame  = frame;
+        indirectCursor = 0;
+    }
+
+    vk::Buffer& storage    = indirectBuffers.current();
+    const VkDeviceSize end = indirectCursor + indirectDraws.byteSize();
+    if (!storage.created()) {
+        if (!storage.create(renderer,
+                            std::max(end, InitialIndirectBufferSize),
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                                VMA_ALLOCATION_CREATE_MAPPED_BIT)) {
+            BL_LOG_ERROR << "Failed to create indirect draw buffer";
+            return false;
+        }
+    }
+    else if (end > storage.getSize()) {
+        // commands already recorded this frame keep the old buffer alive via deferred cleanup
+        storage.ensureSize(std::max(end, storage.getSize() * 2), true);
+    }
+
+    offset = indirectCursor;
+    buffer = storage.getBuffer();
+    indirectDraws.writeCommands(static_cast<char*>(storage.getMappedMemory()) + offset);
+    indirectCursor = end;
+    return true;
+}
+
+VisibilitySet::Stats BatchedScene::getCullStats(std::uint32_t observerIndex) const {
+    return observerIndex < observerVisibility.size() ?
+               observerVisibility[observerIndex].getStats() :
+               VisibilitySet::Stats();
+}
+
+VisibilitySet::Stats BatchedScene::getShadowCullStats(
+    const ctx::ShadowMapContext& shadowContext) const {
+    const std::uint32_t i = shadowCullIndex(shadowContext);
+    return i < shadowVisibility.size() ? shadowVisibility[i].getStats() : VisibilitySet::Stats();
+}
+
+std::uint32_t BatchedScene::shadowCullIndex(const ctx::ShadowMapContext& shadowContext) {
+    switch (shadowContext.lightType) {
+    case ctx::ShadowMapContext::SunLight:
+        return 0;
+    case ctx::ShadowMapContext::SpotLight:
+        return 1 + shadowContext.lightIndex;
+    case ctx::ShadowMapContext::PointLight:
+    default:
+        return 1 + cfg::Limits::MaxSpotShadows + shadowContext.lightIndex;
+    }
+}
+
+void BatchedScene::onShaderResourceSync() {
+    transparentObjects.compact();
+    if (cullingEnabled || sortingEnabled) { updateCullBounds(); }
+    if (cullingEnabled) { cullObjects(); }
+    if (instancingEnabled && instanceIndices.isDirty()) {
+        if (!instanceIndexBuffer) {
+            instanceIndexBuffer =
+                shaderInputStore.getShaderResourceWithKey(sri::InstanceIndexBufferKey);
+        }
+        instanceIndexBuffer->sync(instanceIndices);
+    }
+    if (sortingEnabled) { sortObjects(); }
+}
+
+bool BatchedScene::getObjectTransform(ecs::Entity, std::uint32_t&, glm::mat4&) { return false; }
+
+void BatchedScene::collectShadowCullVolumes(std::vector<ShadowCullVolume>&) {}
+
+void BatchedScene::updateCullBounds() {
+    glm::mat4 transform;
+    objects.forEach([this, &transform](SceneObject& object) {
+        const auto speed                 = static_cast<std::uint8_t>(object.sceneKey.updateFreq);
+        CullingBounds& bounds            = cullBounds[speed];
+        std::vector<CullSource>& sources = cullSources[speed];
+        const std::uint32_t i            = object.sceneKey.sceneId;
+        if (i >= bounds.size()) {
+            const std::uint32_t size = std::max(i + 1, bounds.size() * 2);
+            bounds.resize(size);
+            sources.resize(size);
+        }
+
+        CullSource& source   = sources[i];
+        const bool hasBounds = object.component && object.component->hasCullBounds();
+        if (!object.component || (!hasBounds && !sortingEnabled)) {
+            bounds.setAlwaysVisible(i);
+            source = CullSource();
+            return;
+        }
+
+        // bounds are kept until the transform or the local bounds of the object change
+        const glm::vec4& local    = object.component->getCullBounds();
+        const bool sameSource     = source.entity == object.entity && source.local == local;
+        const std::uint32_t prior = sameSource ? source.version : UnknownTransformVersion;
+        std::uint32_t version     = prior;
+        if (!getObjectTransform(object.entity, version, transform)) {
+            bounds.setAlwaysVisible(i);
+            source = CullSource();
+            return;
+        }
+        if (prior != UnknownTransformVersion && version == prior) { return; }
+        source.entity  = object.entity;
+        source.version = version;
+        source.local   = local;
+
+        if (!hasBounds) {
+            // never culled but still positioned for draw sorting
+            bounds.setAlwaysVisible(i, glm::vec3(transform[3]));
+            return;
+        }
+
+        const auto axisLengthSquared = [&transform](int axis) {
+            const glm::vec3 a(transform[axis]);
+            return glm::dot(a, a);
+        };
+        const float maxScale =
+            std::max({axisLengthSquared(0), axisLengthSquared(1), axisLengthSquared(2)});
+        bounds.set(i,
+                   glm::vec3(transform * glm::vec4(glm::vec3(local), 1.f)),
+                   local.w * std::sqrt(maxScale));
+    });
+}
+
+void BatchedScene::cullObjects() {
+    util::ThreadPool* threadPool = &engine.engineLoopThreadpool();
+
+    observerVisibility.resize(targetTable.nextId());
+    for (unsigned int i = 0; i < targetTable.nextId(); ++i) {
+        RenderTarget* target = targetTable.getTarget(i);
+        VisibilitySet& vis   = observerVisibility[i];
+        if (!target || target->getCurrentScene() != this || !target->getCurrentCamera()) {
+            vis.clear();
+            continue;
+        }
+
+        // depth planes are skipped as some cameras use inverted or unbounded depth ranges
+        cam::Camera& camera      = *target->getCurrentCamera();
+        const glm::mat4 viewProj = camera.getProjectionMatrix(target->getViewport()) *
+                                   camera.getViewMatrix();
+        VisibilityCuller::cull(cullBounds, Frustum::fromMatrix(viewProj, false), vis, threadPool);
+    }
+
+    shadowVolumes.clear();
+    collectShadowCullVolumes(shadowVolumes);
+    shadowVisibility.resize(shadowVolumes.size());
+    for (unsigned int i = 0; i < shadowVolumes.size(); ++i) {
+        const ShadowCullVolume& volume = shadowVolumes[i];
+        if (volume.isSphere) {
+            VisibilityCuller::cull(cullBounds,
+                                   glm::vec3(volume.sphere),
+                                   volume.sphere.w,
+                                   shadowVisibility[i],
+                                   threadPool);
+        }
+        else {
+            VisibilityCuller::cull(cullBounds, volume.frustum, shadowVisibility[i], threadPool);
+        }
+    }
+}
+
+void BatchedScene::sortObjects() {
+    observerSorts.resize(targetTable.nextId());
+    for (unsigned int i = 0; i < targetTable.nextId(); ++i) {
+        RenderTarget* target = targetTable.getTarget(i);
+        ObserverSort& sort   = observerSorts[i];
+        sort.valid = target && target->getCurrentScene() == this && target->getCurrentCamera();
+        if (!sort.valid) { continue; }
+
+        const glm::vec3 eye(glm::inverse(target->getCurrentCamera()->getViewMatrix())[3]);
+        const VisibilitySet* visibility =
+            cullingEnabled && i < observerVisibility.size() ? &observerVisibility[i] : nullptr;
+        sortBatch(opaqueObjects, sort.opaque, visibility, eye);
+        sortBatch(transparentObjects, sort.transparent, visibility, eye);
+    }
+}
+
+void BatchedScene::sortBatch(ObjectBatch& batch, DrawSorter& sorter,
+                             const VisibilitySet* visibility, const glm::vec3& eye) {
+    if (batch.batches.size() > DrawSortKey::MaxPipeline + 1) { return; }
+
+    const bool transparent = &batch == &transparentObjects;
+    const auto isDrawn     = [visibility](const SceneObject& obj) {
+        return !obj.component->isHidden() && (!visibility || visibility->isVisible(obj.sceneKey));
+    };
+    const auto makeKey = [this, transparent, &eye](const SceneObject& obj,
+                                                   std::uint32_t pipeline,
+                                                   std::uint32_t specialization) {
+        const DrawSortKey::Fields state{pipeline, specialization, obj.sceneKey.updateFreq};
+        const CullingBounds& bounds =
+            cullBounds[static_cast<std::uint8_t>(obj.sceneKey.updateFreq)];
+        glm::vec3 center;
+        const float depth = bounds.getCenter(obj.sceneKey.sceneId, center) ?
+                                glm::distance(eye, center) :
+                                0.f;
+        const std::uint64_t geometry =
+            std::hash<const void*>()(obj.component->getDrawParameters().vertexBuffer);
+        return transparent ? DrawSortKey::transparent(state, depth, geometry) :
+                             DrawSortKey::opaque(state, depth, geometry);
+    };
+
+    // revisit last frame's order first so that coherent frames are nearly sorted
+    sorter.beginFrame([this, &batch, transparent, &isDrawn, &makeKey](std::uint32_t value,
+                                                                      std::uint64_t& key) {
+        const DrawSortKey::Fields state = DrawSortKey::unpack(key, transparent);
+        const SceneObject& obj          = objects.getObject(sortValueKey(value));
+        if (state.pipeline >= batch.batches.size()) { return false; }
+        const PipelineBatch& pb = batch.batches[state.pipeline];
+        if (state.specialization >= pb.specBatches.size() ||
+            !pb.specBatches[state.specialization].contains(&obj) || !isDrawn(obj)) {
+            return false;
+        }
+        key = makeKey(obj, state.pipeline, state.specialization);
+        return true;
+    });
+
+    for (std::uint32_t p = 0; p < batch.batches.size(); ++p) {
+        const PipelineBatch& pb = batch.batches[p];
+        for (std::uint32_t s = 0; s < pb.specBatches.size(); ++s) {
+            for (const UpdateSpeed speed : {UpdateSpeed::Dynamic, UpdateSpeed::Static}) {
+                for (const SceneObject* obj : pb.specBatches[s].getObjects(speed)) {
+                    const std::uint32_t value = sortValue(obj->sceneKey);
+                    if (!sorter.contains(value) && isDrawn(*obj)) {
+                        sorter.add(value, makeKey(*obj, p, s));
+                    }
                 }
             }
         }
     }
+
+    sorter.sort(&engine.engineLoopThreadpool());
+}
+
+const VisibilitySet* BatchedScene::getVisibility(const SceneRenderContext& context) const {
+    if (!cullingEnabled) { return nullptr; }
+
+    const auto* shadowContext = context.getExtraContext<ctx::ShadowMapContext>();
+    if (shadowContext) {
+        const std::uint32_t i = shadowCullIndex(*shadowContext);
+        return i < shadowVisibility.size() ? &shadowVisibility[i] : nullptr;
+    }
+
+    const std::uint32_t i = context.currentObserverIndex();
+    return i < observerVisibility.size() ? &observerVisibility[i] : nullptr;
 }
 
 void BatchedScene::doRegisterObserver(RenderTarget* target, std::uint32_t observerIndex) {
@@ -213,15 +781,37 @@ void BatchedScene::doUnregisterObserver(RenderTarget* target, std::uint32_t inde
     }
 }
 
+BatchedScene::ShadowCullVolume::ShadowCullVolume()
+: sphere(0.f, 0.f, 0.f, std::numeric_limits<float>::infinity())
+, isSphere(true) {}
+
+BatchedScene::ShadowCullVolume::ShadowCullVolume(const glm::mat4& viewProj)
+: frustum(Frustum::fromMatrix(viewProj))
+, isSphere(false) {}
+
+BatchedScene::ShadowCullVolume::ShadowCullVolume(const glm::vec3& center, float radius)
+: sphere(center, radius)
+, isSphere(true) {}
+
 BatchedScene::PipelineBatch::PipelineBatch(const PipelineBatch& src)
+: PipelineBatch(src, src.preserveOrder) {}
+
+BatchedScene::PipelineBatch::PipelineBatch(const PipelineBatch& src, bool preserveOrder)
 : needsObserverInit(src.needsObserverInit)
+, preserveOrder(preserveOrder)
 , pipeline(src.pipeline)
+, instancePool(src.instancePool)
+, instanced(!preserveOrder && bindsInstanceIndices(src.pipeline))
 , perPhaseDescriptors(src.perPhaseDescriptors)
 , allDescriptors(src.allDescriptors) {}
 
-BatchedScene::PipelineBatch::PipelineBatch(Scene* scene, mat::MaterialPipeline& pipeline)
-: pipeline(pipeline)
-, needsObserverInit(true) {
+BatchedScene::PipelineBatch::PipelineBatch(Scene* scene, mat::MaterialPipeline& pipeline,
+                                           bool preserveOrder, InstanceIndexPool& instancePool)
+: needsObserverInit(true)
+, preserveOrder(preserveOrder)
+, pipeline(pipeline)
+, instancePool(instancePool)
+, instanced(!preserveOrder && bindsInstanceIndices(pipeline)) {
     for (RenderPhase phase = 0; phase < cfg::Limits::MaxRenderPhaseId; ++phase) {
         vk::Pipeline* phasePipeline = pipeline.getPipeline(phase);
         if (phasePipeline) {
@@ -254,6 +844,7 @@ void BatchedScene::PipelineBatch::registerObserver(unsigned int index, RenderTar
 
     // call allocateObject on all new sets for all existing objects
     for (SpecializationBatch& specBatch : specBatches) {
+        specBatch.compact();
         for (unsigned int i = startIndex; i < allDescriptors.size(); ++i) {
             for (SceneObject* obj : specBatch.objectsStatic) {
                 if (!allDescriptors[i]->allocateObject(obj->entity, obj->sceneKey)) {
@@ -324,7 +915,7 @@ void BatchedScene::PipelineBatch::addForRebatch(SceneObject* object, std::uint32
             return;
         }
     }
-    auto& b = specBatches.emplace_back(specialization);
+    auto& b = specBatches.emplace_back(specialization, instancePool, instanced);
     b.addObject(object);
 }
 
@@ -340,11 +931,23 @@ void BatchedScene::PipelineBatch::removeObject(ecs::Entity entity, SceneObject*
 bool BatchedScene::PipelineBatch::removeForRebatch(SceneObject* object,
                                                    std::uint32_t specialization) {
     for (auto& sb : specBatches) {
-        if (sb.specializationId == specialization) { return sb.removeObject(object); }
+        if (sb.specializationId == specialization) {
+            return sb.removeObject(object, preserveOrder);
+        }
     }
     return false;
 }
 
+void BatchedScene::PipelineBatch::updateInstance(SceneObject* object,
+                                                 std::uint32_t specialization) {
+    for (auto& sb : specBatches) {
+        if (sb.specializationId == specialization) {
+            sb.updateInstance(object);
+            return;
+        }
+    }
+}
+
 void BatchedScene::PipelineBatch::updateDescriptors(ecs::Entity entity, SceneObject* object,
                                                     PipelineBatch& prevBatch) {
     using AllCtr    = decltype(allDescriptors);
@@ -376,7 +979,7 @@ BatchedScene::PipelineBatch& BatchedScene::ObjectBatch::getOrCreateBatch(
     for (PipelineBatch& pb : batches) {
         if (&pb.pipeline == &pipeline) { return pb; }
     }
-    batches.emplace_back(scene, pipeline);
+    batches.emplace_back(scene, pipeline, preserveOrder, instancePool);
     return batches.back();
 }
 
@@ -391,7 +994,7 @@ BatchedScene::PipelineBatch& BatchedScene::ObjectBatch::getBatch(const PipelineB
     for (PipelineBatch& pb : batches) {
         if (&pb.pipeline == &src.pipeline) { return pb; }
     }
-    batches.emplace_back(src);
+    batches.emplace_back(src, preserveOrder);
     return batches.back();
 }
 
@@ -403,6 +1006,21 @@ void BatchedScene::ObjectBatch::removeObject(ecs::Entity entity, SceneObject* ob
     }
 }
 
+void BatchedScene::ObjectBatch::compact() {
+    if (!preserveOrder) { return; }
+    for (PipelineBatch& pb : batches) {
+        for (SpecializationBatch& sb : pb.specBatches) { sb.compact(); }
+    }
+}
+
+BatchedScene::CullSource::CullSource()
+: entity(ecs::InvalidEntity)
+, version(UnknownTransformVersion)
+, local(0.f) {}
+
+BatchedScene::ObserverSort::ObserverSort()
+: valid(false) {}
+
 BatchedScene::ObjectSettingsCache::ObjectSettingsCache() {
     transparency.resize(cfg::Constants::DefaultSceneObjectCapacity, false);
     specializations.resize(cfg::Constants::DefaultSceneObjectCapacity, 0);
@@ -413,28 +1031,90 @@ void BatchedScene::ObjectSettingsCache::ensureSize(std::uint32_t size) {
     specializations.resize(size, 0);
 }
 
-BatchedScene::SpecializationBatch::SpecializationBatch(std::uint32_t specializationId)
-: specializationId(specializationId) {
+BatchedScene::SpecializationBatch::SpecializationBatch(std::uint32_t specializationId,
+                                                       InstanceIndexPool& instancePool,
+                                                       bool instanced)
+: specializationId(specializationId)
+, instanced(instanced)
+, removedStatic(0)
+, removedDynamic(0)
+, instancesStatic(instancePool)
+, instancesDynamic(instancePool) {
     objectsStatic.reserve(cfg::Constants::DefaultSceneObjectCapacity / 2);
     objectsDynamic.reserve(cfg::Constants::DefaultSceneObjectCapacity / 2);
 }
 
 void BatchedScene::SpecializationBatch::addObject(SceneObject* object) {
-    auto& objects =
-        object->sceneKey.updateFreq == UpdateSpeed::Static ? objectsStatic : objectsDynamic;
+    const bool isStatic = object->sceneKey.updateFreq == UpdateSpeed::Static;
+    auto& objects       = isStatic ? objectsStatic : objectsDynamic;
+    auto& instances     = isStatic ? instancesStatic : instancesDynamic;
+    object->batchIndex  = objects.size();
     objects.emplace_back(object);
+    if (instanced) {
+        instances.add(object->sceneKey.sceneId,
+                      object->component ? object->component->getDrawParameters() :
+                                          prim::DrawParameters());
+    }
 }
 
-bool BatchedScene::SpecializationBatch::removeObject(SceneObject* object) {
-    auto& batch =
-        object->sceneKey.updateFreq == UpdateSpeed::Static ? objectsStatic : objectsDynamic;
-    for (auto it = batch.begin(); it != batch.end(); ++it) {
-        if (*it == object) {
-            batch.erase(it);
-            return true;
-        }
+bool BatchedScene::SpecializationBatch::removeObject(SceneObject* object, bool preserveOrder) {
+    const bool isStatic   = object->sceneKey.updateFreq == UpdateSpeed::Static;
+    auto& batch           = isStatic ? objectsStatic : objectsDynamic;
+    const std::uint32_t i = object->batchIndex;
+    if (i >= batch.size() || batch[i] != object) { return false; }
+
+    if (preserveOrder) {
+        // insertion order is the draw order of unsorted transparent objects. Leave a tombstone
+        // and close the gaps once per frame in compact()
+        batch[i] = nullptr;
+        ++(isStatic ? removedStatic : removedDynamic);
     }
-    return false;
+    else {
+        // swap and pop, order within an opaque batch does not matter
+        batch[i]             = batch.back();
+        batch[i]->batchIndex = i;
+        batch.pop_back();
+    }
+    (isStatic ? instancesStatic : instancesDynamic).remove(object->sceneKey.sceneId);
+    return true;
+}
+
+void BatchedScene::SpecializationBatch::compact() {
+    const auto compactObjects = [](std::vector<SceneObject*>& batch, std::uint32_t& removed) {
+        if (removed == 0) { return; }
+        std::uint32_t j = 0;
+        for (SceneObject* object : batch) {
+            if (object) {
+                object->batchIndex = j;
+                batch[j++]         = object;
+            }
+        }
+        batch.resize(j);
+        removed = 0;
+    };
+    compactObjects(objectsStatic, removedStatic);
+    compactObjects(objectsDynamic, removedDynamic);
+}
+
+void BatchedScene::SpecializationBatch::updateInstance(SceneObject* object) {
+    if (!instanced || !contains(object)) { return; }
+    auto& instances =
+        object->sceneKey.updateFreq == UpdateSpeed::Static ? instancesStatic : instancesDynamic;
+    instances.update(object->sceneKey.sceneId, object->component->getDrawParameters());
+}
+
+const InstanceGroups& BatchedScene::SpecializationBatch::getInstances(UpdateSpeed speed) const {
+    return speed == UpdateSpeed::Static ? instancesStatic : instancesDynamic;
+}
+
+const std::vector<SceneObject*>& BatchedScene::SpecializationBatch::getObjects(
+    UpdateSpeed speed) const {
+    return speed == UpdateSpeed::Static ? objectsStatic : objectsDynamic;
+}
+
+bool BatchedScene::SpecializationBatch::contains(const SceneObject* object) const {
+    const auto& batch = getObjects(object->sceneKey.updateFreq);
+    return object->batchIndex < batch.size() && batch[object->batchIndex] == object;
 }
 
 } // namespace scene
@@ -0,0 +1,218 @@
+#include <BLIB/Render/Scenes/DrawSorter.hpp>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <future>
+#include <memory>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace
+{
+constexpr unsigned int DigitCount = sizeof(std::uint64_t);
+using Histogram                   = std::array<std::uint32_t, 256>;
+
+bool compareEntries(const DrawSorter::Entry& left, const DrawSorter::Entry& right) {
+    return left.key < right.key;
+}
+
+std::uint32_t depthBits(float depth) {
+    // positive floats order the same as their bit patterns
+    if (!(depth > 0.f)) { return 0; }
+    return std::bit_cast<std::uint32_t>(depth);
+}
+
+std::uint64_t hashGeometry(std::uint64_t geometry) { return geometry * 0x9E3779B97F4A7C15ull; }
+
+std::uint64_t packState(const DrawSortKey::Fields& fields) {
+    return (static_cast<std::uint64_t>(fields.pipeline & DrawSortKey::MaxPipeline) << 5) |
+           (static_cast<std::uint64_t>(fields.specialization & DrawSortKey::MaxSpecialization)
+            << 1) |
+           (fields.speed == UpdateSpeed::Static ? 0 : 1);
+}
+
+DrawSortKey::Fields unpackState(std::uint64_t state) {
+    DrawSortKey::Fields fields;
+    fields.pipeline       = static_cast<std::uint32_t>(state >> 5) & DrawSortKey::MaxPipeline;
+    fields.specialization = static_cast<std::uint32_t>(state >> 1) & DrawSortKey::MaxSpecialization;
+    fields.speed          = (state & 1) ? UpdateSpeed::Dynamic : UpdateSpeed::Static;
+    return fields;
+}
+
+template<typename TRun>
+void runChunks(util::ThreadPool* threadPool, std::uint32_t taskCount, std::size_t size,
+               const TRun& run) {
+    const std::size_t chunkSize = (size + taskCount - 1) / taskCount;
+    if (!threadPool) {
+        for (std::uint32_t c = 0; c < taskCount; ++c) {
+            run(c, std::min(c * chunkSize, size), std::min((c + 1) * chunkSize, size));
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(taskCount);
+    for (std::uint32_t c = 0; c < taskCount; ++c) {
+        const std::size_t begin = std::min(c * chunkSize, size);
+        const std::size_t end   = std::min((c + 1) * chunkSize, size);
+        auto task               = std::make_shared<std::packaged_task<void()>>(
+            [&run, c, begin, end]() { run(c, begin, end); });
+        futures.emplace_back(task->get_future());
+        threadPool->queueTask([task]() { (*task)(); });
+    }
+    for (auto& f : futures) { f.get(); }
+}
+} // namespace
+
+std::uint64_t DrawSortKey::opaque(const Fields& fields, float depth, std::uint64_t geometry) {
+    // pipeline 12 | specialization 4 | speed 1 | coarse depth 16 | geometry 31
+    const std::uint64_t coarseDepth = depthBits(depth) >> 16;
+    return (packState(fields) << 47) | (coarseDepth << 31) | (hashGeometry(geometry) >> 33);
+}
+
+std::uint64_t DrawSortKey::transparent(const Fields& fields, float depth,
+                                       std::uint64_t geometry) {
+    // inverted depth 32 | pipeline 12 | specialization 4 | speed 1 | geometry 15
+    const std::uint64_t farFirst = ~depthBits(depth);
+    return (farFirst << 32) | (packState(fields) << 15) | (hashGeometry(geometry) >> 49);
+}
+
+DrawSortKey::Fields DrawSortKey::unpack(std::uint64_t key, bool transparent) {
+    return transparent ? unpackState((key >> 15) & 0x1FFFF) : unpackState(key >> 47);
+}
+
+DrawSorter::DrawSorter()
+: frame(1)
+, lastMethod(Method::AlreadySorted) {}
+
+void DrawSorter::nextFrame() {
+    ++frame;
+    if (frame == 0) {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        frame = 1;
+    }
+}
+
+void DrawSorter::add(std::uint32_t value, std::uint64_t key) {
+    mark(value);
+    entries.emplace_back(Entry{key, value});
+}
+
+void DrawSorter::sort(util::ThreadPool* threadPool) {
+    lastMethod = Method::AlreadySorted;
+    if (std::is_sorted(entries.begin(), entries.end(), &compareEntries)) { return; }
+
+    // coherent frames are mostly in order. split off the out of order entries and merge them back
+    scratch.clear();
+    outOfOrder.clear();
+    scratch.reserve(entries.size());
+    for (const Entry& entry : entries) {
+        if (scratch.empty() || entry.key >= scratch.back().key) { scratch.emplace_back(entry); }
+        else if (scratch.size() >= 2 && scratch[scratch.size() - 2].key <= entry.key) {
+            // the previous entry jumped ahead, keep the run going from this one instead
+            outOfOrder.emplace_back(scratch.back());
+            scratch.back() = entry;
+        }
+        else { outOfOrder.emplace_back(entry); }
+    }
+    if (outOfOrder.size() <= entries.size() / 8) {
+        std::sort(outOfOrder.begin(), outOfOrder.end(), &compareEntries);
+        std::merge(scratch.begin(),
+                   scratch.end(),
+                   outOfOrder.begin(),
+                   outOfOrder.end(),
+                   entries.begin(),
+                   &compareEntries);
+        lastMethod = Method::Merged;
+        return;
+    }
+
+    radixSort(entries, scratch, threadPool);
+    lastMethod = Method::RadixSorted;
+}
+
+void DrawSorter::radixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch,
+                           util::ThreadPool* threadPool) {
+    const std::size_t size = entries.size();
+    if (size < 2) { return; }
+    if (threadPool && (!threadPool->running() || size < MinParallelCount)) { threadPool = nullptr; }
+
+    const std::uint32_t taskCount = threadPool ? std::max(threadPool->workerCount(), 1u) * 2 : 1;
+    scratch.resize(size);
+
+    // histogram every digit in a single pass so that trivial passes can be skipped
+    std::vector<std::array<Histogram, DigitCount>> digitCounts(taskCount);
+    const auto countDigits = [&digitCounts, &entries](std::uint32_t c, std::size_t begin,
+                                                      std::size_t end) {
+        auto& counts = digitCounts[c];
+        for (Histogram& h : counts) { h.fill(0); }
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::uint64_t key = entries[i].key;
+            for (unsigned int d = 0; d < DigitCount; ++d) { ++counts[d][(key >> (d * 8)) & 0xFF]; }
+        }
+    };
+    runChunks(threadPool, taskCount, size, countDigits);
+
+    std::vector<Histogram> chunkCounts(taskCount);
+    std::vector<Histogram> chunkOffsets(taskCount);
+    Entry* src         = entries.data();
+    Entry* dst         = scratch.data();
+    unsigned int shift = 0;
+    const auto countPass = [&chunkCounts, &src, &shift](std::uint32_t c, std::size_t begin,
+                                                        std::size_t end) {
+        Histogram& h = chunkCounts[c];
+        h.fill(0);
+        for (std::size_t i = begin; i < end; ++i) { ++h[(src[i].key >> shift) & 0xFF]; }
+    };
+    const auto scatterPass = [&chunkOffsets, &src, &dst, &shift](std::uint32_t c,
+                                                                 std::size_t begin,
+                                                                 std::size_t end) {
+        Histogram& offsets = chunkOffsets[c];
+        for (std::size_t i = begin; i < end; ++i) {
+            dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+    };
+
+    for (unsigned int d = 0; d < DigitCount; ++d) {
+        shift = d * 8;
+
+        bool trivial = false;
+        for (unsigned int b = 0; b < 256; ++b) {
+            std::size_t total = 0;
+            for (std::uint32_t c = 0; c < taskCount; ++c) { total += digitCounts[c][d][b]; }
+            if (total == size) {
+                trivial = true;
+                break;
+            }
+            if (total > 0) { break; }
+        }
+        if (trivial) { continue; }
+
+        // the single pass histogram is only valid per chunk for the original order
+        if (taskCount > 1) { runChunks(threadPool, taskCount, size, countPass); }
+        else { chunkCounts[0] = digitCounts[0][d]; }
+
+        // each chunk writes to its own range within each bucket, preserving stability
+        std::uint32_t offset = 0;
+        for (unsigned int b = 0; b < 256; ++b) {
+            for (std::uint32_t c = 0; c < taskCount; ++c) {
+                chunkOffsets[c][b] = offset;
+                offset += chunkCounts[c][b];
+            }
+        }
+
+        runChunks(threadPool, taskCount, size, scatterPass);
+        std::swap(src, dst);
+    }
+
+    if (src != entries.data()) { entries.swap(scratch); }
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,94 @@
+#include <BLIB/Render/Scenes/IndirectDrawBuilder.hpp>
+
+#include <cstring>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+using DrawType = prim::DrawParameters::DrawType;
+
+void IndirectDrawBuilder::clear() {
+    groups.clear();
+    indexedCommands.clear();
+    vertexCommands.clear();
+}
+
+IndirectDrawBuilder::DrawGroup& IndirectDrawBuilder::getGroup(DrawType type, VkBuffer vb,
+                                                              VkBuffer ib,
+                                                              std::uint32_t firstCommand) {
+    if (!groups.empty()) {
+        DrawGroup& last = groups.back();
+        if (last.type == type && last.vertexBuffer == vb && last.indexBuffer == ib) {
+            return last;
+        }
+    }
+    groups.emplace_back(DrawGroup{type, vb, ib, firstCommand, 0});
+    return groups.back();
+}
+
+void IndirectDrawBuilder::addDraw(const prim::DrawParameters& params, std::uint32_t sceneId) {
+    if (!params.vertexBuffer) { return; }
+
+    const std::uint32_t firstInstance =
+        params.instanceCount == 1 ? sceneId : params.firstInstance;
+    switch (params.type) {
+    case DrawType::VertexBuffer:
+        if (params.vertexCount == 0) { return; }
+        getGroup(DrawType::VertexBuffer, params.vertexBuffer, nullptr, vertexCommands.size())
+            .commandCount += 1;
+        vertexCommands.emplace_back(VkDrawIndirectCommand{
+            params.vertexCount, params.instanceCount, params.vertexOffset, firstInstance});
+        break;
+
+    case DrawType::IndexBuffer:
+        if (!params.indexBuffer || params.indexCount == 0) { return; }
+        getGroup(DrawType::IndexBuffer,
+                 params.vertexBuffer,
+                 params.indexBuffer,
+                 indexedCommands.size())
+            .commandCount += 1;
+        indexedCommands.emplace_back(
+            VkDrawIndexedIndirectCommand{params.indexCount,
+                                         params.instanceCount,
+                                         params.indexOffset,
+                                         static_cast<std::int32_t>(params.vertexOffset),
+                                         firstInstance});
+        break;
+    }
+}
+
+void IndirectDrawBuilder::append(const IndirectDrawBuilder& other) {
+    const std::uint32_t indexedBase = indexedCommands.size();
+    const std::uint32_t vertexBase  = vertexCommands.size();
+
+    for (const DrawGroup& group : other.groups) {
+        const std::uint32_t base = group.type == DrawType::IndexBuffer ? indexedBase : vertexBase;
+        getGroup(group.type, group.vertexBuffer, group.indexBuffer, base + group.firstCommand)
+            .commandCount += group.commandCount;
+    }
+    indexedCommands.insert(
+        indexedCommands.end(), other.indexedCommands.begin(), other.indexedCommands.end());
+    vertexCommands.insert(
+        vertexCommands.end(), other.vertexCommands.begin(), other.vertexCommands.end());
+}
+
+void IndirectDrawBuilder::writeCommands(void* dst) const {
+    char* out = static_cast<char*>(dst);
+    if (!indexedCommands.empty()) {
+        std::memcpy(out,
+                    indexedCommands.data(),
+                    indexedCommands.size() * sizeof(VkDrawIndexedIndirectCommand));
+    }
+    if (!vertexCommands.empty()) {
+        std::memcpy(out + vertexCommandOffset(),
+                    vertexCommands.data(),
+                    vertexCommands.size() * sizeof(VkDrawIndirectCommand));
+    }
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
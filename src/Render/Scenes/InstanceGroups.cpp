@@ -0,0 +1,146 @@
+#include <BLIB/Render/Scenes/InstanceGroups.hpp>
+
+#include <BLIB/Util/HashCombine.hpp>
+#include <algorithm>
+#include <functional>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+using DrawType = prim::DrawParameters::DrawType;
+
+InstanceGroups::InstanceGroups(InstanceIndexPool& pool)
+: pool(&pool)
+, activeGroups(0) {}
+
+bool InstanceGroups::isInstanceable(const prim::DrawParameters& params) {
+    if (!params.vertexBuffer || params.instanceCount != 1) { return false; }
+    if (params.type == DrawType::VertexBuffer) { return params.vertexCount > 0; }
+    return params.indexBuffer != nullptr && params.indexCount > 0;
+}
+
+bool InstanceGroups::matches(const prim::DrawParameters& params,
+                             const prim::DrawParameters& key) {
+    if (params.type != key.type || params.vertexBuffer != key.vertexBuffer ||
+        params.vertexOffset != key.vertexOffset) {
+        return false;
+    }
+    if (params.type == DrawType::VertexBuffer) { return params.vertexCount == key.vertexCount; }
+    return params.indexBuffer == key.indexBuffer && params.indexCount == key.indexCount &&
+           params.indexOffset == key.indexOffset;
+}
+
+std::size_t InstanceGroups::KeyHash::operator()(const prim::DrawParameters& key) const {
+    std::size_t hash = std::hash<const void*>()(key.vertexBuffer);
+    hash             = util::hashCombine(hash, key.vertexOffset);
+    if (key.type == DrawType::VertexBuffer) { hash = util::hashCombine(hash, key.vertexCount); }
+    else {
+        hash = util::hashCombine(hash, std::hash<const void*>()(key.indexBuffer));
+        hash = util::hashCombine(hash, key.indexCount);
+        hash = util::hashCombine(hash, key.indexOffset);
+    }
+    return hash;
+}
+
+void InstanceGroups::add(std::uint32_t id, const prim::DrawParameters& params) {
+    if (id >= slots.size()) { slots.resize(id + 1, Slot{NoGroup, 0}); }
+
+    Slot& slot = slots[id];
+    if (!isInstanceable(params)) {
+        slot.group = LooseGroup;
+        slot.index = loose.size();
+        loose.emplace_back(id);
+        return;
+    }
+
+    slot.group   = getOrCreateGroup(params);
+    Group& group = groups[slot.group];
+    if (group.count == group.range.size) {
+        // relocate to a range twice as large, the old range is left for other groups
+        const InstanceIndexPool::Range grown =
+            pool->allocate(std::max(group.range.size * 2, MinCapacity));
+        if (group.count > 0) {
+            pool->copy(grown.offset, group.range.offset, group.count);
+            pool->release(group.range);
+        }
+        group.range = grown;
+    }
+    slot.index = group.count;
+    pool->set(group.range.offset + group.count, id);
+    ++group.count;
+}
+
+void InstanceGroups::remove(std::uint32_t id) {
+    if (!contains(id)) { return; }
+
+    Slot& slot = slots[id];
+    if (slot.group == LooseGroup) {
+        const std::uint32_t moved = loose.back();
+        loose[slot.index]         = moved;
+        slots[moved].index        = slot.index;
+        loose.pop_back();
+    }
+    else {
+        // swap and pop within the range of the group
+        Group& group             = groups[slot.group];
+        const std::uint32_t last = group.count - 1;
+        if (slot.index != last) {
+            const std::uint32_t moved = (*pool)[group.range.offset + last];
+            pool->set(group.range.offset + slot.index, moved);
+            slots[moved].index = slot.index;
+        }
+        --group.count;
+        if (group.count == 0) {
+            pool->release(group.range);
+            group.range = InstanceIndexPool::Range();
+            lookup.erase(group.key);
+            freeGroups.emplace_back(slot.group);
+            --activeGroups;
+        }
+    }
+    slot.group = NoGroup;
+}
+
+void InstanceGroups::update(std::uint32_t id, const prim::DrawParameters& params) {
+    if (contains(id)) {
+        const Slot& slot = slots[id];
+        if (slot.group == LooseGroup) {
+            if (!isInstanceable(params)) { return; }
+        }
+        else if (isInstanceable(params) && matches(params, groups[slot.group].key)) { return; }
+        remove(id);
+    }
+    add(id, params);
+}
+
+std::uint32_t InstanceGroups::getOrCreateGroup(const prim::DrawParameters& params) {
+    const auto it = lookup.find(params);
+    if (it != lookup.end()) { return it->second; }
+
+    std::uint32_t index;
+    if (!freeGroups.empty()) {
+        index = freeGroups.back();
+        freeGroups.pop_back();
+    }
+    else {
+        index = groups.size();
+        groups.emplace_back();
+    }
+
+    Group& group            = groups[index];
+    group.key               = params;
+    group.key.instanceCount = 1;
+    group.key.firstInstance = 0;
+    group.range             = InstanceIndexPool::Range();
+    group.count             = 0;
+    lookup.emplace(group.key, index);
+    ++activeGroups;
+    return index;
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,59 @@
+#include <BLIB/Render/Scenes/InstanceIndexPool.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace
+{
+constexpr std::uint32_t InitialCapacity = 256;
+constexpr std::uint32_t CleanStart      = std::numeric_limits<std::uint32_t>::max();
+} // namespace
+
+InstanceIndexPool::InstanceIndexPool()
+: allocator(InitialCapacity)
+, ids(InitialCapacity, 0)
+, dirtyStart(CleanStart)
+, dirtyStop(0) {}
+
+InstanceIndexPool::Range InstanceIndexPool::allocate(std::uint32_t size) {
+    Range range = allocator.allocate(size);
+    if (!range.isValid()) {
+        const std::uint32_t newCapacity = std::max(capacity() * 2, allocator.usedEnd() + size);
+        allocator.grow(newCapacity);
+        ids.resize(newCapacity, 0);
+        range = allocator.allocate(size);
+    }
+    return range;
+}
+
+void InstanceIndexPool::release(const Range& range) { allocator.release(range); }
+
+void InstanceIndexPool::set(std::uint32_t slot, std::uint32_t id) {
+    ids[slot] = id;
+    markDirty(slot, 1);
+}
+
+void InstanceIndexPool::copy(std::uint32_t dst, std::uint32_t src, std::uint32_t count) {
+    std::copy(ids.begin() + src, ids.begin() + src + count, ids.begin() + dst);
+    markDirty(dst, count);
+}
+
+void InstanceIndexPool::markClean() {
+    dirtyStart = CleanStart;
+    dirtyStop  = 0;
+}
+
+void InstanceIndexPool::markDirty(std::uint32_t start, std::uint32_t count) {
+    dirtyStart = std::min(dirtyStart, start);
+    dirtyStop  = std::max(dirtyStop, start + count);
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
@@ -19,6 +19,7 @@ Scene::Scene(engine::Engine& engine)
 , syncedResourcesOnFrame(cfg::Limits::MaxConcurrentFrames + 1)
 , isClearingQueues(false) {
     queuedBatchChanges.reserve(32);
+    queuedGeometryChanges.reserve(32);
     queuedAdds.reserve(32);
     queuedRemovals.reserve(32);
 }
@@ -66,6 +67,15 @@ void Scene::syncObjects() {
     }
     queuedBatchChanges.clear();
 
+    // regroup objects with changed geometry
+    for (scene::SceneObject* obj : queuedGeometryChanges) {
+        auto& objectPipelines =
+            obj->sceneKey.updateFreq == UpdateSpeed::Static ? staticPipelines : dynamicPipelines;
+        mat::MaterialPipeline* pipeline = objectPipelines[obj->sceneKey.sceneId];
+        if (pipeline) { doGeometryChange(obj, pipeline); }
+    }
+    queuedGeometryChanges.clear();
+
     // remove queued objects
     for (auto* obj : queuedRemovals) { removeQueuedObject(obj); }
     queuedRemovals.clear();
@@ -102,6 +112,13 @@ void Scene::rebucketObject(rcom::DrawableBase& obj) {
                     .newSpecialization = obj.getPipelineSpecialization()});
 }
 
+void Scene::updateObjectGeometry(rcom::DrawableBase& obj) {
+    std::unique_lock lock(queueMutex);
+    queuedGeometryChanges.emplace_back(obj.sceneRef.object);
+}
+
+void Scene::doGeometryChange(scene::SceneObject*, mat::MaterialPipeline*) {}
+
 void Scene::removeQueuedObject(scene::SceneObject* obj) {
     std::unique_lock lock(queueMutex);
 
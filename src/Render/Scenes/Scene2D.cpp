@@ -1,6 +1,8 @@
 #include <BLIB/Render/Scenes/Scene2D.hpp>
 
 #include <BLIB/Cameras/2D/Camera2D.hpp>
+#include <BLIB/Components/Transform2D.hpp>
+#include <BLIB/Engine/Engine.hpp>
 #include <BLIB/Render/Descriptors/Builtin/Scene2DFactory.hpp>
 
 namespace bl
@@ -31,6 +33,20 @@ void Scene2D::setDefaultNearAndFarPlanes(cam::Camera& cam) const {
     cam.setNearAndFarPlanes(DefaultNear, -DefaultFar);
 }
 
+bool Scene2D::getObjectTransform(ecs::Entity entity, std::uint32_t& version,
+                                 glm::mat4& transform) {
+    com::Transform2D* t = engine.ecs().getComponent<com::Transform2D>(entity);
+    if (!t) { return false; }
+
+    // refreshing the global transform bumps the version so it must come first
+    const glm::mat4& global = t->getGlobalTransform();
+    if (t->getVersion() != version) {
+        version   = t->getVersion();
+        transform = global;
+    }
+    return true;
+}
+
 void Scene2D::useRenderStrategy(rg::Strategy* ns) { strategy = ns; }
 
 rg::Strategy* Scene2D::getRenderStrategy() { return strategy; }
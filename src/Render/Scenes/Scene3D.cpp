@@ -1,6 +1,8 @@
 #include <BLIB/Render/Scenes/Scene3D.hpp>
 
 #include <BLIB/Cameras/3D/Camera3D.hpp>
+#include <BLIB/Components/Transform3D.hpp>
+#include <BLIB/Engine/Engine.hpp>
 #include <BLIB/Render/Descriptors/Builtin/Scene3DFactory.hpp>
 
 namespace bl
@@ -19,7 +21,12 @@ rg::Strategy* strategy = nullptr;
 
 Scene3D::Scene3D(engine::Engine& e)
 : BatchedScene(e)
-, lighting(shaderInputStore.getShaderResourceWithKey(sri::Scene3DLightingKey)->getBuffer()[0]) {}
+, lighting(shaderInputStore.getShaderResourceWithKey(sri::Scene3DLightingKey)->getBuffer()[0],
+           shaderInputStore.getShaderResourceWithKey(sri::Scene3DPointLightsKey)->getBuffer(),
+           shaderInputStore.getShaderResourceWithKey(sri::Scene3DSpotLightsKey)->getBuffer()) {
+    setInstancingEnabled(true);
+    setDrawSortingEnabled(true);
+}
 
 std::unique_ptr<cam::Camera> Scene3D::createDefaultCamera() {
     auto cam = std::make_unique<cam::Camera3D>();
@@ -31,7 +38,39 @@ void Scene3D::setDefaultNearAndFarPlanes(cam::Camera& cam) const {
     cam.setNearAndFarPlanes(DefaultNear, -DefaultFar);
 }
 
-void Scene3D::onShaderResourceSync() { lighting.sync(); }
+void Scene3D::onShaderResourceSync() {
+    lighting.sync();
+    BatchedScene::onShaderResourceSync();
+}
+
+bool Scene3D::getObjectTransform(ecs::Entity entity, std::uint32_t& version,
+                                 glm::mat4& transform) {
+    const com::Transform3D* t = engine.ecs().getComponent<com::Transform3D>(entity);
+    if (!t) { return false; }
+
+    // the version only changes once the hierarchy is propagated so stale globals always refresh
+    const std::uint32_t current = t->refreshRequired() ? UnknownTransformVersion : t->getVersion();
+    if (current != version || current == UnknownTransformVersion) {
+        version   = current;
+        transform = t->getGlobalTransform();
+    }
+    return true;
+}
+
+void Scene3D::collectShadowCullVolumes(std::vector<ShadowCullVolume>& volumes) {
+    const lgt::LightingDescriptor3D& data = lighting.getUniformData();
+    volumes.resize(1 + cfg::Limits::MaxSpotShadows + lighting.getPointShadowCount());
+
+    volumes[0] = ShadowCullVolume(data.sun.viewProjectionMatrix);
+    for (std::uint32_t i = 0; i < lighting.getSpotShadowCount(); ++i) {
+        volumes[1 + i] = ShadowCullVolume(data.spotlightsWithShadows[i].getViewProjectionMatrix());
+    }
+    for (std::uint32_t i = 0; i < lighting.getPointShadowCount(); ++i) {
+        const auto& light = data.pointLightsWithShadows[i];
+        volumes[1 + cfg::Limits::MaxSpotShadows + i] =
+            ShadowCullVolume(light.pos, light.planes.farPlane);
+    }
+}
 
 void Scene3D::useRenderStrategy(rg::Strategy* ns) { strategy = ns; }
 
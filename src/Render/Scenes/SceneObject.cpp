@@ -10,11 +10,8 @@ namespace scene
 {
 SceneObject::SceneObject()
 : entity(ecs::InvalidEntity)
-, component(nullptr) {}
-
-void SceneObject::updateRefToThis() {
-    if (component) { component->sceneRef.object = this; }
-}
+, component(nullptr)
+, batchIndex(0) {}
 
 } // namespace scene
 } // namespace rc
@@ -2,6 +2,7 @@
 
 #include <BLIB/Render/Buffers/IndexBuffer.hpp>
 #include <BLIB/Render/Components/DrawableBase.hpp>
+#include <algorithm>
 
 namespace bl
 {
@@ -47,7 +48,11 @@ void SceneRenderContext::bindDescriptors(VkPipelineLayout layout, UpdateSpeed sp
 }
 
 void SceneRenderContext::renderObject(const SceneObject& object) {
-    const auto& drawParams = object.component->getDrawParameters();
+    renderDraw(object.component->getDrawParameters(), object.sceneKey.sceneId);
+}
+
+void SceneRenderContext::renderDraw(const prim::DrawParameters& drawParams,
+                                    std::uint32_t sceneId) {
     if (!drawParams.vertexBuffer) { return; }
 
     if (prevVB != drawParams.vertexBuffer) {
@@ -65,8 +70,7 @@ void SceneRenderContext::renderObject(const SceneObject& object) {
                   drawParams.vertexCount,
                   drawParams.instanceCount,
                   drawParams.vertexOffset,
-                  drawParams.instanceCount == 1 ? object.sceneKey.sceneId :
-                                                  drawParams.firstInstance);
+                  drawParams.instanceCount == 1 ? sceneId : drawParams.firstInstance);
         break;
 
     case prim::DrawParameters::DrawType::IndexBuffer:
@@ -81,8 +85,7 @@ void SceneRenderContext::renderObject(const SceneObject& object) {
                          drawParams.instanceCount,
                          drawParams.indexOffset,
                          drawParams.vertexOffset,
-                         drawParams.instanceCount == 1 ? object.sceneKey.sceneId :
-                                                         drawParams.firstInstance);
+                         drawParams.instanceCount == 1 ? sceneId : drawParams.firstInstance);
         break;
     }
 }
@@ -91,6 +94,51 @@ void SceneRenderContext::renderObject(const rcom::DrawableBase& object) {
     renderObject(*object.getSceneRef().object);
 }
 
+void SceneRenderContext::renderIndirect(const IndirectDrawBuilder& draws, VkBuffer buffer,
+                                        VkDeviceSize offset, std::uint32_t maxDrawsPerCall) {
+    const VkDeviceSize vertexOffset = offset + draws.vertexCommandOffset();
+    maxDrawsPerCall                 = std::max(maxDrawsPerCall, 1u);
+
+    for (const auto& group : draws.getGroups()) {
+        if (prevVB != group.vertexBuffer) {
+            prevVB = group.vertexBuffer;
+
+            VkBuffer vertexBuffers[] = {group.vertexBuffer};
+            VkDeviceSize offsets[]   = {0};
+            vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        }
+
+        switch (group.type) {
+        case prim::DrawParameters::DrawType::VertexBuffer:
+            for (std::uint32_t i = 0; i < group.commandCount; i += maxDrawsPerCall) {
+                vkCmdDrawIndirect(commandBuffer,
+                                  buffer,
+                                  vertexOffset +
+                                      (group.firstCommand + i) * sizeof(VkDrawIndirectCommand),
+                                  std::min(group.commandCount - i, maxDrawsPerCall),
+                                  sizeof(VkDrawIndirectCommand));
+            }
+            break;
+
+        case prim::DrawParameters::DrawType::IndexBuffer:
+            if (prevIB != group.indexBuffer) {
+                prevIB = group.indexBuffer;
+                vkCmdBindIndexBuffer(
+                    commandBuffer, group.indexBuffer, 0, buf::IndexBuffer::IndexType);
+            }
+            for (std::uint32_t i = 0; i < group.commandCount; i += maxDrawsPerCall) {
+                vkCmdDrawIndexedIndirect(
+                    commandBuffer,
+                    buffer,
+                    offset + (group.firstCommand + i) * sizeof(VkDrawIndexedIndirectCommand),
+                    std::min(group.commandCount - i, maxDrawsPerCall),
+                    sizeof(VkDrawIndexedIndirectCommand));
+            }
+            break;
+        }
+    }
+}
+
 } // namespace scene
 } // namespace rc
 } // namespace bl
@@ -0,0 +1,187 @@
+#include <BLIB/Render/Scenes/VisibilityCuller.hpp>
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <memory>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace
+{
+glm::vec4 normalizePlane(const glm::vec4& plane) {
+    const float len = glm::length(glm::vec3(plane));
+    return len > 0.f ? plane / len : plane;
+}
+
+template<typename TCullRange>
+void cullAll(const std::array<CullingBounds, 2>& bounds, VisibilitySet::Stats& stats,
+             std::array<std::vector<std::uint8_t>, 2>& visible, util::ThreadPool* threadPool,
+             const TCullRange& cullRange) {
+    std::uint32_t bounded = 0;
+    std::uint32_t count   = 0;
+    std::vector<std::future<std::uint32_t>> futures;
+    if (threadPool && !threadPool->running()) { threadPool = nullptr; }
+
+    for (unsigned int s = 0; s < 2; ++s) {
+        const CullingBounds& b = bounds[s];
+        std::vector<std::uint8_t>& out = visible[s];
+        out.resize(b.size());
+        bounded += b.boundedCount();
+
+        if (!threadPool || b.size() < VisibilityCuller::MinParallelCount) {
+            count += cullRange(b, 0, b.size(), out.data());
+            continue;
+        }
+
+        const std::uint32_t taskCount = std::max(threadPool->workerCount(), 1u) * 2;
+        const std::uint32_t chunkSize =
+            std::max((b.size() + taskCount - 1) / taskCount, VisibilityCuller::MinParallelCount);
+        for (std::uint32_t i = 0; i < b.size(); i += chunkSize) {
+            const std::uint32_t end = std::min(i + chunkSize, b.size());
+            auto task = std::make_shared<std::packaged_task<std::uint32_t()>>(
+                [&cullRange, &b, &out, i, end]() { return cullRange(b, i, end, out.data()); });
+            futures.emplace_back(task->get_future());
+            threadPool->queueTask([task]() { (*task)(); });
+        }
+    }
+
+    for (auto& f : futures) { count += f.get(); }
+    stats.visible = count;
+    stats.culled  = bounded - count;
+}
+} // namespace
+
+Frustum Frustum::fromMatrix(const glm::mat4& m, bool includeDepthPlanes) {
+    const glm::vec4 r0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    const glm::vec4 r1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    const glm::vec4 r2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    const glm::vec4 r3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    Frustum f;
+    f.planes[0] = normalizePlane(r3 + r0);
+    f.planes[1] = normalizePlane(r3 - r0);
+    f.planes[2] = normalizePlane(r3 + r1);
+    f.planes[3] = normalizePlane(r3 - r1);
+    if (includeDepthPlanes) {
+        f.planes[4] = normalizePlane(r2);
+        f.planes[5] = normalizePlane(r3 - r2);
+    }
+    else {
+        // degenerate planes that everything is in front of
+        f.planes[4] = glm::vec4(0.f, 0.f, 0.f, std::numeric_limits<float>::max());
+        f.planes[5] = f.planes[4];
+    }
+    return f;
+}
+
+bool Frustum::containsSphere(const glm::vec3& center, float radius) const {
+    for (const glm::vec4& p : planes) {
+        if (glm::dot(glm::vec3(p), center) + p.w < -radius) { return false; }
+    }
+    return true;
+}
+
+CullingBounds::CullingBounds()
+: bounded(0) {}
+
+void CullingBounds::resize(std::uint32_t size) {
+    for (std::uint32_t i = size; i < radius.size(); ++i) { bounded -= radius[i] >= 0.f; }
+    centerX.resize(size, 0.f);
+    centerY.resize(size, 0.f);
+    centerZ.resize(size, 0.f);
+    radius.resize(size, -1.f);
+}
+
+void CullingBounds::set(std::uint32_t i, const glm::vec3& center, float r) {
+    centerX[i] = center.x;
+    centerY[i] = center.y;
+    centerZ[i] = center.z;
+    bounded    = bounded + (r >= 0.f) - (radius[i] >= 0.f);
+    radius[i]  = r;
+}
+
+void CullingBounds::setAlwaysVisible(std::uint32_t i, const glm::vec3& center) {
+    set(i, center, -1.f);
+}
+
+bool CullingBounds::getCenter(std::uint32_t i, glm::vec3& center) const {
+    if (i >= radius.size()) { return false; }
+    center = glm::vec3(centerX[i], centerY[i], centerZ[i]);
+    return true;
+}
+
+void VisibilitySet::clear() {
+    for (auto& v : visible) { v.clear(); }
+    stats = {};
+}
+
+void VisibilityCuller::cull(const std::array<CullingBounds, 2>& bounds, const Frustum& frustum,
+                            VisibilitySet& result, util::ThreadPool* threadPool) {
+    const auto cullFrustum =
+        [&frustum](const CullingBounds& b, std::uint32_t begin, std::uint32_t end,
+                   std::uint8_t* out) { return cullRange(b, frustum, begin, end, out); };
+    cullAll(bounds, result.stats, result.visible, threadPool, cullFrustum);
+}
+
+void VisibilityCuller::cull(const std::array<CullingBounds, 2>& bounds, const glm::vec3& center,
+                            float radius, VisibilitySet& result, util::ThreadPool* threadPool) {
+    const auto cullSphere = [&center, radius](const CullingBounds& b,
+                                              std::uint32_t begin,
+                                              std::uint32_t end,
+                                              std::uint8_t* out) {
+        return cullRange(b, center, radius, begin, end, out);
+    };
+    cullAll(bounds, result.stats, result.visible, threadPool, cullSphere);
+}
+
+std::uint32_t VisibilityCuller::cullRange(const CullingBounds& bounds, const Frustum& frustum,
+                                          std::uint32_t begin, std::uint32_t end,
+                                          std::uint8_t* out) {
+    const float* cx = bounds.centerX.data();
+    const float* cy = bounds.centerY.data();
+    const float* cz = bounds.centerZ.data();
+    const float* cr = bounds.radius.data();
+    const auto& p   = frustum.planes;
+
+    std::uint32_t count = 0;
+    for (std::uint32_t i = begin; i < end; ++i) {
+        float dist = std::numeric_limits<float>::max();
+        for (unsigned int j = 0; j < 6; ++j) {
+            dist = std::min(dist, p[j].x * cx[i] + p[j].y * cy[i] + p[j].z * cz[i] + p[j].w);
+        }
+        const std::uint8_t pass = (dist >= -cr[i]) & (cr[i] >= 0.f);
+        out[i]                  = pass | (cr[i] < 0.f);
+        count += pass;
+    }
+    return count;
+}
+
+std::uint32_t VisibilityCuller::cullRange(const CullingBounds& bounds, const glm::vec3& center,
+                                          float radius, std::uint32_t begin, std::uint32_t end,
+                                          std::uint8_t* out) {
+    const float* cx = bounds.centerX.data();
+    const float* cy = bounds.centerY.data();
+    const float* cz = bounds.centerZ.data();
+    const float* cr = bounds.radius.data();
+
+    std::uint32_t count = 0;
+    for (std::uint32_t i = begin; i < end; ++i) {
+        const float dx          = cx[i] - center.x;
+        const float dy          = cy[i] - center.y;
+        const float dz          = cz[i] - center.z;
+        const float r           = radius + cr[i];
+        const std::uint8_t pass = (dx * dx + dy * dy + dz * dz <= r * r) & (cr[i] >= 0.f);
+        out[i]                  = pass | (cr[i] < 0.f);
+        count += pass;
+    }
+    return count;
+}
+
+} // namespace scene
+} // namespace rc
+} // namespace bl
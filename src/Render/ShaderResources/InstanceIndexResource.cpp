@@ -0,0 +1,36 @@
+#include <BLIB/Render/ShaderResources/InstanceIndexResource.hpp>
+
+#include <BLIB/Render/Config/Limits.hpp>
+#include <BLIB/Render/Scenes/InstanceIndexPool.hpp>
+
+namespace bl
+{
+namespace rc
+{
+namespace sri
+{
+InstanceIndexResource::InstanceIndexResource()
+: dirtyFrames(0) {}
+
+void InstanceIndexResource::sync(scene::InstanceIndexPool& pool) {
+    if (!pool.isDirty()) { return; }
+
+    if (buffer.getSize() < pool.capacity()) {
+        buffer.resize(pool.capacity());
+        dirtyFrames = 0x1 << cfg::Limits::MaxConcurrentFrames;
+    }
+
+    for (std::uint32_t i = pool.dirtyBegin(); i < pool.dirtyEnd(); ++i) { buffer[i] = pool[i]; }
+    buffer.markDirty(pool.dirtyBegin(), pool.dirtyEnd() - pool.dirtyBegin());
+    pool.markClean();
+}
+
+void InstanceIndexResource::performTransfer() { dirtyFrames = dirtyFrames >> 1; }
+
+bool InstanceIndexResource::dynamicDescriptorUpdateRequired() const { return dirtyFrames > 0; }
+
+bool InstanceIndexResource::staticDescriptorUpdateRequired() const { return dirtyFrames > 0; }
+
+} // namespace sri
+} // namespace rc
+} // namespace bl
@@ -1,6 +1,8 @@
 #include <BLIB/Render/ShaderResources/ShaderResourceStore.hpp>
 
 #include <BLIB/Engine/Engine.hpp>
+#include <future>
+#include <vector>
 
 namespace bl
 {
@@ -24,7 +26,22 @@ void ShaderResourceStore::performTransfers() {
 }
 
 void ShaderResourceStore::updateFromSources() {
-    for (auto& pair : cache) { pair.second->copyFromSource(); }
+    util::ThreadPool& pool = engine.engineLoopThreadpool();
+    if (!pool.running()) {
+        for (auto& pair : cache) { pair.second->copyFromSource(); }
+        return;
+    }
+
+    // large copies go to workers while the remaining resources are copied here
+    std::vector<std::future<void>> futures;
+    for (auto& pair : cache) {
+        ShaderResource* resource = pair.second.get();
+        if (resource->copyFromSourceInParallel()) {
+            futures.emplace_back(pool.queueTask([resource]() { resource->copyFromSource(); }));
+        }
+        else { resource->copyFromSource(); }
+    }
+    for (auto& future : futures) { future.wait(); }
 }
 
 void ShaderResourceStore::initInput(ShaderResource& input) { input.init(engine, owner); }
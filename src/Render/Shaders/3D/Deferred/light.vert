@@ -18,16 +18,16 @@ void main() {
         vec3 lightPos = vec3(0.0);
         switch (lightType) {
         case LIGHT_TYPE_SPOT:
-            lightPos = lighting.spotLights[gl_InstanceIndex].position.xyz;
-            radius = lighting.spotLights[gl_InstanceIndex].attenuation.radius;
+            lightPos = spotLightStorage.spotLights[gl_InstanceIndex].position.xyz;
+            radius = spotLightStorage.spotLights[gl_InstanceIndex].attenuation.radius;
             break;
         case LIGHT_TYPE_SPOT_SHADOW:
             lightPos = lighting.spotShadows[gl_InstanceIndex].light.position.xyz;
             radius = lighting.spotShadows[gl_InstanceIndex].light.attenuation.radius;
             break;
         case LIGHT_TYPE_POINT:
-            lightPos = lighting.pointLights[gl_InstanceIndex].position.xyz;
-            radius = lighting.pointLights[gl_InstanceIndex].attenuation.radius;
+            lightPos = pointLightStorage.pointLights[gl_InstanceIndex].position.xyz;
+            radius = pointLightStorage.pointLights[gl_InstanceIndex].attenuation.radius;
             break;
         case LIGHT_TYPE_POINT_SHADOW:
             lightPos = lighting.pointShadows[gl_InstanceIndex].light.position.xyz;
@@ -27,7 +27,7 @@ vec4 computeLightColor(
         break;
     case LIGHT_TYPE_SPOT:
         lightColors = computeSpotLight(
-            lighting.spotLights[lightIndex],
+            spotLightStorage.spotLights[lightIndex],
             normal,
             position,
             viewDir,
@@ -48,7 +48,7 @@ vec4 computeLightColor(
         break;
     case LIGHT_TYPE_POINT:
         lightColors = computePointLight(
-            lighting.pointLights[lightIndex],
+            pointLightStorage.pointLights[lightIndex],
             normal,
             position,
             viewDir,
@@ -109,6 +109,18 @@ vec3 synthesizeLightColor(mat3 lightMatrix, vec3 diffuse, vec3 specular, float s
     return ambientComponent + diffuseComponent + specularComponent;
 }
 
+uint computeLightCluster(vec3 fragPos) {
+    uvec3 grid = lightClusters.gridSize.xyz;
+    vec2 tile = (gl_FragCoord.xy - lightClusters.viewport.xy) / lightClusters.viewport.zw;
+    uvec2 tileIndex = uvec2(clamp(tile * vec2(grid.xy), vec2(0.0), vec2(grid.xy) - 1.0));
+
+    float depth = max(-(camera.view * vec4(fragPos, 1.0)).z, 0.0001);
+    float slice = log(depth) * lightClusters.depthParams.x + lightClusters.depthParams.y;
+    uint sliceIndex = uint(clamp(slice, 0.0, float(grid.z) - 1.0));
+
+    return (sliceIndex * grid.y + tileIndex.y) * grid.x + tileIndex.x;
+}
+
 vec3 computeLighting(vec3 fragPos, vec3 normal, vec3 diffuse, vec3 specular, float shininess, float ssao) {
     vec3 viewDir = normalize(camera.camPos - fragPos);
 
@@ -120,9 +132,11 @@ vec3 computeLighting(vec3 fragPos, vec3 normal, vec3 diffuse, vec3 specular, flo
         lightColors += computePointLight(
             lighting.pointShadows[i].light, normal, fragPos, viewDir, shininess, shadow);
     }
-    for (uint i = 0; i < lighting.info.nPointLights; i += 1) {
-        lightColors +=
-            computePointLight(lighting.pointLights[i], normal, fragPos, viewDir, shininess, 1.0);
+    uvec4 cluster = lightClusters.clusters[computeLightCluster(fragPos)];
+    uint pointEnd = cluster.x + cluster.y;
+    for (uint i = cluster.x; i < pointEnd; i += 1) {
+        PointLight light = pointLightStorage.pointLights[clusterLightIndices.indices[i]];
+        lightColors += computePointLight(light, normal, fragPos, viewDir, shininess, 1.0);
     }
 
     for (uint i = 0; i < lighting.info.nSpotShadows; i += 1) {
@@ -130,9 +144,10 @@ vec3 computeLighting(vec3 fragPos, vec3 normal, vec3 diffuse, vec3 specular, flo
         lightColors += computeSpotLight(
             lighting.spotShadows[i].light, normal, fragPos, viewDir, shininess, shadow);
     }
-    for (uint i = 0; i < lighting.info.nSpotLights; i += 1) {
-        lightColors +=
-            computeSpotLight(lighting.spotLights[i], normal, fragPos, viewDir, shininess, 1.0);
+    uint spotEnd = pointEnd + cluster.z;
+    for (uint i = pointEnd; i < spotEnd; i += 1) {
+        SpotLight light = spotLightStorage.spotLights[clusterLightIndices.indices[i]];
+        lightColors += computeSpotLight(light, normal, fragPos, viewDir, shininess, 1.0);
     }
 
     return synthesizeLightColor(lightColors, diffuse, specular, ssao);
@@ -3,8 +3,8 @@
 
 #include "3D/Helpers/uniforms.glsl"
 
-mat4 computeBoneMatrix(uvec4 indices, vec4 weights) {
-    uint base = boneOffsets.boneOffsets[gl_InstanceIndex];
+mat4 computeBoneMatrix(uint objectIndex, uvec4 indices, vec4 weights) {
+    uint base = boneOffsets.boneOffsets[objectIndex];
     mat4 transform = bonePool.bones[base + indices[0]] * weights[0];
     transform += bonePool.bones[base + indices[1]] * weights[1];
     transform += bonePool.bones[base + indices[2]] * weights[2];
@@ -1,8 +1,6 @@
 #ifndef UNIFORMS_3D_INCLUDED
 #define UNIFORMS_3D_INCLUDED
 
-#define MAX_POINT_LIGHTS 128
-#define MAX_SPOT_LIGHTS 128
 #define MAX_SPOT_SHADOWS 16
 #define MAX_POINT_SHADOWS 16
 
@@ -25,13 +23,24 @@ layout(set = OBJECTS_SET_NUMBER, binding = 0) readonly buffer obj {
 layout(std430, set = OBJECTS_SET_NUMBER, binding = 1) readonly buffer tex {
     uint index[];
 } material;
+layout(std430, set = OBJECTS_SET_NUMBER, binding = 2) readonly buffer instance_ids {
+    uint ids[];
+} instances;
+
+// instanced draws offset their instances to index the scene ids of the instance buffer
+#define INSTANCE_INDEX_BASE 16777216
+
+uint resolveObjectIndex(int instanceIndex) {
+    return instanceIndex >= INSTANCE_INDEX_BASE ?
+        instances.ids[instanceIndex - INSTANCE_INDEX_BASE] : uint(instanceIndex);
+}
 #endif // OBJECTS_SET_NUMBER
 
 #ifdef OBJECTS_SKINNED_SET_NUMBER
-layout(std430, set = OBJECTS_SKINNED_SET_NUMBER, binding = 2) readonly buffer bone_pool {
+layout(std430, set = OBJECTS_SKINNED_SET_NUMBER, binding = 3) readonly buffer bone_pool {
     mat4 bones[];
 } bonePool;
-layout(std430, set = OBJECTS_SKINNED_SET_NUMBER, binding = 3) readonly buffer bone_info {
+layout(std430, set = OBJECTS_SKINNED_SET_NUMBER, binding = 4) readonly buffer bone_info {
     uint boneOffsets[];
 } boneOffsets;
 #endif // OBJECTS_SKINNED_SET_NUMBER
@@ -102,15 +111,27 @@ layout(set = SCENE_SET_NUMBER, binding = 0) uniform cam {
 layout(set = SCENE_SET_NUMBER, binding = 1) uniform block_light_info {
     LightInfo info;
 
-    SpotLight spotLights[MAX_SPOT_LIGHTS];
     SpotLightCaster spotShadows[MAX_SPOT_SHADOWS];
-
-    PointLight pointLights[MAX_POINT_LIGHTS];
     PointLightCaster pointShadows[MAX_POINT_SHADOWS];
 } lighting;
 layout(set = SCENE_SET_NUMBER, binding = 2) uniform sampler2DShadow spotShadowMaps[MAX_SPOT_SHADOWS];
 layout(set = SCENE_SET_NUMBER, binding = 3) uniform samplerCubeShadow pointShadowMaps[MAX_POINT_SHADOWS];
 layout(set = SCENE_SET_NUMBER, binding = 4) uniform sampler2D ssaoBuffer;
+layout(std140, set = SCENE_SET_NUMBER, binding = 5) readonly buffer block_point_lights {
+    PointLight pointLights[];
+} pointLightStorage;
+layout(std140, set = SCENE_SET_NUMBER, binding = 6) readonly buffer block_spot_lights {
+    SpotLight spotLights[];
+} spotLightStorage;
+layout(std430, set = SCENE_SET_NUMBER, binding = 7) readonly buffer block_light_clusters {
+    uvec4 gridSize;    // tiles x, tiles y, depth slices
+    vec4 depthParams;  // slice = log(depth) * x + y
+    vec4 viewport;     // x, y, width, height
+    uvec4 clusters[];  // light index offset, point light count, spot light count
+} lightClusters;
+layout(std430, set = SCENE_SET_NUMBER, binding = 8) readonly buffer block_light_indices {
+    uint indices[];
+} clusterLightIndices;
 #endif // SCENE_SET_NUMBER
 
 #ifdef LIGHT_CAM_SET_NUMBER
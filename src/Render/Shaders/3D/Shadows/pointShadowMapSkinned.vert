@@ -14,7 +14,8 @@ layout(location = 6) in vec4 boneWeights;
 #include "3D/Helpers/skinning.glsl"
 
 void main() {
-    mat4 boneTransform = computeBoneMatrix(boneIndices, boneWeights);
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    mat4 boneTransform = computeBoneMatrix(objectIndex, boneIndices, boneWeights);
+    ModelTransform model = object.model[objectIndex];
 	gl_Position = model.transform * boneTransform * vec4(inPosition, 1.0);
 }
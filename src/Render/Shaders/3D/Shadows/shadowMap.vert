@@ -8,6 +8,7 @@ layout(location = 0) in vec3 inPosition;
 #include "3D/Helpers/uniforms.glsl"
 
 void main() {
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    ModelTransform model = object.model[objectIndex];
 	gl_Position = lightCameras.viewProj[0] * model.transform * vec4(inPosition, 1.0);
 }
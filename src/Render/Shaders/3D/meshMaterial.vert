@@ -22,14 +22,15 @@ layout(location = 0) out VS_OUT {
 #include "3D/Helpers/constants.glsl"
 
 void main() {
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    ModelTransform model = object.model[objectIndex];
     vec4 inPos = vec4(inPosition, 1.0);
 
 	gl_Position = camera.projection * camera.view * model.transform * inPos;
     vs_out.fragPos = vec3(model.transform * inPos);
 	vs_out.fragColor = inColor;
 	vs_out.texCoords = inTexCoords;
-    vs_out.objectIndex = gl_InstanceIndex;
+    vs_out.objectIndex = objectIndex;
     
     vec3 T = normalize(mat3(model.transform) * inTangent);
     vec3 N = normalize(model.normal * inNormal);
@@ -23,8 +23,9 @@ layout(location = 0) out VS_OUT {
 #include "3D/Helpers/skinning.glsl"
 
 void main() {
-    mat4 boneTransform = computeBoneMatrix(boneIndices, boneWeights);
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    mat4 boneTransform = computeBoneMatrix(objectIndex, boneIndices, boneWeights);
+    ModelTransform model = object.model[objectIndex];
 
     vec4 inPos = vec4(inPosition, 1.0);
     vec4 outPos = model.transform * boneTransform * inPos;
@@ -33,7 +34,7 @@ void main() {
     vs_out.fragPos = vec3(outPos);
 	vs_out.fragColor = inColor;
 	vs_out.texCoords = inTexCoords;
-    vs_out.objectIndex = gl_InstanceIndex;
+    vs_out.objectIndex = objectIndex;
     
     mat3 boneNormal = mat3(transpose(inverse(boneTransform)));
     vec3 T = normalize(vec3(mat3(model.transform) * mat3(boneTransform) * inTangent));
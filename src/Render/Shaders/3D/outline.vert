@@ -16,7 +16,8 @@ layout(push_constant) uniform PushConstants {
 } outline;
 
 void main() {
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    ModelTransform model = object.model[objectIndex];
     vec4 inPos = vec4(inPosition, 1.0);
     vec3 normal = normalize(model.normal * inNormal);
 
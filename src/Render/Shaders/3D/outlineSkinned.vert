@@ -19,8 +19,9 @@ layout(push_constant) uniform PushConstants {
 } outline;
 
 void main() {
-    mat4 boneTransform = computeBoneMatrix(boneIndices, boneWeights);
-    ModelTransform model = object.model[gl_InstanceIndex];
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
+    mat4 boneTransform = computeBoneMatrix(objectIndex, boneIndices, boneWeights);
+    ModelTransform model = object.model[objectIndex];
     vec4 inPos = vec4(inPosition, 1.0);
     vec3 normal = normalize(model.normal * inNormal);
 
@@ -13,11 +13,13 @@ layout(location = 0) out VS_OUT {
 } vs_out;
 
 #define SCENE_SET_NUMBER 1
+#define OBJECTS_SET_NUMBER 2
 #include "3D/Helpers/uniforms.glsl"
 
 void main() {
+    uint objectIndex = resolveObjectIndex(gl_InstanceIndex);
     vs_out.texCoords = inPosition;
-    vs_out.objectIndex = gl_InstanceIndex;
+    vs_out.objectIndex = objectIndex;
     mat4 view = mat4(mat3(camera.view));
     vec4 pos = camera.projection * view * vec4(inPosition, 1.0);
     gl_Position = pos.xyww;
@@ -0,0 +1,80 @@
+#include <BLIB/Render/Transfers/StagingRing.hpp>
+
+#include <algorithm>
+
+namespace bl
+{
+namespace rc
+{
+namespace tfr
+{
+StagingRing::Stats::Stats()
+: highWaterMark(0)
+, frameBytes(0)
+, frameHighWaterMark(0)
+, fallbackCount(0)
+, fallbackBytes(0) {}
+
+StagingRing::StagingRing(std::uint64_t capacity)
+: size(capacity)
+, head(0)
+, inUse(0)
+, currentFrame(0) {}
+
+void StagingRing::beginFrame(std::uint32_t frame) {
+    for (Span& span : spans) {
+        if (span.frame == frame) { span.released = true; }
+    }
+
+    // regions are only reclaimed in order so that the free space stays contiguous
+    while (!spans.empty() && spans.front().released) {
+        inUse -= spans.front().bytes;
+        spans.pop_front();
+    }
+    if (inUse == 0) { head = 0; }
+
+    currentFrame     = frame;
+    stats.frameBytes = 0;
+}
+
+bool StagingRing::allocate(std::uint64_t bytes, std::uint64_t& offset, std::uint64_t alignment) {
+    if (bytes > size) { return false; }
+
+    std::uint64_t start = alignment > 1 ? (head + alignment - 1) / alignment * alignment : head;
+    if (start + bytes > size) {
+        // wrap around, the tail end of the ring is wasted until released
+        start = 0;
+    }
+    const std::uint64_t padding = start >= head ? start - head : size - head;
+    const std::uint64_t needed  = padding + bytes;
+    if (inUse + needed > size) { return false; }
+
+    offset = start;
+    head   = start + bytes;
+    inUse += needed;
+    if (!spans.empty() && spans.back().frame == currentFrame && !spans.back().released) {
+        spans.back().bytes += needed;
+    }
+    else { spans.emplace_back(Span{currentFrame, needed, false}); }
+
+    stats.frameBytes += bytes;
+    stats.highWaterMark      = std::max(stats.highWaterMark, inUse);
+    stats.frameHighWaterMark = std::max(stats.frameHighWaterMark, stats.frameBytes);
+    return true;
+}
+
+void StagingRing::recordFallback(std::uint64_t bytes) {
+    stats.fallbackCount += 1;
+    stats.fallbackBytes += bytes;
+    stats.frameBytes += bytes;
+    stats.frameHighWaterMark = std::max(stats.frameHighWaterMark, stats.frameBytes);
+}
+
+void StagingRing::resetStats() {
+    stats               = Stats();
+    stats.highWaterMark = inUse;
+}
+
+} // namespace tfr
+} // namespace rc
+} // namespace bl
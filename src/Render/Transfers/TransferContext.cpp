@@ -9,6 +9,7 @@ namespace rc
 namespace tfr
 {
 TransferContext::TransferContext(std::mutex& bucketMutex, vk::VulkanLayer& vs,
+                                 StagingRing& stagingRing, VkBuffer ringBuffer, void* ringMemory,
                                  std::vector<VkBuffer>& stagingBuffers,
                                  std::vector<VmaAllocation>& stagingAllocs,
                                  std::vector<VkMemoryBarrier>& memoryBarriers,
@@ -16,6 +17,9 @@ TransferContext::TransferContext(std::mutex& bucketMutex, vk::VulkanLayer& vs,
                                  std::vector<VkImageMemoryBarrier>& imageBarriers)
 : bucketMutex(bucketMutex)
 , vulkanState(vs)
+, stagingRing(stagingRing)
+, ringBuffer(ringBuffer)
+, ringMemory(ringMemory)
 , stagingBuffers(stagingBuffers)
 , stagingAllocs(stagingAllocs)
 , memoryBarriers(memoryBarriers)
@@ -41,6 +45,22 @@ void TransferContext::createTemporaryStagingBuffer(VkDeviceSize size, VkBuffer&
     *mapped = allocInfo.pMappedData;
 }
 
+void TransferContext::createTemporaryStagingBuffer(VkDeviceSize size, VkBuffer& bufferHandle,
+                                                   VkDeviceSize& offset, void** mapped) {
+    {
+        std::unique_lock lock(bucketMutex);
+        if (ringBuffer != VK_NULL_HANDLE && stagingRing.allocate(size, offset)) {
+            bufferHandle = ringBuffer;
+            *mapped      = static_cast<char*>(ringMemory) + offset;
+            return;
+        }
+        stagingRing.recordFallback(size);
+    }
+
+    offset = 0;
+    createTemporaryStagingBuffer(size, bufferHandle, mapped);
+}
+
 void TransferContext::registerMemoryBarrier(const VkMemoryBarrier& barrier) {
     std::unique_lock lock(bucketMutex);
     memoryBarriers.emplace_back(barrier);
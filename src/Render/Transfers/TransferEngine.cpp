@@ -2,6 +2,7 @@
 
 #include <BLIB/Render/Transfers/TransferContext.hpp>
 #include <BLIB/Render/Vulkan/VulkanLayer.hpp>
+#include <BLIB/Util/Profiler.hpp>
 
 namespace bl
 {
@@ -10,8 +11,12 @@ namespace rc
 namespace tfr
 {
 
-TransferEngine::Bucket::Bucket(vk::VulkanLayer& vs)
-: vulkanState(vs) {
+TransferEngine::Bucket::Bucket(vk::VulkanLayer& vs, VkDeviceSize stagingCapacity)
+: vulkanState(vs)
+, stagingRing(stagingCapacity)
+, ringBuffer(VK_NULL_HANDLE)
+, ringAlloc(VK_NULL_HANDLE)
+, ringMemory(nullptr) {
     oneTimeItems.reserve(32);
     everyFrameItems.reserve(32);
     stagingBuffers.init(vs, [](std::vector<VkBuffer>& bufs) { bufs.reserve(32); });
@@ -36,6 +41,17 @@ void TransferEngine::Bucket::init(VkCommandPool pool) {
     alloc.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     alloc.commandBufferCount = cfg::Limits::MaxConcurrentFrames;
     vkCheck(vkAllocateCommandBuffers(vulkanState.getDevice(), &alloc, commandBuffer.rawData()));
+
+    VmaAllocationInfo ringInfo;
+    vulkanState.createBuffer(
+        stagingRing.capacity(),
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &ringBuffer,
+        &ringAlloc,
+        &ringInfo);
+    ringMemory = ringInfo.pMappedData;
 }
 
 void TransferEngine::Bucket::cleanup(VkCommandPool pool) {
@@ -46,6 +62,8 @@ void TransferEngine::Bucket::cleanup(VkCommandPool pool) {
                              stagingAllocs.getRaw(j)[i]);
         }
     }
+    vmaDestroyBuffer(vulkanState.getVmaAllocator(), ringBuffer, ringAlloc);
+    ringBuffer = VK_NULL_HANDLE;
     fence.cleanup([this](VkFence f) { vkDestroyFence(vulkanState.getDevice(), f, nullptr); });
     vkFreeCommandBuffers(
         vulkanState.getDevice(), pool, cfg::Limits::MaxConcurrentFrames, commandBuffer.rawData());
@@ -53,8 +71,8 @@ void TransferEngine::Bucket::cleanup(VkCommandPool pool) {
 
 TransferEngine::TransferEngine(vk::VulkanLayer& vs)
 : vulkanState(vs)
-, immediateBucket(vs)
-, frameBucket(vs) {
+, immediateBucket(vs, StagingRing::DefaultCapacity)
+, frameBucket(vs, StagingRing::DefaultCapacity / 4) {
     tempVertices.reserve(64);
     tempIndices.reserve(64);
 }
@@ -84,6 +102,7 @@ std::uint32_t* TransferEngine::createOneTimeIndexStorage(std::uint32_t count) {
 }
 
 void TransferEngine::executeTransfers() {
+    BL_PROFILE_SCOPE("TransferEngine::executeTransfers");
     std::unique_lock lock(mutex);
 
     if (immediateBucket.hasTransfers()) { immediateBucket.executeTransfers(); }
@@ -111,6 +130,9 @@ void TransferEngine::Bucket::executeTransfers() {
     // queue transfer commands
     TransferContext context(mutex,
                             vulkanState,
+                            stagingRing,
+                            ringBuffer,
+                            ringMemory,
                             stagingBuffers.current(),
                             stagingAllocs.current(),
                             memoryBarriers,
@@ -162,6 +184,7 @@ void TransferEngine::Bucket::resetResourcesWithSync() {
     }
     stagingBuffers.current().clear();
     stagingAllocs.current().clear();
+    stagingRing.beginFrame(vulkanState.currentFrameIndex());
 }
 
 void TransferEngine::queueOneTimeTransfer(Transferable* item,
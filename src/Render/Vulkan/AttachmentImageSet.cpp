@@ -2,6 +2,7 @@
 
 #include <BLIB/Render/Renderer.hpp>
 #include <BLIB/Render/Vulkan/VulkanLayer.hpp>
+#include <algorithm>
 
 namespace bl
 {
@@ -9,6 +10,13 @@ namespace rc
 {
 namespace vk
 {
+namespace
+{
+VkDeviceSize alignUp(VkDeviceSize offset, VkDeviceSize alignment) {
+    return alignment > 1 ? (offset + alignment - 1) / alignment * alignment : offset;
+}
+} // namespace
+
 AttachmentImageSet::AttachmentImageSet()
 : owner(nullptr) {}
 
@@ -92,6 +100,54 @@ bool AttachmentImageSet::recreateForFormatChange() {
     return recreated;
 }
 
+VkMemoryRequirements AttachmentImageSet::getMemoryRequirements() const {
+    if (owner == nullptr) { return VkMemoryRequirements{}; }
+
+    VkMemoryRequirements total{0, 1, ~0u};
+    for (std::uint32_t i = 0; i < attachments.getAttachmentCount(); ++i) {
+        const VkMemoryRequirements req = buffers[i].getMemoryRequirements();
+        total.size                     = alignUp(total.size, req.alignment) + req.size;
+        total.alignment                = std::max(total.alignment, req.alignment);
+        total.memoryTypeBits &= req.memoryTypeBits;
+    }
+    return total;
+}
+
+void AttachmentImageSet::alias(VmaAllocation memory, VkDeviceSize offset) {
+    if (owner == nullptr) { return; }
+
+    auto commandBuffer = owner->getSharedCommandPool().createBuffer();
+    std::array<VkImageAspectFlags, MaxBufferCount> aspects;
+    for (std::uint32_t i = 0; i < attachments.getAttachmentCount(); ++i) {
+        const VkMemoryRequirements req = buffers[i].getMemoryRequirements();
+        offset                         = alignUp(offset, req.alignment);
+        aspects[i]                     = buffers[i].getAspect();
+        buffers[i].createAliased(*owner,
+                                 {.type    = ImageOptions::Type::Image2D,
+                                  .format  = buffers[i].getFormat(),
+                                  .usage   = buffers[i].getUsage(),
+                                  .extent  = attachments.getRenderExtent(),
+                                  .aspect  = aspects[i],
+                                  .samples = buffers[i].getSampleCount()},
+                                 memory,
+                                 offset);
+        offset += req.size;
+        images[i] = buffers[i].getImage();
+        views[i]  = buffers[i].getView();
+        buffers[i].clearAndTransition(commandBuffer,
+                                      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                      {.color = {{0.f, 0.f, 0.f, 1.f}}});
+    }
+    commandBuffer.submit();
+
+    attachments.init(attachments.getAttachmentCount(),
+                     images.data(),
+                     views.data(),
+                     aspects.data(),
+                     attachments.getRenderExtent(),
+                     buffers[0].getLayerCount());
+}
+
 } // namespace vk
 } // namespace rc
 } // namespace bl
\ No newline at end of file
@@ -31,8 +31,12 @@ ComputePipeline::ComputePipeline(Renderer& renderer, std::uint32_t id,
     createInfo.stage.pSpecializationInfo = &specInfo;
     createInfo.layout                    = layout->rawLayout();
 
-    vkCheck(vkCreateComputePipelines(
-        renderer.vulkanState().getDevice(), VK_NULL_HANDLE, 1, &createInfo, nullptr, &pipeline));
+    vkCheck(vkCreateComputePipelines(renderer.vulkanState().getDevice(),
+                                     renderer.pipelineCache().getVulkanCache(),
+                                     1,
+                                     &createInfo,
+                                     nullptr,
+                                     &pipeline));
 }
 
 ComputePipeline::~ComputePipeline() {
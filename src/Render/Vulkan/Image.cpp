@@ -48,7 +48,8 @@ Image::Image()
 Image::~Image() { deferDestroy(); }
 
 void Image::create(Renderer& r, const ImageOptions& options) {
-    if (renderer && compareOptions(createOptions, options)) { return; }
+    // aliased images are always re-created so that they stop using the shared memory
+    if (renderer && alloc && compareOptions(createOptions, options)) { return; }
 
     deferDestroy();
     renderer      = &r;
@@ -62,6 +63,47 @@ void Image::create(Renderer& r, const ImageOptions& options) {
     allocInfo.usage         = VMA_MEMORY_USAGE_AUTO;
     allocInfo.flags         = createOptions.allocFlags;
 
+    const VkImageCreateInfo createInfo = makeCreateInfo();
+    if (vmaCreateImage(renderer->vulkanState().getVmaAllocator(),
+                       &createInfo,
+                       &allocInfo,
+                       &imageHandle,
+                       &alloc,
+                       nullptr) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create image");
+    }
+    createView();
+}
+
+void Image::createAliased(Renderer& r, const ImageOptions& options, VmaAllocation memory,
+                          VkDeviceSize offset) {
+    deferDestroy();
+    renderer      = &r;
+    createOptions = options;
+    if (createOptions.viewAspect == VK_IMAGE_ASPECT_FLAG_BITS_MAX_ENUM) {
+        createOptions.viewAspect = createOptions.aspect;
+    }
+
+    // no allocation is owned, destruction only destroys the image
+    alloc                              = nullptr;
+    const VkImageCreateInfo createInfo = makeCreateInfo();
+    if (vmaCreateAliasingImage2(renderer->vulkanState().getVmaAllocator(),
+                                memory,
+                                offset,
+                                &createInfo,
+                                &imageHandle) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create aliased image");
+    }
+    createView();
+}
+
+VkMemoryRequirements Image::getMemoryRequirements() const {
+    VkMemoryRequirements requirements{};
+    vkGetImageMemoryRequirements(renderer->vulkanState().getDevice(), imageHandle, &requirements);
+    return requirements;
+}
+
+VkImageCreateInfo Image::makeCreateInfo() const {
     VkImageCreateInfo createInfo{};
     createInfo.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     createInfo.imageType     = VK_IMAGE_TYPE_2D;
@@ -77,15 +119,10 @@ void Image::create(Renderer& r, const ImageOptions& options) {
     createInfo.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
     createInfo.samples       = createOptions.samples;
     createInfo.flags         = getCreateFlags(createOptions.type) | createOptions.extraCreateFlags;
-    if (vmaCreateImage(renderer->vulkanState().getVmaAllocator(),
-                       &createInfo,
-                       &allocInfo,
-                       &imageHandle,
-                       &alloc,
-                       nullptr) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create image");
-    }
+    return createInfo;
+}
 
+void Image::createView() {
     viewHandle    = renderer->vulkanState().createImageView(imageHandle,
                                                          createOptions.format,
                                                          createOptions.viewAspect,
@@ -13,13 +13,16 @@ Pipeline::Pipeline(Renderer& renderer, std::uint32_t id, PipelineParameters&& pa
 , renderer(renderer)
 , createParams(params) {
     layout = renderer.pipelineLayoutCache().getLayout(std::move(params.layoutParams));
-    for (auto& set : pipelines) { set.fill(nullptr); }
+    for (auto& set : pipelines) {
+        for (auto& pipeline : set) { pipeline.store(nullptr, std::memory_order_relaxed); }
+    }
     subscribe(renderer.getSignalChannel());
 }
 
 Pipeline::~Pipeline() {
     for (auto& set : pipelines) {
-        for (const VkPipeline pipeline : set) {
+        for (const auto& handle : set) {
+            const VkPipeline pipeline = handle.load(std::memory_order_acquire);
             if (pipeline != nullptr) {
                 vkDestroyPipeline(renderer.vulkanState().getDevice(), pipeline, nullptr);
             }
@@ -28,9 +31,8 @@ Pipeline::~Pipeline() {
 }
 
 void Pipeline::bind(VkCommandBuffer commandBuffer, std::uint32_t renderPassId, std::uint32_t spec) {
-    if (!pipelines[spec][renderPassId]) { createForRenderPass(renderPassId, spec); }
     vkCmdBindPipeline(
-        commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[spec][renderPassId]);
+        commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, rawPipeline(renderPassId, spec));
     if (createParams.rasterizer.depthBiasEnable == VK_TRUE) {
         const auto& s = renderer.getSettings();
         vkCmdSetDepthBias(commandBuffer,
@@ -40,6 +42,11 @@ void Pipeline::bind(VkCommandBuffer commandBuffer, std::uint32_t renderPassId, s
     }
 }
 
+void Pipeline::precompile(std::uint32_t rpid, std::uint32_t spec) {
+    std::unique_lock lock(createMutex);
+    if (!pipelines[spec][rpid].load(std::memory_order_relaxed)) { createForRenderPass(rpid, spec); }
+}
+
 void Pipeline::createForRenderPass(std::uint32_t rpid, std::uint32_t spec) {
     PipelineSpecialization& specialization =
         spec > 0 && spec <= createParams.specializations.size() ?
@@ -171,15 +178,19 @@ void Pipeline::createForRenderPass(std::uint32_t rpid, std::uint32_t spec) {
     pipelineInfo.basePipelineIndex   = -1;             // Optional
     pipelineInfo.renderPass          = renderPass.rawPass();
 
+    VkPipeline pipeline = nullptr;
     if (vkCreateGraphicsPipelines(renderer.vulkanState().getDevice(),
-                                  VK_NULL_HANDLE,
+                                  renderer.pipelineCache().getVulkanCache(),
                                   1,
                                   &pipelineInfo,
                                   nullptr,
-                                  &pipelines[spec][rpid]) != VK_SUCCESS) {
+                                  &pipeline) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create graphics pipeline");
     }
 
+    // publish after creation so lock-free readers never see a partially created handle
+    pipelines[spec][rpid].store(pipeline, std::memory_order_release);
+
     // reset sample shading setting
     createParams.msaa.sampleShadingEnable = sampleShadingSetting;
 }
@@ -204,12 +215,13 @@ void Pipeline::process(const event::RenderPassInvalidated& event) {
 }
 
 void Pipeline::recreateForRenderPass(std::uint32_t rpid) {
+    std::unique_lock lock(createMutex);
     for (std::uint32_t spec = 0; spec < pipelines[rpid].size(); ++spec) {
-        if (pipelines[spec][rpid]) {
-            renderer.getCleanupManager().add(
-                [device = renderer.vulkanState().getDevice(), pipeline = pipelines[spec][rpid]]() {
-                    vkDestroyPipeline(device, pipeline, nullptr);
-                });
+        const VkPipeline old = pipelines[spec][rpid].load(std::memory_order_relaxed);
+        if (old) {
+            renderer.getCleanupManager().add([device = renderer.vulkanState().getDevice(), old]() {
+                vkDestroyPipeline(device, old, nullptr);
+            });
             createForRenderPass(rpid, spec);
         }
     }
@@ -0,0 +1,84 @@
+#include <BLIB/Render/Vulkan/PipelineCacheFile.hpp>
+
+#include <BLIB/Logging.hpp>
+#include <BLIB/Util/FileUtil.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace bl
+{
+namespace rc
+{
+namespace vk
+{
+std::string PipelineCacheFile::getFilename(const VkPhysicalDeviceProperties& props) {
+    std::stringstream ss;
+    ss << "pipelines-" << std::hex << props.vendorID << "-" << props.deviceID << "-";
+    for (const std::uint8_t byte : props.pipelineCacheUUID) {
+        ss << std::setw(2) << std::setfill('0') << static_cast<unsigned int>(byte);
+    }
+    ss << ".bin";
+    return ss.str();
+}
+
+bool PipelineCacheFile::isCompatible(const std::vector<char>& data,
+                                     const VkPhysicalDeviceProperties& props) {
+    VkPipelineCacheHeaderVersionOne header{};
+    if (data.size() < sizeof(header)) { return false; }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header) && header.headerSize <= data.size() &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == props.vendorID && header.deviceID == props.deviceID &&
+           std::memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+std::vector<char> PipelineCacheFile::load(const std::string& directory,
+                                          const VkPhysicalDeviceProperties& props) {
+    std::vector<char> data;
+    const std::string path = util::FileUtil::joinPath(directory, getFilename(props));
+    if (!util::FileUtil::exists(path)) { return data; }
+
+    if (!util::FileUtil::readFile(path, data) || !isCompatible(data, props)) {
+        BL_LOG_WARN << "Ignoring invalid or incompatible pipeline cache: " << path;
+        data.clear();
+    }
+    return data;
+}
+
+bool PipelineCacheFile::save(const std::string& directory, const VkPhysicalDeviceProperties& props,
+                             const std::vector<char>& data) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        BL_LOG_WARN << "Failed to create pipeline cache directory " << directory << ": "
+                    << ec.message();
+        return false;
+    }
+
+    const std::string path = util::FileUtil::joinPath(directory, getFilename(props));
+    const std::string temp = path + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size());
+        if (!file.good()) {
+            BL_LOG_WARN << "Failed to write pipeline cache: " << temp;
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        BL_LOG_WARN << "Failed to save pipeline cache " << path << ": " << ec.message();
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace vk
+} // namespace rc
+} // namespace bl
@@ -379,13 +379,16 @@ namespace std
 {
 std::size_t std::hash<bl::rc::vk::PipelineParameters>::operator()(
     const bl::rc::vk::PipelineParameters& params) const {
-    // hashing the shaders is generally enough as we do not need speed nor will we have many
-    // pipelines sharing the same set of shaders
+    // only hash state that is compared for equality and is not changed by dynamic modifiers or
+    // pipeline creation so that the hash of cached parameters remains valid
     std::size_t result = hash<size_t>()(params.shaders.size());
     for (unsigned int i = 0; i < params.shaders.size(); ++i) {
         const size_t nh = hash<std::string>()(params.shaders[i].path);
         result          = bl::util::hashCombine(result, nh);
+        result          = bl::util::hashCombine(result, params.shaders[i].stage);
     }
+    result = bl::util::hashCombine(result, params.primitiveType);
+    result = bl::util::hashCombine(result, params.vertexAttributes.size());
     return result;
 }
 } // namespace std
@@ -30,8 +30,9 @@ void Swapchain::Frame::init(VulkanLayer& vulkanState) {
         throw std::runtime_error("Failed to create fence");
     }
 
-    commandPool = vulkanState.createCommandPool(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT |
-                                                VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    commandPool   = vulkanState.createCommandPool(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT |
+                                                  VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    parallelCount = 0;
 
     // create command buffer
     VkCommandBufferAllocateInfo allocInfo{};
@@ -49,6 +50,11 @@ void Swapchain::Frame::cleanup(VulkanLayer& vulkanState) {
     vkDestroySemaphore(vulkanState.getDevice(), renderFinishedSemaphore, nullptr);
     vkDestroyFence(vulkanState.getDevice(), commandBufferFence, nullptr);
     vkDestroyCommandPool(vulkanState.getDevice(), commandPool, nullptr);
+    for (VkCommandPool pool : parallelPools) {
+        vkDestroyCommandPool(vulkanState.getDevice(), pool, nullptr);
+    }
+    parallelPools.clear();
+    parallelBuffers.clear();
 }
 
 void Swapchain::Swapframes::init(VulkanLayer& vulkanState) {
@@ -125,6 +131,7 @@ void Swapchain::beginFrame(AttachmentSet*& renderFrame, VkCommandBuffer& cb) {
     vkCheck(vkResetCommandBuffer(frameData.current().commandBuffer, 0));
     vkCheck(vkResetFences(
         renderer.vulkanState().getDevice(), 1, &frameData.current().commandBufferFence));
+    frameData.current().parallelCount = 0;
 
     // begin command buffer
     VkCommandBufferBeginInfo beginInfo{};
@@ -157,7 +164,19 @@ void Swapchain::completeFrame() {
     submitInfo.pSignalSemaphores    = signalSemaphores;
     submitInfo.commandBufferCount   = 1;
     submitInfo.pCommandBuffers      = &frameData.current().commandBuffer;
-    renderer.vulkanState().submitCommandBuffer(submitInfo, frameData.current().commandBufferFence);
+
+    // parallel recorded buffers follow the primary so that submission order matches recording
+    Frame& frame = frameData.current();
+    if (frame.parallelCount > 0) {
+        submitBuffers.clear();
+        submitBuffers.emplace_back(frame.commandBuffer);
+        submitBuffers.insert(submitBuffers.end(),
+                             frame.parallelBuffers.begin(),
+                             frame.parallelBuffers.begin() + frame.parallelCount);
+        submitInfo.commandBufferCount = static_cast<std::uint32_t>(submitBuffers.size());
+        submitInfo.pCommandBuffers    = submitBuffers.data();
+    }
+    renderer.vulkanState().submitCommandBuffer(submitInfo, frame.commandBufferFence);
 
     // trigger swap chain
     VkPresentInfoKHR presentInfo{};
@@ -183,6 +202,34 @@ void Swapchain::completeFrame() {
     }
 }
 
+VkCommandBuffer* Swapchain::getParallelCommandBuffers(std::uint32_t count) {
+    Frame& frame        = frameData.current();
+    VulkanLayer& vs     = renderer.vulkanState();
+    frame.parallelCount = count;
+
+    while (frame.parallelPools.size() < count) {
+        frame.parallelPools.emplace_back(
+            vs.createCommandPool(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT));
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool        = frame.parallelPools.back();
+        allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        frame.parallelBuffers.emplace_back();
+        if (vkAllocateCommandBuffers(vs.getDevice(), &allocInfo, &frame.parallelBuffers.back()) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate command buffers");
+        }
+    }
+
+    // reset alongside the primary command buffer of this frame in beginFrame()
+    for (std::uint32_t i = 0; i < count; ++i) {
+        vkCheck(vkResetCommandPool(vs.getDevice(), frame.parallelPools[i], 0));
+    }
+    return frame.parallelBuffers.data();
+}
+
 void Swapchain::cleanup() {
     for (AttachmentSet& frame : renderFrames) {
         vkDestroyImageView(renderer.vulkanState().getDevice(), frame.getImageView(0), nullptr);
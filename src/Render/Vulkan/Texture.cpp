@@ -166,8 +166,9 @@ void Texture::executeTransfer(VkCommandBuffer cb, tfr::TransferContext& engine)
         // create staging buffer
         const VkDeviceSize stageSize = source.size.x * source.size.y * 4 * image.getLayerCount();
         VkBuffer stagingBuffer;
+        VkDeviceSize stagingOffset;
         void* data;
-        engine.createTemporaryStagingBuffer(stageSize, stagingBuffer, &data);
+        engine.createTemporaryStagingBuffer(stageSize, stagingBuffer, stagingOffset, &data);
         if (!fullImage) { copyImageToStaging(src, data, source); }
         else { std::memcpy(data, src.getPixelsPtr(), stageSize); }
 
@@ -180,7 +181,7 @@ void Texture::executeTransfer(VkCommandBuffer cb, tfr::TransferContext& engine)
         VkBufferImageCopy copyInfos[6]{};
         for (unsigned int face = 0; face < image.getLayerCount(); ++face) {
             auto& copyInfo                           = copyInfos[face];
-            copyInfo.bufferOffset                    = face * layerSize;
+            copyInfo.bufferOffset                    = stagingOffset + face * layerSize;
             copyInfo.bufferRowLength                 = 0;
             copyInfo.bufferImageHeight               = 0;
             copyInfo.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -224,8 +225,10 @@ void Texture::executeTransfer(VkCommandBuffer cb, tfr::TransferContext& engine)
 
                 // get one combined staging buffer
                 VkBuffer mipStaging;
+                VkDeviceSize mipStagingOffset;
                 void* stagingDst = nullptr;
-                engine.createTemporaryStagingBuffer(totalSize, mipStaging, &stagingDst);
+                engine.createTemporaryStagingBuffer(
+                    totalSize, mipStaging, mipStagingOffset, &stagingDst);
 
                 // gen on cpu
                 sf::Image mipSrc = Image::genMipMapsOnCpu(src);
@@ -236,7 +239,7 @@ void Texture::executeTransfer(VkCommandBuffer cb, tfr::TransferContext& engine)
                 for (unsigned int i = 1; i < mipLevels; ++i) {
                     // copy from staging to mip image
                     auto& copy              = copyInfos[i - 1];
-                    copy.bufferOffset       = baseOffset;
+                    copy.bufferOffset       = mipStagingOffset + baseOffset;
                     copy.bufferImageHeight  = 0;
                     copy.bufferRowLength    = 0;
                     copy.imageExtent.width  = bounds.size.x;
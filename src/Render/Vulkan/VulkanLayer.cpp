@@ -380,7 +380,9 @@ void VulkanLayer::createLogicalDevice() {
     deviceFeatures.samplerAnisotropy = VK_TRUE;
     deviceFeatures.wideLines =
         physicalDeviceProperties.limits.lineWidthRange[1] > 1.f ? VK_TRUE : VK_FALSE;
-    deviceFeatures.sampleRateShading = physicalDeviceFeatures.sampleRateShading;
+    deviceFeatures.sampleRateShading         = physicalDeviceFeatures.sampleRateShading;
+    deviceFeatures.multiDrawIndirect         = physicalDeviceFeatures.multiDrawIndirect;
+    deviceFeatures.drawIndirectFirstInstance = physicalDeviceFeatures.drawIndirectFirstInstance;
 
     // extension features
     VkPhysicalDeviceShaderAtomicFloatFeaturesEXT atomicFloatFeatures{};
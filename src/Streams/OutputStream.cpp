@@ -81,6 +81,22 @@ bool OutputStream::write(const void* voidData, std::size_t len) {
                       stream);
 }
 
+bool OutputStream::canPatch() const { return getMode() == Mode::Memory; }
+
+std::size_t OutputStream::position() const { return getBuffer().size(); }
+
+bool OutputStream::patch(std::size_t position, const void* data, std::size_t len) {
+    std::vector<char>* buffer = std::get_if<std::vector<char>>(&stream);
+    if (!buffer) {
+        std::vector<char>** external = std::get_if<std::vector<char>*>(&stream);
+        buffer                       = external ? *external : nullptr;
+    }
+    if (!buffer || position + len > buffer->size()) { return false; }
+
+    std::memcpy(buffer->data() + position, data, len);
+    return true;
+}
+
 std::span<const char> OutputStream::getBuffer() const {
     if (auto* buffer = std::get_if<std::vector<char>>(&stream)) {
         return std::span<const char>(buffer->data(), buffer->size());
@@ -18,6 +18,8 @@ constexpr std::uint32_t InitialSlideshowFrameCapacity = 128;
 Animation2DSystem::Animation2DSystem(rc::Renderer& renderer)
 : renderer(renderer)
 , players(nullptr)
+, vertexPool(nullptr)
+, transformPool(nullptr)
 , slideshowFrameRangeAllocator(InitialSlideshowFrameCapacity)
 , slideshowRefreshRequired(rc::cfg::Limits::MaxConcurrentFrames)
 , slideshowLastFrameUpdated(255) {
@@ -50,8 +52,9 @@ void Animation2DSystem::init(engine::Engine& engine) {
                            .getOrCreateFactory<rc::dsi::SlideshowFactory>()
                            ->getDescriptorLayout();
 
-    players    = &engine.ecs().getAllComponents<com::Animation2DPlayer>();
-    vertexPool = &engine.ecs().getAllComponents<com::Animation2D>();
+    players       = &engine.ecs().getAllComponents<com::Animation2DPlayer>();
+    vertexPool    = &engine.ecs().getAllComponents<com::Animation2D>();
+    transformPool = &engine.ecs().getAllComponents<com::Transform2D>();
 
     slideshowFramesSSBO.create(renderer, InitialSlideshowFrameCapacity);
     slideshowFrameOffsetSSBO.create(renderer, 32);
@@ -63,9 +66,23 @@ void Animation2DSystem::init(engine::Engine& engine) {
     subscribe(engine.ecs().getSignalChannel());
 }
 
+AnimationLod& Animation2DSystem::lod() { return lodPolicy; }
+
+const AnimationLod::Stats& Animation2DSystem::getLodStats() const { return lodStats; }
+
 void Animation2DSystem::update(std::mutex&, float dt, float, float, float) {
     // play animations
-    players->forEach([dt](ecs::Entity, com::Animation2DPlayer& player) { player.update(dt); });
+    lodStats.reset();
+    if (lodPolicy.isEnabled()) { lodPolicy.refreshObservers(renderer); }
+    players->forEach([this, dt](ecs::Entity entity, com::Animation2DPlayer& player) {
+        if (!player.playing()) { return; }
+
+        const com::Transform2D* transform = transformPool->get(entity);
+        const float distance =
+            transform ? lodPolicy.distanceTo2D(transform->getGlobalPosition()) : 0.f;
+        const float elapsed = lodPolicy.advance(player.lod, distance, dt, lodStats);
+        if (elapsed >= 0.f) { player.update(elapsed); }
+    });
 
     // perform slideshow uploads
     slideshowPlayerCurrentFrameSSBO.markFullDirty(); // always upload all play indices
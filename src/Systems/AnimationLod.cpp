@@ -0,0 +1,121 @@
+#include <BLIB/Systems/AnimationLod.hpp>
+
+#include <BLIB/Cameras/2D/Camera2D.hpp>
+#include <BLIB/Render/Renderer.hpp>
+#include <algorithm>
+
+namespace bl
+{
+namespace sys
+{
+namespace
+{
+void addObserverFrom(AnimationLod& lod, rc::RenderTarget& target) {
+    if (!target.hasScene()) { return; }
+    cam::Camera* camera = target.getCurrentCamera();
+    if (!camera) { return; }
+
+    const cam::Camera2D* cam2d = dynamic_cast<const cam::Camera2D*>(camera);
+    lod.addObserver(camera->getObserverPosition(),
+                    cam2d ? cam2d->getSize() * 0.5f : glm::vec2(0.f, 0.f));
+}
+} // namespace
+
+AnimationLod::AnimationLod()
+: enabled(true) {
+    clearLevels();
+}
+
+void AnimationLod::setEnabled(bool e) { enabled = e; }
+
+bool AnimationLod::isEnabled() const { return enabled; }
+
+void AnimationLod::addLevel(float minDistance, std::uint32_t updateInterval,
+                            std::uint32_t maxBoneDepth) {
+    const auto it =
+        std::upper_bound(levels.begin(), levels.end(), minDistance, [](float d, const Level& l) {
+            return d < l.minDistance;
+        });
+    levels.insert(it, Level{minDistance, updateInterval, maxBoneDepth});
+}
+
+void AnimationLod::clearLevels() {
+    levels.clear();
+    levels.emplace_back(Level{0.f, 1, AllBones});
+}
+
+std::uint32_t AnimationLod::levelCount() const { return levels.size(); }
+
+const AnimationLod::Level& AnimationLod::getLevel(std::uint32_t index) const {
+    return levels[index];
+}
+
+std::uint32_t AnimationLod::selectLevel(float distance) const {
+    const auto it =
+        std::upper_bound(levels.begin(), levels.end(), distance, [](float d, const Level& l) {
+            return d < l.minDistance;
+        });
+    return it == levels.begin() ? 0 : std::distance(levels.begin(), it) - 1;
+}
+
+void AnimationLod::refreshObservers(rc::Renderer& renderer) {
+    clearObservers();
+    addObserverFrom(*this, renderer.getCommonObserver());
+    for (unsigned int i = 0; i < renderer.observerCount(); ++i) {
+        addObserverFrom(*this, renderer.getObserver(i));
+    }
+}
+
+void AnimationLod::clearObservers() { observers.clear(); }
+
+void AnimationLod::addObserver(const glm::vec3& position, const glm::vec2& halfExtents) {
+    observers.emplace_back(ObserverInfo{position, halfExtents});
+}
+
+float AnimationLod::distanceTo2D(const glm::vec2& position) const {
+    if (observers.empty()) { return 0.f; }
+
+    float minDist = std::numeric_limits<float>::max();
+    for (const ObserverInfo& o : observers) {
+        const glm::vec2 delta =
+            glm::max(glm::abs(position - glm::vec2(o.position)) - o.halfExtents, glm::vec2(0.f));
+        minDist = std::min(minDist, glm::length(delta));
+    }
+    return minDist;
+}
+
+float AnimationLod::distanceTo3D(const glm::vec3& position) const {
+    if (observers.empty()) { return 0.f; }
+
+    float minDist = std::numeric_limits<float>::max();
+    for (const ObserverInfo& o : observers) {
+        minDist = std::min(minDist, glm::distance(position, o.position));
+    }
+    return minDist;
+}
+
+float AnimationLod::advance(State& state, float distance, float dt, Stats& stats) const {
+    state.level = (enabled && state.enabled) ? selectLevel(distance) : 0;
+    const Level& level = levels[state.level];
+
+    if (level.updateInterval == Frozen) {
+        ++stats.frozen;
+        return -1.f;
+    }
+
+    state.accumulatedTime += dt;
+    ++state.ticksSinceUpdate;
+    if (state.ticksSinceUpdate < level.updateInterval) {
+        ++stats.throttled;
+        return -1.f;
+    }
+
+    const float elapsed    = state.accumulatedTime;
+    state.accumulatedTime  = 0.f;
+    state.ticksSinceUpdate = 0;
+    ++stats.evaluated;
+    return elapsed;
+}
+
+} // namespace sys
+} // namespace bl
@@ -10,13 +10,39 @@ namespace bl
 {
 namespace sys
 {
+SkeletalAnimationSystem::SkeletalAnimationSystem()
+: renderer(nullptr)
+, skeletons(nullptr) {}
+
 void SkeletalAnimationSystem::init(engine::Engine& engine) {
+    renderer  = &engine.renderer();
     skeletons = &engine.ecs().getAllComponents<com::Skeleton>();
 }
 
-void SkeletalAnimationSystem::update(std::mutex&, float dt, float, float, float) {
-    skeletons->forEach([dt](ecs::Entity, com::Skeleton& skeleton) {
+AnimationLod& SkeletalAnimationSystem::lod() { return lodPolicy; }
+
+const AnimationLod::Stats& SkeletalAnimationSystem::getLodStats() const { return lodStats; }
+
+void SkeletalAnimationSystem::update(std::mutex&, float frameDt, float, float, float) {
+    lodStats.reset();
+    if (lodPolicy.isEnabled()) { lodPolicy.refreshObservers(*renderer); }
+
+    skeletons->forEach([this, frameDt](ecs::Entity, com::Skeleton& skeleton) {
         if (skeleton.needsRefresh || !skeleton.activeAnimations.empty()) {
+            float dt = frameDt;
+            if (!skeleton.needsRefresh) {
+                const float distance =
+                    skeleton.worldTransform ?
+                        lodPolicy.distanceTo3D(
+                            glm::vec3(skeleton.worldTransform->getGlobalTransform()[3])) :
+                        0.f;
+                dt = lodPolicy.advance(skeleton.lod, distance, frameDt, lodStats);
+                if (dt < 0.f) { return; }
+            }
+            const std::uint32_t maxBoneDepth =
+                skeleton.needsRefresh ? AnimationLod::AllBones :
+                                        lodPolicy.getLevel(skeleton.lod.level).maxBoneDepth;
+
             for (auto& animation : skeleton.activeAnimations) {
                 const auto& src = skeleton.animations[animation.animationIndex].payload().get();
                 animation.time += dt * src.getTicksPerSecond();
@@ -27,6 +53,7 @@ void SkeletalAnimationSystem::update(std::mutex&, float dt, float, float, float)
             }
 
             for (auto& bone : skeleton.bones) {
+                if (bone.depth > maxBoneDepth) { continue; }
                 if (!bone.bone->animations.empty()) {
                     glm::vec3 animatedPosition(0.f);
                     glm::quat animatedRotation(1.f, 0.f, 0.f, 0.f);
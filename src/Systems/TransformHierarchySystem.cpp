@@ -0,0 +1,70 @@
+#include <BLIB/Systems/TransformHierarchySystem.hpp>
+
+#include <BLIB/Engine/Engine.hpp>
+
+namespace bl
+{
+namespace sys
+{
+TransformHierarchySystem::TransformHierarchySystem()
+: threadPool(nullptr)
+, pool2d(nullptr)
+, pool3d(nullptr)
+, stale2d(true)
+, stale3d(true)
+, refreshedCount(0) {}
+
+void TransformHierarchySystem::init(engine::Engine& engine) {
+    threadPool = &engine.engineLoopThreadpool();
+    pool2d     = &engine.ecs().getAllComponents<com::Transform2D>();
+    pool3d     = &engine.ecs().getAllComponents<com::Transform3D>();
+    subscribe(engine.ecs().getSignalChannel());
+}
+
+void TransformHierarchySystem::earlyCleanup() {
+    unsubscribe();
+    levels2d.clear();
+    levels3d.clear();
+}
+
+void TransformHierarchySystem::update(std::mutex&, float, float, float, float) {
+    if (stale2d.exchange(false)) { levels2d.rebuild(*pool2d); }
+    if (stale3d.exchange(false)) { levels3d.rebuild(*pool3d); }
+
+    refreshedCount = 0;
+    levels2d.forEachBreadthFirst(threadPool, [this](com::Transform2D& t) {
+        if (t.propagateGlobalTransform()) { ++refreshedCount; }
+    });
+    levels3d.forEachBreadthFirst(threadPool, [this](com::Transform3D& t) {
+        if (t.propagateGlobalTransform()) { ++refreshedCount; }
+    });
+}
+
+void TransformHierarchySystem::process(const ecs::event::ComponentAdded<com::Transform2D>&) {
+    stale2d = true;
+}
+
+void TransformHierarchySystem::process(const ecs::event::ComponentRemoved<com::Transform2D>&) {
+    stale2d = true;
+}
+
+void TransformHierarchySystem::process(const ecs::event::ComponentAdded<com::Transform3D>&) {
+    stale3d = true;
+}
+
+void TransformHierarchySystem::process(const ecs::event::ComponentRemoved<com::Transform3D>&) {
+    stale3d = true;
+}
+
+void TransformHierarchySystem::process(const ecs::event::EntityParentSet&) {
+    stale2d = true;
+    stale3d = true;
+}
+
+void TransformHierarchySystem::process(const ecs::event::EntityParentRemoved&) {
+    stale2d = true;
+    stale3d = true;
+}
+
+} // namespace sys
+} // namespace bl
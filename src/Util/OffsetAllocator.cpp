@@ -0,0 +1,198 @@
+#include <BLIB/Util/OffsetAllocator.hpp>
+
+#include <bit>
+
+namespace bl
+{
+namespace util
+{
+namespace
+{
+// sizes below this get an exact bin, above it each power of two is split into this many bins
+constexpr std::uint32_t LinearBins    = 8;
+constexpr std::uint32_t LinearBinBits = 3;
+
+std::uint32_t binLowerBound(std::uint32_t bin) {
+    if (bin < LinearBins) { return bin; }
+    const std::uint32_t exponent = bin / LinearBins + LinearBinBits - 1;
+    const std::uint32_t mantissa = bin % LinearBins + LinearBins;
+    return mantissa << (exponent - LinearBinBits);
+}
+} // namespace
+
+OffsetAllocator::OffsetAllocator(std::uint32_t capacity) { reset(capacity); }
+
+OffsetAllocator::Allocation OffsetAllocator::allocate(std::uint32_t size) {
+    Allocation result;
+    if (size == 0) {
+        result.offset = 0;
+        return result;
+    }
+
+    std::uint32_t node      = InvalidNode;
+    const std::uint32_t bin = findBin(binRoundUp(size));
+    if (bin != InvalidNode) { node = binHeads[bin]; }
+    else {
+        // every node in larger bins fits, but the bin containing size may still hold a fit
+        node = binHeads[binRoundDown(size)];
+        while (node != InvalidNode && nodes[node].size < size) { node = nodes[node].nextInBin; }
+        if (node == InvalidNode) { return result; }
+    }
+
+    removeFree(node);
+    Node& n = nodes[node];
+    if (n.size > size) {
+        const std::uint32_t rem = createNode(n.offset + size, n.size - size);
+        Node& remainder         = nodes[rem];
+        Node& alloc             = nodes[node]; // createNode may reallocate
+        remainder.prevAddress   = node;
+        remainder.nextAddress   = alloc.nextAddress;
+        if (alloc.nextAddress != InvalidNode) { nodes[alloc.nextAddress].prevAddress = rem; }
+        else { tailNode = rem; }
+        alloc.nextAddress = rem;
+        alloc.size        = size;
+        insertFree(rem);
+    }
+
+    nodes[node].free = false;
+    freeTotal -= size;
+    result.offset = nodes[node].offset;
+    result.size   = size;
+    result.node   = node;
+    return result;
+}
+
+void OffsetAllocator::release(const Allocation& allocation) {
+    if (allocation.node == InvalidNode) { return; }
+
+    const std::uint32_t node = allocation.node;
+    freeTotal += nodes[node].size;
+
+    const std::uint32_t prev = nodes[node].prevAddress;
+    if (prev != InvalidNode && nodes[prev].free) {
+        removeFree(prev);
+        Node& n       = nodes[node];
+        n.offset      = nodes[prev].offset;
+        n.size        = n.size + nodes[prev].size;
+        n.prevAddress = nodes[prev].prevAddress;
+        if (n.prevAddress != InvalidNode) { nodes[n.prevAddress].nextAddress = node; }
+        recycleNode(prev);
+    }
+
+    const std::uint32_t next = nodes[node].nextAddress;
+    if (next != InvalidNode && nodes[next].free) {
+        removeFree(next);
+        Node& n       = nodes[node];
+        n.size        = n.size + nodes[next].size;
+        n.nextAddress = nodes[next].nextAddress;
+        if (n.nextAddress != InvalidNode) { nodes[n.nextAddress].prevAddress = node; }
+        else { tailNode = node; }
+        recycleNode(next);
+    }
+
+    insertFree(node);
+}
+
+void OffsetAllocator::grow(std::uint32_t newCapacity) {
+    if (newCapacity <= totalSize) { return; }
+
+    const std::uint32_t extra = newCapacity - totalSize;
+    if (tailNode != InvalidNode && nodes[tailNode].free) {
+        removeFree(tailNode);
+        nodes[tailNode].size += extra;
+        insertFree(tailNode);
+    }
+    else {
+        const std::uint32_t node = createNode(totalSize, extra);
+        nodes[node].prevAddress  = tailNode;
+        if (tailNode != InvalidNode) { nodes[tailNode].nextAddress = node; }
+        tailNode = node;
+        insertFree(node);
+    }
+    totalSize = newCapacity;
+    freeTotal += extra;
+}
+
+void OffsetAllocator::reset(std::uint32_t capacity) {
+    nodes.clear();
+    recycledNodes.clear();
+    binHeads.fill(InvalidNode);
+    binMask.fill(0);
+    totalSize = 0;
+    freeTotal = 0;
+    tailNode  = InvalidNode;
+    grow(capacity);
+}
+
+std::uint32_t OffsetAllocator::createNode(std::uint32_t offset, std::uint32_t size) {
+    std::uint32_t i;
+    if (!recycledNodes.empty()) {
+        i = recycledNodes.back();
+        recycledNodes.pop_back();
+    }
+    else {
+        i = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    Node& n       = nodes[i];
+    n.offset      = offset;
+    n.size        = size;
+    n.prevAddress = InvalidNode;
+    n.nextAddress = InvalidNode;
+    n.prevInBin   = InvalidNode;
+    n.nextInBin   = InvalidNode;
+    n.free        = false;
+    return i;
+}
+
+void OffsetAllocator::recycleNode(std::uint32_t node) { recycledNodes.emplace_back(node); }
+
+void OffsetAllocator::insertFree(std::uint32_t node) {
+    const std::uint32_t bin = binRoundDown(nodes[node].size);
+    Node& n                 = nodes[node];
+    n.free                  = true;
+    n.prevInBin             = InvalidNode;
+    n.nextInBin             = binHeads[bin];
+    if (n.nextInBin != InvalidNode) { nodes[n.nextInBin].prevInBin = node; }
+    binHeads[bin] = node;
+    binMask[bin / 64] |= std::uint64_t(1) << (bin % 64);
+}
+
+void OffsetAllocator::removeFree(std::uint32_t node) {
+    Node& n = nodes[node];
+    if (n.prevInBin != InvalidNode) { nodes[n.prevInBin].nextInBin = n.nextInBin; }
+    else {
+        const std::uint32_t bin = binRoundDown(n.size);
+        binHeads[bin]           = n.nextInBin;
+        if (n.nextInBin == InvalidNode) {
+            binMask[bin / 64] &= ~(std::uint64_t(1) << (bin % 64));
+        }
+    }
+    if (n.nextInBin != InvalidNode) { nodes[n.nextInBin].prevInBin = n.prevInBin; }
+    n.free = false;
+}
+
+std::uint32_t OffsetAllocator::findBin(std::uint32_t minBin) const {
+    for (std::uint32_t w = minBin / 64; w < binMask.size(); ++w) {
+        std::uint64_t bits = binMask[w];
+        if (w == minBin / 64) { bits &= ~std::uint64_t(0) << (minBin % 64); }
+        if (bits != 0) { return w * 64 + std::countr_zero(bits); }
+    }
+    return InvalidNode;
+}
+
+std::uint32_t OffsetAllocator::binRoundDown(std::uint32_t size) {
+    if (size < LinearBins) { return size; }
+    const std::uint32_t exponent = std::bit_width(size) - 1;
+    const std::uint32_t mantissa = (size >> (exponent - LinearBinBits)) & (LinearBins - 1);
+    return (exponent - LinearBinBits + 1) * LinearBins + mantissa;
+}
+
+std::uint32_t OffsetAllocator::binRoundUp(std::uint32_t size) {
+    const std::uint32_t bin = binRoundDown(size);
+    return binLowerBound(bin) == size ? bin : bin + 1;
+}
+
+} // namespace util
+} // namespace bl
@@ -0,0 +1,185 @@
+#include <BLIB/Util/Profiler.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+
+namespace bl
+{
+namespace util
+{
+namespace
+{
+void writeEscaped(std::ostream& os, std::string_view str) {
+    for (const char c : str) {
+        if (c == '"' || c == '\\') { os << '\\' << c; }
+        else if (static_cast<unsigned char>(c) < 0x20) { os << ' '; }
+        else { os << c; }
+    }
+}
+
+void writeMicros(std::ostream& os, std::uint64_t ns) {
+    os << ns / 1000 << '.';
+    const std::uint64_t frac = ns % 1000;
+    if (frac < 100) { os << '0'; }
+    if (frac < 10) { os << '0'; }
+    os << frac;
+}
+} // namespace
+
+Profiler::ThreadBuffer::ThreadBuffer(std::uint32_t thread)
+: thread(thread)
+, events(std::make_unique<Event[]>(BufferCapacity))
+, head(0) {}
+
+Profiler::Profiler()
+: epoch(std::chrono::steady_clock::now())
+, enabled(true)
+, floor(0)
+, frameCount(0) {}
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::setEnabled(bool e) { enabled.store(e); }
+
+Profiler::ThreadBuffer& Profiler::localBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        std::unique_lock lock(bufferMutex);
+        buffers.emplace_back(
+            std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(buffers.size())));
+        buffer = buffers.back().get();
+    }
+    return *buffer;
+}
+
+void Profiler::record(std::string_view name, std::uint64_t start, std::uint64_t end) {
+    ThreadBuffer& buffer     = localBuffer();
+    const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    buffer.events[head % BufferCapacity] = Event{name, start, end - start, buffer.thread};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::markFrame() {
+    const std::uint64_t time = now();
+    std::unique_lock lock(frameMutex);
+    frames.emplace_back(time);
+    if (frames.size() > FrameHistory) { frames.pop_front(); }
+    ++frameCount;
+}
+
+std::uint64_t Profiler::getFrameCount() const {
+    std::unique_lock lock(frameMutex);
+    return frameCount;
+}
+
+void Profiler::collect(std::vector<Event>& events, std::uint64_t since) const {
+    events.clear();
+    since = std::max(since, floor.load());
+
+    std::unique_lock lock(bufferMutex);
+    for (const auto& buffer : buffers) {
+        const std::uint64_t head  = buffer->head.load(std::memory_order_acquire);
+        const std::uint64_t first = head > BufferCapacity ? head - BufferCapacity : 0;
+        const std::size_t offset  = events.size();
+        for (std::uint64_t i = first; i < head; ++i) {
+            events.emplace_back(buffer->events[i % BufferCapacity]);
+        }
+
+        // drop the events that the owning thread may have overwritten while we were copying
+        const std::uint64_t after = buffer->head.load(std::memory_order_acquire);
+        const std::uint64_t valid = after > BufferCapacity ? after - BufferCapacity : 0;
+        if (valid > first) {
+            const std::size_t stale = std::min<std::uint64_t>(valid - first, head - first);
+            events.erase(events.begin() + offset, events.begin() + offset + stale);
+        }
+    }
+    lock.unlock();
+
+    events.erase(std::remove_if(events.begin(),
+                                events.end(),
+                                [since](const Event& e) { return e.start < since; }),
+                 events.end());
+    std::sort(events.begin(), events.end(), [](const Event& l, const Event& r) {
+        return l.start < r.start;
+    });
+}
+
+void Profiler::summarizeLastFrame(std::vector<ScopeSummary>& summary) const {
+    summary.clear();
+
+    std::unique_lock lock(frameMutex);
+    if (frames.size() < 2) { return; }
+    const std::uint64_t frameStart = frames[frames.size() - 2];
+    const std::uint64_t frameEnd   = frames.back();
+    lock.unlock();
+
+    std::vector<Event> events;
+    collect(events, frameStart);
+
+    std::unordered_map<std::string_view, std::size_t> indices;
+    for (const Event& event : events) {
+        if (event.start >= frameEnd) { break; }
+        const auto it = indices.try_emplace(event.name, summary.size()).first;
+        if (it->second == summary.size()) {
+            summary.emplace_back(ScopeSummary{event.name, 0, 0, 0});
+        }
+        ScopeSummary& scope = summary[it->second];
+        ++scope.count;
+        scope.total += event.duration;
+        scope.longest = std::max(scope.longest, event.duration);
+    }
+    std::sort(summary.begin(), summary.end(), [](const ScopeSummary& l, const ScopeSummary& r) {
+        return l.total > r.total;
+    });
+}
+
+void Profiler::writeChromeTrace(std::ostream& os) const {
+    std::vector<Event> events;
+    collect(events);
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const Event& event : events) {
+        os << (first ? "\n" : ",\n") << "{\"name\":\"";
+        writeEscaped(os, event.name);
+        os << "\",\"cat\":\"blib\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":";
+        writeMicros(os, event.start);
+        os << ",\"dur\":";
+        writeMicros(os, event.duration);
+        os << '}';
+        first = false;
+    }
+
+    const std::uint64_t minTime = floor.load();
+    std::unique_lock lock(frameMutex);
+    for (const std::uint64_t frame : frames) {
+        if (frame < minTime) { continue; }
+        os << (first ? "\n" : ",\n")
+           << "{\"name\":\"Frame\",\"cat\":\"blib\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,"
+              "\"ts\":";
+        writeMicros(os, frame);
+        os << '}';
+        first = false;
+    }
+    os << "\n]}\n";
+}
+
+bool Profiler::exportChromeTrace(const std::string& path) const {
+    std::ofstream file(path.c_str());
+    if (!file.good()) { return false; }
+    writeChromeTrace(file);
+    return file.good();
+}
+
+void Profiler::clear() {
+    floor.store(now());
+    std::unique_lock lock(frameMutex);
+    frames.clear();
+}
+
+} // namespace util
+} // namespace bl
@@ -0,0 +1,105 @@
+#include <BLIB/Util/SkylinePacker.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace bl
+{
+namespace util
+{
+SkylinePacker::SkylinePacker(unsigned int width, unsigned int height) { reset(width, height); }
+
+void SkylinePacker::reset(unsigned int width, unsigned int height) {
+    size     = {width, height};
+    usedArea = 0;
+    skyline.clear();
+    skyline.emplace_back(Segment{0, 0, width});
+}
+
+void SkylinePacker::grow(unsigned int width, unsigned int height) {
+    if (width > size.x) {
+        if (skyline.back().y == 0) { skyline.back().width += width - size.x; }
+        else { skyline.emplace_back(Segment{size.x, 0, width - size.x}); }
+        size.x = width;
+    }
+    if (height > size.y) { size.y = height; }
+}
+
+std::optional<glm::u32vec2> SkylinePacker::pack(unsigned int width, unsigned int height) {
+    if (width == 0 || height == 0) { return glm::u32vec2(0, 0); }
+
+    std::size_t bestIndex  = skyline.size();
+    unsigned int bestTop   = std::numeric_limits<unsigned int>::max();
+    unsigned int bestWidth = std::numeric_limits<unsigned int>::max();
+    for (std::size_t i = 0; i < skyline.size(); ++i) {
+        const std::optional<unsigned int> y = fitAt(i, width, height);
+        if (!y.has_value()) { continue; }
+
+        const unsigned int top = y.value() + height;
+        if (top < bestTop || (top == bestTop && skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestTop   = top;
+            bestWidth = skyline[i].width;
+        }
+    }
+
+    if (bestIndex == skyline.size()) { return {}; }
+
+    const glm::u32vec2 pos(skyline[bestIndex].x, bestTop - height);
+    place(bestIndex, pos.x, pos.y, width, height);
+    usedArea += static_cast<std::uint64_t>(width) * height;
+    return pos;
+}
+
+float SkylinePacker::getOccupancy() const {
+    const std::uint64_t area = static_cast<std::uint64_t>(size.x) * size.y;
+    return area > 0 ? static_cast<float>(usedArea) / static_cast<float>(area) : 0.f;
+}
+
+std::optional<unsigned int> SkylinePacker::fitAt(std::size_t i, unsigned int width,
+                                                 unsigned int height) const {
+    if (skyline[i].x + width > size.x) { return {}; }
+
+    // the rectangle rests on the highest segment it spans
+    unsigned int y         = 0;
+    unsigned int remaining = width;
+    for (std::size_t j = i; remaining > 0; ++j) {
+        if (j >= skyline.size()) { return {}; }
+        y = std::max(y, skyline[j].y);
+        if (y + height > size.y) { return {}; }
+        remaining -= std::min(remaining, skyline[j].width);
+    }
+    return y;
+}
+
+void SkylinePacker::place(std::size_t i, unsigned int x, unsigned int y, unsigned int width,
+                          unsigned int height) {
+    skyline.insert(skyline.begin() + i, Segment{x, y + height, width});
+
+    // trim or remove the segments now covered by the new one
+    const unsigned int right = x + width;
+    for (std::size_t j = i + 1; j < skyline.size();) {
+        Segment& s = skyline[j];
+        if (s.x >= right) { break; }
+
+        const unsigned int segRight = s.x + s.width;
+        if (segRight <= right) { skyline.erase(skyline.begin() + j); }
+        else {
+            s.width = segRight - right;
+            s.x     = right;
+            break;
+        }
+    }
+
+    // merge neighbors at the same height
+    for (std::size_t j = 0; j + 1 < skyline.size();) {
+        if (skyline[j].y == skyline[j + 1].y) {
+            skyline[j].width += skyline[j + 1].width;
+            skyline.erase(skyline.begin() + j + 1);
+        }
+        else { ++j; }
+    }
+}
+
+} // namespace util
+} // namespace bl
@@ -48,6 +48,8 @@ bool ThreadPool::start(unsigned int wc) {
 
 bool ThreadPool::running() const { return !workers.empty() && !shuttingDown.load(); }
 
+unsigned int ThreadPool::workerCount() const { return workers.size(); }
+
 void ThreadPool::drain() {
     std::unique_lock lock(taskMutex);
     const auto isDrained = [this]() { return tasks.empty() && inFlightCount.load() == 0; };
@@ -0,0 +1,103 @@
+#include <BLIB/Audio/Mixer.hpp>
+#include <BLIB/Audio/NullOutput.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+namespace unittest
+{
+namespace
+{
+constexpr std::int16_t Level = 8192;
+} // namespace
+
+TEST(Mixer, OverlappingVoicesSum) {
+    const std::vector<std::int16_t> samples(2000, Level);
+    const SoundData sound{samples.data(), samples.size(), 1, Mixer::DefaultSampleRate};
+
+    Mixer mixer;
+    NullOutput output;
+    output.start(mixer);
+    mixer.voices()->play(sound, 1, {});
+    mixer.voices()->play(sound, 1, {});
+
+    const std::vector<std::int16_t>& out = output.render(256);
+    ASSERT_EQ(out.size(), 512u);
+    for (const std::int16_t s : out) { EXPECT_NEAR(s, 16383, 2); }
+}
+
+TEST(Mixer, PositionalVoicesAttenuateAndPan) {
+    const std::vector<std::int16_t> samples(2000, Level);
+    const SoundData sound{samples.data(), samples.size(), 1, Mixer::DefaultSampleRate};
+
+    Mixer mixer;
+    NullOutput output;
+    output.start(mixer);
+
+    VoiceSettings settings;
+    settings.position = glm::vec3(10.f, 0.f, 0.f);
+    mixer.voices()->play(sound, 1, settings);
+
+    // min distance 1 and attenuation 1 at a distance of 10 gives 0.1, fully to the right
+    const std::vector<std::int16_t>& out = output.render(128);
+    for (std::size_t i = 0; i < 128; ++i) {
+        EXPECT_EQ(out[i * 2], 0);
+        EXPECT_NEAR(out[i * 2 + 1], 819, 2);
+    }
+}
+
+TEST(Mixer, ResamplesAndFinishes) {
+    const std::vector<std::int16_t> samples(100, Level);
+    const SoundData sound{samples.data(), samples.size(), 1, Mixer::DefaultSampleRate / 2};
+
+    Mixer mixer;
+    NullOutput output;
+    output.start(mixer);
+    const VoicePool::VoiceId voice = mixer.voices()->play(sound, 1, {});
+
+    // half the sample rate plays for twice as many output frames
+    const std::vector<std::int16_t>& out = output.render(150);
+    EXPECT_NEAR(out[0], 8191, 2);
+    EXPECT_NEAR(out[299], 8191, 2);
+    EXPECT_TRUE(mixer.voices()->isPlaying(voice));
+
+    output.render(100);
+    EXPECT_FALSE(mixer.voices()->isPlaying(voice));
+    EXPECT_EQ(output.getSamples()[199], 0);
+}
+
+TEST(Mixer, PauseHoldsVoices) {
+    const std::vector<std::int16_t> samples(600, Level);
+    const SoundData sound{samples.data(), samples.size(), 1, Mixer::DefaultSampleRate};
+
+    Mixer mixer;
+    NullOutput output;
+    output.start(mixer);
+    const VoicePool::VoiceId voice = mixer.voices()->play(sound, 1, {});
+
+    mixer.setPaused(true);
+    for (const std::int16_t s : output.render(512)) { EXPECT_EQ(s, 0); }
+    mixer.setPaused(false);
+
+    output.render(512);
+    EXPECT_TRUE(mixer.voices()->isPlaying(voice));
+    output.render(512);
+    EXPECT_FALSE(mixer.voices()->isPlaying(voice));
+}
+
+TEST(Mixer, StoppedOutputIsSilent) {
+    const std::vector<std::int16_t> samples(600, Level);
+    const SoundData sound{samples.data(), samples.size(), 1, Mixer::DefaultSampleRate};
+
+    Mixer mixer;
+    NullOutput output;
+    mixer.voices()->play(sound, 1, {});
+    for (const std::int16_t s : output.render(64)) { EXPECT_EQ(s, 0); }
+}
+
+} // namespace unittest
+} // namespace audio
+} // namespace bl
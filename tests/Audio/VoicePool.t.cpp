@@ -0,0 +1,119 @@
+#include <BLIB/Audio/VoicePool.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bl
+{
+namespace audio
+{
+namespace unittest
+{
+namespace
+{
+constexpr unsigned int SampleRate = 44100;
+
+SoundData makeSound(const std::vector<std::int16_t>& samples) {
+    return SoundData{samples.data(), samples.size(), 1, SampleRate};
+}
+} // namespace
+
+TEST(VoicePool, SoundsOverlapUpToVoiceLimit) {
+    const std::vector<std::int16_t> samples(1000, 100);
+    const SoundData sound = makeSound(samples);
+
+    VoicePool pool;
+    pool.setVoiceLimit(1, 2);
+    const VoicePool::VoiceId a = pool.play(sound, 1, {});
+    const VoicePool::VoiceId b = pool.play(sound, 1, {});
+    EXPECT_TRUE(pool.isPlaying(a));
+    EXPECT_TRUE(pool.isPlaying(b));
+
+    // the oldest voice of the sound is stolen
+    const VoicePool::VoiceId c = pool.play(sound, 1, {});
+    EXPECT_FALSE(pool.isPlaying(a));
+    EXPECT_TRUE(pool.isPlaying(b));
+    EXPECT_TRUE(pool.isPlaying(c));
+    EXPECT_EQ(pool.getActiveCount(), 2u);
+
+    // other sounds are not affected by the limit
+    const VoicePool::VoiceId d = pool.play(sound, 2, {});
+    EXPECT_TRUE(pool.isPlaying(d));
+    EXPECT_EQ(pool.getActiveCount(), 3u);
+
+    pool.stopSound(1);
+    EXPECT_FALSE(pool.isSoundPlaying(1));
+    EXPECT_TRUE(pool.isSoundPlaying(2));
+}
+
+TEST(VoicePool, PolyphonyVirtualizesLowestPriority) {
+    const std::vector<std::int16_t> samples(SampleRate, 100);
+    const SoundData sound = makeSound(samples);
+
+    VoicePool pool(8, 2);
+    VoiceSettings settings;
+    settings.loop = true;
+
+    settings.priority          = 0;
+    const VoicePool::VoiceId a = pool.play(sound, 1, settings);
+    settings.priority          = 5;
+    const VoicePool::VoiceId b = pool.play(sound, 2, settings);
+    settings.priority          = 1;
+    const VoicePool::VoiceId c = pool.play(sound, 3, settings);
+
+    pool.prepare(64, SampleRate);
+    EXPECT_EQ(pool.getAudibleCount(), 2u);
+    EXPECT_FALSE(pool.isAudible(a));
+    EXPECT_TRUE(pool.isAudible(b));
+    EXPECT_TRUE(pool.isAudible(c));
+    EXPECT_TRUE(pool.isPlaying(a));
+
+    pool.stop(b);
+    pool.prepare(64, SampleRate);
+    EXPECT_TRUE(pool.isAudible(a));
+    EXPECT_TRUE(pool.isAudible(c));
+}
+
+TEST(VoicePool, InaudibleVoicesAreVirtual) {
+    const std::vector<std::int16_t> samples(100, 100);
+    const SoundData sound = makeSound(samples);
+
+    VoicePool pool;
+    VoiceSettings settings;
+    settings.position            = glm::vec3(1000.f, 0.f, 0.f);
+    settings.attenuation         = 10.f;
+    const VoicePool::VoiceId far = pool.play(sound, 1, settings);
+
+    pool.prepare(64, SampleRate);
+    EXPECT_TRUE(pool.isPlaying(far));
+    EXPECT_FALSE(pool.isAudible(far));
+
+    // virtual voices still advance and finish with the sound
+    pool.prepare(64, SampleRate);
+    EXPECT_FALSE(pool.isPlaying(far));
+}
+
+TEST(VoicePool, FullPoolStealsLowerPriority) {
+    const std::vector<std::int16_t> samples(1000, 100);
+    const SoundData sound = makeSound(samples);
+
+    VoicePool pool(2, 2);
+    pool.setDefaultVoiceLimit(0);
+    VoiceSettings settings;
+    settings.priority          = 1;
+    const VoicePool::VoiceId a = pool.play(sound, 1, settings);
+    const VoicePool::VoiceId b = pool.play(sound, 1, settings);
+
+    settings.priority = 0;
+    EXPECT_EQ(pool.play(sound, 1, settings), VoicePool::InvalidVoice);
+
+    settings.priority          = 2;
+    const VoicePool::VoiceId c = pool.play(sound, 1, settings);
+    EXPECT_NE(c, VoicePool::InvalidVoice);
+    EXPECT_FALSE(pool.isPlaying(a));
+    EXPECT_TRUE(pool.isPlaying(b));
+    EXPECT_TRUE(pool.isPlaying(c));
+}
+
+} // namespace unittest
+} // namespace audio
+} // namespace bl
@@ -0,0 +1,90 @@
+#include <BLIB/Components/Transform2D.hpp>
+#include <BLIB/ECS.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace ecs
+{
+namespace unittest
+{
+TEST(ECSHierarchyLevels, SortsByDepth) {
+    Registry registry;
+    const Entity root       = registry.createEntity(0);
+    const Entity child      = registry.createEntity(0);
+    const Entity grandchild = registry.createEntity(0);
+    const Entity other      = registry.createEntity(0);
+    com::Transform2D* rt    = registry.addComponent<com::Transform2D>(root);
+    com::Transform2D* ct    = registry.addComponent<com::Transform2D>(child);
+    com::Transform2D* gt    = registry.addComponent<com::Transform2D>(grandchild);
+    com::Transform2D* ot    = registry.addComponent<com::Transform2D>(other);
+    registry.setEntityParent(grandchild, child);
+    registry.setEntityParent(child, root);
+
+    HierarchyLevels<com::Transform2D> levels;
+    levels.rebuild(registry.getAllComponents<com::Transform2D>());
+    ASSERT_EQ(levels.levelCount(), 3);
+    EXPECT_EQ(levels.size(), 4);
+    ASSERT_EQ(levels.getLevel(0).size(), 2);
+    EXPECT_TRUE(levels.getLevel(0)[0] == rt || levels.getLevel(0)[1] == rt);
+    EXPECT_TRUE(levels.getLevel(0)[0] == ot || levels.getLevel(0)[1] == ot);
+    ASSERT_EQ(levels.getLevel(1).size(), 1);
+    EXPECT_EQ(levels.getLevel(1)[0], ct);
+    ASSERT_EQ(levels.getLevel(2).size(), 1);
+    EXPECT_EQ(levels.getLevel(2)[0], gt);
+
+    registry.removeEntityParent(grandchild);
+    levels.rebuild(registry.getAllComponents<com::Transform2D>());
+    EXPECT_EQ(levels.levelCount(), 2);
+    EXPECT_EQ(levels.getLevel(0).size(), 3);
+}
+
+TEST(ECSHierarchyLevels, PropagatesTransforms) {
+    Registry registry;
+    const Entity root       = registry.createEntity(0);
+    const Entity child      = registry.createEntity(0);
+    const Entity grandchild = registry.createEntity(0);
+    com::Transform2D* rt = registry.addComponent<com::Transform2D>(root, glm::vec2(10.f, 0.f));
+    registry.addComponent<com::Transform2D>(child, glm::vec2(5.f, 0.f));
+    com::Transform2D* gt =
+        registry.addComponent<com::Transform2D>(grandchild, glm::vec2(1.f, 2.f));
+    registry.setEntityParent(grandchild, child);
+    registry.setEntityParent(child, root);
+
+    HierarchyLevels<com::Transform2D> levels;
+    levels.rebuild(registry.getAllComponents<com::Transform2D>());
+
+    unsigned int refreshed = 0;
+    const auto propagate   = [&refreshed](com::Transform2D& t) {
+        if (t.propagateGlobalTransform()) { ++refreshed; }
+    };
+
+    levels.forEachBreadthFirst(nullptr, propagate);
+    EXPECT_EQ(refreshed, 3);
+    EXPECT_FALSE(gt->refreshRequired());
+    glm::vec3 p = gt->transformPoint({0.f, 0.f, 0.f});
+    EXPECT_FLOAT_EQ(p.x, 16.f);
+    EXPECT_FLOAT_EQ(p.y, 2.f);
+
+    refreshed = 0;
+    levels.forEachBreadthFirst(nullptr, propagate);
+    EXPECT_EQ(refreshed, 0);
+
+    rt->move({4.f, 0.f});
+
+    // const getters see the change before propagation without touching the cache
+    const com::Transform2D& cgt = *gt;
+    EXPECT_FLOAT_EQ(cgt.getGlobalPosition().x, 20.f);
+    EXPECT_FLOAT_EQ(cgt.transformPoint({0.f, 0.f, 0.f}).x, 20.f);
+    EXPECT_TRUE(gt->refreshRequired());
+
+    levels.forEachBreadthFirst(nullptr, propagate);
+    EXPECT_EQ(refreshed, 3);
+    p = gt->transformPoint({0.f, 0.f, 0.f});
+    EXPECT_FLOAT_EQ(p.x, 20.f);
+    EXPECT_FLOAT_EQ(p.y, 2.f);
+}
+
+} // namespace unittest
+} // namespace ecs
+} // namespace bl
@@ -607,6 +607,46 @@ TEST(ECS, DestroyInWorld) {
     for (std::size_t i = 0; i < nLive; ++i) { EXPECT_TRUE(testRegistry.entityExists(toLive[i])); }
 }
 
+TEST(ECS, BulkCreateAndDestroy) {
+    Registry testRegistry;
+    auto* view = testRegistry.getOrCreateView<Require<int, char>>();
+
+    std::vector<Entity> entities;
+    testRegistry.createEntities(0, Flags::None, MaxEntities, entities, 5, 'a');
+    ASSERT_EQ(entities.size(), MaxEntities);
+    for (const Entity ent : entities) {
+        ASSERT_TRUE(testRegistry.entityExists(ent));
+        ASSERT_NE(testRegistry.getComponent<int>(ent), nullptr);
+        EXPECT_EQ(*testRegistry.getComponent<int>(ent), 5);
+        EXPECT_EQ(*testRegistry.getComponent<char>(ent), 'a');
+    }
+
+    unsigned int visited = 0;
+    view->forEach([&visited](ComponentSet<Require<int, char>>&) { ++visited; });
+    EXPECT_EQ(visited, MaxEntities);
+
+    // destroy the first half in bulk
+    const std::size_t half = MaxEntities / 2;
+    EXPECT_EQ(testRegistry.destroyEntities(std::span<const Entity>(entities.data(), half)), half);
+    testRegistry.flushDeletions();
+    for (std::size_t i = 0; i < MaxEntities; ++i) {
+        EXPECT_EQ(testRegistry.entityExists(entities[i]), i >= half);
+    }
+
+    visited = 0;
+    view->forEach([&visited](ComponentSet<Require<int, char>>&) { ++visited; });
+    EXPECT_EQ(visited, MaxEntities - half);
+
+    // released ids are reused with new versions
+    std::vector<Entity> reused;
+    testRegistry.createEntities(0, Flags::None, half, reused, 7);
+    for (const Entity ent : reused) {
+        EXPECT_EQ(*testRegistry.getComponent<int>(ent), 7);
+        EXPECT_EQ(testRegistry.getComponent<char>(ent), nullptr);
+    }
+    EXPECT_FALSE(testRegistry.entityExists(entities[0]));
+}
+
 namespace
 {
 struct RemoveEventCounter : public sig::Listener<event::ComponentRemoved<int>> {
@@ -0,0 +1,43 @@
+#include <BLIB/Engine/SystemAccess.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace engine
+{
+namespace unittest
+{
+using ecs::tx::ComponentRead;
+using ecs::tx::ComponentWrite;
+
+TEST(SystemAccess, Conflicts) {
+    const SystemAccess readInt  = SystemAccess::make<ComponentRead<int>>();
+    const SystemAccess readBoth = SystemAccess::make<ComponentRead<int, char>>();
+    const SystemAccess writeInt = SystemAccess::make<ComponentWrite<int>>();
+    const SystemAccess writeChar =
+        SystemAccess::make<ComponentRead<float>, ComponentWrite<char>>();
+    const SystemAccess undeclared;
+
+    EXPECT_FALSE(readInt.conflictsWith(readBoth));
+    EXPECT_TRUE(readInt.conflictsWith(writeInt));
+    EXPECT_TRUE(writeInt.conflictsWith(readBoth));
+    EXPECT_TRUE(writeInt.conflictsWith(writeInt));
+    EXPECT_FALSE(writeInt.conflictsWith(writeChar));
+    EXPECT_TRUE(writeChar.conflictsWith(readBoth));
+    EXPECT_TRUE(undeclared.conflictsWith(readInt));
+    EXPECT_TRUE(readInt.conflictsWith(undeclared));
+}
+
+TEST(SystemAccess, WritesImplyReads) {
+    const SystemAccess access =
+        SystemAccess::make<ComponentRead<int, char, int>, ComponentWrite<char>>();
+    ASSERT_TRUE(access.isDeclared());
+    ASSERT_EQ(access.getReads().size(), 1);
+    EXPECT_EQ(access.getReads().front(), std::type_index(typeid(int)));
+    ASSERT_EQ(access.getWrites().size(), 1);
+    EXPECT_EQ(access.getWrites().front(), std::type_index(typeid(char)));
+}
+
+} // namespace unittest
+} // namespace engine
+} // namespace bl
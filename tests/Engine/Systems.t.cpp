@@ -0,0 +1,197 @@
+#include <BLIB/Engine.hpp>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bl
+{
+namespace engine
+{
+namespace unittest
+{
+using ecs::tx::ComponentRead;
+using ecs::tx::ComponentWrite;
+
+struct SystemsTestAccess {
+    static Systems make(Engine& engine) { return Systems(engine); }
+
+    static void build(Systems& systems) {
+        systems.schedule =
+            &systems.getSchedule(FrameStage::Update0, FrameStage::COUNT, StateMask::All);
+    }
+
+    static const void* current(Systems& systems) { return systems.schedule; }
+
+    static std::size_t cachedCount(Systems& systems) { return systems.schedules.size(); }
+
+    static void update(Systems& systems) {
+        systems.update(
+            FrameStage::Update0, FrameStage::COUNT, StateMask::All, 0.1f, 0.1f, 0.f, 0.f);
+    }
+
+    static std::uint32_t find(Systems& systems, System& system) {
+        const std::vector<Systems::ScheduleNode>& nodes = systems.schedule->nodes;
+        for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+            const Systems::ScheduleNode& node = nodes[i];
+            if (node.system && node.system->system.get() == &system) { return i; }
+        }
+        return nodes.size();
+    }
+
+    static bool dependsOn(Systems& systems, System& later, System& earlier) {
+        const std::uint32_t l = find(systems, later);
+        const std::uint32_t e = find(systems, earlier);
+        for (const std::uint32_t dep : systems.schedule->nodes[e].dependents) {
+            if (dep == l) { return true; }
+        }
+        return false;
+    }
+
+    static bool onCaller(Systems& systems, System& system) {
+        return systems.schedule->nodes[find(systems, system)].onCaller;
+    }
+};
+
+namespace
+{
+struct UpdateLog {
+    std::mutex mutex;
+    std::vector<int> order;
+};
+
+template<int N>
+class TestSystem : public System {
+public:
+    TestSystem(UpdateLog* log = nullptr)
+    : log(log) {}
+
+    virtual void init(Engine&) override {}
+
+    virtual void update(std::mutex&, float, float, float, float) override {
+        thread = std::this_thread::get_id();
+        if (log) {
+            std::unique_lock lock(log->mutex);
+            log->order.emplace_back(N);
+        }
+    }
+
+    std::thread::id thread;
+
+private:
+    UpdateLog* log;
+};
+
+int indexOf(const std::vector<int>& order, int system) {
+    for (unsigned int i = 0; i < order.size(); ++i) {
+        if (order[i] == system) { return i; }
+    }
+    return -1;
+}
+} // namespace
+
+TEST(Systems, ScheduleOrdersByAccess) {
+    Engine engine(Settings{});
+    Systems systems = SystemsTestAccess::make(engine);
+
+    auto& writeInt  = systems.registerSystem<TestSystem<0>>(FrameStage::Update0, StateMask::All);
+    auto& readChar  = systems.registerSystem<TestSystem<1>>(FrameStage::Update1, StateMask::All);
+    auto& readInt   = systems.registerSystem<TestSystem<2>>(FrameStage::Update2, StateMask::All);
+    auto& parallelA = systems.registerSystem<TestSystem<3>>(FrameStage::Update3, StateMask::All);
+    auto& parallelB = systems.registerSystem<TestSystem<4>>(FrameStage::Update3, StateMask::All);
+    auto& alone     = systems.registerSystem<TestSystem<5>>(FrameStage::Animate, StateMask::All);
+    systems.declareAccess<TestSystem<0>, ComponentWrite<int>>();
+    systems.declareAccess<TestSystem<1>, ComponentRead<char>>();
+    systems.declareAccess<TestSystem<2>, ComponentRead<int>>();
+    SystemsTestAccess::build(systems);
+
+    // declared systems only wait on conflicting access and may overlap later stages
+    EXPECT_FALSE(SystemsTestAccess::dependsOn(systems, readChar, writeInt));
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, readInt, writeInt));
+    EXPECT_FALSE(SystemsTestAccess::dependsOn(systems, readInt, readChar));
+
+    // undeclared systems keep the stage barrier and run together within their stage
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, parallelA, writeInt));
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, parallelA, readChar));
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, parallelB, readInt));
+    EXPECT_FALSE(SystemsTestAccess::dependsOn(systems, parallelB, parallelA));
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, alone, parallelA));
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, alone, parallelB));
+
+    // only undeclared systems that are alone in their stage stay on the calling thread
+    EXPECT_FALSE(SystemsTestAccess::onCaller(systems, writeInt));
+    EXPECT_FALSE(SystemsTestAccess::onCaller(systems, parallelA));
+    EXPECT_FALSE(SystemsTestAccess::onCaller(systems, parallelB));
+    EXPECT_TRUE(SystemsTestAccess::onCaller(systems, alone));
+}
+
+TEST(Systems, UpdateRespectsSchedule) {
+    Engine engine(Settings{});
+    engine.engineLoopThreadpool().start(2);
+    Systems systems = SystemsTestAccess::make(engine);
+    UpdateLog log;
+
+    systems.registerSystem<TestSystem<0>>(FrameStage::Update0, StateMask::All, &log);
+    systems.registerSystem<TestSystem<1>>(FrameStage::Update1, StateMask::All, &log);
+    systems.registerSystem<TestSystem<2>>(FrameStage::Update2, StateMask::All, &log);
+    auto& first = systems.registerSystem<TestSystem<3>>(FrameStage::Update3, StateMask::All, &log);
+    auto& last  = systems.registerSystem<TestSystem<4>>(FrameStage::Animate, StateMask::All, &log);
+    systems.declareAccess<TestSystem<0>, ComponentWrite<int>>();
+    systems.declareAccess<TestSystem<1>, ComponentRead<char>>();
+    systems.declareAccess<TestSystem<2>, ComponentRead<int>>();
+    SystemsTestAccess::update(systems);
+
+    ASSERT_EQ(log.order.size(), 5);
+    EXPECT_LT(indexOf(log.order, 0), indexOf(log.order, 2));
+    EXPECT_LT(indexOf(log.order, 2), indexOf(log.order, 3));
+    EXPECT_LT(indexOf(log.order, 1), indexOf(log.order, 3));
+    EXPECT_EQ(log.order[3], 3);
+    EXPECT_EQ(log.order[4], 4);
+    EXPECT_EQ(first.thread, std::this_thread::get_id());
+    EXPECT_EQ(last.thread, std::this_thread::get_id());
+}
+
+TEST(Systems, ScheduleCachedUntilChanged) {
+    Engine engine(Settings{});
+    Systems systems = SystemsTestAccess::make(engine);
+    UpdateLog log;
+
+    auto& first  = systems.registerSystem<TestSystem<0>>(FrameStage::Update0, StateMask::All);
+    auto& second = systems.registerSystem<TestSystem<1>>(FrameStage::Update1, StateMask::All);
+    SystemsTestAccess::update(systems);
+    const void* cached = SystemsTestAccess::current(systems);
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, second, first));
+
+    // repeated updates reuse the schedule
+    SystemsTestAccess::update(systems);
+    EXPECT_EQ(SystemsTestAccess::current(systems), cached);
+    EXPECT_EQ(SystemsTestAccess::cachedCount(systems), 1);
+
+    // frame tasks add a barrier so they get their own schedule without dropping the other
+    bool ran = false;
+    systems.addFrameTask(FrameStage::Update1, [&ran]() { ran = true; });
+    SystemsTestAccess::update(systems);
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(SystemsTestAccess::cachedCount(systems), 2);
+    SystemsTestAccess::update(systems);
+    EXPECT_EQ(SystemsTestAccess::cachedCount(systems), 2);
+
+    // declaring access rebuilds the schedule
+    systems.declareAccess<TestSystem<0>, ComponentRead<int>>();
+    systems.declareAccess<TestSystem<1>, ComponentRead<int>>();
+    EXPECT_EQ(SystemsTestAccess::cachedCount(systems), 0);
+    SystemsTestAccess::update(systems);
+    EXPECT_FALSE(SystemsTestAccess::dependsOn(systems, second, first));
+
+    // registering a system rebuilds the schedule
+    auto& third = systems.registerSystem<TestSystem<2>>(FrameStage::Update2, StateMask::All, &log);
+    EXPECT_EQ(SystemsTestAccess::cachedCount(systems), 0);
+    SystemsTestAccess::update(systems);
+    EXPECT_TRUE(SystemsTestAccess::dependsOn(systems, third, first));
+    ASSERT_EQ(log.order.size(), 1);
+    EXPECT_EQ(log.order.front(), 2);
+}
+
+} // namespace unittest
+} // namespace engine
+} // namespace bl
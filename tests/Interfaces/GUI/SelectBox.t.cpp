@@ -0,0 +1,62 @@
+#include <BLIB/Interfaces/GUI/Elements/SelectBox.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace gui
+{
+namespace unittest
+{
+TEST(SelectBox, SelectionFollowsRemoval) {
+    SelectBox::Ptr box = SelectBox::create();
+    box->addOption("a");
+    box->addOption("b");
+    box->addOption("c");
+    EXPECT_FALSE(box->getSelectedOption().has_value());
+
+    box->setSelectedOption("c");
+    ASSERT_TRUE(box->getSelectedOption().has_value());
+    EXPECT_EQ(box->getSelectedOption().value(), 2);
+
+    box->removeOption(0u);
+    ASSERT_TRUE(box->getSelectedOption().has_value());
+    EXPECT_EQ(box->getSelectedOption().value(), 1);
+    EXPECT_EQ(box->getOption(1), "c");
+
+    box->removeOption("c");
+    EXPECT_FALSE(box->getSelectedOption().has_value());
+    EXPECT_EQ(box->optionCount(), 1);
+}
+
+TEST(SelectBox, ManyOptions) {
+    constexpr unsigned int Count = 10000;
+    SelectBox::Ptr box           = SelectBox::create();
+    box->setMaxSize({200.f, 100.f});
+    for (unsigned int i = 0; i < Count; ++i) { box->addOption(std::to_string(i)); }
+    box->assignAcquisition({{0.f, 0.f}, box->getRequisition()});
+
+    // the requisition is capped by the max size instead of growing with the options
+    EXPECT_LE(box->getRequisition().y, 100.f + 4.f);
+    EXPECT_EQ(box->optionCount(), Count);
+
+    box->setSelectedOption(Count - 1);
+    ASSERT_TRUE(box->getSelectedOption().has_value());
+    EXPECT_EQ(box->getSelectedOption().value(), Count - 1);
+
+    box->editOptionText(Count - 1, "last");
+    EXPECT_EQ(box->getOption(Count - 1), "last");
+
+    std::vector<std::string> options;
+    box->getAllOptions(options);
+    ASSERT_EQ(options.size(), Count);
+    EXPECT_EQ(options.front(), "0");
+    EXPECT_EQ(options.back(), "last");
+
+    box->clearOptions();
+    EXPECT_EQ(box->optionCount(), 0);
+    EXPECT_FALSE(box->getSelectedOption().has_value());
+}
+
+} // namespace unittest
+} // namespace gui
+} // namespace bl
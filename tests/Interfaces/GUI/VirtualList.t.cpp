@@ -0,0 +1,116 @@
+#include <BLIB/Interfaces/GUI/Elements/VirtualList.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace gui
+{
+namespace unittest
+{
+namespace
+{
+class TestRow : public Element {
+public:
+    TestRow(const sf::Vector2f& size)
+    : size(size)
+    , index(VirtualList::NoIndex) {}
+
+    const sf::Vector2f& size;
+    std::size_t index;
+
+protected:
+    virtual sf::Vector2f minimumRequisition() const override { return size; }
+    virtual rdr::Component* doPrepareRender(rdr::Renderer&) override { return nullptr; }
+};
+
+VirtualList::Ptr makeList(const sf::Vector2f& rowSize) {
+    return VirtualList::create([&rowSize]() { return std::make_shared<TestRow>(rowSize); },
+                               [](Element& row, std::size_t i) {
+                                   static_cast<TestRow&>(row).index = i;
+                               });
+}
+
+std::vector<TestRow*> boundRows(VirtualList& list) {
+    std::vector<TestRow*> rows;
+    for (const Element::Ptr& child : list.getChildren()) {
+        TestRow* row = dynamic_cast<TestRow*>(child.get());
+        if (row && row->visible()) { rows.emplace_back(row); }
+    }
+    return rows;
+}
+} // namespace
+
+TEST(VirtualList, RecyclesRowsWhenScrolling) {
+    const sf::Vector2f rowSize(50.f, 10.f);
+    VirtualList::Ptr list = makeList(rowSize);
+    list->setItemCount(1000);
+    list->assignAcquisition({{0.f, 0.f}, {100.f, 52.f}});
+
+    // only the rows in view plus overscan are created
+    const std::size_t created = list->getCreatedRowCount();
+    EXPECT_GT(created, 0);
+    EXPECT_LT(created, 10);
+
+    list->scrollToItem(500);
+    const std::size_t scrolled = list->getCreatedRowCount();
+    EXPECT_LT(scrolled, 12);
+    bool found = false;
+    for (TestRow* row : boundRows(*list)) {
+        EXPECT_EQ(list->getRowIndex(row), row->index);
+        if (row->index == 500) { found = true; }
+    }
+    EXPECT_TRUE(found);
+
+    // scrolling back reuses the rows that left the window
+    list->scrollToItem(0);
+    EXPECT_EQ(list->getCreatedRowCount(), scrolled);
+    for (TestRow* row : boundRows(*list)) {
+        EXPECT_EQ(list->getRowIndex(row), row->index);
+        EXPECT_LT(row->index, 10);
+    }
+}
+
+TEST(VirtualList, RemeasuresChangedRows) {
+    sf::Vector2f rowSize(60.f, 15.f);
+    VirtualList::Ptr list = makeList(rowSize);
+    list->setItemCount(10);
+    list->assignAcquisition({{0.f, 0.f}, {200.f, 400.f}});
+    const float initialWidth = list->getRequisition().x;
+    EXPECT_FLOAT_EQ(list->getRequisition().y, 15.f * 10.f + 2.f);
+
+    // a row changing size, such as a label creating its component, replaces the estimate
+    rowSize = {30.f, 8.f};
+    std::vector<TestRow*> rows = boundRows(*list);
+    ASSERT_FALSE(rows.empty());
+    rows.front()->makeDirty();
+    EXPECT_FLOAT_EQ(list->getRequisition().x, initialWidth - 30.f);
+    EXPECT_FLOAT_EQ(list->getRequisition().y, 8.f * 10.f + 2.f);
+
+    // an explicit item height is kept while the width still follows the rows
+    list->setItemHeight(12.f);
+    rowSize = {40.f, 20.f};
+    rows.front()->makeDirty();
+    EXPECT_FLOAT_EQ(list->getRequisition().x, initialWidth - 20.f);
+    EXPECT_FLOAT_EQ(list->getRequisition().y, 12.f * 10.f + 2.f);
+}
+
+TEST(VirtualList, ShrinkingItemCountRecyclesRows) {
+    const sf::Vector2f rowSize(50.f, 10.f);
+    VirtualList::Ptr list = makeList(rowSize);
+    list->setItemCount(20);
+    list->assignAcquisition({{0.f, 0.f}, {100.f, 300.f}});
+    const std::size_t created = list->getCreatedRowCount();
+    EXPECT_EQ(boundRows(*list).size(), 20);
+
+    list->setItemCount(5);
+    EXPECT_EQ(boundRows(*list).size(), 5);
+    EXPECT_EQ(list->getCreatedRowCount(), created);
+
+    list->setItemCount(15);
+    EXPECT_EQ(boundRows(*list).size(), 15);
+    EXPECT_EQ(list->getCreatedRowCount(), created);
+}
+
+} // namespace unittest
+} // namespace gui
+} // namespace bl
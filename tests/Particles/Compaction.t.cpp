@@ -0,0 +1,41 @@
+#include <BLIB/Particles/Compaction.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace pcl
+{
+namespace unittest
+{
+TEST(ParticleCompaction, EraseSortedIndicesPreservesOrder) {
+    std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const std::vector<std::size_t> dead{0, 3, 4, 9};
+
+    priv::eraseSortedIndices<int>(values, dead);
+    EXPECT_EQ(values, std::vector<int>({1, 2, 5, 6, 7, 8}));
+}
+
+TEST(ParticleCompaction, EraseAll) {
+    std::vector<int> values{0, 1, 2};
+    const std::vector<std::size_t> dead{0, 1, 2};
+
+    priv::eraseSortedIndices<int>(values, dead);
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(ParticleCompaction, EraseNone) {
+    std::vector<int> values{0, 1, 2};
+
+    priv::eraseSortedIndices<int>(values, {});
+    EXPECT_EQ(values, std::vector<int>({0, 1, 2}));
+}
+
+TEST(ParticleCompaction, ChunkSizeAdaptsToPoolSize) {
+    EXPECT_EQ(priv::computeChunkSize(10, 8), 1024);
+    EXPECT_EQ(priv::computeChunkSize(1000000, 8), 31250);
+    EXPECT_EQ(priv::computeChunkSize(1000000, 0), 250000);
+}
+
+} // namespace unittest
+} // namespace pcl
+} // namespace bl
@@ -0,0 +1,75 @@
+#include <BLIB/Particles/Kernels.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bl
+{
+namespace pcl
+{
+namespace unittest
+{
+namespace
+{
+struct TestParticle {
+    glm::vec2 pos;
+    glm::vec2 vel;
+    glm::vec4 color;
+    float age;
+    float lifetime;
+
+    TestParticle(const glm::vec2& pos, const glm::vec2& vel)
+    : pos(pos)
+    , vel(vel)
+    , color(1.f)
+    , age(0.f)
+    , lifetime(2.f) {}
+};
+} // namespace
+
+TEST(ParticleKernels, AccelerateAndIntegrate) {
+    std::vector<TestParticle> particles(3, TestParticle({0.f, 0.f}, {1.f, 0.f}));
+
+    kernel::accelerate<&TestParticle::vel>(std::span<TestParticle>(particles), {0.f, 10.f}, 0.5f);
+    kernel::integrateVelocity<&TestParticle::pos, &TestParticle::vel>(
+        std::span<TestParticle>(particles), 2.f);
+
+    for (const TestParticle& p : particles) {
+        EXPECT_FLOAT_EQ(p.vel.x, 1.f);
+        EXPECT_FLOAT_EQ(p.vel.y, 5.f);
+        EXPECT_FLOAT_EQ(p.pos.x, 2.f);
+        EXPECT_FLOAT_EQ(p.pos.y, 10.f);
+    }
+}
+
+TEST(ParticleKernels, ColorOverLifetime) {
+    std::vector<TestParticle> particles(2, TestParticle({0.f, 0.f}, {0.f, 0.f}));
+    particles[1].age = 1.5f;
+
+    const glm::vec4 start(1.f, 1.f, 1.f, 1.f);
+    const glm::vec4 end(0.f, 0.f, 0.f, 0.f);
+    kernel::colorOverLifetime<&TestParticle::color, &TestParticle::age, &TestParticle::lifetime>(
+        std::span<TestParticle>(particles), start, end, 1.f);
+
+    EXPECT_FLOAT_EQ(particles[0].age, 1.f);
+    EXPECT_FLOAT_EQ(particles[0].color.a, 0.5f);
+    EXPECT_FLOAT_EQ(particles[1].color.a, 0.f);
+}
+
+TEST(ParticleKernels, FindOutOfBounds) {
+    std::vector<TestParticle> particles;
+    particles.emplace_back(glm::vec2(5.f, 5.f), glm::vec2(0.f));
+    particles.emplace_back(glm::vec2(-1.f, 5.f), glm::vec2(0.f));
+    particles.emplace_back(glm::vec2(5.f, 5.f), glm::vec2(0.f));
+    particles.emplace_back(glm::vec2(5.f, 11.f), glm::vec2(0.f));
+
+    std::vector<const TestParticle*> out(particles.size());
+    const std::size_t count = kernel::findOutOfBounds<&TestParticle::pos>(
+        std::span<TestParticle>(particles), {0.f, 0.f}, {10.f, 10.f}, out.data());
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(out[0], &particles[1]);
+    EXPECT_EQ(out[1], &particles[3]);
+}
+
+} // namespace unittest
+} // namespace pcl
+} // namespace bl
@@ -0,0 +1,106 @@
+#include <BLIB/Render/Buffers/DirtySet.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace buf
+{
+namespace unittest
+{
+namespace
+{
+std::vector<DirtyRange> ranges(const DirtySet& set) {
+    std::vector<DirtyRange> result;
+    set.getRanges(result);
+    return result;
+}
+
+void expectRange(const DirtyRange& range, std::uint32_t start, std::uint32_t size) {
+    EXPECT_EQ(range.start, start);
+    EXPECT_EQ(range.size, size);
+}
+} // namespace
+
+TEST(DirtySet, EmptyAndReset) {
+    DirtySet set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(ranges(set).empty());
+
+    set.markDirty(5, 3);
+    EXPECT_FALSE(set.empty());
+    EXPECT_EQ(set.dirtyCount(), 3);
+    expectRange(set.getBounds(), 5, 3);
+
+    set.reset();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.isDirty(5));
+    EXPECT_EQ(set.dirtyCount(), 0);
+}
+
+TEST(DirtySet, SparseElementsStaySeparate) {
+    DirtySet set(0);
+    set.markDirty(3);
+    set.markDirty(1000);
+    set.markDirty(70, 130);
+
+    const auto result = ranges(set);
+    ASSERT_EQ(result.size(), 3);
+    expectRange(result[0], 3, 1);
+    expectRange(result[1], 70, 130);
+    expectRange(result[2], 1000, 1);
+    expectRange(set.getBounds(), 3, 998);
+    EXPECT_EQ(set.dirtyCount(), 132);
+}
+
+TEST(DirtySet, GapThresholdCoalesces) {
+    DirtySet set(2);
+    set.markDirty(10);
+    set.markDirty(13); // gap of 2, merged
+    set.markDirty(17); // gap of 3, separate
+    set.markDirty(63);
+    set.markDirty(64); // adjacent across word boundary, merged
+
+    auto result = ranges(set);
+    ASSERT_EQ(result.size(), 3);
+    expectRange(result[0], 10, 4);
+    expectRange(result[1], 17, 1);
+    expectRange(result[2], 63, 2);
+
+    set.setGapThreshold(100);
+    result = ranges(set);
+    ASSERT_EQ(result.size(), 1);
+    expectRange(result[0], 10, 55);
+}
+
+TEST(DirtySet, Combine) {
+    DirtySet a(0);
+    DirtySet b(0);
+    a.markDirty(2);
+    b.markDirty(500, 2);
+    b.markDirty(0);
+
+    a.markDirty(b);
+    const auto result = ranges(a);
+    ASSERT_EQ(result.size(), 3);
+    expectRange(result[0], 0, 1);
+    expectRange(result[1], 2, 1);
+    expectRange(result[2], 500, 2);
+}
+
+TEST(DirtyRange, CombineWithEmpty) {
+    DirtyRange range;
+    range.markDirty(5);
+    EXPECT_EQ(range.start, 5);
+    EXPECT_EQ(range.size, 1);
+
+    range.combine(DirtyRange());
+    EXPECT_EQ(range.start, 5);
+    EXPECT_EQ(range.size, 1);
+}
+
+} // namespace unittest
+} // namespace buf
+} // namespace rc
+} // namespace bl
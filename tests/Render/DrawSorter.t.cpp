@@ -0,0 +1,115 @@
+#include <BLIB/Render/Scenes/DrawSorter.hpp>
+#include <BLIB/Util/Random.hpp>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace unittest
+{
+namespace
+{
+std::vector<std::uint64_t> keysOf(const DrawSorter& sorter) {
+    std::vector<std::uint64_t> keys;
+    for (const auto& e : sorter.getEntries()) { keys.emplace_back(e.key); }
+    return keys;
+}
+} // namespace
+
+TEST(DrawSorter, OpaqueKeysSortByStateThenFrontToBack) {
+    const DrawSortKey::Fields first{1, 0, UpdateSpeed::Static};
+    const DrawSortKey::Fields second{2, 0, UpdateSpeed::Static};
+
+    EXPECT_LT(DrawSortKey::opaque(first, 100.f, 1), DrawSortKey::opaque(second, 1.f, 1));
+    EXPECT_LT(DrawSortKey::opaque(first, 1.f, 1), DrawSortKey::opaque(first, 100.f, 1));
+    EXPECT_EQ(DrawSortKey::opaque(first, -5.f, 1), DrawSortKey::opaque(first, 0.f, 1));
+
+    const DrawSortKey::Fields unpacked =
+        DrawSortKey::unpack(DrawSortKey::opaque({4095, 15, UpdateSpeed::Dynamic}, 3.f, 7), false);
+    EXPECT_EQ(unpacked.pipeline, 4095);
+    EXPECT_EQ(unpacked.specialization, 15);
+    EXPECT_EQ(unpacked.speed, UpdateSpeed::Dynamic);
+}
+
+TEST(DrawSorter, TransparentKeysSortBackToFront) {
+    const DrawSortKey::Fields first{1, 0, UpdateSpeed::Static};
+    const DrawSortKey::Fields second{2, 3, UpdateSpeed::Dynamic};
+
+    EXPECT_LT(DrawSortKey::transparent(second, 100.f, 1), DrawSortKey::transparent(first, 1.f, 1));
+    EXPECT_LT(DrawSortKey::transparent(first, 5.f, 1), DrawSortKey::transparent(second, 5.f, 1));
+
+    const DrawSortKey::Fields unpacked =
+        DrawSortKey::unpack(DrawSortKey::transparent(second, 12.f, 9), true);
+    EXPECT_EQ(unpacked.pipeline, 2);
+    EXPECT_EQ(unpacked.specialization, 3);
+    EXPECT_EQ(unpacked.speed, UpdateSpeed::Dynamic);
+}
+
+TEST(DrawSorter, CoherentFramesAvoidFullSort) {
+    constexpr std::uint32_t Count = 1000;
+    DrawSorter sorter;
+    sorter.beginFrame([](std::uint32_t, std::uint64_t&) { return true; });
+    for (std::uint32_t i = 0; i < Count; ++i) { sorter.add(i, (Count - i) * 10); }
+    sorter.sort();
+    EXPECT_EQ(sorter.getLastMethod(), DrawSorter::Method::RadixSorted);
+    std::vector<std::uint64_t> keys = keysOf(sorter);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // unchanged frame
+    sorter.beginFrame([](std::uint32_t, std::uint64_t&) { return true; });
+    sorter.sort();
+    EXPECT_EQ(sorter.getLastMethod(), DrawSorter::Method::AlreadySorted);
+
+    // a few moved, one removed, one added
+    sorter.beginFrame([](std::uint32_t value, std::uint64_t& key) {
+        if (value == 5) { return false; }
+        if (value % 100 == 0) { key = value * 7; }
+        return true;
+    });
+    EXPECT_FALSE(sorter.contains(5));
+    EXPECT_TRUE(sorter.contains(6));
+    sorter.add(Count, 15);
+    sorter.sort();
+    EXPECT_EQ(sorter.getLastMethod(), DrawSorter::Method::Merged);
+    EXPECT_EQ(sorter.getEntries().size(), Count);
+    keys = keysOf(sorter);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+}
+
+TEST(DrawSorter, RadixSortMatchesStdSort) {
+    util::ThreadPool pool;
+    pool.start(2);
+
+    for (const std::uint32_t count : {0u, 1u, 500u, DrawSorter::MinParallelCount * 3 + 17}) {
+        std::vector<DrawSorter::Entry> entries(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            // leave the upper bytes constant to exercise pass skipping
+            entries[i] = {util::Random::get<std::uint64_t>(0, 1ull << 40), i};
+        }
+        std::vector<DrawSorter::Entry> expected = entries;
+        std::stable_sort(expected.begin(),
+                         expected.end(),
+                         [](const DrawSorter::Entry& l, const DrawSorter::Entry& r) {
+                             return l.key < r.key;
+                         });
+
+        std::vector<DrawSorter::Entry> scratch;
+        DrawSorter::radixSort(entries, scratch, &pool);
+        ASSERT_EQ(entries.size(), expected.size());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            ASSERT_EQ(entries[i].key, expected[i].key);
+            ASSERT_EQ(entries[i].value, expected[i].value);
+        }
+    }
+
+    pool.shutdown();
+}
+
+} // namespace unittest
+} // namespace scene
+} // namespace rc
+} // namespace bl
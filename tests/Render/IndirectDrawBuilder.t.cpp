@@ -0,0 +1,122 @@
+#include <BLIB/Render/Scenes/IndirectDrawBuilder.hpp>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace unittest
+{
+namespace
+{
+using DrawType = prim::DrawParameters::DrawType;
+
+VkBuffer fakeBuffer(std::uintptr_t id) { return reinterpret_cast<VkBuffer>(id); }
+
+prim::DrawParameters indexed(std::uintptr_t vb, std::uintptr_t ib, std::uint32_t offset,
+                             std::uint32_t count) {
+    prim::DrawParameters params;
+    params.type         = DrawType::IndexBuffer;
+    params.vertexBuffer = fakeBuffer(vb);
+    params.indexBuffer  = fakeBuffer(ib);
+    params.indexOffset  = offset;
+    params.indexCount   = count;
+    return params;
+}
+
+prim::DrawParameters vertices(std::uintptr_t vb, std::uint32_t offset, std::uint32_t count) {
+    prim::DrawParameters params;
+    params.type         = DrawType::VertexBuffer;
+    params.vertexBuffer = fakeBuffer(vb);
+    params.vertexOffset = offset;
+    params.vertexCount  = count;
+    return params;
+}
+} // namespace
+
+TEST(IndirectDrawBuilder, GroupsByBuffersAndSkipsEmpty) {
+    IndirectDrawBuilder draws;
+    draws.addDraw(indexed(1, 2, 0, 6), 10);
+    draws.addDraw(indexed(1, 2, 6, 6), 11);
+    draws.addDraw(indexed(1, 2, 12, 0), 12);
+    draws.addDraw(prim::DrawParameters(), 13);
+    draws.addDraw(vertices(3, 0, 4), 14);
+    draws.addDraw(indexed(1, 2, 18, 3), 15);
+
+    ASSERT_EQ(draws.commandCount(), 4);
+    ASSERT_EQ(draws.getGroups().size(), 3);
+    EXPECT_EQ(draws.getGroups()[0].type, DrawType::IndexBuffer);
+    EXPECT_EQ(draws.getGroups()[0].firstCommand, 0);
+    EXPECT_EQ(draws.getGroups()[0].commandCount, 2);
+    EXPECT_EQ(draws.getGroups()[1].type, DrawType::VertexBuffer);
+    EXPECT_EQ(draws.getGroups()[1].vertexBuffer, fakeBuffer(3));
+    EXPECT_EQ(draws.getGroups()[1].commandCount, 1);
+    EXPECT_EQ(draws.getGroups()[2].firstCommand, 2);
+    EXPECT_EQ(draws.getGroups()[2].commandCount, 1);
+
+    const auto& commands = draws.getIndexedCommands();
+    EXPECT_EQ(commands[1].firstIndex, 6);
+    EXPECT_EQ(commands[1].firstInstance, 11);
+    EXPECT_EQ(commands[2].firstIndex, 18);
+    EXPECT_EQ(commands[2].firstInstance, 15);
+    EXPECT_EQ(draws.getVertexCommands()[0].vertexCount, 4);
+    EXPECT_EQ(draws.getVertexCommands()[0].firstInstance, 14);
+}
+
+TEST(IndirectDrawBuilder, InstancedDrawKeepsFirstInstance) {
+    prim::DrawParameters params = indexed(1, 2, 0, 6);
+    params.instanceCount        = 5;
+    params.firstInstance        = 20;
+
+    IndirectDrawBuilder draws;
+    draws.addDraw(params, 3);
+    ASSERT_EQ(draws.commandCount(), 1);
+    EXPECT_EQ(draws.getIndexedCommands()[0].instanceCount, 5);
+    EXPECT_EQ(draws.getIndexedCommands()[0].firstInstance, 20);
+}
+
+TEST(IndirectDrawBuilder, AppendMatchesSerialBuild) {
+    std::vector<prim::DrawParameters> params;
+    for (std::uint32_t i = 0; i < 100; ++i) {
+        if (i % 7 == 0) { params.emplace_back(vertices(9, i, 3)); }
+        else { params.emplace_back(indexed(1 + i / 40, 2, i * 6, i % 5 == 0 ? 0 : 6)); }
+    }
+
+    IndirectDrawBuilder serial;
+    for (std::uint32_t i = 0; i < params.size(); ++i) { serial.addDraw(params[i], i); }
+
+    IndirectDrawBuilder merged;
+    IndirectDrawBuilder chunk;
+    for (std::uint32_t start = 0; start < params.size(); start += 13) {
+        chunk.clear();
+        for (std::uint32_t i = start; i < std::min<std::uint32_t>(start + 13, params.size());
+             ++i) {
+            chunk.addDraw(params[i], i);
+        }
+        merged.append(chunk);
+    }
+
+    ASSERT_EQ(merged.getGroups().size(), serial.getGroups().size());
+    for (unsigned int i = 0; i < serial.getGroups().size(); ++i) {
+        EXPECT_EQ(merged.getGroups()[i].type, serial.getGroups()[i].type);
+        EXPECT_EQ(merged.getGroups()[i].vertexBuffer, serial.getGroups()[i].vertexBuffer);
+        EXPECT_EQ(merged.getGroups()[i].firstCommand, serial.getGroups()[i].firstCommand);
+        EXPECT_EQ(merged.getGroups()[i].commandCount, serial.getGroups()[i].commandCount);
+    }
+
+    ASSERT_EQ(merged.byteSize(), serial.byteSize());
+    std::vector<char> a(serial.byteSize());
+    std::vector<char> b(merged.byteSize());
+    serial.writeCommands(a.data());
+    merged.writeCommands(b.data());
+    EXPECT_EQ(a, b);
+}
+
+} // namespace unittest
+} // namespace scene
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,219 @@
+#include <BLIB/Render/Scenes/InstanceGroups.hpp>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace unittest
+{
+namespace
+{
+struct DrawRun {
+    std::vector<std::uint32_t> ids;
+    VkBuffer vertexBuffer;
+
+    bool operator==(const DrawRun& other) const {
+        return ids == other.ids && vertexBuffer == other.vertexBuffer;
+    }
+};
+
+VkBuffer fakeBuffer(std::uintptr_t id) { return reinterpret_cast<VkBuffer>(id); }
+
+prim::DrawParameters mesh(std::uintptr_t vb, std::uint32_t indexCount = 36) {
+    prim::DrawParameters params;
+    params.vertexBuffer = fakeBuffer(vb);
+    params.indexBuffer  = fakeBuffer(vb + 1000);
+    params.indexCount   = indexCount;
+    return params;
+}
+
+prim::DrawParameters vertices(std::uintptr_t vb, std::uint32_t vertexCount,
+                              std::uint32_t vertexOffset = 0) {
+    prim::DrawParameters params;
+    params.type         = prim::DrawParameters::DrawType::VertexBuffer;
+    params.vertexBuffer = fakeBuffer(vb);
+    params.vertexCount  = vertexCount;
+    params.vertexOffset = vertexOffset;
+    return params;
+}
+
+std::vector<DrawRun> collect(const InstanceGroups& groups, const InstanceIndexPool& pool,
+                             const std::vector<std::uint32_t>& hidden = {}) {
+    std::vector<DrawRun> runs;
+    groups.forEachRun(
+        [&hidden](std::uint32_t id, const prim::DrawParameters&) {
+            return std::find(hidden.begin(), hidden.end(), id) == hidden.end();
+        },
+        [&runs, &pool](const prim::DrawParameters& params, std::uint32_t first) {
+            EXPECT_GE(params.firstInstance, cfg::Limits::InstanceIndexBase);
+            const std::uint32_t slot = params.firstInstance - cfg::Limits::InstanceIndexBase;
+            EXPECT_EQ(pool[slot], first);
+
+            DrawRun run{{}, params.vertexBuffer};
+            for (std::uint32_t i = 0; i < params.instanceCount; ++i) {
+                run.ids.emplace_back(pool[slot + i]);
+            }
+            runs.emplace_back(run);
+        });
+    return runs;
+}
+} // namespace
+
+TEST(InstanceGroups, GroupsSharedGeometry) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    for (std::uint32_t i = 0; i < 6; ++i) { groups.add(i, mesh(1)); }
+    groups.add(6, mesh(2));
+    groups.add(7, mesh(1));
+
+    EXPECT_EQ(groups.groupCount(), 2);
+    EXPECT_EQ(collect(groups, pool),
+              (std::vector<DrawRun>{{{0, 1, 2, 3, 4, 5, 7}, fakeBuffer(1)},
+                                    {{6}, fakeBuffer(2)}}));
+    EXPECT_EQ(collect(groups, pool, {2}),
+              (std::vector<DrawRun>{{{0, 1}, fakeBuffer(1)},
+                                    {{3, 4, 5, 7}, fakeBuffer(1)},
+                                    {{6}, fakeBuffer(2)}}));
+}
+
+TEST(InstanceGroups, InterleavedIds) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+
+    // children of models get interleaved ids but still share one draw per mesh
+    for (std::uint32_t i = 0; i < 6; ++i) { groups.add(i, mesh(i % 2 + 1)); }
+    EXPECT_EQ(collect(groups, pool),
+              (std::vector<DrawRun>{{{0, 2, 4}, fakeBuffer(1)}, {{1, 3, 5}, fakeBuffer(2)}}));
+}
+
+TEST(InstanceGroups, RemoveAndRebatch) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    for (std::uint32_t i = 0; i < 4; ++i) { groups.add(i, mesh(1)); }
+
+    groups.remove(1);
+    EXPECT_FALSE(groups.contains(1));
+    groups.add(1, mesh(1));
+    EXPECT_EQ(collect(groups, pool), (std::vector<DrawRun>{{{0, 3, 2, 1}, fakeBuffer(1)}}));
+
+    // changed draw parameters move the object to a different group
+    groups.update(2, mesh(3));
+    groups.update(0, mesh(1));
+    EXPECT_EQ(groups.groupCount(), 2);
+    EXPECT_EQ(collect(groups, pool),
+              (std::vector<DrawRun>{{{0, 3, 1}, fakeBuffer(1)}, {{2}, fakeBuffer(3)}}));
+
+    groups.remove(2);
+    EXPECT_EQ(groups.groupCount(), 1);
+}
+
+TEST(InstanceGroups, IncrementalPoolUpdates) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    for (std::uint32_t i = 0; i < 3; ++i) { groups.add(i, mesh(1)); }
+    pool.markClean();
+
+    // steady state frames do not touch the pool
+    collect(groups, pool);
+    EXPECT_FALSE(pool.isDirty());
+
+    groups.update(1, mesh(1));
+    EXPECT_FALSE(pool.isDirty());
+
+    // removal only rewrites the slot the last member moves into
+    groups.remove(0);
+    ASSERT_TRUE(pool.isDirty());
+    EXPECT_EQ(pool.dirtyEnd() - pool.dirtyBegin(), 1);
+    pool.markClean();
+
+    // growing past the capacity of a group moves it to a larger range
+    for (std::uint32_t i = 3; i < 300; ++i) { groups.add(i, mesh(1)); }
+    std::vector<std::uint32_t> expected{2, 1};
+    for (std::uint32_t i = 3; i < 300; ++i) { expected.emplace_back(i); }
+    EXPECT_EQ(collect(groups, pool), (std::vector<DrawRun>{{expected, fakeBuffer(1)}}));
+    EXPECT_GE(pool.capacity(), 299);
+}
+
+TEST(InstanceGroups, LooseObjects) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    prim::DrawParameters instanced = mesh(1);
+    instanced.instanceCount        = 4;
+    groups.add(0, instanced);
+    groups.add(1, mesh(1, 0));
+    groups.add(2, mesh(1));
+
+    EXPECT_EQ(groups.getLoose(), (std::vector<std::uint32_t>{0, 1}));
+    groups.update(1, mesh(1));
+    EXPECT_EQ(groups.getLoose(), (std::vector<std::uint32_t>{0}));
+    EXPECT_EQ(collect(groups, pool), (std::vector<DrawRun>{{{2, 1}, fakeBuffer(1)}}));
+
+    groups.remove(0);
+    EXPECT_TRUE(groups.getLoose().empty());
+}
+
+TEST(InstanceGroups, NonIndexedDraws) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    groups.add(0, vertices(1, 6));
+    groups.add(1, vertices(1, 6));
+    groups.add(2, vertices(1, 6, 6));
+    groups.add(3, vertices(1, 3));
+    groups.add(4, vertices(1, 0));
+    groups.add(5, mesh(1, 6));
+
+    // vertex count and offset select the geometry and indexed draws never share a group
+    EXPECT_EQ(groups.groupCount(), 4);
+    EXPECT_EQ(groups.getLoose(), (std::vector<std::uint32_t>{4}));
+    EXPECT_EQ(collect(groups, pool),
+              (std::vector<DrawRun>{{{0, 1}, fakeBuffer(1)},
+                                    {{2}, fakeBuffer(1)},
+                                    {{3}, fakeBuffer(1)},
+                                    {{5}, fakeBuffer(1)}}));
+
+    groups.update(2, vertices(1, 6));
+    EXPECT_EQ(groups.groupCount(), 3);
+    EXPECT_EQ(collect(groups, pool),
+              (std::vector<DrawRun>{{{0, 1, 2}, fakeBuffer(1)},
+                                    {{3}, fakeBuffer(1)},
+                                    {{5}, fakeBuffer(1)}}));
+}
+
+TEST(InstanceGroups, SingleGroupLookup) {
+    InstanceIndexPool pool;
+    InstanceGroups groups(pool);
+    groups.add(0, mesh(1));
+    groups.add(1, mesh(2));
+    groups.add(2, mesh(1));
+    groups.add(3, mesh(1, 0));
+
+    const std::uint32_t first  = groups.getGroup(0);
+    const std::uint32_t second = groups.getGroup(1);
+    EXPECT_EQ(groups.getGroup(2), first);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(groups.getGroup(3), InstanceGroups::NoGroup);
+    EXPECT_EQ(groups.getGroup(4), InstanceGroups::NoGroup);
+    EXPECT_NE(groups.getGroupSlot(first), groups.getGroupSlot(second));
+
+    std::vector<std::uint32_t> drawn;
+    groups.forEachRun(
+        first,
+        [](std::uint32_t, const prim::DrawParameters&) { return true; },
+        [&drawn, &pool](const prim::DrawParameters& params, std::uint32_t) {
+            const std::uint32_t slot = params.firstInstance - cfg::Limits::InstanceIndexBase;
+            for (std::uint32_t i = 0; i < params.instanceCount; ++i) {
+                drawn.emplace_back(pool[slot + i]);
+            }
+        });
+    EXPECT_EQ(drawn, (std::vector<std::uint32_t>{0, 2}));
+}
+
+} // namespace unittest
+} // namespace scene
+} // namespace rc
+} // namespace bl
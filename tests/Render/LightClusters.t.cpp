@@ -0,0 +1,152 @@
+#include <BLIB/Render/Lighting/LightClusters.hpp>
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace lgt
+{
+namespace unittest
+{
+namespace
+{
+constexpr float Near = 0.1f;
+constexpr float Far  = 100.f;
+
+glm::mat4 makeProjection(bool flipY) {
+    glm::mat4 proj = glm::perspective(glm::radians(75.f), 16.f / 9.f, Near, Far);
+    if (flipY) { proj[1][1] *= -1.f; }
+    return proj;
+}
+
+glm::mat4 makeView() {
+    return glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+}
+
+bool contains(std::span<const std::uint32_t> list, std::uint32_t i) {
+    return std::find(list.begin(), list.end(), i) != list.end();
+}
+} // namespace
+
+TEST(LightClusters, DepthSlices) {
+    LightClusters clusters({4, 4, 8});
+    clusters.setProjection(makeProjection(false), Near, Far);
+    EXPECT_EQ(clusters.getDepthSlice(0.f), 0);
+    EXPECT_EQ(clusters.getDepthSlice(Near * 1.01f), 0);
+    EXPECT_EQ(clusters.getDepthSlice(Far * 0.99f), 7);
+    EXPECT_EQ(clusters.getDepthSlice(Far * 10.f), 7);
+
+    std::uint32_t prev = 0;
+    for (float d = Near; d < Far; d *= 1.1f) {
+        const std::uint32_t slice = clusters.getDepthSlice(d);
+        EXPECT_GE(slice, prev);
+        prev = slice;
+    }
+}
+
+TEST(LightClusters, AssignsVisibleLights) {
+    LightClusters clusters;
+    clusters.setProjection(makeProjection(false), Near, Far);
+
+    const std::vector<glm::vec4> points = {
+        {0.f, 0.f, -10.f, 1.f}, // in front of the camera
+        {0.f, 0.f, 10.f, 1.f},  // behind the camera
+        {0.f, 0.f, -500.f, 1.f} // beyond the far plane
+    };
+    const std::vector<glm::vec4> spots = {{0.f, 0.f, -10.f, 0.5f}};
+    clusters.build(makeView(), points, spots);
+
+    const std::uint32_t center = clusters.getClusterIndex(glm::vec2(0.f), 10.f);
+    ASSERT_EQ(clusters.getPointLights(center).size(), 1);
+    EXPECT_EQ(clusters.getPointLights(center)[0], 0);
+    ASSERT_EQ(clusters.getSpotLights(center).size(), 1);
+    EXPECT_EQ(clusters.getSpotLights(center)[0], 0);
+
+    const std::uint32_t corner = clusters.getClusterIndex(glm::vec2(0.95f), 10.f);
+    EXPECT_TRUE(clusters.getPointLights(corner).empty());
+    const std::uint32_t closest = clusters.getClusterIndex(glm::vec2(0.f), 1.f);
+    EXPECT_TRUE(clusters.getPointLights(closest).empty());
+
+    for (std::uint32_t c = 0; c < clusters.clusterCount(); ++c) {
+        EXPECT_FALSE(contains(clusters.getPointLights(c), 1));
+        EXPECT_FALSE(contains(clusters.getPointLights(c), 2));
+    }
+}
+
+TEST(LightClusters, CompactIndexList) {
+    LightClusters clusters({8, 8, 8});
+    clusters.setProjection(makeProjection(false), Near, Far);
+
+    std::vector<glm::vec4> points;
+    for (int i = 0; i < 50; ++i) {
+        points.emplace_back(static_cast<float>(i % 10) - 5.f,
+                            static_cast<float>(i / 10) - 2.f,
+                            -5.f - static_cast<float>(i),
+                            2.f);
+    }
+    clusters.build(makeView(), points, points);
+
+    std::uint32_t expectedOffset = 0;
+    for (const LightClusters::Cluster& cluster : clusters.getClusters()) {
+        EXPECT_EQ(cluster.offset, expectedOffset);
+        EXPECT_EQ(cluster.pointCount, cluster.spotCount);
+        expectedOffset += cluster.pointCount + cluster.spotCount;
+    }
+    EXPECT_EQ(expectedOffset, clusters.getLightIndices().size());
+}
+
+TEST(LightClusters, AssignmentIsConservative) {
+    for (const bool flipY : {false, true}) {
+        const glm::mat4 proj = makeProjection(flipY);
+        const glm::mat4 view = glm::lookAt(
+            glm::vec3(3.f, 2.f, 5.f), glm::vec3(0.f, 0.f, -20.f), glm::vec3(0.f, 1.f, 0.f));
+
+        LightClusters clusters;
+        clusters.setProjection(proj, Near, Far);
+
+        std::vector<glm::vec4> points;
+        for (int x = -4; x <= 4; ++x) {
+            for (int z = 0; z < 8; ++z) {
+                points.emplace_back(static_cast<float>(x) * 4.f,
+                                    static_cast<float>(z % 3) - 1.f,
+                                    static_cast<float>(z) * -6.f,
+                                    1.f + static_cast<float>(z % 4));
+            }
+        }
+        clusters.build(view, points, {});
+
+        // every sample inside of a light volume must land in a cluster listing that light
+        unsigned int tested = 0;
+        for (std::uint32_t li = 0; li < points.size(); ++li) {
+            const glm::vec3 c(points[li]);
+            const float r = points[li].w * 0.99f;
+            for (const glm::vec3 offset : {glm::vec3(0.f),
+                                           glm::vec3(r, 0.f, 0.f),
+                                           glm::vec3(-r, 0.f, 0.f),
+                                           glm::vec3(0.f, r, 0.f),
+                                           glm::vec3(0.f, -r, 0.f),
+                                           glm::vec3(0.f, 0.f, r),
+                                           glm::vec3(0.f, 0.f, -r)}) {
+                const glm::vec4 viewPos = view * glm::vec4(c + offset, 1.f);
+                const glm::vec4 clip    = proj * viewPos;
+                if (clip.w <= Near) { continue; }
+                const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+                if (std::abs(ndc.x) > 1.f || std::abs(ndc.y) > 1.f) { continue; }
+                if (-viewPos.z > Far) { continue; }
+
+                const std::uint32_t cluster = clusters.getClusterIndex(ndc, -viewPos.z);
+                EXPECT_TRUE(contains(clusters.getPointLights(cluster), li));
+                ++tested;
+            }
+        }
+        EXPECT_GT(tested, 100);
+    }
+}
+
+} // namespace unittest
+} // namespace lgt
+} // namespace rc
+} // namespace bl
@@ -0,0 +1,75 @@
+#include <BLIB/Render/Vulkan/PipelineCacheFile.hpp>
+#include <BLIB/Util/FileUtil.hpp>
+#include <cstring>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace vk
+{
+namespace unittest
+{
+namespace
+{
+VkPhysicalDeviceProperties makeDevice(std::uint8_t uuidSeed) {
+    VkPhysicalDeviceProperties props{};
+    props.vendorID = 0x10de;
+    props.deviceID = 0x2484;
+    for (std::uint8_t i = 0; i < VK_UUID_SIZE; ++i) { props.pipelineCacheUUID[i] = uuidSeed + i; }
+    return props;
+}
+
+std::vector<char> makeCache(const VkPhysicalDeviceProperties& props, std::size_t payload) {
+    VkPipelineCacheHeaderVersionOne header{};
+    header.headerSize    = sizeof(header);
+    header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+    header.vendorID      = props.vendorID;
+    header.deviceID      = props.deviceID;
+    std::memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+
+    std::vector<char> data(sizeof(header) + payload, 7);
+    std::memcpy(data.data(), &header, sizeof(header));
+    return data;
+}
+} // namespace
+
+TEST(PipelineCacheFile, Compatibility) {
+    const VkPhysicalDeviceProperties device = makeDevice(1);
+    const std::vector<char> data            = makeCache(device, 64);
+    EXPECT_TRUE(PipelineCacheFile::isCompatible(data, device));
+
+    VkPhysicalDeviceProperties newDriver = device;
+    newDriver.pipelineCacheUUID[3]       = 0;
+    EXPECT_FALSE(PipelineCacheFile::isCompatible(data, newDriver));
+
+    VkPhysicalDeviceProperties otherGpu = device;
+    otherGpu.deviceID                   = 0x1234;
+    EXPECT_FALSE(PipelineCacheFile::isCompatible(data, otherGpu));
+
+    EXPECT_FALSE(PipelineCacheFile::isCompatible({}, device));
+    EXPECT_FALSE(PipelineCacheFile::isCompatible(std::vector<char>(data.begin(), data.begin() + 8),
+                                                 device));
+    EXPECT_NE(PipelineCacheFile::getFilename(device), PipelineCacheFile::getFilename(newDriver));
+}
+
+TEST(PipelineCacheFile, SaveAndLoad) {
+    const std::string dir                   = util::FileUtil::genTempNameInTempDir();
+    const VkPhysicalDeviceProperties device = makeDevice(5);
+    const std::vector<char> data            = makeCache(device, 128);
+
+    EXPECT_TRUE(PipelineCacheFile::load(dir, device).empty());
+    ASSERT_TRUE(PipelineCacheFile::save(dir, device, data));
+    EXPECT_EQ(PipelineCacheFile::load(dir, device), data);
+
+    // data for a different driver is never loaded
+    EXPECT_TRUE(PipelineCacheFile::load(dir, makeDevice(9)).empty());
+
+    util::FileUtil::deleteDirectory(dir);
+}
+
+} // namespace unittest
+} // namespace vk
+} // namespace rc
+} // namespace bl
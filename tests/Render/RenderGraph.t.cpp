@@ -22,20 +22,27 @@ namespace
 constexpr std::string_view ShadowLightsTag = "shadow-lights";
 constexpr std::string_view ShadowMapTag    = "shadowmap";
 constexpr std::string_view SharedTag       = "shared";
+constexpr VkDeviceSize TransientSize        = 1024;
 
 struct TestAsset : public Asset {
     bool created;
     bool preparedForInput;
     bool preparedForOutput;
+    VkDeviceSize transientSize;
 
-    TestAsset(std::string_view tag)
+    TestAsset(std::string_view tag, VkDeviceSize transientSize = 0)
     : Asset(tag, false)
     , created(false)
     , preparedForInput(false)
-    , preparedForOutput(false) {}
+    , preparedForOutput(false)
+    , transientSize(transientSize) {}
 
     virtual void doCreate(const InitContext&) override { created = true; }
 
+    virtual VkMemoryRequirements getTransientMemoryRequirements() const override {
+        return VkMemoryRequirements{transientSize, 256, 0x3};
+    }
+
     virtual void doPrepareForInput(const ExecutionContext&) override {
         EXPECT_TRUE(created);
         preparedForInput = true;
@@ -74,7 +81,7 @@ struct SceneRenderOutput : public TestAsset {
     bool rendered;
 
     SceneRenderOutput()
-    : TestAsset(AssetTags::RenderedSceneOutput)
+    : TestAsset(AssetTags::RenderedSceneOutput, TransientSize)
     , rendered(false) {}
 };
 
@@ -82,7 +89,7 @@ struct PostFXOutput : public TestAsset {
     bool rendered;
 
     PostFXOutput()
-    : TestAsset(AssetTags::PostFXOutput)
+    : TestAsset(AssetTags::PostFXOutput, TransientSize)
     , rendered(false) {}
 };
 
@@ -614,6 +621,69 @@ TEST(RenderGraph, TaskSharedOnlyOutputExternal) {
     EXPECT_EQ(task2->executedAtCount, 1);
 }
 
+TEST(RenderGraph, TransientAssetsAliasAcrossTimeline) {
+    AssetFactory factory;
+    setupFactory(factory);
+
+    AssetPool pool(factory, nullptr);
+    pool.putAsset<SceneObjects>();
+    Swapframe* swapframe = pool.putAsset<Swapframe>();
+
+    engine::Engine engine(engine::Settings{});
+    Renderer renderer(engine, {});
+    RenderGraph graph(engine, renderer, pool, nullptr, nullptr);
+
+    // scene -> postfx -> postfx -> postfx -> swapframe
+    graph.putTask<SceneRenderTask>();
+    graph.putTask<PostFXTask>();
+    graph.putTask<PostFXTask>();
+    graph.putTask<PostFXTask>();
+
+    graph.execute(nullptr, 0, false);
+    EXPECT_TRUE(swapframe->rendered);
+
+    // each intermediate is live for its write and the following read only
+    const AliasingPlan& plan = graph.getAliasingPlan();
+    EXPECT_EQ(plan.getUnaliasedSize(), 3 * TransientSize);
+    EXPECT_EQ(plan.getSlotCount(), 2);
+    EXPECT_EQ(plan.getAliasedSize(), 2 * TransientSize);
+}
+
+TEST(RenderGraph, AliasingPlanRespectsLifetimesAndMemoryTypes) {
+    GraphAsset a(nullptr), b(nullptr), c(nullptr), d(nullptr), e(nullptr);
+
+    AliasingPlan plan;
+    plan.addAsset(&a, {4096, 256, 0x1}, 0, 1);
+    plan.addAsset(&b, {1024, 256, 0x1}, 1, 2);
+    plan.addAsset(&c, {2048, 1024, 0x1}, 2, 3);
+    plan.addAsset(&d, {512, 256, 0x2}, 3, 4);
+    plan.addAsset(&e, {8192, 256, 0x1}, 4, 4);
+    plan.build();
+
+    EXPECT_EQ(plan.getSlot(&a), plan.getSlot(&c));
+    EXPECT_EQ(plan.getSlot(&a), plan.getSlot(&e));
+    EXPECT_NE(plan.getSlot(&a), plan.getSlot(&b));
+    EXPECT_NE(plan.getSlot(&d), plan.getSlot(&b));
+    EXPECT_NE(plan.getSlot(&d), plan.getSlot(&a));
+    EXPECT_EQ(plan.getSlot(nullptr), AliasingPlan::NotAliased);
+
+    EXPECT_EQ(plan.getSlotCount(), 3);
+    EXPECT_EQ(plan.getSlotSize(plan.getSlot(&e)), 8192);
+    EXPECT_EQ(plan.getUnaliasedSize(), 4096 + 1024 + 2048 + 512 + 8192);
+    EXPECT_EQ(plan.getAliasedSize(), 8192 + 1024 + 512);
+}
+
+TEST(RenderGraph, AliasingPlanPacksRequirements) {
+    VkMemoryRequirements packed{0, 1, ~0u};
+    EXPECT_EQ(AliasingPlan::pack(packed, {100, 64, 0x7}), 0);
+    EXPECT_EQ(AliasingPlan::pack(packed, {200, 256, 0x3}), 256);
+    EXPECT_EQ(AliasingPlan::pack(packed, {50, 16, 0x2}), 464);
+
+    EXPECT_EQ(packed.size, 514);
+    EXPECT_EQ(packed.alignment, 256);
+    EXPECT_EQ(packed.memoryTypeBits, 0x2u);
+}
+
 } // namespace unittest
 } // namespace rg
 } // namespace rc
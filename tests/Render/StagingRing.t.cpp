@@ -0,0 +1,99 @@
+#include <BLIB/Render/Transfers/StagingRing.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace tfr
+{
+namespace unittest
+{
+TEST(StagingRing, AlignsAndReleasesPerFrame) {
+    StagingRing ring(1024);
+    std::uint64_t offset = 0;
+
+    ring.beginFrame(0);
+    ASSERT_TRUE(ring.allocate(10, offset));
+    EXPECT_EQ(offset, 0);
+    ASSERT_TRUE(ring.allocate(100, offset));
+    EXPECT_EQ(offset, 16);
+    EXPECT_EQ(ring.used(), 116);
+
+    ring.beginFrame(1);
+    ASSERT_TRUE(ring.allocate(200, offset));
+    EXPECT_EQ(offset, 128);
+
+    // frame 0 is released but frame 1 still holds its region
+    ring.beginFrame(0);
+    EXPECT_EQ(ring.used(), 212);
+    ring.beginFrame(1);
+    EXPECT_EQ(ring.used(), 0);
+
+    EXPECT_EQ(ring.getStats().highWaterMark, 328);
+    EXPECT_EQ(ring.getStats().frameHighWaterMark, 200);
+}
+
+TEST(StagingRing, WrapsWithoutOverwritingLiveRegions) {
+    StagingRing ring(1024);
+    std::uint64_t offset = 0;
+
+    ring.beginFrame(0);
+    ASSERT_TRUE(ring.allocate(512, offset));
+    ring.beginFrame(1);
+    ASSERT_TRUE(ring.allocate(384, offset));
+    EXPECT_EQ(offset, 512);
+
+    // frame 0 done, the next region wraps to the front and wastes the tail end
+    ring.beginFrame(0);
+    ASSERT_TRUE(ring.allocate(256, offset));
+    EXPECT_EQ(offset, 0);
+    EXPECT_EQ(ring.used(), 384 + 128 + 256);
+
+    // the front is only free up to the live region of frame 1
+    EXPECT_FALSE(ring.allocate(300, offset));
+    ASSERT_TRUE(ring.allocate(256, offset));
+    EXPECT_EQ(offset, 256);
+    EXPECT_FALSE(ring.allocate(1, offset));
+}
+
+TEST(StagingRing, ReclaimsInOrder) {
+    StagingRing ring(1024);
+    std::uint64_t offset = 0;
+
+    ring.beginFrame(1);
+    ASSERT_TRUE(ring.allocate(256, offset));
+    ring.beginFrame(0);
+    ASSERT_TRUE(ring.allocate(256, offset));
+
+    // transfers flushed twice in one frame. frame 1 is older and still in flight
+    ring.beginFrame(0);
+    EXPECT_EQ(ring.used(), 512);
+    ASSERT_TRUE(ring.allocate(512, offset));
+    EXPECT_EQ(offset, 512);
+    EXPECT_FALSE(ring.allocate(16, offset));
+
+    ring.beginFrame(1);
+    EXPECT_EQ(ring.used(), 512);
+}
+
+TEST(StagingRing, OversizedRequestsFallBack) {
+    StagingRing ring(1024);
+    std::uint64_t offset = 0;
+
+    ring.beginFrame(0);
+    EXPECT_FALSE(ring.allocate(2048, offset));
+    ring.recordFallback(2048);
+    EXPECT_EQ(ring.used(), 0);
+    EXPECT_EQ(ring.getStats().fallbackCount, 1);
+    EXPECT_EQ(ring.getStats().fallbackBytes, 2048);
+
+    ring.resetStats();
+    EXPECT_EQ(ring.getStats().fallbackCount, 0);
+    EXPECT_EQ(ring.getStats().highWaterMark, 0);
+}
+
+} // namespace unittest
+} // namespace tfr
+} // namespace rc
+} // namespace bl
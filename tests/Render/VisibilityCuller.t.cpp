@@ -0,0 +1,128 @@
+#include <BLIB/Render/Scenes/VisibilityCuller.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace rc
+{
+namespace scene
+{
+namespace unittest
+{
+namespace
+{
+constexpr std::uint8_t Static  = static_cast<std::uint8_t>(UpdateSpeed::Static);
+constexpr std::uint8_t Dynamic = static_cast<std::uint8_t>(UpdateSpeed::Dynamic);
+
+Frustum makeFrustum(bool includeDepth = true) {
+    const glm::mat4 proj = glm::perspective(glm::radians(90.f), 1.f, 0.1f, 100.f);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), {0.f, 1.f, 0.f});
+    return Frustum::fromMatrix(proj * view, includeDepth);
+}
+} // namespace
+
+TEST(VisibilityCuller, FrustumContainsSphere) {
+    const Frustum frustum = makeFrustum();
+    EXPECT_TRUE(frustum.containsSphere({0.f, 0.f, -10.f}, 1.f));
+    EXPECT_FALSE(frustum.containsSphere({0.f, 0.f, 10.f}, 1.f));
+    EXPECT_FALSE(frustum.containsSphere({50.f, 0.f, -10.f}, 1.f));
+    EXPECT_TRUE(frustum.containsSphere({10.5f, 0.f, -10.f}, 1.f));
+    EXPECT_FALSE(frustum.containsSphere({0.f, 0.f, -200.f}, 1.f));
+
+    const Frustum noDepth = makeFrustum(false);
+    EXPECT_TRUE(noDepth.containsSphere({0.f, 0.f, -200.f}, 1.f));
+}
+
+TEST(VisibilityCuller, CullFrustum) {
+    std::array<CullingBounds, 2> bounds;
+    bounds[Static].resize(3);
+    bounds[Static].set(0, {0.f, 0.f, -10.f}, 1.f);
+    bounds[Static].set(1, {0.f, 0.f, 10.f}, 1.f);
+    bounds[Dynamic].resize(2);
+    bounds[Dynamic].set(0, {50.f, 0.f, -10.f}, 1.f);
+    bounds[Dynamic].set(1, {50.f, 0.f, -10.f}, 1.f);
+    bounds[Dynamic].setAlwaysVisible(1);
+
+    VisibilitySet result;
+    VisibilityCuller::cull(bounds, makeFrustum(), result);
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Static, 0}));
+    EXPECT_FALSE(result.isVisible({UpdateSpeed::Static, 1}));
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Static, 2}));
+    EXPECT_FALSE(result.isVisible({UpdateSpeed::Dynamic, 0}));
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Dynamic, 1}));
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Dynamic, 10}));
+
+    // objects without bounds are drawn but not counted
+    EXPECT_EQ(result.getStats().visible, 1);
+    EXPECT_EQ(result.getStats().culled, 2);
+
+    result.clear();
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Static, 1}));
+    EXPECT_EQ(result.getStats().culled, 0);
+}
+
+TEST(VisibilityCuller, BoundedCount) {
+    CullingBounds bounds;
+    bounds.resize(4);
+    EXPECT_EQ(bounds.boundedCount(), 0);
+
+    bounds.set(0, {0.f, 0.f, -10.f}, 1.f);
+    bounds.set(1, {0.f, 0.f, 10.f}, 1.f);
+    bounds.set(3, {0.f, 0.f, 10.f}, 1.f);
+    bounds.set(3, {0.f, 0.f, 20.f}, 2.f);
+    EXPECT_EQ(bounds.boundedCount(), 3);
+
+    bounds.setAlwaysVisible(1);
+    EXPECT_EQ(bounds.boundedCount(), 2);
+
+    bounds.resize(2);
+    EXPECT_EQ(bounds.boundedCount(), 1);
+}
+
+TEST(VisibilityCuller, CullSphere) {
+    std::array<CullingBounds, 2> bounds;
+    bounds[Dynamic].resize(2);
+    bounds[Dynamic].set(0, {5.f, 0.f, 0.f}, 1.f);
+    bounds[Dynamic].set(1, {20.f, 0.f, 0.f}, 1.f);
+
+    VisibilitySet result;
+    VisibilityCuller::cull(bounds, glm::vec3(0.f), 4.5f, result);
+    EXPECT_TRUE(result.isVisible({UpdateSpeed::Dynamic, 0}));
+    EXPECT_FALSE(result.isVisible({UpdateSpeed::Dynamic, 1}));
+    EXPECT_EQ(result.getStats().visible, 1);
+    EXPECT_EQ(result.getStats().culled, 1);
+}
+
+TEST(VisibilityCuller, ParallelMatchesSerial) {
+    constexpr std::uint32_t Count = VisibilityCuller::MinParallelCount * 5 + 17;
+    std::array<CullingBounds, 2> bounds;
+    bounds[Static].resize(Count);
+    for (std::uint32_t i = 0; i < Count; ++i) {
+        const float x = static_cast<float>(i % 200) - 100.f;
+        bounds[Static].set(i, {x, 0.f, -10.f}, 0.5f);
+    }
+
+    VisibilitySet serial;
+    VisibilityCuller::cull(bounds, makeFrustum(), serial);
+
+    util::ThreadPool pool;
+    pool.start(4);
+    VisibilitySet parallel;
+    VisibilityCuller::cull(bounds, makeFrustum(), parallel, &pool);
+    pool.shutdown();
+
+    EXPECT_GT(serial.getStats().visible, 0);
+    EXPECT_GT(serial.getStats().culled, 0);
+    EXPECT_EQ(serial.getStats().visible, parallel.getStats().visible);
+    EXPECT_EQ(serial.getStats().culled, parallel.getStats().culled);
+    for (std::uint32_t i = 0; i < Count; ++i) {
+        ASSERT_EQ(serial.isVisible({UpdateSpeed::Static, i}),
+                  parallel.isVisible({UpdateSpeed::Static, i}));
+    }
+}
+
+} // namespace unittest
+} // namespace scene
+} // namespace rc
+} // namespace bl
@@ -310,6 +310,30 @@ TEST(BinarySerializableObject, SerializePackedObject) {
     EXPECT_FLOAT_EQ(boi.fF(), 0.55f);
 }
 
+TEST(BinarySerializableObject, NestedBackpatchMatchesSizedWrite) {
+    Data data(42, "string", {Nested(true, 37.5f), Nested(false, 11.f)});
+
+    stream::OutputStream memory(1024);
+    ASSERT_TRUE(binary::Serializer<Data>::serialize(memory, data));
+    ASSERT_EQ(memory.getBuffer().size(), binary::Serializer<Data>::size(data));
+
+    // wrapped streams cannot be patched and write precomputed sizes instead
+    std::stringstream ss;
+    stream::OutputStream wrapped(ss);
+    ASSERT_TRUE(binary::Serializer<Data>::serialize(wrapped, data));
+    const std::span<const char> bytes = memory.getBuffer();
+    EXPECT_EQ(ss.str(), std::string(bytes.data(), bytes.size()));
+
+    Data read(0, "", {});
+    stream::InputStream in(bytes);
+    ASSERT_TRUE(binary::Serializer<Data>::deserialize(in, read));
+    EXPECT_EQ(read.intValue, 42);
+    EXPECT_EQ(read.stringValue, "string");
+    ASSERT_EQ(read.nestedValue.size(), 2);
+    EXPECT_EQ(read.nestedValue[0].boolValue, true);
+    EXPECT_NEAR(read.nestedValue[1].floatValue, 11.f, 0.1f);
+}
+
 } // namespace unittest
 } // namespace serial
 } // namespace bl
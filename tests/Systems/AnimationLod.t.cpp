@@ -0,0 +1,82 @@
+#include <BLIB/Systems/AnimationLod.hpp>
+#include <gtest/gtest.h>
+
+namespace bl
+{
+namespace sys
+{
+namespace unittest
+{
+TEST(AnimationLod, SelectLevel) {
+    AnimationLod lod;
+    lod.addLevel(50.f, 4, 2);
+    lod.addLevel(20.f, 2);
+    lod.addLevel(100.f, AnimationLod::Frozen);
+
+    ASSERT_EQ(lod.levelCount(), 4);
+    EXPECT_EQ(lod.selectLevel(0.f), 0);
+    EXPECT_EQ(lod.selectLevel(19.f), 0);
+    EXPECT_EQ(lod.selectLevel(20.f), 1);
+    EXPECT_EQ(lod.selectLevel(75.f), 2);
+    EXPECT_EQ(lod.getLevel(2).maxBoneDepth, 2);
+    EXPECT_EQ(lod.selectLevel(1000.f), 3);
+
+    lod.clearLevels();
+    EXPECT_EQ(lod.levelCount(), 1);
+    EXPECT_EQ(lod.selectLevel(1000.f), 0);
+}
+
+TEST(AnimationLod, ObserverDistance) {
+    AnimationLod lod;
+    EXPECT_EQ(lod.distanceTo2D({500.f, 500.f}), 0.f);
+    EXPECT_EQ(lod.distanceTo3D({500.f, 500.f, 500.f}), 0.f);
+
+    lod.addObserver({0.f, 0.f, 0.f}, {100.f, 50.f});
+    EXPECT_EQ(lod.distanceTo2D({90.f, -40.f}), 0.f);
+    EXPECT_FLOAT_EQ(lod.distanceTo2D({110.f, 0.f}), 10.f);
+    EXPECT_FLOAT_EQ(lod.distanceTo2D({0.f, -80.f}), 30.f);
+
+    lod.addObserver({300.f, 0.f, 0.f});
+    EXPECT_FLOAT_EQ(lod.distanceTo2D({305.f, 0.f}), 5.f);
+    EXPECT_FLOAT_EQ(lod.distanceTo3D({300.f, 0.f, 20.f}), 20.f);
+}
+
+TEST(AnimationLod, ThrottleAccumulatesTime) {
+    AnimationLod lod;
+    lod.addLevel(10.f, 3);
+    AnimationLod::State state;
+    AnimationLod::Stats stats;
+
+    EXPECT_FLOAT_EQ(lod.advance(state, 0.f, 0.1f, stats), 0.1f);
+    EXPECT_LT(lod.advance(state, 20.f, 0.1f, stats), 0.f);
+    EXPECT_LT(lod.advance(state, 20.f, 0.1f, stats), 0.f);
+    EXPECT_FLOAT_EQ(lod.advance(state, 20.f, 0.1f, stats), 0.3f);
+    EXPECT_EQ(state.level, 1);
+    EXPECT_EQ(stats.evaluated, 2);
+    EXPECT_EQ(stats.throttled, 2);
+    EXPECT_EQ(stats.frozen, 0);
+}
+
+TEST(AnimationLod, FrozenAndDisabled) {
+    AnimationLod lod;
+    lod.addLevel(10.f, AnimationLod::Frozen);
+    AnimationLod::State state;
+    AnimationLod::Stats stats;
+
+    EXPECT_LT(lod.advance(state, 20.f, 0.1f, stats), 0.f);
+    EXPECT_EQ(stats.frozen, 1);
+    EXPECT_EQ(state.accumulatedTime, 0.f);
+
+    state.enabled = false;
+    EXPECT_FLOAT_EQ(lod.advance(state, 20.f, 0.1f, stats), 0.1f);
+    EXPECT_EQ(state.level, 0);
+
+    state.enabled = true;
+    lod.setEnabled(false);
+    EXPECT_FLOAT_EQ(lod.advance(state, 20.f, 0.1f, stats), 0.1f);
+    EXPECT_EQ(stats.evaluated, 2);
+}
+
+} // namespace unittest
+} // namespace sys
+} // namespace bl
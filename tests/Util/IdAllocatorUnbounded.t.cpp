@@ -47,6 +47,28 @@ TEST(IdAllocatorUnbounded, ReAllocOrder) {
     ASSERT_EQ(alloc.allocate(), 3);
 }
 
+TEST(IdAllocatorUnbounded, BlockAllocateAndRelease) {
+    IdAllocatorUnbounded<unsigned int> alloc;
+    std::vector<unsigned int> ids;
+
+    alloc.allocate(6, ids);
+    ASSERT_EQ(ids, std::vector<unsigned int>({0, 1, 2, 3, 4, 5}));
+
+    const std::vector<unsigned int> released = {4, 1, 2};
+    alloc.release(released);
+    for (unsigned int id : released) { EXPECT_FALSE(alloc.isAllocated(id)); }
+
+    // lowest free ids are reused first, then the pool grows
+    ids.clear();
+    alloc.allocate(2, ids);
+    ASSERT_EQ(ids, std::vector<unsigned int>({1, 2}));
+    ids.clear();
+    alloc.allocate(3, ids);
+    ASSERT_EQ(ids, std::vector<unsigned int>({4, 6, 7}));
+    for (unsigned int i = 0; i < 8; ++i) { EXPECT_TRUE(alloc.isAllocated(i)); }
+    EXPECT_EQ(alloc.allocate(), 8);
+}
+
 } // namespace unittest
 } // namespace util
 } // namespace bl
@@ -0,0 +1,106 @@
+#include <BLIB/Util/OffsetAllocator.hpp>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace bl
+{
+namespace util
+{
+namespace unittest
+{
+TEST(OffsetAllocator, AllocAndRelease) {
+    OffsetAllocator allocator(100);
+
+    const auto a = allocator.allocate(10);
+    const auto b = allocator.allocate(20);
+    const auto c = allocator.allocate(30);
+    ASSERT_TRUE(a.isValid());
+    ASSERT_TRUE(b.isValid());
+    ASSERT_TRUE(c.isValid());
+    EXPECT_EQ(allocator.freeSpace(), 40);
+    EXPECT_EQ(allocator.usedEnd(), 60);
+    EXPECT_FALSE(allocator.allocate(41).isValid());
+
+    allocator.release(b);
+    EXPECT_EQ(allocator.freeSpace(), 60);
+    EXPECT_EQ(allocator.usedEnd(), 60);
+
+    // hole is reused without moving neighbors
+    const auto d = allocator.allocate(20);
+    ASSERT_TRUE(d.isValid());
+    EXPECT_EQ(d.offset, b.offset);
+
+    allocator.release(c);
+    EXPECT_EQ(allocator.usedEnd(), d.offset + d.size);
+    allocator.release(a);
+    allocator.release(d);
+    EXPECT_EQ(allocator.usedEnd(), 0);
+    EXPECT_EQ(allocator.freeSpace(), 100);
+
+    // fully coalesced
+    const auto all = allocator.allocate(100);
+    ASSERT_TRUE(all.isValid());
+    EXPECT_EQ(all.offset, 0);
+}
+
+TEST(OffsetAllocator, Grow) {
+    OffsetAllocator allocator(16);
+    const auto a = allocator.allocate(16);
+    ASSERT_TRUE(a.isValid());
+    EXPECT_FALSE(allocator.allocate(8).isValid());
+
+    allocator.grow(64);
+    EXPECT_EQ(allocator.capacity(), 64);
+    const auto b = allocator.allocate(48);
+    ASSERT_TRUE(b.isValid());
+    EXPECT_EQ(b.offset, 16);
+
+    allocator.release(b);
+    allocator.grow(128);
+    const auto c = allocator.allocate(112);
+    ASSERT_TRUE(c.isValid());
+    EXPECT_EQ(c.offset, 16);
+}
+
+TEST(OffsetAllocator, RandomChurnNeverOverlaps) {
+    constexpr std::uint32_t Capacity = 4096;
+    OffsetAllocator allocator(Capacity);
+    std::vector<OffsetAllocator::Allocation> live;
+    std::vector<bool> used(Capacity, false);
+    std::mt19937 rng(42);
+
+    for (unsigned int i = 0; i < 5000; ++i) {
+        if (live.empty() || rng() % 3 != 0) {
+            const auto alloc = allocator.allocate(1 + rng() % 64);
+            if (!alloc.isValid()) { continue; }
+            ASSERT_LE(alloc.offset + alloc.size, Capacity);
+            for (std::uint32_t j = alloc.offset; j < alloc.offset + alloc.size; ++j) {
+                ASSERT_FALSE(used[j]);
+                used[j] = true;
+            }
+            live.emplace_back(alloc);
+        }
+        else {
+            const std::size_t k = rng() % live.size();
+            for (std::uint32_t j = live[k].offset; j < live[k].offset + live[k].size; ++j) {
+                used[j] = false;
+            }
+            allocator.release(live[k]);
+            live[k] = live.back();
+            live.pop_back();
+        }
+
+        const auto lastUsed = std::find(used.rbegin(), used.rend(), true);
+        ASSERT_EQ(allocator.usedEnd(), static_cast<std::uint32_t>(used.rend() - lastUsed));
+        ASSERT_EQ(allocator.freeSpace(),
+                  static_cast<std::uint32_t>(std::count(used.begin(), used.end(), false)));
+    }
+
+    for (const auto& alloc : live) { allocator.release(alloc); }
+    EXPECT_EQ(allocator.allocate(Capacity).offset, 0);
+}
+
+} // namespace unittest
+} // namespace util
+} // namespace bl
@@ -0,0 +1,73 @@
+#include <BLIB/Util/Profiler.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+namespace bl
+{
+namespace util
+{
+namespace unittest
+{
+TEST(Profiler, CollectAndSummarize) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+
+    profiler.markFrame();
+    { ProfileScope scope("outer"); }
+    std::thread([]() { ProfileScope scope("worker"); }).join();
+    { ProfileScope scope("outer"); }
+    profiler.markFrame();
+    { ProfileScope scope("next frame"); }
+
+    std::vector<Profiler::Event> events;
+    profiler.collect(events);
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].name, "outer");
+    EXPECT_EQ(events[1].name, "worker");
+    EXPECT_NE(events[0].thread, events[1].thread);
+
+    std::vector<Profiler::ScopeSummary> summary;
+    profiler.summarizeLastFrame(summary);
+    ASSERT_EQ(summary.size(), 2);
+    for (const auto& scope : summary) {
+        EXPECT_EQ(scope.count, scope.name == "outer" ? 2 : 1);
+        EXPECT_NE(scope.name, "next frame");
+    }
+
+    profiler.clear();
+    profiler.collect(events);
+    EXPECT_TRUE(events.empty());
+}
+
+TEST(Profiler, ChromeTrace) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+    profiler.markFrame();
+    { ProfileScope scope("quote\"d"); }
+
+    std::stringstream ss;
+    profiler.writeChromeTrace(ss);
+    const std::string trace = ss.str();
+    EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"quote\\\"d\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"i\""), std::string::npos);
+    profiler.clear();
+}
+
+TEST(Profiler, Disabled) {
+    Profiler& profiler = Profiler::get();
+    profiler.clear();
+    profiler.setEnabled(false);
+    { ProfileScope scope("ignored"); }
+    profiler.setEnabled(true);
+
+    std::vector<Profiler::Event> events;
+    profiler.collect(events);
+    EXPECT_TRUE(events.empty());
+}
+
+} // namespace unittest
+} // namespace util
+} // namespace bl
@@ -0,0 +1,91 @@
+#include <BLIB/Util/SkylinePacker.hpp>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace bl
+{
+namespace util
+{
+namespace unittest
+{
+namespace
+{
+struct Rect {
+    glm::u32vec2 pos;
+    glm::u32vec2 size;
+
+    bool overlaps(const Rect& r) const {
+        return pos.x < r.pos.x + r.size.x && r.pos.x < pos.x + size.x &&
+               pos.y < r.pos.y + r.size.y && r.pos.y < pos.y + size.y;
+    }
+};
+} // namespace
+
+TEST(SkylinePacker, PlacesLowestFirst) {
+    SkylinePacker packer(100, 100);
+
+    const auto a = packer.pack(40, 30);
+    const auto b = packer.pack(40, 10);
+    const auto c = packer.pack(20, 10);
+    ASSERT_TRUE(a.has_value());
+    ASSERT_TRUE(b.has_value());
+    ASSERT_TRUE(c.has_value());
+    EXPECT_EQ(a.value(), glm::u32vec2(0, 0));
+    EXPECT_EQ(b.value(), glm::u32vec2(40, 0));
+    EXPECT_EQ(c.value(), glm::u32vec2(80, 0));
+
+    // the short segment at x=40 is lower than the segment at x=0
+    const auto d = packer.pack(40, 10);
+    ASSERT_TRUE(d.has_value());
+    EXPECT_EQ(d.value(), glm::u32vec2(40, 10));
+
+    EXPECT_FALSE(packer.pack(101, 1).has_value());
+    EXPECT_FALSE(packer.pack(1, 101).has_value());
+}
+
+TEST(SkylinePacker, GrowKeepsPlacements) {
+    SkylinePacker packer(32, 32);
+    ASSERT_TRUE(packer.pack(32, 32).has_value());
+    EXPECT_FALSE(packer.pack(8, 8).has_value());
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.f);
+
+    packer.grow(64, 64);
+    EXPECT_EQ(packer.getSize(), glm::u32vec2(64, 64));
+    const auto right = packer.pack(32, 32);
+    ASSERT_TRUE(right.has_value());
+    EXPECT_EQ(right.value(), glm::u32vec2(32, 0));
+    const auto below = packer.pack(64, 32);
+    ASSERT_TRUE(below.has_value());
+    EXPECT_EQ(below.value(), glm::u32vec2(0, 32));
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.f);
+
+    packer.reset(16, 16);
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 0.f);
+    EXPECT_TRUE(packer.pack(16, 16).has_value());
+}
+
+TEST(SkylinePacker, NoOverlapsRandomSizes) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<unsigned int> dist(1, 24);
+
+    SkylinePacker packer(256, 256);
+    std::vector<Rect> placed;
+    for (unsigned int i = 0; i < 400; ++i) {
+        const glm::u32vec2 size(dist(rng), dist(rng));
+        const auto pos = packer.pack(size.x, size.y);
+        if (!pos.has_value()) { continue; }
+
+        const Rect rect{pos.value(), size};
+        EXPECT_LE(rect.pos.x + rect.size.x, 256u);
+        EXPECT_LE(rect.pos.y + rect.size.y, 256u);
+        for (const Rect& other : placed) { ASSERT_FALSE(rect.overlaps(other)); }
+        placed.emplace_back(rect);
+    }
+
+    EXPECT_GT(placed.size(), 200u);
+    EXPECT_GT(packer.getOccupancy(), 0.5f);
+}
+
+} // namespace unittest
+} // namespace util
+} // namespace bl